@@ -17,6 +17,8 @@
 
 #include "stdUniquePtr.h"
 
+#include <boost/utility/string_view.hpp>
+
 #include <string>
 #include <tuple>
 
@@ -32,6 +34,10 @@ namespace data
  * \par Description:
  * Data object consisting of message address, attributes and payload.
  * 
+ * The delimited message string is the only copy of the payload; address, 
+ * attributes and payload are accessible as views into it. The address is 
+ * additionally kept as a (short) string for address look-ups.
+ * 
  * \n
  */
 class AddressedAttributedMessage : public AddressedMessage
@@ -47,9 +53,12 @@ public:
     AddressedAttributedMessage()
     : AddressedMessage() { };
 
+    /** \brief Set all message fields. The delimited message string is built 
+     * in a single allocation; the payload is copied once (into the message string).
+     */
     bool
-    setAddressAttributesAndPayload(const std::string address, const std::string contentType, const std::string descriptor, 
-    const std::string sourceGroup, const std::string sourceEntityId, const std::string sourceServiceId, const std::string payload)
+    setAddressAttributesAndPayload(const std::string& address, const std::string& contentType, const std::string& descriptor, 
+    const std::string& sourceGroup, const std::string& sourceEntityId, const std::string& sourceServiceId, const std::string& payload)
     {
         if (!AddressedMessage::isValidAddress(address))
         {
@@ -65,13 +74,15 @@ public:
         }
 
         m_messageAttributes = uxas::stduxas::make_unique<MessageAttributes>();
-        if (m_messageAttributes->setAttributes(std::move(contentType), std::move(descriptor), std::move(sourceGroup), std::move(sourceEntityId), std::move(sourceServiceId)))
+        if (m_messageAttributes->setAttributes(contentType, descriptor, sourceGroup, sourceEntityId, sourceServiceId))
         {
-            m_address.clear();
-            m_payload.clear();
+            const std::string& attributes = m_messageAttributes->getString();
+            m_string.clear();
+            m_string.reserve(address.length() + attributes.length() + payload.length() + 2 + s_headerPatchCapacity);
+            m_string.append(address).append(s_addressAttributesDelimiter()).append(attributes).append(s_addressAttributesDelimiter()).append(payload);
             m_address = address;
-            m_payload = payload;
-            m_string = m_address + s_addressAttributesDelimiter() + m_messageAttributes->getString() + s_addressAttributesDelimiter() + m_payload;
+            m_payload.clear();
+            setFieldOffsets(address.length(), attributes.length());
             m_isValid = true;
             return (m_isValid);
         }
@@ -83,24 +94,46 @@ public:
         }
    };
    
-   bool
-   updateSourceAttributes(const std::string sourceGroup, const std::string sourceEntityId, const std::string sourceServiceId)
-   {
-       m_isValid = m_isValid & m_messageAttributes->updateSourceAttributes(sourceGroup, sourceEntityId, sourceServiceId);
-       m_string = m_address + s_addressAttributesDelimiter() + m_messageAttributes->getString() + s_addressAttributesDelimiter() + m_payload;
-       return (m_isValid);
-   };
+    /** \brief Replace the source attributes. Only the address and attribute 
+     * portion of the message string is re-written; the payload is not copied.
+     */
+    bool
+    updateSourceAttributes(const std::string& sourceGroup, const std::string& sourceEntityId, const std::string& sourceServiceId)
+    {
+        if (!m_messageAttributes)
+        {
+            UXAS_LOG_ERROR(s_typeName(), "::updateSourceAttributes message attributes have been detached");
+            m_isValid = false;
+            return (m_isValid);
+        }
+        m_isValid = m_isValid & m_messageAttributes->updateSourceAttributes(sourceGroup, sourceEntityId, sourceServiceId);
+        replaceAddressAndAttributes(m_address, m_messageAttributes->getString());
+        return (m_isValid);
+    };
 
+    /** \brief Replace the message address. Only the address and attribute 
+     * portion of the message string is re-written; the payload is not copied.
+     */
     bool
-    updateAddress(const std::string address)
+    updateAddress(const std::string& address)
     {
+        if (!m_messageAttributes)
+        {
+            UXAS_LOG_ERROR(s_typeName(), "::updateAddress message attributes have been detached");
+            m_isValid = false;
+            return (m_isValid);
+        }
         m_address = address;
-        m_string = m_address + s_addressAttributesDelimiter() + m_messageAttributes->getString() + s_addressAttributesDelimiter() + m_payload;
+        replaceAddressAndAttributes(m_address, m_messageAttributes->getString());
         return (m_isValid);
     }
 
+    /** \brief Set all message fields from a delimited message string. The 
+     * string is adopted as the message string (pass an r-value to avoid 
+     * copying the payload).
+     */
     bool
-    setAddressAttributesAndPayloadFromDelimitedString(const std::string delimitedString)
+    setAddressAttributesAndPayloadFromDelimitedString(std::string delimitedString)
     {
         if (delimitedString.length() >= s_minimumDelimitedAddressAttributeMessageStringLength)
         {
@@ -134,6 +167,49 @@ public:
         }
     };
 
+    /** \brief View of the message address within the message string. 
+     * 
+     * @return message address (valid until the message is modified or destroyed)
+     */
+    boost::string_view
+    getAddressView() const
+    {
+        return (boost::string_view(m_string.data(), m_addressLength));
+    };
+
+    /** \brief View of the delimited attribute fields within the message string. 
+     * 
+     * @return delimited attribute fields (valid until the message is modified or destroyed)
+     */
+    boost::string_view
+    getAttributesView() const
+    {
+        return (boost::string_view(m_string.data() + m_addressLength + 1, m_attributesLength));
+    };
+
+    /** \brief View of the payload within the message string. Preferred over 
+     * <B><i>getPayload</i></B>, which copies the payload.
+     * 
+     * @return data sent/received via message system (valid until the message 
+     * is modified or destroyed)
+     */
+    boost::string_view
+    getPayloadView() const
+    {
+        return (getPayloadOffset() < m_string.length() ? boost::string_view(m_string.data() + getPayloadOffset(), m_string.length() - getPayloadOffset()) : boost::string_view());
+    };
+
+    /** \brief Copy of the payload (the payload is only stored within the 
+     * message string, see <B><i>getPayloadView</i></B>).
+     * 
+     * @return data string sent/received via message system.
+     */
+    std::string
+    getPayload() const override
+    {
+        return (getPayloadView().to_string());
+    };
+
     /** \brief Ownership transfer accessor for message attributes.
      * 
      * @return message attributes
@@ -149,7 +225,7 @@ public:
      * @return message attributes
      */
     const std::unique_ptr<MessageAttributes>&
-    getMessageAttributesReference()
+    getMessageAttributesReference() const
     {
         return (m_messageAttributes);
     };
@@ -157,7 +233,7 @@ public:
 protected:
 
     bool
-    parseAddressedAttributedMessageStringAndSetFields(const std::string delimitedString)
+    parseAddressedAttributedMessageStringAndSetFields(std::string delimitedString)
     {
         std::string::size_type endOfAddressDelimIndex = delimitedString.find(*(s_addressAttributesDelimiter().c_str()));
         if (endOfAddressDelimIndex == std::string::npos
@@ -182,6 +258,7 @@ protected:
             return (m_isValid);
         }
 
+        // attribute fields and address are short; only they are copied out of the message string
         m_messageAttributes = uxas::stduxas::make_unique<MessageAttributes>();
         if (!m_messageAttributes->setAttributesFromDelimitedString(
             delimitedString.substr(endOfAddressDelimIndex + 1, endOfMessageAttributesDelimIndex - (endOfAddressDelimIndex + 1))))
@@ -191,18 +268,57 @@ protected:
             return (m_isValid);
         }
 
-        m_address.clear();
+        m_address.assign(delimitedString, 0, endOfAddressDelimIndex);
         m_payload.clear();
-        m_address = delimitedString.substr(0, endOfAddressDelimIndex);
-        m_payload = delimitedString.substr(endOfMessageAttributesDelimIndex + 1, delimitedString.length() - (endOfMessageAttributesDelimIndex + 1));
-        m_string = delimitedString;
+        m_string = std::move(delimitedString);
+        setFieldOffsets(endOfAddressDelimIndex, endOfMessageAttributesDelimIndex - (endOfAddressDelimIndex + 1));
         m_isValid = true;
         return (m_isValid);
     };
 
+    /** \brief Re-write the address and attribute portion of the message 
+     * string in place. The payload is not moved if the length is unchanged; 
+     * otherwise it is shifted within the string (no re-allocation unless the 
+     * string capacity is exceeded).
+     */
+    void
+    replaceAddressAndAttributes(const std::string& address, const std::string& attributes)
+    {
+        if (m_string.empty())
+        {
+            return;
+        }
+        std::string addressAttributes;
+        addressAttributes.reserve(address.length() + attributes.length() + 2);
+        addressAttributes.append(address).append(s_addressAttributesDelimiter()).append(attributes).append(s_addressAttributesDelimiter());
+        m_string.replace(0, getPayloadOffset(), addressAttributes);
+        setFieldOffsets(address.length(), attributes.length());
+    };
+
+    void
+    setFieldOffsets(size_t addressLength, size_t attributesLength)
+    {
+        m_addressLength = addressLength;
+        m_attributesLength = attributesLength;
+    };
+
+    size_t
+    getPayloadOffset() const
+    {
+        return (m_addressLength + m_attributesLength + 2);
+    };
+
+    /** \brief additional message string capacity reserved so that address and 
+     * attribute updates (e.g., bridge source attributes) do not re-allocate */
+    static const size_t s_headerPatchCapacity{64};
+
     static std::string s_emptyString;
     std::unique_ptr<MessageAttributes> m_messageAttributes;
 
+    /** \brief lengths of the address and attribute fields within the message string */
+    size_t m_addressLength{0};
+    size_t m_attributesLength{0};
+
 };
 
 }; //namespace data
@@ -137,11 +137,13 @@ public:
         return m_address;
     };
 
-    /** \brief Data payload to be transported.
+    /** \brief Data payload to be transported (a copy, since derived messages 
+     * may store the payload within the message string).
      * 
      * @return data string sent/received via message system.
      */
-    const std::string&
+    virtual
+    std::string
     getPayload() const
     {
         return m_payload;
@@ -0,0 +1,376 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+// 
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#include "BinaryFrameBuffer.h"
+
+#include "UxAS_Log.h"
+
+#include "stdUniquePtr.h"
+
+#include <array>
+
+namespace uxas
+{
+namespace communications
+{
+namespace transport
+{
+
+std::string
+BinaryFrameBuffer::createFrame(data::AddressedAttributedMessage& message)
+{
+    std::string frame;
+    const std::unique_ptr<data::MessageAttributes>& messageAttributes = message.getMessageAttributesReference();
+    if (!message.isValid() || !messageAttributes)
+    {
+        UXAS_LOG_WARN(s_typeName(), "::createFrame ignoring invalid message or message without attributes");
+        return (frame);
+    }
+
+    const std::array<boost::string_view, s_attributeFieldCount> attributeFields{{message.getAddressView(),
+        messageAttributes->getContentType(), messageAttributes->getDescriptor(), messageAttributes->getSourceGroup(),
+        messageAttributes->getSourceEntityId(), messageAttributes->getSourceServiceId()}};
+    boost::string_view payload = message.getPayloadView();
+
+    uint64_t bodySize = payload.size();
+    for (const boost::string_view& attributeField : attributeFields)
+    {
+        std::string fieldSize;
+        appendVarint(fieldSize, attributeField.size());
+        bodySize += fieldSize.size() + attributeField.size();
+    }
+
+    frame.reserve(3 + 10 + bodySize + 4);
+    frame.push_back(static_cast<char>(s_magic0));
+    frame.push_back(static_cast<char>(s_magic1));
+    frame.push_back(static_cast<char>(s_formatVersion));
+    appendVarint(frame, bodySize);
+    size_t bodyOffset = frame.size();
+    for (const boost::string_view& attributeField : attributeFields)
+    {
+        appendVarint(frame, attributeField.size());
+        frame.append(attributeField.data(), attributeField.size());
+    }
+    frame.append(payload.data(), payload.size());
+
+    uint32_t crc = updateCrc32(0, reinterpret_cast<const uint8_t*>(frame.data()) + bodyOffset, frame.size() - bodyOffset);
+    for (uint32_t byteIndex = 0; byteIndex < 4; byteIndex++)
+    {
+        frame.push_back(static_cast<char>((crc >> (8 * byteIndex)) & 0xFF));
+    }
+    return (frame);
+};
+
+uint32_t
+BinaryFrameBuffer::updateCrc32(uint32_t crc, const uint8_t* data, size_t size)
+{
+    // table-driven reflected CRC-32 (polynomial 0xEDB88320)
+    static const std::array<uint32_t, 256> s_crcTable = []()
+    {
+        std::array<uint32_t, 256> crcTable;
+        for (uint32_t tableIndex = 0; tableIndex < 256; tableIndex++)
+        {
+            uint32_t value = tableIndex;
+            for (uint32_t bitIndex = 0; bitIndex < 8; bitIndex++)
+            {
+                value = (value & 1) ? (0xEDB88320u ^ (value >> 1)) : (value >> 1);
+            }
+            crcTable[tableIndex] = value;
+        }
+        return (crcTable);
+    }();
+
+    crc = ~crc;
+    for (size_t byteIndex = 0; byteIndex < size; byteIndex++)
+    {
+        crc = s_crcTable[(crc ^ data[byteIndex]) & 0xFF] ^ (crc >> 8);
+    }
+    return (~crc);
+};
+
+void
+BinaryFrameBuffer::appendData(const uint8_t* data, size_t size)
+{
+    std::string rescanData;
+    size_t index = scanData(data, size);
+    while (m_isRescanRequired)
+    {
+        // resume after the first magic byte of the discarded frame
+        m_isRescanRequired = false;
+        std::string nextRescanData(m_frameBytes, 1);
+        nextRescanData.append(reinterpret_cast<const char*>(data + index), size - index);
+        m_frameBytes.clear();
+        rescanData.swap(nextRescanData);
+        data = reinterpret_cast<const uint8_t*>(rescanData.data());
+        size = rescanData.size();
+        index = scanData(data, size);
+    }
+};
+
+size_t
+BinaryFrameBuffer::scanData(const uint8_t* data, size_t size)
+{
+    size_t index{0};
+    while (index < size && !m_isRescanRequired)
+    {
+        uint8_t byte = data[index];
+        switch (m_frameState)
+        {
+            case FrameState::MAGIC0:
+                if (byte == s_magic0)
+                {
+                    m_frameBytes.assign(1, static_cast<char>(byte));
+                    m_frameState = FrameState::MAGIC1;
+                }
+                else
+                {
+                    m_disregardedDataCount++;
+                }
+                index++;
+                break;
+
+            case FrameState::MAGIC1:
+                if (byte == s_magic1)
+                {
+                    m_frameBytes.push_back(static_cast<char>(byte));
+                    m_frameState = FrameState::VERSION;
+                }
+                else if (byte != s_magic0)
+                {
+                    m_disregardedDataCount++;
+                    m_frameState = FrameState::MAGIC0;
+                }
+                index++;
+                break;
+
+            case FrameState::VERSION:
+                m_frameBytes.push_back(static_cast<char>(byte));
+                index++;
+                if (byte == s_formatVersion)
+                {
+                    m_varintValue = 0;
+                    m_varintShift = 0;
+                    m_frameState = FrameState::BODY_SIZE;
+                }
+                else
+                {
+                    discardFrame("unsupported frame format version");
+                }
+                break;
+
+            case FrameState::BODY_SIZE:
+                m_frameBytes.push_back(static_cast<char>(byte));
+                index++;
+                if (isVarintCompleted(byte))
+                {
+                    if (m_varintValue > s_maximumBodySize)
+                    {
+                        discardFrame("body size exceeds maximum frame size");
+                        break;
+                    }
+                    m_bodyRemainingSize = m_varintValue;
+                    m_crc = 0;
+                    m_fieldIndex = 0;
+                    m_messageString.clear();
+                    m_messageString.reserve(m_bodyRemainingSize <= s_maximumBodyReserveSize ? m_bodyRemainingSize : s_maximumBodyReserveSize);
+                    m_varintValue = 0;
+                    m_varintShift = 0;
+                    m_frameState = FrameState::FIELD_SIZE;
+                }
+                break;
+
+            case FrameState::FIELD_SIZE:
+                if (m_bodyRemainingSize == 0)
+                {
+                    discardFrame("body ends within attribute block");
+                    break;
+                }
+                m_frameBytes.push_back(static_cast<char>(byte));
+                m_crc = updateCrc32(m_crc, &byte, 1);
+                m_bodyRemainingSize--;
+                index++;
+                if (isVarintCompleted(byte))
+                {
+                    if (m_varintValue > m_bodyRemainingSize)
+                    {
+                        discardFrame("attribute field exceeds body size");
+                        break;
+                    }
+                    if (m_varintValue > s_maximumAttributeFieldSize)
+                    {
+                        discardFrame("attribute field exceeds maximum attribute field size");
+                        break;
+                    }
+                    m_fieldRemainingSize = m_varintValue;
+                    m_frameState = FrameState::FIELD;
+                }
+                break;
+
+            case FrameState::FIELD:
+            {
+                size_t fieldSize = (size - index < m_fieldRemainingSize) ? (size - index) : static_cast<size_t>(m_fieldRemainingSize);
+                m_messageString.append(reinterpret_cast<const char*>(data + index), fieldSize);
+                m_frameBytes.append(reinterpret_cast<const char*>(data + index), fieldSize);
+                m_crc = updateCrc32(m_crc, data + index, fieldSize);
+                m_bodyRemainingSize -= fieldSize;
+                m_fieldRemainingSize -= fieldSize;
+                index += fieldSize;
+                if (m_fieldRemainingSize == 0)
+                {
+                    // address$contentType|descriptor|sourceGroup|sourceEntityId|sourceServiceId$payload
+                    m_fieldIndex++;
+                    if (m_fieldIndex == 1 || m_fieldIndex == s_attributeFieldCount)
+                    {
+                        m_messageString.append(data::AddressedMessage::s_addressAttributesDelimiter());
+                    }
+                    else
+                    {
+                        m_messageString.append(data::AddressedMessage::s_fieldDelimiter());
+                    }
+
+                    if (m_fieldIndex < s_attributeFieldCount)
+                    {
+                        m_varintValue = 0;
+                        m_varintShift = 0;
+                        m_frameState = FrameState::FIELD_SIZE;
+                    }
+                    else
+                    {
+                        // the header is valid, frame bytes are no longer re-scanned
+                        m_frameBytes.clear();
+                        m_receivedCrc = 0;
+                        m_crcByteCount = 0;
+                        m_frameState = (m_bodyRemainingSize > 0) ? FrameState::PAYLOAD : FrameState::CRC;
+                    }
+                }
+                break;
+            }
+
+            case FrameState::PAYLOAD:
+            {
+                size_t payloadSize = (size - index < m_bodyRemainingSize) ? (size - index) : static_cast<size_t>(m_bodyRemainingSize);
+                m_messageString.append(reinterpret_cast<const char*>(data + index), payloadSize);
+                m_crc = updateCrc32(m_crc, data + index, payloadSize);
+                m_bodyRemainingSize -= payloadSize;
+                index += payloadSize;
+                if (m_bodyRemainingSize == 0)
+                {
+                    m_frameState = FrameState::CRC;
+                }
+                break;
+            }
+
+            case FrameState::CRC:
+                m_receivedCrc |= static_cast<uint32_t>(byte) << (8 * m_crcByteCount);
+                m_crcByteCount++;
+                index++;
+                if (m_crcByteCount == 4)
+                {
+                    completeFrame();
+                }
+                break;
+        }
+    }
+    return (index);
+};
+
+uint8_t*
+BinaryFrameBuffer::getWriteBuffer(size_t minimumSize)
+{
+    if (m_writeBuffer.size() < minimumSize)
+    {
+        m_writeBuffer.resize(minimumSize);
+    }
+    return (m_writeBuffer.data());
+};
+
+void
+BinaryFrameBuffer::commitData(size_t size)
+{
+    appendData(m_writeBuffer.data(), size);
+};
+
+std::unique_ptr<data::AddressedAttributedMessage>
+BinaryFrameBuffer::getNextMessage()
+{
+    std::unique_ptr<data::AddressedAttributedMessage> message;
+    if (!m_messages.empty())
+    {
+        message = std::move(m_messages.front());
+        m_messages.pop_front();
+    }
+    return (message);
+};
+
+void
+BinaryFrameBuffer::appendVarint(std::string& frame, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        frame.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    frame.push_back(static_cast<char>(value));
+};
+
+bool
+BinaryFrameBuffer::isVarintCompleted(uint8_t byte)
+{
+    m_varintValue |= static_cast<uint64_t>(byte & 0x7F) << m_varintShift;
+    if ((byte & 0x80) == 0)
+    {
+        return (true);
+    }
+    m_varintShift += 7;
+    if (m_varintShift > 63)
+    {
+        discardFrame("invalid varint");
+    }
+    return (false);
+};
+
+void
+BinaryFrameBuffer::discardFrame(const char* reason)
+{
+    m_invalidFrameCount++;
+    UXAS_LOG_WARN(s_typeName(), "::appendData discarding frame: ", reason, " (m_invalidFrameCount=", m_invalidFrameCount, ")");
+    m_messageString.clear();
+    m_frameState = FrameState::MAGIC0;
+    m_isRescanRequired = true;
+};
+
+void
+BinaryFrameBuffer::completeFrame()
+{
+    m_frameState = FrameState::MAGIC0;
+    if (m_receivedCrc != m_crc)
+    {
+        m_invalidFrameCount++;
+        UXAS_LOG_WARN(s_typeName(), "::appendData ignoring frame since calculated CRC=", m_crc, " does not equal received CRC=", m_receivedCrc);
+        m_messageString.clear();
+        return;
+    }
+
+    std::unique_ptr<data::AddressedAttributedMessage> message = uxas::stduxas::make_unique<data::AddressedAttributedMessage>();
+    if (message->setAddressAttributesAndPayloadFromDelimitedString(std::move(m_messageString)))
+    {
+        m_validFrameCount++;
+        m_messages.push_back(std::move(message));
+    }
+    else
+    {
+        m_invalidFrameCount++;
+        UXAS_LOG_WARN(s_typeName(), "::appendData failed to create AddressedAttributedMessage object from frame");
+    }
+    m_messageString = std::string();
+};
+
+}; //namespace transport
+}; //namespace communications
+}; //namespace uxas
@@ -0,0 +1,214 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+// 
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#ifndef UXAS_MESSAGE_TRANSPORT_BINARY_FRAME_BUFFER_H
+#define UXAS_MESSAGE_TRANSPORT_BINARY_FRAME_BUFFER_H
+
+#include "AddressedAttributedMessage.h"
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uxas
+{
+namespace communications
+{
+namespace transport
+{
+
+/** \class BinaryFrameBuffer
+ * 
+ * \par Description:
+ * Binary, length-prefixed framing of <B><i>AddressedAttributedMessage</i></B> 
+ * objects for byte stream transports (TCP stream and serial bridges). It is 
+ * the compact alternative to the text sentinels of 
+ * <B><i>SentinelSerialBuffer</i></B> (selected per bridge by the 
+ * <B><i>FrameFormat</i></B> XML attribute; both peers must use the same format).
+ * 
+ * Frame layout (varint is unsigned LEB128):
+ * <ul style="padding-left:1em;margin-left:0">
+ * <li>header: magic bytes 0xA5 0x5A, format version byte, varint body size
+ * <li>body: attribute block of six varint length-prefixed fields (address, 
+ * content type, descriptor, source group, source entity ID, source service ID) 
+ * followed by the payload (remainder of the body)
+ * <li>CRC-32 (IEEE 802.3) of the body, little-endian
+ * </ul>
+ * 
+ * Received bytes are scanned once; the CRC is accumulated as body bytes arrive 
+ * and fields and payload are written directly into the delimited string of the 
+ * received <B><i>AddressedAttributedMessage</i></B>.
+ * 
+ * Frame headers (version, body size up to <B><i>s_maximumBodySize</i></B>, 
+ * attribute field sizes up to <B><i>s_maximumAttributeFieldSize</i></B>) are 
+ * validated before the body is awaited. After an invalid header, scanning 
+ * resumes at the byte following the frame's first magic byte, so that a 
+ * corrupt header does not hide the frames that follow it.
+ * 
+ * \par Threading:
+ * multi-thread safety not implemented
+ * 
+ * \n
+ */
+class BinaryFrameBuffer final
+{
+public:
+
+    static const std::string&
+    s_typeName() { static std::string s_string("BinaryFrameBuffer"); return (s_string); };
+
+    static const uint8_t s_magic0{0xA5};
+    static const uint8_t s_magic1{0x5A};
+    static const uint8_t s_formatVersion{1};
+
+    /** \brief number of attribute block fields */
+    static const uint32_t s_attributeFieldCount{6};
+
+    /** \brief maximum body size of a valid frame */
+    static const uint64_t s_maximumBodySize{64 * 1024 * 1024};
+
+    /** \brief maximum size of a valid attribute field (address, content type, etc.) */
+    static const uint64_t s_maximumAttributeFieldSize{4096};
+
+    BinaryFrameBuffer() { };
+
+private:
+
+    /** \brief Copy construction not permitted */
+    BinaryFrameBuffer(BinaryFrameBuffer const&) = delete;
+
+    /** \brief Copy assignment operation not permitted */
+    void operator=(BinaryFrameBuffer const&) = delete;
+
+public:
+
+    /** \brief Create the binary frame of a message.
+     * 
+     * @param message message with attached message attributes
+     * @return binary frame (empty string if the message is invalid)
+     */
+    static std::string
+    createFrame(data::AddressedAttributedMessage& message);
+
+    /** \brief Update a CRC-32 (IEEE 802.3) with additional data (start with 
+     * a CRC of zero).
+     */
+    static uint32_t
+    updateCrc32(uint32_t crc, const uint8_t* data, size_t size);
+
+    /** \brief Scan received data; completed messages are queued for 
+     * <B><i>getNextMessage</i></B>.
+     * 
+     * @param data received data
+     * @param size number of received bytes
+     */
+    void
+    appendData(const uint8_t* data, size_t size);
+
+    /** \brief Writable region for reading directly from a device (e.g., 
+     * serial port). Must be followed by <B><i>commitData</i></B>.
+     * 
+     * @param minimumSize minimum number of writable bytes
+     * @return start of the writable region
+     */
+    uint8_t*
+    getWriteBuffer(size_t minimumSize);
+
+    /** \brief Scan bytes written to the region returned by 
+     * <B><i>getWriteBuffer</i></B>.
+     * 
+     * @param size number of bytes written
+     */
+    void
+    commitData(size_t size);
+
+    /** \brief Next received message.
+     * 
+     * @return message (empty unique pointer if none has been completed)
+     */
+    std::unique_ptr<data::AddressedAttributedMessage>
+    getNextMessage();
+
+    uint32_t m_validFrameCount{0};
+    uint32_t m_invalidFrameCount{0};
+    uint32_t m_disregardedDataCount{0};
+
+private:
+
+    enum class FrameState
+    {
+        MAGIC0,
+        MAGIC1,
+        VERSION,
+        BODY_SIZE,
+        FIELD_SIZE,
+        FIELD,
+        PAYLOAD,
+        CRC
+    };
+
+    static void
+    appendVarint(std::string& frame, uint64_t value);
+
+    /** \brief Scan received data until it is consumed or an invalid frame 
+     * header requires re-scanning (see <B><i>m_isRescanRequired</i></B>).
+     * 
+     * @return index of the first byte not consumed
+     */
+    size_t
+    scanData(const uint8_t* data, size_t size);
+
+    /** \brief Accumulate a varint byte.
+     * @return true if the varint is complete
+     */
+    bool
+    isVarintCompleted(uint8_t byte);
+
+    /** \brief Discard a frame with an invalid header (or attribute block); the 
+     * bytes following its first magic byte are scanned again. */
+    void
+    discardFrame(const char* reason);
+
+    void
+    completeFrame();
+
+    /** \brief maximum body size for which message storage is reserved up front */
+    static const size_t s_maximumBodyReserveSize{1024 * 1024};
+
+    std::vector<uint8_t> m_writeBuffer;
+
+    FrameState m_frameState{FrameState::MAGIC0};
+    uint64_t m_varintValue{0};
+    uint32_t m_varintShift{0};
+    uint64_t m_bodyRemainingSize{0};
+    uint32_t m_fieldIndex{0};
+    uint64_t m_fieldRemainingSize{0};
+    uint32_t m_crc{0};
+    uint32_t m_receivedCrc{0};
+    uint32_t m_crcByteCount{0};
+
+    /** \brief delimited message string of the frame being received */
+    std::string m_messageString;
+
+    /** \brief received bytes of the frame from its first magic byte until the 
+     * end of the attribute block (re-scanned if the frame is discarded) */
+    std::string m_frameBytes;
+    bool m_isRescanRequired{false};
+
+    std::deque< std::unique_ptr<data::AddressedAttributedMessage> > m_messages;
+
+};
+
+}; //namespace transport
+}; //namespace communications
+}; //namespace uxas
+
+#endif /* UXAS_MESSAGE_TRANSPORT_BINARY_FRAME_BUFFER_H */
@@ -0,0 +1,470 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#include "BinaryMessageLog.h"
+
+#include "UxAS_Log.h"
+#include "stdUniquePtr.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace uxas
+{
+namespace communications
+{
+namespace data
+{
+
+namespace
+{
+
+const size_t s_ioBufferSize{1024 * 1024};
+
+void
+encodeUInt32(char* bytes, uint32_t value)
+{
+    for (size_t i = 0; i < 4; i++)
+    {
+        bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+void
+encodeUInt64(char* bytes, uint64_t value)
+{
+    for (size_t i = 0; i < 8; i++)
+    {
+        bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+uint32_t
+decodeUInt32(const char* bytes)
+{
+    uint32_t value{0};
+    for (size_t i = 0; i < 4; i++)
+    {
+        value |= static_cast<uint32_t>(static_cast<uint8_t>(bytes[i])) << (8 * i);
+    }
+    return (value);
+}
+
+uint64_t
+decodeUInt64(const char* bytes)
+{
+    uint64_t value{0};
+    for (size_t i = 0; i < 8; i++)
+    {
+        value |= static_cast<uint64_t>(static_cast<uint8_t>(bytes[i])) << (8 * i);
+    }
+    return (value);
+}
+
+void
+writeHeader(std::ofstream& stream, const std::string& magic, uint32_t segmentNumber)
+{
+    char header[BinaryMessageLog::s_headerSize];
+    std::memcpy(header, magic.data(), 8);
+    encodeUInt32(header + 8, BinaryMessageLog::s_version);
+    encodeUInt32(header + 12, segmentNumber);
+    stream.write(header, BinaryMessageLog::s_headerSize);
+}
+
+bool
+readHeader(std::ifstream& stream, const std::string& magic)
+{
+    char header[BinaryMessageLog::s_headerSize];
+    if (!stream.read(header, BinaryMessageLog::s_headerSize))
+    {
+        return (false);
+    }
+    return (magic.compare(0, 8, header, 8) == 0 && decodeUInt32(header + 8) == BinaryMessageLog::s_version);
+}
+
+}
+
+BinaryMessageLogWriter::~BinaryMessageLogWriter()
+{
+    close();
+};
+
+bool
+BinaryMessageLogWriter::open(const std::string& location, uint64_t segmentSizeLimit_B)
+{
+    close();
+    m_location = location;
+    m_segmentSizeLimit_B = segmentSizeLimit_B;
+    m_segmentNumber = 0;
+    m_messageCount = 0;
+    m_lastFlushTime_ms = 0;
+    m_messageTypeIds.clear();
+
+    // segments of a previous log at the location would be read after this log's segments
+    for (uint32_t segmentNumber = 1; std::ifstream(BinaryMessageLog::getSegmentFilePath(m_location, segmentNumber)).good(); segmentNumber++)
+    {
+        std::remove(BinaryMessageLog::getSegmentFilePath(m_location, segmentNumber).c_str());
+        std::remove(BinaryMessageLog::getIndexFilePath(m_location, segmentNumber).c_str());
+    }
+
+    m_messageTypeStream.open(BinaryMessageLog::getMessageTypeFilePath(m_location), std::ofstream::out | std::ofstream::trunc);
+    if (!m_messageTypeStream.is_open())
+    {
+        UXAS_LOG_ERROR("BinaryMessageLogWriter::open failed to open message type file ", BinaryMessageLog::getMessageTypeFilePath(m_location));
+        return (false);
+    }
+
+    m_isOpen = openSegment();
+    return (m_isOpen);
+};
+
+bool
+BinaryMessageLogWriter::write(int64_t time_ms, const AddressedAttributedMessage& message)
+{
+    if (!m_isOpen)
+    {
+        return (false);
+    }
+
+    const std::string& messageType = message.getMessageAttributesReference()->getDescriptor();
+    auto messageTypeIdIt = m_messageTypeIds.find(messageType);
+    if (messageTypeIdIt == m_messageTypeIds.end())
+    {
+        messageTypeIdIt = m_messageTypeIds.emplace(messageType, static_cast<uint32_t>(m_messageTypeIds.size())).first;
+        m_messageTypeStream << messageType << "\n";
+        m_messageTypeStream.flush();
+    }
+
+    const std::string& messageString = message.getString();
+    uint32_t recordSize = static_cast<uint32_t>(BinaryMessageLog::s_recordHeaderSize + messageString.size());
+    if (m_segmentOffset > BinaryMessageLog::s_headerSize && m_segmentOffset + recordSize > m_segmentSizeLimit_B)
+    {
+        closeSegment();
+        if (!openSegment())
+        {
+            m_isOpen = false;
+            return (false);
+        }
+    }
+
+    encodeUInt32(m_recordHeader, recordSize);
+    encodeUInt64(m_recordHeader + 4, static_cast<uint64_t>(time_ms));
+    encodeUInt32(m_recordHeader + 12, messageTypeIdIt->second);
+    m_segmentStream.write(m_recordHeader, BinaryMessageLog::s_recordHeaderSize);
+    m_segmentStream.write(messageString.data(), messageString.size());
+
+    encodeUInt64(m_indexEntry, static_cast<uint64_t>(time_ms));
+    encodeUInt64(m_indexEntry + 8, m_segmentOffset);
+    encodeUInt32(m_indexEntry + 16, messageTypeIdIt->second);
+    encodeUInt32(m_indexEntry + 20, recordSize);
+    m_indexStream.write(m_indexEntry, BinaryMessageLog::s_indexEntrySize);
+
+    m_segmentOffset += recordSize;
+    m_messageCount++;
+
+    if (time_ms - m_lastFlushTime_ms >= s_flushPeriod_ms)
+    {
+        flush();
+        m_lastFlushTime_ms = time_ms;
+    }
+
+    if (!m_segmentStream || !m_indexStream)
+    {
+        UXAS_LOG_ERROR("BinaryMessageLogWriter::write failed to write segment ", m_segmentNumber, " of ", m_location);
+        m_isOpen = false;
+        return (false);
+    }
+    return (true);
+};
+
+bool
+BinaryMessageLogWriter::close()
+{
+    if (m_isOpen)
+    {
+        closeSegment();
+        m_isOpen = false;
+    }
+    if (m_messageTypeStream.is_open())
+    {
+        m_messageTypeStream.close();
+    }
+    return (true);
+};
+
+bool
+BinaryMessageLogWriter::openSegment()
+{
+    m_segmentNumber++;
+    m_segmentOffset = 0;
+
+    // large stream buffers (must be set before open) - records are written in few system calls
+    m_segmentStreamBuffer.resize(s_ioBufferSize);
+    m_indexStreamBuffer.resize(s_ioBufferSize / 8);
+    m_segmentStream.rdbuf()->pubsetbuf(m_segmentStreamBuffer.data(), m_segmentStreamBuffer.size());
+    m_indexStream.rdbuf()->pubsetbuf(m_indexStreamBuffer.data(), m_indexStreamBuffer.size());
+
+    std::string segmentFilePath = BinaryMessageLog::getSegmentFilePath(m_location, m_segmentNumber);
+    std::string indexFilePath = BinaryMessageLog::getIndexFilePath(m_location, m_segmentNumber);
+    m_segmentStream.open(segmentFilePath, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+    m_indexStream.open(indexFilePath, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+    if (!m_segmentStream.is_open() || !m_indexStream.is_open())
+    {
+        UXAS_LOG_ERROR("BinaryMessageLogWriter::openSegment failed to open ", segmentFilePath, " and/or ", indexFilePath);
+        return (false);
+    }
+
+    writeHeader(m_segmentStream, BinaryMessageLog::s_segmentMagic(), m_segmentNumber);
+    writeHeader(m_indexStream, BinaryMessageLog::s_indexMagic(), m_segmentNumber);
+    m_segmentOffset = BinaryMessageLog::s_headerSize;
+    UXAS_LOG_INFORM("BinaryMessageLogWriter::openSegment opened ", segmentFilePath);
+    return (true);
+};
+
+void
+BinaryMessageLogWriter::closeSegment()
+{
+    if (m_segmentStream.is_open())
+    {
+        m_segmentStream.close();
+    }
+    if (m_indexStream.is_open())
+    {
+        m_indexStream.close();
+    }
+};
+
+void
+BinaryMessageLogWriter::flush()
+{
+    m_segmentStream.flush();
+    m_indexStream.flush();
+};
+
+bool
+BinaryMessageLogReader::open(const std::string& location)
+{
+    m_location = location;
+    m_segmentCount = 0;
+    m_segmentNumber = 0;
+    m_indexEntries.clear();
+    m_indexEntryIndex = 0;
+    m_messageTypes.clear();
+    if (m_segmentStream.is_open())
+    {
+        m_segmentStream.close();
+    }
+
+    std::ifstream messageTypeStream(BinaryMessageLog::getMessageTypeFilePath(m_location));
+    std::string messageType;
+    while (std::getline(messageTypeStream, messageType))
+    {
+        m_messageTypes.push_back(messageType);
+    }
+
+    while (std::ifstream(BinaryMessageLog::getSegmentFilePath(m_location, m_segmentCount + 1)).good())
+    {
+        m_segmentCount++;
+    }
+    if (m_segmentCount == 0)
+    {
+        UXAS_LOG_ERROR("BinaryMessageLogReader::open found no segment file ", BinaryMessageLog::getSegmentFilePath(m_location, 1));
+        return (false);
+    }
+
+    // re-apply a message type selection made before open
+    setMessageTypes(m_selectedMessageTypes);
+    return (true);
+};
+
+void
+BinaryMessageLogReader::setTimeRange(int64_t startTime_ms, int64_t endTime_ms)
+{
+    m_startTime_ms = startTime_ms;
+    m_endTime_ms = endTime_ms;
+};
+
+void
+BinaryMessageLogReader::setMessageType(const std::string& messageType)
+{
+    setMessageTypes(messageType.empty() ? std::vector<std::string>() : std::vector<std::string>{messageType});
+};
+
+void
+BinaryMessageLogReader::setMessageTypes(const std::vector<std::string>& messageTypes)
+{
+    m_selectedMessageTypes = messageTypes;
+    m_isMessageTypeSelected = !messageTypes.empty();
+    m_isMessageTypeIdSelected.assign(m_messageTypes.size(), false);
+    for (size_t messageTypeId = 0; messageTypeId < m_messageTypes.size(); messageTypeId++)
+    {
+        m_isMessageTypeIdSelected[messageTypeId] = (std::find(messageTypes.begin(), messageTypes.end(), m_messageTypes[messageTypeId]) != messageTypes.end());
+    }
+};
+
+bool
+BinaryMessageLogReader::readNext(Record& record)
+{
+    std::vector<char> recordBytes;
+    while (true)
+    {
+        if (m_indexEntryIndex >= m_indexEntries.size())
+        {
+            if (m_segmentNumber >= m_segmentCount || !openSegment(m_segmentNumber + 1))
+            {
+                return (false);
+            }
+            continue;
+        }
+
+        const BinaryMessageLog::IndexEntry& indexEntry = m_indexEntries[m_indexEntryIndex++];
+        // (record times follow the wall clock, which can step back - check every record)
+        if (indexEntry.m_time_ms < m_startTime_ms || indexEntry.m_time_ms > m_endTime_ms
+                || (m_isMessageTypeSelected && (indexEntry.m_messageTypeId >= m_isMessageTypeIdSelected.size()
+                                                || !m_isMessageTypeIdSelected[indexEntry.m_messageTypeId]))
+                || indexEntry.m_recordSize < BinaryMessageLog::s_recordHeaderSize)
+        {
+            continue;
+        }
+
+        recordBytes.resize(indexEntry.m_recordSize - BinaryMessageLog::s_recordHeaderSize);
+        m_segmentStream.clear();
+        m_segmentStream.seekg(indexEntry.m_offset + BinaryMessageLog::s_recordHeaderSize);
+        if (!m_segmentStream.read(recordBytes.data(), recordBytes.size()))
+        {
+            UXAS_LOG_WARN("BinaryMessageLogReader::readNext truncated record in segment ", m_segmentNumber, " of ", m_location);
+            m_indexEntryIndex = m_indexEntries.size();
+            continue;
+        }
+
+        record.m_time_ms = indexEntry.m_time_ms;
+        record.m_messageType = indexEntry.m_messageTypeId < m_messageTypes.size() ? m_messageTypes[indexEntry.m_messageTypeId] : std::string();
+        record.m_message = uxas::stduxas::make_unique<AddressedAttributedMessage>();
+        if (!record.m_message->setAddressAttributesAndPayloadFromDelimitedString(std::string(recordBytes.data(), recordBytes.size())))
+        {
+            UXAS_LOG_WARN("BinaryMessageLogReader::readNext invalid message in segment ", m_segmentNumber, " of ", m_location);
+            continue;
+        }
+        return (true);
+    }
+};
+
+bool
+BinaryMessageLogReader::openSegment(uint32_t segmentNumber)
+{
+    m_segmentNumber = segmentNumber;
+    m_indexEntries.clear();
+    m_indexEntryIndex = 0;
+    if (m_segmentStream.is_open())
+    {
+        m_segmentStream.close();
+    }
+    m_segmentStream.clear();
+
+    std::string segmentFilePath = BinaryMessageLog::getSegmentFilePath(m_location, m_segmentNumber);
+    m_segmentStream.open(segmentFilePath, std::ifstream::in | std::ifstream::binary);
+    if (!m_segmentStream.is_open() || !readHeader(m_segmentStream, BinaryMessageLog::s_segmentMagic()))
+    {
+        UXAS_LOG_WARN("BinaryMessageLogReader::openSegment skipping invalid segment ", segmentFilePath);
+        // empty index - readNext moves to the next segment
+        return (true);
+    }
+
+    if (!loadIndex(m_segmentNumber))
+    {
+        UXAS_LOG_INFORM("BinaryMessageLogReader::openSegment no complete index for ", segmentFilePath, ", scanning segment");
+        scanSegment();
+    }
+    return (true);
+};
+
+bool
+BinaryMessageLogReader::loadIndex(uint32_t segmentNumber)
+{
+    std::ifstream indexStream(BinaryMessageLog::getIndexFilePath(m_location, segmentNumber), std::ifstream::in | std::ifstream::binary);
+    if (!indexStream.is_open() || !readHeader(indexStream, BinaryMessageLog::s_indexMagic()))
+    {
+        return (false);
+    }
+
+    std::vector<char> indexBytes((std::istreambuf_iterator<char>(indexStream)), std::istreambuf_iterator<char>());
+    size_t entryCount = indexBytes.size() / BinaryMessageLog::s_indexEntrySize;
+    m_indexEntries.resize(entryCount);
+    for (size_t entryIndex = 0; entryIndex < entryCount; entryIndex++)
+    {
+        const char* entryBytes = indexBytes.data() + entryIndex * BinaryMessageLog::s_indexEntrySize;
+        BinaryMessageLog::IndexEntry& indexEntry = m_indexEntries[entryIndex];
+        indexEntry.m_time_ms = static_cast<int64_t>(decodeUInt64(entryBytes));
+        indexEntry.m_offset = decodeUInt64(entryBytes + 8);
+        indexEntry.m_messageTypeId = decodeUInt32(entryBytes + 16);
+        indexEntry.m_recordSize = decodeUInt32(entryBytes + 20);
+    }
+
+    // index must cover the segment (index and segment are not flushed together)
+    m_segmentStream.seekg(0, std::ifstream::end);
+    uint64_t segmentSize = static_cast<uint64_t>(m_segmentStream.tellg());
+    uint64_t indexedSize = m_indexEntries.empty() ? BinaryMessageLog::s_headerSize
+            : m_indexEntries.back().m_offset + m_indexEntries.back().m_recordSize;
+    if (indexBytes.size() % BinaryMessageLog::s_indexEntrySize != 0 || indexedSize != segmentSize)
+    {
+        m_indexEntries.clear();
+        return (false);
+    }
+
+    // start at the first record of the time range
+    m_indexEntryIndex = std::lower_bound(m_indexEntries.begin(), m_indexEntries.end(), m_startTime_ms,
+            [](const BinaryMessageLog::IndexEntry& indexEntry, int64_t time_ms) { return (indexEntry.m_time_ms < time_ms); })
+            - m_indexEntries.begin();
+    return (true);
+};
+
+void
+BinaryMessageLogReader::scanSegment()
+{
+    m_indexEntries.clear();
+    m_indexEntryIndex = 0;
+    m_segmentStream.clear();
+    m_segmentStream.seekg(BinaryMessageLog::s_headerSize);
+
+    char recordHeader[BinaryMessageLog::s_recordHeaderSize];
+    uint64_t offset = BinaryMessageLog::s_headerSize;
+    while (m_segmentStream.read(recordHeader, BinaryMessageLog::s_recordHeaderSize))
+    {
+        BinaryMessageLog::IndexEntry indexEntry;
+        indexEntry.m_recordSize = decodeUInt32(recordHeader);
+        indexEntry.m_time_ms = static_cast<int64_t>(decodeUInt64(recordHeader + 4));
+        indexEntry.m_messageTypeId = decodeUInt32(recordHeader + 12);
+        indexEntry.m_offset = offset;
+        if (indexEntry.m_recordSize < BinaryMessageLog::s_recordHeaderSize
+                || !m_segmentStream.seekg(indexEntry.m_recordSize - BinaryMessageLog::s_recordHeaderSize, std::ifstream::cur))
+        {
+            break;
+        }
+        // a partially written last record is not indexed
+        if (m_segmentStream.peek() == std::ifstream::traits_type::eof())
+        {
+            m_segmentStream.clear();
+            m_segmentStream.seekg(0, std::ifstream::end);
+            if (static_cast<uint64_t>(m_segmentStream.tellg()) < offset + indexEntry.m_recordSize)
+            {
+                break;
+            }
+            m_indexEntries.push_back(indexEntry);
+            break;
+        }
+        m_indexEntries.push_back(indexEntry);
+        offset += indexEntry.m_recordSize;
+    }
+    m_segmentStream.clear();
+};
+
+}; //namespace data
+}; //namespace communications
+}; //namespace uxas
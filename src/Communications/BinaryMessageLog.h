@@ -0,0 +1,261 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#ifndef UXAS_MESSAGE_DATA_BINARY_MESSAGE_LOG_H
+#define UXAS_MESSAGE_DATA_BINARY_MESSAGE_LOG_H
+
+#include "AddressedAttributedMessage.h"
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace uxas
+{
+namespace communications
+{
+namespace data
+{
+
+/** \class BinaryMessageLog
+ *
+ * \par Description:
+ * Append-only, segmented log of serialized <b>LMCP</b> messages. For a log
+ * location (path prefix) <B><i>L</i></B>, the log consists of:
+ * <ul style="padding-left:1em;margin-left:0">
+ * <li> segment files <B><i>L_n.lmcplog</i></B> (n = 1, 2, ...) - records of
+ * [uint32 record size][int64 time (ms)][uint32 message type ID][delimited
+ * addressed attributed message string (address, attributes and the
+ * serialized <b>LMCP</b> payload as received)]
+ * <li> index files <B><i>L_n.lmcpidx</i></B> - one entry per record of
+ * [int64 time (ms)][uint64 segment offset][uint32 message type ID][uint32 record size]
+ * <li> message type file <B><i>L.lmcptypes</i></B> - message type (descriptor)
+ * of each message type ID, one per line (line number = ID)
+ * </ul>
+ * Segment and index files start with a 16 byte header (8 byte magic, uint32
+ * version, uint32 segment number). Integers are little-endian.
+ *
+ * \n
+ */
+class BinaryMessageLog
+{
+public:
+
+    static const uint32_t s_version{1};
+    static const size_t s_headerSize{16};
+    static const size_t s_recordHeaderSize{16};
+    static const size_t s_indexEntrySize{24};
+
+    static const std::string&
+    s_segmentMagic() { static std::string s_string("UXASMLOG"); return (s_string); };
+
+    static const std::string&
+    s_indexMagic() { static std::string s_string("UXASMIDX"); return (s_string); };
+
+    static std::string
+    getSegmentFilePath(const std::string& location, uint32_t segmentNumber) { return (location + "_" + std::to_string(segmentNumber) + ".lmcplog"); };
+
+    static std::string
+    getIndexFilePath(const std::string& location, uint32_t segmentNumber) { return (location + "_" + std::to_string(segmentNumber) + ".lmcpidx"); };
+
+    static std::string
+    getMessageTypeFilePath(const std::string& location) { return (location + ".lmcptypes"); };
+
+    /** \brief Index entry of a logged message */
+    struct IndexEntry
+    {
+        int64_t m_time_ms{0};
+        uint64_t m_offset{0};
+        uint32_t m_messageTypeId{0};
+        uint32_t m_recordSize{0};
+    };
+};
+
+/** \class BinaryMessageLogWriter
+ *
+ * \par Description:
+ * Writes a <B><i>BinaryMessageLog</i></B>. Messages are appended without
+ * de-serialization or conversion; a new segment is started when the segment
+ * size limit is reached. Files are flushed when a segment is closed and at
+ * most every <B><i>s_flushPeriod_ms</i></B> of message time.
+ *
+ * \n
+ */
+class BinaryMessageLogWriter final
+{
+public:
+
+    BinaryMessageLogWriter() { };
+
+    ~BinaryMessageLogWriter();
+
+private:
+
+    /** \brief Copy construction not permitted */
+    BinaryMessageLogWriter(BinaryMessageLogWriter const&) = delete;
+
+    /** \brief Copy assignment operation not permitted */
+    void operator=(BinaryMessageLogWriter const&) = delete;
+
+public:
+
+    /** \brief Open the first segment of a log. The segment and index files 
+     * of a previous log at the location are deleted.
+     *
+     * @param location log path prefix (e.g., "./datawork/MessageLogger/messageLog").
+     * @param segmentSizeLimit_B segment file size that starts a new segment.
+     * @return true if the segment, index and message type files were created.
+     */
+    bool
+    open(const std::string& location, uint64_t segmentSizeLimit_B);
+
+    /** \brief Append a message (serialized payload, address and attributes). */
+    bool
+    write(int64_t time_ms, const AddressedAttributedMessage& message);
+
+    bool
+    close();
+
+    uint64_t
+    getMessageCount() const { return (m_messageCount); };
+
+private:
+
+    bool
+    openSegment();
+
+    void
+    closeSegment();
+
+    void
+    flush();
+
+    std::string m_location;
+    uint64_t m_segmentSizeLimit_B{64 * 1024 * 1024};
+    uint32_t m_segmentNumber{0};
+    uint64_t m_segmentOffset{0};
+    uint64_t m_messageCount{0};
+    int64_t m_lastFlushTime_ms{0};
+    bool m_isOpen{false};
+
+    std::ofstream m_segmentStream;
+    std::ofstream m_indexStream;
+    std::ofstream m_messageTypeStream;
+    std::vector<char> m_segmentStreamBuffer;
+    std::vector<char> m_indexStreamBuffer;
+
+    /** \brief message type (descriptor) -> message type ID */
+    std::unordered_map<std::string, uint32_t> m_messageTypeIds;
+
+    /** \brief record header and index entry encoding buffers (re-used) */
+    char m_recordHeader[BinaryMessageLog::s_recordHeaderSize];
+    char m_indexEntry[BinaryMessageLog::s_indexEntrySize];
+
+    static const int64_t s_flushPeriod_ms{1000};
+};
+
+/** \class BinaryMessageLogReader
+ *
+ * \par Description:
+ * Reads the messages of a <B><i>BinaryMessageLog</i></B> in logged order.
+ * Index files select the records of a time range and/or message type without
+ * reading other records; a segment without a (complete) index file is
+ * scanned instead (e.g., a log that was not closed).
+ *
+ * \n
+ */
+class BinaryMessageLogReader final
+{
+public:
+
+    /** \brief Logged message */
+    struct Record
+    {
+        int64_t m_time_ms{0};
+        std::string m_messageType;
+        std::unique_ptr<AddressedAttributedMessage> m_message;
+    };
+
+    BinaryMessageLogReader() { };
+
+private:
+
+    /** \brief Copy construction not permitted */
+    BinaryMessageLogReader(BinaryMessageLogReader const&) = delete;
+
+    /** \brief Copy assignment operation not permitted */
+    void operator=(BinaryMessageLogReader const&) = delete;
+
+public:
+
+    /** \brief Open a log (see <B><i>BinaryMessageLogWriter::open</i></B>).
+     *
+     * @return true if the log has at least one segment.
+     */
+    bool
+    open(const std::string& location);
+
+    /** \brief Read only records with <B><i>startTime_ms</i></B> <= time <= <B><i>endTime_ms</i></B>. */
+    void
+    setTimeRange(int64_t startTime_ms, int64_t endTime_ms);
+
+    /** \brief Read only records of the message type (descriptor); empty implies all types. */
+    void
+    setMessageType(const std::string& messageType);
+
+    /** \brief Read only records of the message types (descriptors); empty implies all types. */
+    void
+    setMessageTypes(const std::vector<std::string>& messageTypes);
+
+    /** \brief Read the next (selected) record.
+     *
+     * @return false if there are no more records.
+     */
+    bool
+    readNext(Record& record);
+
+    uint32_t
+    getSegmentCount() const { return (m_segmentCount); };
+
+private:
+
+    bool
+    openSegment(uint32_t segmentNumber);
+
+    bool
+    loadIndex(uint32_t segmentNumber);
+
+    void
+    scanSegment();
+
+    std::string m_location;
+    uint32_t m_segmentCount{0};
+    uint32_t m_segmentNumber{0};
+    std::ifstream m_segmentStream;
+
+    std::vector<std::string> m_messageTypes;
+    std::vector<BinaryMessageLog::IndexEntry> m_indexEntries;
+    size_t m_indexEntryIndex{0};
+
+    int64_t m_startTime_ms{INT64_MIN};
+    int64_t m_endTime_ms{INT64_MAX};
+    bool m_isMessageTypeSelected{false};
+    /** \brief selection of each message type ID (types that were never logged select no records) */
+    std::vector<bool> m_isMessageTypeIdSelected;
+    std::vector<std::string> m_selectedMessageTypes;
+};
+
+}; //namespace data
+}; //namespace communications
+}; //namespace uxas
+
+#endif /* UXAS_MESSAGE_DATA_BINARY_MESSAGE_LOG_H */
@@ -209,7 +209,7 @@ ImpactSubscribePushBridge::processReceivedSerializedLmcpMessage(
     // send message to the external entity
     UXAS_LOG_DEBUGGING(s_typeName(), "::processReceivedSerializedLmcpMessage before sending serialized message ",
         "having address ", receivedLmcpMessage->getAddress(),
-        " and size ", receivedLmcpMessage->getPayload().size());
+        " and size ", receivedLmcpMessage->getPayloadView().size());
 
     // do not forward uni-cast messages (or any address on blocked list)
     if (m_nonExportForwardAddresses.find(receivedLmcpMessage->getAddress()) == m_nonExportForwardAddresses.end())
@@ -217,10 +217,10 @@ ImpactSubscribePushBridge::processReceivedSerializedLmcpMessage(
         UXAS_LOG_INFORM(s_typeName(), "::processReceivedSerializedLmcpMessage processing message with source service ID ", receivedLmcpMessage->getMessageAttributesReference()->getSourceServiceId());
 
         // unpack message to get complete attributes
-        std::string message = receivedLmcpMessage->getPayload();
+        boost::string_view message = receivedLmcpMessage->getPayloadView();
         avtas::lmcp::ByteBuffer byteBuffer;
         byteBuffer.allocate(message.size());
-        byteBuffer.put(reinterpret_cast<const uint8_t*> (message.c_str()), message.size());
+        byteBuffer.put(reinterpret_cast<const uint8_t*> (message.data()), message.size());
         byteBuffer.rewind();
 
         std::shared_ptr<avtas::lmcp::Object> ptr_Object;
@@ -254,7 +254,7 @@ ImpactSubscribePushBridge::processReceivedSerializedLmcpMessage(
 
         std::string impact_address = "lmcp:" + seriesName + ":" + ptr_Object->getLmcpTypeName();
         n_ZMQ::s_sendmore(*sender, impact_address);
-        n_ZMQ::s_send(*sender, receivedLmcpMessage->getPayload());
+        zmq_send(*sender, receivedLmcpMessage->getPayloadView().data(), receivedLmcpMessage->getPayloadView().size(), 0);
     }
     else
     {
@@ -297,7 +297,7 @@ ImpactSubscribePushBridge::executeExternalSerializedLmcpObjectReceiveProcessing(
                 {
                     UXAS_LOG_DEBUGGING(s_typeName(), "::executeExternalSerializedLmcpObjectReceiveProcessing before sending serialized message ",
                         "having address ", recvdAddAttMsg->getAddress(),
-                        " and size ", recvdAddAttMsg->getPayload().size());
+                        " and size ", recvdAddAttMsg->getPayloadView().size());
 
                     sendSerializedLmcpObjectMessage(std::move(recvdAddAttMsg));
                 }
@@ -0,0 +1,196 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#include "LmcpObjectInProcessBus.h"
+
+#include "UxAS_Log.h"
+
+#include "stdUniquePtr.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace uxas
+{
+namespace communications
+{
+
+void
+LmcpObjectInProcessSubscriber::pushMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> lmcpMessage)
+{
+    m_messages.push(std::move(lmcpMessage));
+    if (m_isNotifying.load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock(m_notifierMutex);
+        if (m_messageNotifier)
+        {
+            m_messageNotifier();
+            return;
+        }
+    }
+
+    // full fence pairs with the fence in getNextMessage so that either the
+    // consumer observes the new message or the producer observes the waiting flag
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_isWaiting.load(std::memory_order_relaxed))
+    {
+        wake();
+    }
+};
+
+void
+LmcpObjectInProcessSubscriber::wake()
+{
+    if (m_isNotifying.load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock(m_notifierMutex);
+        if (m_messageNotifier)
+        {
+            m_messageNotifier();
+            return;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_waitMutex);
+    m_waitCondition.notify_one();
+};
+
+void
+LmcpObjectInProcessSubscriber::setMessageNotifier(std::function<void()> messageNotifier)
+{
+    std::lock_guard<std::mutex> lock(m_notifierMutex);
+    m_messageNotifier = std::move(messageNotifier);
+    m_isNotifying.store(static_cast<bool>(m_messageNotifier), std::memory_order_release);
+};
+
+std::unique_ptr<uxas::communications::data::LmcpMessage>
+LmcpObjectInProcessSubscriber::getNextMessage(int32_t waitTime_ms)
+{
+    std::unique_ptr<uxas::communications::data::LmcpMessage> nextMessage;
+    if (m_messages.tryPop(nextMessage) || waitTime_ms == 0)
+    {
+        return (nextMessage);
+    }
+
+    std::unique_lock<std::mutex> lock(m_waitMutex);
+    m_isWaiting.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_messages.isEmpty())
+    {
+        if (waitTime_ms < 0)
+        {
+            m_waitCondition.wait(lock);
+        }
+        else
+        {
+            m_waitCondition.wait_for(lock, std::chrono::milliseconds(waitTime_ms));
+        }
+    }
+    m_isWaiting.store(false, std::memory_order_relaxed);
+    lock.unlock();
+
+    m_messages.tryPop(nextMessage);
+    return (nextMessage);
+};
+
+LmcpObjectInProcessBus&
+LmcpObjectInProcessBus::getInstance()
+{
+    // first time/one time creation, thread-safe initialization of a function-local static
+    static LmcpObjectInProcessBus s_instance;
+    return s_instance;
+};
+
+std::shared_ptr<LmcpObjectInProcessSubscriber>
+LmcpObjectInProcessBus::registerSubscriber(uint32_t entityId, int64_t networkId, bool isObjectReceiver)
+{
+    auto subscriber = std::make_shared<LmcpObjectInProcessSubscriber>(entityId, networkId, isObjectReceiver);
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+    m_subscribers.push_back(subscriber);
+    m_routingGeneration++;
+    UXAS_LOG_INFORM("LmcpObjectInProcessBus::registerSubscriber registered network client ", networkId, (isObjectReceiver ? " as object receiver" : " as serialized receiver"));
+    return (subscriber);
+};
+
+void
+LmcpObjectInProcessBus::unregisterSubscriber(const std::shared_ptr<LmcpObjectInProcessSubscriber>& subscriber)
+{
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+    m_subscribers.erase(std::remove(m_subscribers.begin(), m_subscribers.end(), subscriber), m_subscribers.end());
+    m_routingGeneration++;
+};
+
+bool
+LmcpObjectInProcessBus::addSubscriptionAddress(const std::shared_ptr<LmcpObjectInProcessSubscriber>& subscriber, const std::string& address)
+{
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+    bool isAdded = subscriber->m_subscriptionAddresses.emplace(address).second;
+    if (isAdded)
+    {
+        m_routingGeneration++;
+    }
+    return (isAdded);
+};
+
+bool
+LmcpObjectInProcessBus::removeSubscriptionAddress(const std::shared_ptr<LmcpObjectInProcessSubscriber>& subscriber, const std::string& address)
+{
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+    bool isRemoved = (subscriber->m_subscriptionAddresses.erase(address) > 0);
+    if (isRemoved)
+    {
+        m_routingGeneration++;
+    }
+    return (isRemoved);
+};
+
+bool
+LmcpObjectInProcessBus::removeAllSubscriptionAddresses(const std::shared_ptr<LmcpObjectInProcessSubscriber>& subscriber)
+{
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+    subscriber->m_subscriptionAddresses.clear();
+    m_routingGeneration++;
+    return (true);
+};
+
+LmcpObjectInProcessBus::Route
+LmcpObjectInProcessBus::getRoute(const std::string& address)
+{
+    Route route;
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+    for (const auto& subscriber : m_subscribers)
+    {
+        // Zero MQ subscription semantics - subscription address is a prefix of the message address
+        bool isMatch{false};
+        for (const auto& subscriptionAddress : subscriber->m_subscriptionAddresses)
+        {
+            if (address.compare(0, subscriptionAddress.size(), subscriptionAddress) == 0)
+            {
+                isMatch = true;
+                break;
+            }
+        }
+
+        if (isMatch)
+        {
+            if (subscriber->m_isObjectReceiver)
+            {
+                route.m_objectReceivers.push_back(subscriber);
+            }
+            else
+            {
+                route.m_isSerializedRequired = true;
+            }
+        }
+    }
+    return (route);
+};
+
+}; //namespace communications
+}; //namespace uxas
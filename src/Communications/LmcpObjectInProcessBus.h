@@ -0,0 +1,196 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#ifndef UXAS_MESSAGE_LMCP_OBJECT_IN_PROCESS_BUS_H
+#define UXAS_MESSAGE_LMCP_OBJECT_IN_PROCESS_BUS_H
+
+#include "LmcpMessage.h"
+
+#include "UxAS_MpscQueue.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace uxas
+{
+namespace communications
+{
+
+/** \class LmcpObjectInProcessSubscriber
+ *
+ * \par Description:
+ * Registration of a single network client (service or bridge) with the
+ * <B><i>LmcpObjectInProcessBus</i></B>. Object receivers are handed
+ * <b>LMCP</b> messages through a lock-free queue; serialized receivers only
+ * contribute their subscriptions so that senders know when a serialized
+ * copy of a message must still be sent through the <b>LMCP</b> network hub.
+ *
+ * \n
+ */
+class LmcpObjectInProcessSubscriber final
+{
+public:
+
+    LmcpObjectInProcessSubscriber(uint32_t entityId, int64_t networkId, bool isObjectReceiver)
+    : m_entityIdString(std::to_string(entityId)), m_networkIdString(std::to_string(networkId)), m_isObjectReceiver(isObjectReceiver) { };
+
+private:
+
+    /** \brief Copy construction not permitted */
+    LmcpObjectInProcessSubscriber(LmcpObjectInProcessSubscriber const&) = delete;
+
+    /** \brief Copy assignment operation not permitted */
+    void operator=(LmcpObjectInProcessSubscriber const&) = delete;
+
+public:
+
+    /** \brief Hand an <b>LMCP</b> message to the subscriber (any thread). */
+    void
+    pushMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> lmcpMessage);
+
+    /** \brief Get next <b>LMCP</b> message (subscriber thread only), waiting
+     * up to the specified duration if none is queued.
+     *
+     * @param waitTime_ms maximum wait duration (negative value waits indefinitely).
+     * @return <b>LMCP</b> message or empty unique pointer if none arrived.
+     */
+    std::unique_ptr<uxas::communications::data::LmcpMessage>
+    getNextMessage(int32_t waitTime_ms);
+
+    /** \brief Wake the subscriber thread if it is waiting for a message 
+     * (invokes the message notifier instead, if one is set). */
+    void
+    wake();
+
+    /** \brief Set (or clear, if empty) the function invoked after each 
+     * message is pushed. Used for worker pool execution instead of waiting 
+     * in <B><i>getNextMessage</i></B>; notifications are not invoked 
+     * after this method returns with an empty function.
+     * 
+     * @param messageNotifier function invoked by the pushing thread.
+     */
+    void
+    setMessageNotifier(std::function<void()> messageNotifier);
+
+    const std::string m_entityIdString;
+    const std::string m_networkIdString;
+    const bool m_isObjectReceiver;
+
+private:
+
+    friend class LmcpObjectInProcessBus;
+
+    /** \brief subscription addresses (guarded by the bus registry mutex) */
+    std::set<std::string> m_subscriptionAddresses;
+
+    uxas::common::MpscQueue< std::unique_ptr<uxas::communications::data::LmcpMessage> > m_messages;
+
+    std::atomic<bool> m_isWaiting{false};
+
+    std::atomic<bool> m_isNotifying{false};
+    std::mutex m_notifierMutex;
+    std::function<void()> m_messageNotifier;
+    std::mutex m_waitMutex;
+    std::condition_variable m_waitCondition;
+
+};
+
+/** \class LmcpObjectInProcessBus
+ *
+ * \par Description:
+ * Process-wide registry that delivers <b>LMCP</b> objects between network
+ * clients hosted by the same UxAS process without serialization. Senders
+ * resolve a message address into a route (the object receivers to hand the
+ * object to - each receiver gets its own copy - and whether any serialized
+ * receiver - e.g., a bridge - also subscribes). Address matching follows Zero MQ subscription
+ * semantics (prefix match).
+ *
+ * \par Singleton pattern
+ *
+ * \n
+ */
+class LmcpObjectInProcessBus final
+{
+public:
+
+    /** \brief Resolved delivery targets for a message address */
+    struct Route
+    {
+        std::vector< std::shared_ptr<LmcpObjectInProcessSubscriber> > m_objectReceivers;
+        bool m_isSerializedRequired{false};
+    };
+
+    static LmcpObjectInProcessBus&
+    getInstance();
+
+    ~LmcpObjectInProcessBus() { };
+
+private:
+
+    /** \brief Public, direct construction not permitted (singleton pattern) */
+    LmcpObjectInProcessBus() { };
+
+    /** \brief Copy construction not permitted */
+    LmcpObjectInProcessBus(LmcpObjectInProcessBus const&) = delete;
+
+    /** \brief Copy assignment operation not permitted */
+    void operator=(LmcpObjectInProcessBus const&) = delete;
+
+public:
+
+    std::shared_ptr<LmcpObjectInProcessSubscriber>
+    registerSubscriber(uint32_t entityId, int64_t networkId, bool isObjectReceiver);
+
+    void
+    unregisterSubscriber(const std::shared_ptr<LmcpObjectInProcessSubscriber>& subscriber);
+
+    bool
+    addSubscriptionAddress(const std::shared_ptr<LmcpObjectInProcessSubscriber>& subscriber, const std::string& address);
+
+    bool
+    removeSubscriptionAddress(const std::shared_ptr<LmcpObjectInProcessSubscriber>& subscriber, const std::string& address);
+
+    bool
+    removeAllSubscriptionAddresses(const std::shared_ptr<LmcpObjectInProcessSubscriber>& subscriber);
+
+    /** \brief Counter incremented on every registration or subscription
+     * change. Senders cache routes and discard them when it changes.
+     *
+     * @return routing generation.
+     */
+    uint64_t
+    getRoutingGeneration() const { return (m_routingGeneration.load(std::memory_order_acquire)); };
+
+    /** \brief Resolve the delivery route for a message address.
+     *
+     * @param address message address.
+     * @return route to object and serialized receivers.
+     */
+    Route
+    getRoute(const std::string& address);
+
+private:
+
+    std::mutex m_registryMutex;
+    std::vector< std::shared_ptr<LmcpObjectInProcessSubscriber> > m_subscribers;
+    std::atomic<uint64_t> m_routingGeneration{1};
+
+};
+
+}; //namespace communications
+}; //namespace uxas
+
+#endif /* UXAS_MESSAGE_LMCP_OBJECT_IN_PROCESS_BUS_H */
@@ -50,8 +50,10 @@ LmcpObjectMessageReceiverPipe::initializeExternalSubscription(uint32_t entityId,
 void
 LmcpObjectMessageReceiverPipe::initializeSubscription(uint32_t entityId, uint32_t serviceId)
 {
-    initializeZmqSocket(entityId, serviceId, ZMQ_SUB,
-                        uxas::common::LmcpNetworkSocketAddress::strGetInProc_FromMessageHub(), false);
+    // the message hub routes to subscribers by socket identity
+    initializeZmqSocket(entityId, serviceId, ZMQ_DEALER,
+                        uxas::common::LmcpNetworkSocketAddress::strGetInProc_FromMessageHub(), false,
+                        std::to_string(entityId) + "." + std::to_string(serviceId));
 };
 
 void
@@ -63,7 +65,7 @@ LmcpObjectMessageReceiverPipe::initializeStream(uint32_t entityId, uint32_t serv
 
 void
 LmcpObjectMessageReceiverPipe::initializeZmqSocket(uint32_t entityId, uint32_t serviceId, int32_t zmqSocketType,
-                                          const std::string& socketAddress, bool isServer)
+                                          const std::string& socketAddress, bool isServer, const std::string& socketIdentity)
 {
     m_entityId = entityId;
     m_serviceId = serviceId;
@@ -81,6 +83,7 @@ LmcpObjectMessageReceiverPipe::initializeZmqSocket(uint32_t entityId, uint32_t s
                                   true,
                                   zmqhighWaterMark,
                                   zmqhighWaterMark);
+    zmqLmcpNetworkReceiveSocket.m_identity = socketIdentity;
 
     m_transportReceiver = uxas::stduxas::make_unique<uxas::communications::transport::ZeroMqAddressedAttributedMessageReceiver>(
             (zmqSocketType == ZMQ_STREAM ? true : false));
@@ -118,7 +121,7 @@ LmcpObjectMessageReceiverPipe::getNextMessageObject()
     if (nextZeroMqMessage)
     {
         // deserialize
-        std::unique_ptr<avtas::lmcp::Object> lmcpObject = deserializeMessage(nextZeroMqMessage->getPayload());
+        std::unique_ptr<avtas::lmcp::Object> lmcpObject = deserializeMessage(nextZeroMqMessage->getPayloadView());
         if (lmcpObject)
         {
             std::unique_ptr<uxas::communications::data::LmcpMessage> lmcpMessage 
@@ -134,27 +137,76 @@ LmcpObjectMessageReceiverPipe::getNextMessageObject()
     return (emptyLmcpMessage);
 };
 
+size_t
+LmcpObjectMessageReceiverPipe::getNextMessageObjects(std::vector< std::unique_ptr<uxas::communications::data::LmcpMessage> >& lmcpMessages, size_t maximumMessageCount)
+{
+    std::vector< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> > nextZeroMqMessages;
+    m_transportReceiver->getNextMessages(nextZeroMqMessages, maximumMessageCount);
+
+    size_t lmcpMessageCount{0};
+    for (auto& nextZeroMqMessage : nextZeroMqMessages)
+    {
+        // messages that fail de-serialization are dropped
+        std::unique_ptr<avtas::lmcp::Object> lmcpObject = deserializeMessage(nextZeroMqMessage->getPayloadView());
+        if (lmcpObject)
+        {
+            lmcpMessages.push_back(uxas::stduxas::make_unique<uxas::communications::data::LmcpMessage>
+              (nextZeroMqMessage->getMessageAttributesOwnership(), std::move(lmcpObject)));
+            lmcpMessageCount++;
+        }
+    }
+    return (lmcpMessageCount);
+};
+
 std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>
 LmcpObjectMessageReceiverPipe::getNextSerializedMessage()
 {
     return (m_transportReceiver->getNextMessage());
 };
 
+void
+LmcpObjectMessageReceiverPipe::enableEventDrivenReceive()
+{
+    if (m_transportReceiver)
+    {
+        m_transportReceiver->enableEventDrivenReceive();
+    }
+};
+
+void
+LmcpObjectMessageReceiverPipe::wake()
+{
+    if (m_transportReceiver)
+    {
+        m_transportReceiver->wake();
+    }
+};
+
 
 std::unique_ptr<avtas::lmcp::Object>
 LmcpObjectMessageReceiverPipe::deserializeMessage(const std::string& payload)
+{
+    return (deserializeMessage(reinterpret_cast<const uint8_t*>(payload.data()), payload.size()));
+};
+
+std::unique_ptr<avtas::lmcp::Object>
+LmcpObjectMessageReceiverPipe::deserializeMessage(boost::string_view payload)
+{
+    return (deserializeMessage(reinterpret_cast<const uint8_t*>(payload.data()), payload.size()));
+};
+
+std::unique_ptr<avtas::lmcp::Object>
+LmcpObjectMessageReceiverPipe::deserializeMessage(const uint8_t* data, size_t size)
 {
     std::unique_ptr<avtas::lmcp::Object> lmcpObject;
 
-    // allocate memory
+    // the LMCP factory validates the checksum over the full buffer capacity,
+    // so the buffer must be sized exactly to the payload; fill it with a
+    // single block copy (rather than byte-by-byte)
     avtas::lmcp::ByteBuffer lmcpByteBuffer;
-    lmcpByteBuffer.allocate(payload.size());
+    lmcpByteBuffer.allocate(static_cast<uint32_t>(size));
     lmcpByteBuffer.rewind();
-
-    for (size_t charIndex = 0; charIndex < payload.size(); charIndex++)
-    {
-        lmcpByteBuffer.putByte(payload[charIndex]); // TODO REVIEW
-    }
+    lmcpByteBuffer.put(data, static_cast<uint32_t>(size));
     lmcpByteBuffer.rewind();
     
     lmcpObject.reset(avtas::lmcp::Factory::getObject(lmcpByteBuffer));
@@ -82,17 +82,69 @@ public:
     std::unique_ptr<uxas::communications::data::LmcpMessage>
     getNextMessageObject();
 
+    /** \brief Get the next <b>LMCP</b> message (waiting as 
+     * <B><i>getNextMessageObject</i></B> does), then drain further messages 
+     * that are already queued without polling.
+     * 
+     * @param lmcpMessages container that received <b>LMCP</b> messages are appended to.
+     * @param maximumMessageCount maximum number of messages to receive.
+     * @return number of messages appended.
+     */
+    size_t
+    getNextMessageObjects(std::vector< std::unique_ptr<uxas::communications::data::LmcpMessage> >& lmcpMessages, size_t maximumMessageCount);
+
     std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>
     getNextSerializedMessage();
 
+    /** \brief Wait for messages through the process-wide <B><i>ZeroMqReceivePoller</i></B> 
+     * (no polling timeout). Must be invoked after the pipe is initialized.
+     */
+    void
+    enableEventDrivenReceive();
+
+    /** \brief Return a waiting <B><i>getNextMessageObject</i></B> or 
+     * <B><i>getNextSerializedMessage</i></B> call (any thread).
+     */
+    void
+    wake();
+
+    /** \brief De-serialize an <b>LMCP</b> object from a serialized payload string.
+     * 
+     * @param payload serialized <b>LMCP</b> object.
+     * @return <b>LMCP</b> object (empty unique pointer if de-serialization fails).
+     */
+    static
     std::unique_ptr<avtas::lmcp::Object>
     deserializeMessage(const std::string& payload);
 
+    /** \brief De-serialize an <b>LMCP</b> object from a payload view (e.g., 
+     * <B><i>AddressedAttributedMessage::getPayloadView</i></B>) without 
+     * copying the payload into a string.
+     * 
+     * @param payload serialized <b>LMCP</b> object.
+     * @return <b>LMCP</b> object (empty unique pointer if de-serialization fails).
+     */
+    static
+    std::unique_ptr<avtas::lmcp::Object>
+    deserializeMessage(boost::string_view payload);
+
+    /** \brief De-serialize an <b>LMCP</b> object directly from a received 
+     * buffer (e.g., Zero MQ frame data). The buffer is transferred into the 
+     * <b>LMCP</b> byte buffer with a single block copy.
+     * 
+     * @param data start of serialized <b>LMCP</b> object.
+     * @param size number of bytes of serialized <b>LMCP</b> object.
+     * @return <b>LMCP</b> object (empty unique pointer if de-serialization fails).
+     */
+    static
+    std::unique_ptr<avtas::lmcp::Object>
+    deserializeMessage(const uint8_t* data, size_t size);
+
 private:
 
     void
     initializeZmqSocket(uint32_t entityId, uint32_t serviceId, int32_t zmqSocketType, 
-               const std::string& socketAddress, bool isServer);
+               const std::string& socketAddress, bool isServer, const std::string& socketIdentity = "");
 
 public:
 
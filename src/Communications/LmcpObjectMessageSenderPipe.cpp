@@ -12,6 +12,7 @@
 #include "avtas/lmcp/ByteBuffer.h"
 #include "avtas/lmcp/Factory.h"
 
+#include "LmcpObjectMessageReceiverPipe.h"
 #include "ZeroMqSocketConfiguration.h"
 
 #include "SerialHelper.h"
@@ -20,6 +21,8 @@
 
 #include "stdUniquePtr.h"
 
+#include <algorithm>
+
 namespace uxas
 {
 namespace communications
@@ -59,6 +62,16 @@ LmcpObjectMessageSenderPipe::initializeStream(const std::string& sourceGroup, ui
     initializeZmqSocket(sourceGroup, entityId, serviceId, ZMQ_STREAM, socketAddress, isServer);
 };
 
+void
+LmcpObjectMessageSenderPipe::initializeInProcessPush(const std::string& sourceGroup, uint32_t entityId, uint32_t serviceId)
+{
+    initializePush(sourceGroup, entityId, serviceId);
+    m_isInProcessDelivery = true;
+    m_sourceGroup = sourceGroup;
+    m_entityIdString = std::to_string(entityId);
+    m_serviceIdString = std::to_string(serviceId);
+};
+
 void
 LmcpObjectMessageSenderPipe::initializeZmqSocket(const std::string& sourceGroup, uint32_t entityId, uint32_t serviceId, int32_t zmqSocketType,
                                                  const std::string& socketAddress, bool isServer)
@@ -95,6 +108,20 @@ LmcpObjectMessageSenderPipe::sendBroadcastMessage(std::unique_ptr<avtas::lmcp::O
 void
 LmcpObjectMessageSenderPipe::sendLimitedCastMessage(const std::string& castAddress, std::unique_ptr<avtas::lmcp::Object> lmcpObject)
 {
+    if (m_isInProcessDelivery)
+    {
+        std::shared_ptr<avtas::lmcp::Object> sharedLmcpObject(std::move(lmcpObject));
+        const LmcpObjectInProcessBus::Route& route = getInProcessRoute(castAddress);
+        if (!route.m_isSerializedRequired)
+        {
+            deliverInProcess(route, uxas::common::ContentType::lmcp(), sharedLmcpObject->getFullLmcpTypeName(), m_sourceGroup,
+                             m_entityIdString, m_serviceIdString, sharedLmcpObject, true);
+            return;
+        }
+        sendSharedLimitedCastMessage(castAddress, sharedLmcpObject);
+        return;
+    }
+
     avtas::lmcp::ByteBuffer* lmcpByteBuffer = avtas::lmcp::Factory::packMessage(lmcpObject.get(), true);
     std::string serializedPayload = std::string(reinterpret_cast<char*>(lmcpByteBuffer->array()), lmcpByteBuffer->capacity());
     delete lmcpByteBuffer;
@@ -104,6 +131,26 @@ LmcpObjectMessageSenderPipe::sendLimitedCastMessage(const std::string& castAddre
 void
 LmcpObjectMessageSenderPipe::sendSerializedMessage(std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> serializedLmcpObject)
 {
+    if (m_isInProcessDelivery && serializedLmcpObject->isValid())
+    {
+        const LmcpObjectInProcessBus::Route& route = getInProcessRoute(serializedLmcpObject->getAddress());
+        if (!route.m_objectReceivers.empty())
+        {
+            // de-serialize once for all co-located object receivers
+            std::shared_ptr<avtas::lmcp::Object> lmcpObject = LmcpObjectMessageReceiverPipe::deserializeMessage(serializedLmcpObject->getPayloadView());
+            if (lmcpObject)
+            {
+                const std::unique_ptr<uxas::communications::data::MessageAttributes>& attributes = serializedLmcpObject->getMessageAttributesReference();
+                deliverInProcess(route, attributes->getContentType(), attributes->getDescriptor(), attributes->getSourceGroup(),
+                                 attributes->getSourceEntityId(), attributes->getSourceServiceId(), lmcpObject, true);
+            }
+        }
+        if (!route.m_isSerializedRequired)
+        {
+            return;
+        }
+    }
+
     m_transportSender->sendAddressedAttributedMessage(std::move(serializedLmcpObject));
 };
 
@@ -118,11 +165,78 @@ LmcpObjectMessageSenderPipe::sendSharedBroadcastMessage(const std::shared_ptr<av
 void
 LmcpObjectMessageSenderPipe::sendSharedLimitedCastMessage(const std::string& castAddress, const std::shared_ptr<avtas::lmcp::Object>& lmcpObject)
 {
+    if (m_isInProcessDelivery)
+    {
+        const LmcpObjectInProcessBus::Route& route = getInProcessRoute(castAddress);
+        deliverInProcess(route, uxas::common::ContentType::lmcp(), lmcpObject->getFullLmcpTypeName(), m_sourceGroup,
+                         m_entityIdString, m_serviceIdString, lmcpObject, false);
+        if (!route.m_isSerializedRequired)
+        {
+            return;
+        }
+    }
+
     avtas::lmcp::ByteBuffer* lmcpByteBuffer = avtas::lmcp::Factory::packMessage(lmcpObject.get(), true);
     std::string serializedPayload = std::string(reinterpret_cast<char*>(lmcpByteBuffer->array()), lmcpByteBuffer->capacity());
     delete lmcpByteBuffer;
     m_transportSender->sendMessage(castAddress, uxas::common::ContentType::lmcp(), lmcpObject->getFullLmcpTypeName(), std::move(serializedPayload));
 };
 
+const LmcpObjectInProcessBus::Route&
+LmcpObjectMessageSenderPipe::getInProcessRoute(const std::string& address)
+{
+    uint64_t routingGeneration = LmcpObjectInProcessBus::getInstance().getRoutingGeneration();
+    if (routingGeneration != m_inProcessRoutesGeneration)
+    {
+        m_inProcessRoutes.clear();
+        m_inProcessRoutesGeneration = routingGeneration;
+    }
+
+    auto routeIt = m_inProcessRoutes.find(address);
+    if (routeIt == m_inProcessRoutes.end())
+    {
+        routeIt = m_inProcessRoutes.emplace(address, LmcpObjectInProcessBus::getInstance().getRoute(address)).first;
+    }
+    return (routeIt->second);
+};
+
+void
+LmcpObjectMessageSenderPipe::deliverInProcess(const LmcpObjectInProcessBus::Route& route, const std::string& contentType, const std::string& descriptor,
+                                              const std::string& sourceGroup, const std::string& sourceEntityId, const std::string& sourceServiceId,
+                                              const std::shared_ptr<avtas::lmcp::Object>& lmcpObject, bool isObjectOwned)
+{
+    // consistent with Zero MQ receivers, never deliver a message back to its source
+    auto isSource = [&sourceEntityId, &sourceServiceId](const std::shared_ptr<LmcpObjectInProcessSubscriber>& receiver)
+    {
+        return (receiver->m_entityIdString == sourceEntityId && receiver->m_networkIdString == sourceServiceId);
+    };
+    size_t receiverCount = route.m_objectReceivers.size() - std::count_if(route.m_objectReceivers.begin(), route.m_objectReceivers.end(), isSource);
+
+    for (const auto& receiver : route.m_objectReceivers)
+    {
+        if (isSource(receiver))
+        {
+            continue;
+        }
+        receiverCount--;
+
+        std::unique_ptr<uxas::communications::data::MessageAttributes> attributes = uxas::stduxas::make_unique<uxas::communications::data::MessageAttributes>();
+        attributes->setAttributes(contentType, descriptor, sourceGroup, sourceEntityId, sourceServiceId);
+        std::unique_ptr<uxas::communications::data::LmcpMessage> lmcpMessage = uxas::stduxas::make_unique<uxas::communications::data::LmcpMessage>();
+        lmcpMessage->m_attributes = std::move(attributes);
+        // receivers own their copies (as if de-serialized from the hub), the
+        // sender's object is only handed over when nobody else references it
+        if (isObjectOwned && receiverCount == 0)
+        {
+            lmcpMessage->m_object = lmcpObject;
+        }
+        else
+        {
+            lmcpMessage->m_object.reset(lmcpObject->clone());
+        }
+        receiver->pushMessage(std::move(lmcpMessage));
+    }
+};
+
 }; //namespace communications
 }; //namespace uxas
@@ -10,12 +10,14 @@
 #ifndef UXAS_MESSAGE_LMCP_OBJECT_MESSAGE_SENDER_PIPE_H
 #define UXAS_MESSAGE_LMCP_OBJECT_MESSAGE_SENDER_PIPE_H
 
+#include "LmcpObjectInProcessBus.h"
 #include "ZeroMqAddressedAttributedMessageSender.h"
 
 #include "avtas/lmcp/Object.h"
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 namespace uxas
 {
@@ -63,6 +65,15 @@ public:
 
     void
     initializeStream(const std::string& sourceGroup, uint32_t entityId, uint32_t serviceId, const std::string& socketAddress, bool isServer);
+
+    /** \brief Initialize a push pipe to the <b>LMCP</b> network hub that first 
+     * delivers messages through the <B><i>LmcpObjectInProcessBus</i></B>. 
+     * <b>LMCP</b> objects are handed to co-located object receivers without 
+     * serialization; a serialized copy is sent to the hub only if a serialized 
+     * receiver (e.g., bridge) subscribes to the message address.
+     */
+    void
+    initializeInProcessPush(const std::string& sourceGroup, uint32_t entityId, uint32_t serviceId);
     
     void
     sendBroadcastMessage(std::unique_ptr<avtas::lmcp::Object> lmcpObject);
@@ -85,6 +96,21 @@ private:
     initializeZmqSocket(const std::string& sourceGroup, uint32_t entityId, uint32_t serviceId, int32_t zmqSocketType, 
             const std::string& socketAddress, bool isServer);
 
+    const LmcpObjectInProcessBus::Route&
+    getInProcessRoute(const std::string& address);
+
+    /** \brief Hand the object to the object receivers of the route (except
+     * the sender). Every receiver gets its own copy, so that receivers may
+     * modify their messages as they can with messages received from the hub.
+     *
+     * @param isObjectOwned true if the sender does not use the object after
+     * delivery (then the last receiver is handed the object itself).
+     */
+    void
+    deliverInProcess(const LmcpObjectInProcessBus::Route& route, const std::string& contentType, const std::string& descriptor,
+                     const std::string& sourceGroup, const std::string& sourceEntityId, const std::string& sourceServiceId,
+                     const std::shared_ptr<avtas::lmcp::Object>& lmcpObject, bool isObjectOwned);
+
 public:
 
     uint32_t m_entityId;
@@ -94,6 +120,15 @@ private:
 
     std::unique_ptr<uxas::communications::transport::ZeroMqAddressedAttributedMessageSender> m_transportSender;
 
+    bool m_isInProcessDelivery{false};
+    std::string m_sourceGroup;
+    std::string m_entityIdString;
+    std::string m_serviceIdString;
+
+    /** \brief in-process routes by message address, valid for m_inProcessRoutesGeneration */
+    std::unordered_map<std::string, LmcpObjectInProcessBus::Route> m_inProcessRoutes;
+    uint64_t m_inProcessRoutesGeneration{0};
+
 };
 
 }; //namespace communications
@@ -10,6 +10,7 @@
 #include "LmcpObjectMessageTcpReceiverSenderPipe.h"
 
 #include "LmcpMessage.h"
+#include "LmcpObjectMessageReceiverPipe.h"
 #include "MessageAttributes.h"
 #include "ZeroMqSocketConfiguration.h"
 
@@ -27,9 +28,10 @@ namespace communications
 {
 
 void
-LmcpObjectMessageTcpReceiverSenderPipe::initializeStream(uint32_t entityId, uint32_t serviceId, const std::string& socketAddress, bool isServer)
+LmcpObjectMessageTcpReceiverSenderPipe::initializeStream(uint32_t entityId, uint32_t serviceId, const std::string& socketAddress, bool isServer, bool isBinaryFrame)
 {
     initializeZmqSocket(entityId, serviceId, ZMQ_STREAM, socketAddress, isServer);
+    m_transportTcpReceiverSender->setIsBinaryFrame(isBinaryFrame);
 };
 
 void
@@ -82,7 +84,7 @@ LmcpObjectMessageTcpReceiverSenderPipe::getNextMessageObject()
     if (nextZeroMqMessage)
     {
         // deserialize
-        std::unique_ptr<avtas::lmcp::Object> lmcpObject = deserializeMessage(nextZeroMqMessage->getPayload());
+        std::unique_ptr<avtas::lmcp::Object> lmcpObject = LmcpObjectMessageReceiverPipe::deserializeMessage(nextZeroMqMessage->getPayloadView());
         if (lmcpObject)
         {
             std::unique_ptr<uxas::communications::data::LmcpMessage> lmcpMessage 
@@ -108,26 +110,7 @@ LmcpObjectMessageTcpReceiverSenderPipe::getNextSerializedMessage()
 std::unique_ptr<avtas::lmcp::Object>
 LmcpObjectMessageTcpReceiverSenderPipe::deserializeMessage(const std::string& payload)
 {
-    std::unique_ptr<avtas::lmcp::Object> lmcpObject;
-
-    // allocate memory
-    avtas::lmcp::ByteBuffer lmcpByteBuffer;
-    lmcpByteBuffer.allocate(payload.size());
-    lmcpByteBuffer.rewind();
-
-    for (size_t charIndex = 0; charIndex < payload.size(); charIndex++)
-    {
-        lmcpByteBuffer.putByte(payload[charIndex]); // TODO REVIEW
-    }
-    lmcpByteBuffer.rewind();
-    
-    lmcpObject.reset(avtas::lmcp::Factory::getObject(lmcpByteBuffer));
-    if (!lmcpObject)
-    {
-        UXAS_LOG_ERROR("LmcpObjectMessageTcpReceiverSenderPipe::deserializeMessage failed to convert message payload string into an LMCP object");
-    }
-
-    return (lmcpObject);
+    return (LmcpObjectMessageReceiverPipe::deserializeMessage(payload));
 };
 
 void
@@ -52,8 +52,11 @@ private:
 
 public:
 
+    /** \brief Initialize the TCP stream (binary framing if 
+     * <B><i>isBinaryFrame</i></B> is true, text sentinel framing otherwise).
+     */
     void
-    initializeStream(uint32_t entityId, uint32_t serviceId, const std::string& socketAddress, bool isServer);
+    initializeStream(uint32_t entityId, uint32_t serviceId, const std::string& socketAddress, bool isServer, bool isBinaryFrame = false);
 
     bool
     addLmcpObjectSubscriptionAddress(const std::string& address);
@@ -19,6 +19,8 @@
 
 #include "stdUniquePtr.h"
 
+#include <chrono>
+
 namespace uxas
 {
 namespace communications
@@ -40,6 +42,18 @@ LmcpObjectNetworkClientBase::LmcpObjectNetworkClientBase()
 
 LmcpObjectNetworkClientBase::~LmcpObjectNetworkClientBase()
 {
+    if (m_inProcessSubscriber)
+    {
+        m_inProcessSubscriber->setMessageNotifier(nullptr);
+        LmcpObjectInProcessBus::getInstance().unregisterSubscriber(m_inProcessSubscriber);
+    }
+
+    // tasks still queued on the strand reference this network client
+    {
+        std::unique_lock<std::mutex> lock(m_networkClientTaskMutex);
+        m_networkClientTaskCondition.wait(lock, [this]() { return (m_networkClientTaskCount == 0); });
+    }
+
     if (m_networkClientThread && m_networkClientThread->joinable())
     {
         m_networkClientThread->detach();
@@ -56,6 +70,26 @@ LmcpObjectNetworkClientBase::configureNetworkClient(const std::string& subclassT
     m_networkClientTypeName = subclassTypeName;
     m_receiveProcessingType = receiveProcessingType;
 
+    // worker pool execution applies to de-serializing network clients and
+    // requires the in-process bus; the network client XML may override the UxAS default
+    bool isWorkerPoolExecution = uxas::common::ConfigurationManager::getIsWorkerPoolExecution();
+    if (!networkClientXmlNode.attribute(uxas::common::StringConstant::NetworkClientExecution().c_str()).empty())
+    {
+        isWorkerPoolExecution = (uxas::common::NetworkClientExecution::WorkerPool().compare(
+                networkClientXmlNode.attribute(uxas::common::StringConstant::NetworkClientExecution().c_str()).value()) == 0);
+    }
+    if (isWorkerPoolExecution && m_receiveProcessingType == ReceiveProcessingType::LMCP)
+    {
+        if (uxas::common::ConfigurationManager::getIsInProcessLmcpDelivery())
+        {
+            m_executionType = ExecutionType::WORKER_POOL;
+        }
+        else
+        {
+            UXAS_LOG_WARN(m_networkClientTypeName, "::configureNetworkClient using dedicated thread since worker pool execution requires InProcessLmcpDelivery");
+        }
+    }
+
     //
     // DESIGN 20150911 RJT message addressing - entity ID + service ID (uni-cast)
     // - sent messages always include entity ID and service ID
@@ -143,6 +177,19 @@ LmcpObjectNetworkClientBase::initializeAndStart()
     switch (m_receiveProcessingType)
     {
         case ReceiveProcessingType::LMCP:
+            if (m_executionType == ExecutionType::WORKER_POOL)
+            {
+                m_executorStrand = uxas::common::WorkerPoolExecutor::getInstance().createStrand();
+                m_isThreadStarted = true;
+                m_inProcessSubscriber->setMessageNotifier([this]()
+                {
+                    scheduleNetworkClientTask();
+                });
+                // process anything delivered before the notifier was set
+                scheduleNetworkClientTask();
+                UXAS_LOG_INFORM(m_networkClientTypeName, "::initializeAndStart started LMCP network client processing on worker pool strand");
+                break;
+            }
             m_networkClientThread = uxas::stduxas::make_unique<std::thread>(&LmcpObjectNetworkClientBase::executeNetworkClient, this);
             UXAS_LOG_INFORM(m_networkClientTypeName, "::initializeAndStart started LMCP network client processing thread [", m_networkClientThread->get_id(), "]");
             break;
@@ -167,7 +214,18 @@ LmcpObjectNetworkClientBase::addSubscriptionAddress(const std::string& address)
     bool isAdded{false};
     if (m_isThreadStarted)
     {
-        if (m_lmcpObjectMessageReceiverPipe.addLmcpObjectSubscriptionAddress(address))
+        bool isInProcessReceiveOnly{false};
+        if (m_inProcessSubscriber)
+        {
+            LmcpObjectInProcessBus::getInstance().addSubscriptionAddress(m_inProcessSubscriber, address);
+            isInProcessReceiveOnly = m_inProcessSubscriber->m_isObjectReceiver;
+        }
+
+        if (isInProcessReceiveOnly)
+        {
+            UXAS_LOG_INFORM(m_networkClientTypeName, "::addSubscriptionAddress subscribed to in-process message address [", address, "]");
+        }
+        else if (m_lmcpObjectMessageReceiverPipe.addLmcpObjectSubscriptionAddress(address))
         {
             UXAS_LOG_INFORM(m_networkClientTypeName, "::addSubscriptionAddress subscribed to message address [", address, "]");
         }
@@ -200,7 +258,14 @@ LmcpObjectNetworkClientBase::removeSubscriptionAddress(const std::string& addres
     bool isRemoved{false};
     if (m_isThreadStarted)
     {
-        isRemoved = m_lmcpObjectMessageReceiverPipe.removeLmcpObjectSubscriptionAddress(address);
+        if (m_inProcessSubscriber)
+        {
+            isRemoved = LmcpObjectInProcessBus::getInstance().removeSubscriptionAddress(m_inProcessSubscriber, address);
+        }
+        if (!m_inProcessSubscriber || !m_inProcessSubscriber->m_isObjectReceiver)
+        {
+            isRemoved = m_lmcpObjectMessageReceiverPipe.removeLmcpObjectSubscriptionAddress(address);
+        }
     }
     else
     {
@@ -226,7 +291,14 @@ LmcpObjectNetworkClientBase::removeAllSubscriptionAddresses()
     bool isRemoved{false};
     if (m_isThreadStarted)
     {
-        isRemoved = m_lmcpObjectMessageReceiverPipe.removeAllLmcpObjectSubscriptionAddresses();
+        if (m_inProcessSubscriber)
+        {
+            isRemoved = LmcpObjectInProcessBus::getInstance().removeAllSubscriptionAddresses(m_inProcessSubscriber);
+        }
+        if (!m_inProcessSubscriber || !m_inProcessSubscriber->m_isObjectReceiver)
+        {
+            isRemoved = m_lmcpObjectMessageReceiverPipe.removeAllLmcpObjectSubscriptionAddresses();
+        }
     }
     else
     {
@@ -251,27 +323,68 @@ LmcpObjectNetworkClientBase::initializeNetworkClient()
 {
     UXAS_LOG_DEBUGGING(m_networkClientTypeName, "::initializeNetworkClient method START");
 
-    m_lmcpObjectMessageReceiverPipe.initializeSubscription(m_entityId, m_networkId);
+    if (uxas::common::ConfigurationManager::getIsInProcessLmcpDelivery())
+    {
+        // serialized receivers (bridges) register so that senders know when a
+        // serialized copy of a message is still needed, but keep receiving via Zero MQ
+        m_inProcessSubscriber = LmcpObjectInProcessBus::getInstance().registerSubscriber(m_entityId, m_networkId,
+                                                                                          (m_receiveProcessingType == ReceiveProcessingType::LMCP));
+        for (const auto& address : m_preStartLmcpSubscriptionAddresses)
+        {
+            LmcpObjectInProcessBus::getInstance().addSubscriptionAddress(m_inProcessSubscriber, address);
+            UXAS_LOG_INFORM(m_networkClientTypeName, "::initializeNetworkClient subscribed to staged in-process message address [", address, "]");
+        }
+    }
 
-    for (const auto& address : m_preStartLmcpSubscriptionAddresses)
+    if (!m_inProcessSubscriber || !m_inProcessSubscriber->m_isObjectReceiver)
     {
-        if (m_lmcpObjectMessageReceiverPipe.addLmcpObjectSubscriptionAddress(address))
+        m_lmcpObjectMessageReceiverPipe.initializeSubscription(m_entityId, m_networkId);
+
+        for (const auto& address : m_preStartLmcpSubscriptionAddresses)
         {
-            UXAS_LOG_INFORM(m_networkClientTypeName, "::addSubscriptionAddress subscribed to staged message address [", address, "]");
+            if (m_lmcpObjectMessageReceiverPipe.addLmcpObjectSubscriptionAddress(address))
+            {
+                UXAS_LOG_INFORM(m_networkClientTypeName, "::addSubscriptionAddress subscribed to staged message address [", address, "]");
+            }
+            else
+            {
+                UXAS_LOG_INFORM(m_networkClientTypeName, "::addSubscriptionAddress attempted to subscribe to staged message address [", address, "] "
+                           " subscription not added since already exists");
+            }
         }
-        else
+
+        if (uxas::common::ConfigurationManager::getIsEventDrivenReceive())
         {
-            UXAS_LOG_INFORM(m_networkClientTypeName, "::addSubscriptionAddress attempted to subscribe to staged message address [", address, "] "
-                       " subscription not added since already exists");
+            m_lmcpObjectMessageReceiverPipe.enableEventDrivenReceive();
         }
     }
 
-    m_lmcpObjectMessageSenderPipe.initializePush(m_messageSourceGroup, m_entityId, m_networkId);
+    if (m_inProcessSubscriber)
+    {
+        m_lmcpObjectMessageSenderPipe.initializeInProcessPush(m_messageSourceGroup, m_entityId, m_networkId);
+    }
+    else
+    {
+        m_lmcpObjectMessageSenderPipe.initializePush(m_messageSourceGroup, m_entityId, m_networkId);
+    }
 
     UXAS_LOG_DEBUGGING(m_networkClientTypeName, "::initializesendAddressedAttributedMessageNetworkClient method END");
     return (true);
 };
 
+void
+LmcpObjectNetworkClientBase::stopNetworkClient()
+{
+    m_isTerminateNetworkClient = true;
+    if (m_inProcessSubscriber)
+    {
+        // worker pool strand observes the request on its next task
+        m_inProcessSubscriber->wake();
+    }
+    // event-driven receiver waits without timeout
+    m_lmcpObjectMessageReceiverPipe.wake();
+};
+
 void
 LmcpObjectNetworkClientBase::executeNetworkClient()
 {
@@ -280,35 +393,38 @@ LmcpObjectNetworkClientBase::executeNetworkClient()
         UXAS_LOG_DEBUGGING(m_networkClientTypeName, "::executeNetworkClient method START");
         UXAS_LOG_DEBUGGING(m_networkClientTypeName, "::executeNetworkClient method START infinite while loop");
         m_isThreadStarted = true;
+        std::vector< std::unique_ptr<uxas::communications::data::LmcpMessage> > receivedLmcpMessages;
         while (!m_isTerminateNetworkClient)
         {
             try
             {
-                // get the next LMCP message (if any) from the LMCP network server
-                UXAS_LOG_DEBUG_VERBOSE_MESSAGING(m_networkClientTypeName, "::executeNetworkClient calling m_lmcpObjectMessageReceiverPipe.getNextMessageObject()");
-                std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage
-                        = m_lmcpObjectMessageReceiverPipe.getNextMessageObject();
-                UXAS_LOG_DEBUG_VERBOSE_MESSAGING(m_networkClientTypeName, "::executeNetworkClient completed calling m_lmcpObjectMessageReceiverPipe.getNextMessageObject()");
-
-                if (receivedLmcpMessage)
+                // get the next LMCP message (if any) from the LMCP network server,
+                // together with any further messages that are already queued
+                UXAS_LOG_DEBUG_VERBOSE_MESSAGING(m_networkClientTypeName, "::executeNetworkClient calling m_lmcpObjectMessageReceiverPipe.getNextMessageObjects()");
+                receivedLmcpMessages.clear();
+                if (m_inProcessSubscriber)
                 {
-                    UXAS_LOG_DEBUG_VERBOSE_MESSAGING(m_networkClientTypeName, "::executeNetworkClient processing received LMCP message");
-                    UXAS_LOG_DEBUG_VERBOSE_MESSAGING("ContentType:      [", receivedLmcpMessage->m_attributes->getContentType(), "]");
-                    UXAS_LOG_DEBUG_VERBOSE_MESSAGING("Descriptor:       [", receivedLmcpMessage->m_attributes->getDescriptor(), "]");
-                    UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceGroup:      [", receivedLmcpMessage->m_attributes->getSourceGroup(), "]");
-                    UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceEntityId:   [", receivedLmcpMessage->m_attributes->getSourceEntityId(), "]");
-                    UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceServiceId:  [", receivedLmcpMessage->m_attributes->getSourceServiceId(), "]");
-                    UXAS_LOG_DEBUG_VERBOSE_MESSAGING("AttributesString: [", receivedLmcpMessage->m_attributes->getString(), "]");
-                    if ((m_isBaseClassKillServiceProcessingPermitted
-                            && uxas::messages::uxnative::isKillService(receivedLmcpMessage->m_object)
-                            //&& m_entityIdString.compare(std::static_pointer_cast<uxas::messages::uxnative::KillService>(receivedLmcpMessage->m_object)->getEntityID()) == 0//TODO check entityID
-                            && m_networkIdString.compare(std::to_string(std::static_pointer_cast<uxas::messages::uxnative::KillService>(receivedLmcpMessage->m_object)->getServiceID())) == 0)
-                            || processReceivedLmcpMessage(std::move(receivedLmcpMessage)))
+                    std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage
+                            = m_inProcessSubscriber->getNextMessage(uxas::common::ConfigurationManager::getZeroMqReceiveSocketPollWaitTime_ms());
+                    while (receivedLmcpMessage)
                     {
-                        UXAS_LOG_INFORM(m_networkClientTypeName, "::executeNetworkClient starting termination since received [", uxas::messages::uxnative::KillService::TypeName, "] message ");
-                        m_isTerminateNetworkClient = true;
+                        receivedLmcpMessages.push_back(std::move(receivedLmcpMessage));
+                        if (receivedLmcpMessages.size() < m_receiveBatchMaximumCount)
+                        {
+                            receivedLmcpMessage = m_inProcessSubscriber->getNextMessage(0);
+                        }
                     }
                 }
+                else
+                {
+                    m_lmcpObjectMessageReceiverPipe.getNextMessageObjects(receivedLmcpMessages, m_receiveBatchMaximumCount);
+                }
+                UXAS_LOG_DEBUG_VERBOSE_MESSAGING(m_networkClientTypeName, "::executeNetworkClient completed calling m_lmcpObjectMessageReceiverPipe.getNextMessageObjects()");
+
+                if (!receivedLmcpMessages.empty() && processNextLmcpMessageBatch(receivedLmcpMessages))
+                {
+                    m_isTerminateNetworkClient = true;
+                }
             }
             catch (std::exception& ex)
             {
@@ -319,36 +435,171 @@ LmcpObjectNetworkClientBase::executeNetworkClient()
         UXAS_LOG_DEBUGGING(m_networkClientTypeName, "::executeNetworkClient method END infinite while loop");
 
         m_isBaseClassTerminationFinished = true;
+        terminateSubclass();
+        UXAS_LOG_INFORM(m_networkClientTypeName, "::executeNetworkClient exiting infinite loop thread [", std::this_thread::get_id(), "]");
+        UXAS_LOG_DEBUGGING(m_networkClientTypeName, "::executeNetworkClient method END");
+    }
+    catch (std::exception& ex)
+    {
+        UXAS_LOG_ERROR(m_networkClientTypeName, "::executeNetworkClient EXCEPTION: ", ex.what());
+    }
+};
 
-        uint32_t subclassTerminateDuration_ms{0};
-        while (true)
-        {
-            m_isSubclassTerminationFinished = terminate();
-            if (m_isSubclassTerminationFinished)
-            {
-                UXAS_LOG_INFORM(m_networkClientTypeName, "::executeNetworkClient terminated subclass processing after [", subclassTerminateDuration_ms, "] milliseconds on thread [", std::this_thread::get_id(), "]");
-                break;
-            }
+void
+LmcpObjectNetworkClientBase::executeNetworkClientTask()
+{
+    // deliveries from now on schedule another task
+    m_isNetworkClientTaskScheduled.store(false, std::memory_order_seq_cst);
+    if (m_isBaseClassTerminationFinished)
+    {
+        return;
+    }
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(m_subclassTerminationAttemptPeriod_ms));
-            subclassTerminateDuration_ms += m_subclassTerminationAttemptPeriod_ms;
-            if (subclassTerminateDuration_ms > m_subclassTerminationWarnDuration_ms)
-            {
-                UXAS_LOG_WARN(m_networkClientTypeName, "::executeNetworkClient has not terminated subclass processing after [", subclassTerminateDuration_ms, "] milliseconds on thread [", std::this_thread::get_id(), "]");
-            }
-            else if (subclassTerminateDuration_ms > m_subclassTerminationAbortDuration_ms)
+    // bounded so that other strands sharing this worker are not starved by a burst
+    std::vector< std::unique_ptr<uxas::communications::data::LmcpMessage> > receivedLmcpMessages;
+    try
+    {
+        while (receivedLmcpMessages.size() < m_receiveBatchMaximumCount)
+        {
+            std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage = m_inProcessSubscriber->getNextMessage(0);
+            if (!receivedLmcpMessage)
             {
-                UXAS_LOG_ERROR(m_networkClientTypeName, "::executeNetworkClient aborting termination of subclass processing after [", subclassTerminateDuration_ms, "] milliseconds on thread [", std::this_thread::get_id(), "]");
                 break;
             }
+            receivedLmcpMessages.push_back(std::move(receivedLmcpMessage));
+        }
+        if (!receivedLmcpMessages.empty() && !m_isTerminateNetworkClient && processNextLmcpMessageBatch(receivedLmcpMessages))
+        {
+            m_isTerminateNetworkClient = true;
         }
-        UXAS_LOG_INFORM(m_networkClientTypeName, "::executeNetworkClient exiting infinite loop thread [", std::this_thread::get_id(), "]");
-        UXAS_LOG_DEBUGGING(m_networkClientTypeName, "::executeNetworkClient method END");
     }
     catch (std::exception& ex)
     {
-        UXAS_LOG_ERROR(m_networkClientTypeName, "::executeNetworkClient EXCEPTION: ", ex.what());
+        UXAS_LOG_ERROR(m_networkClientTypeName, "::executeNetworkClientTask continuing after EXCEPTION: ", ex.what());
+    }
+
+    if (!m_isTerminateNetworkClient && receivedLmcpMessages.size() == m_receiveBatchMaximumCount)
+    {
+        // continue after other queued strands have had a turn
+        scheduleNetworkClientTask();
+    }
+    else if (m_isTerminateNetworkClient)
+    {
+        m_inProcessSubscriber->setMessageNotifier(nullptr);
+        m_isBaseClassTerminationFinished = true;
+        terminateSubclass();
+        UXAS_LOG_INFORM(m_networkClientTypeName, "::executeNetworkClientTask finished worker pool processing on thread [", std::this_thread::get_id(), "]");
+    }
+};
+
+void
+LmcpObjectNetworkClientBase::scheduleNetworkClientTask()
+{
+    if (m_isNetworkClientTaskScheduled.exchange(true))
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_networkClientTaskMutex);
+        m_networkClientTaskCount++;
+    }
+    m_executorStrand->post([this]()
+    {
+        executeNetworkClientTask();
+        // last access to this network client (the destructor may proceed)
+        std::lock_guard<std::mutex> lock(m_networkClientTaskMutex);
+        m_networkClientTaskCount--;
+        m_networkClientTaskCondition.notify_all();
+    });
+};
+
+bool
+LmcpObjectNetworkClientBase::processNextLmcpMessageBatch(std::vector< std::unique_ptr<uxas::communications::data::LmcpMessage> >& receivedLmcpMessages)
+{
+    bool isKillService{false};
+    for (auto receivedLmcpMessageIt = receivedLmcpMessages.begin(); receivedLmcpMessageIt != receivedLmcpMessages.end(); receivedLmcpMessageIt++)
+    {
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING(m_networkClientTypeName, "::processNextLmcpMessageBatch processing received LMCP message");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("ContentType:      [", (*receivedLmcpMessageIt)->m_attributes->getContentType(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("Descriptor:       [", (*receivedLmcpMessageIt)->m_attributes->getDescriptor(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceGroup:      [", (*receivedLmcpMessageIt)->m_attributes->getSourceGroup(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceEntityId:   [", (*receivedLmcpMessageIt)->m_attributes->getSourceEntityId(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceServiceId:  [", (*receivedLmcpMessageIt)->m_attributes->getSourceServiceId(), "]");
+        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("AttributesString: [", (*receivedLmcpMessageIt)->m_attributes->getString(), "]");
+        if (m_isBaseClassKillServiceProcessingPermitted
+                && uxas::messages::uxnative::isKillService((*receivedLmcpMessageIt)->m_object)
+                && m_networkIdString.compare(std::to_string(std::static_pointer_cast<uxas::messages::uxnative::KillService>((*receivedLmcpMessageIt)->m_object)->getServiceID())) == 0)
+        {
+            // messages received after the KillService message are not processed
+            receivedLmcpMessages.erase(receivedLmcpMessageIt, receivedLmcpMessages.end());
+            isKillService = true;
+            break;
+        }
+    }
+
+    if ((!receivedLmcpMessages.empty() && processReceivedLmcpMessageBatch(receivedLmcpMessages)) || isKillService)
+    {
+        UXAS_LOG_INFORM(m_networkClientTypeName, "::processNextLmcpMessageBatch starting termination since received [", uxas::messages::uxnative::KillService::TypeName, "] message ");
+        return (true);
     }
+    return (false);
+};
+
+bool
+LmcpObjectNetworkClientBase::processReceivedLmcpMessageBatch(std::vector< std::unique_ptr<uxas::communications::data::LmcpMessage> >& receivedLmcpMessages)
+{
+    for (auto& receivedLmcpMessage : receivedLmcpMessages)
+    {
+        if (processReceivedLmcpMessage(std::move(receivedLmcpMessage)))
+        {
+            return (true);
+        }
+    }
+    return (false);
+};
+
+void
+LmcpObjectNetworkClientBase::terminateSubclass()
+{
+    uint32_t subclassTerminateDuration_ms{0};
+    while (true)
+    {
+        m_isSubclassTerminationFinished = terminate();
+        if (m_isSubclassTerminationFinished)
+        {
+            UXAS_LOG_INFORM(m_networkClientTypeName, "::terminateSubclass terminated subclass processing after [", subclassTerminateDuration_ms, "] milliseconds on thread [", std::this_thread::get_id(), "]");
+            break;
+        }
+
+        // wait for the subclass to report progress (notifySubclassTermination) or the attempt period,
+        // so that a worker pool thread is only held as long as the subclass needs
+        auto attemptStart = std::chrono::steady_clock::now();
+        {
+            std::unique_lock<std::mutex> lock(m_subclassTerminationMutex);
+            m_subclassTerminationCondition.wait_for(lock, std::chrono::milliseconds(m_subclassTerminationAttemptPeriod_ms),
+                                                    [this]() { return (m_isSubclassTerminationNotified); });
+            m_isSubclassTerminationNotified = false;
+        }
+        subclassTerminateDuration_ms += static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - attemptStart).count());
+        if (subclassTerminateDuration_ms > m_subclassTerminationAbortDuration_ms)
+        {
+            UXAS_LOG_ERROR(m_networkClientTypeName, "::terminateSubclass aborting termination of subclass processing after [", subclassTerminateDuration_ms, "] milliseconds on thread [", std::this_thread::get_id(), "]");
+            break;
+        }
+        else if (subclassTerminateDuration_ms > m_subclassTerminationWarnDuration_ms)
+        {
+            UXAS_LOG_WARN(m_networkClientTypeName, "::terminateSubclass has not terminated subclass processing after [", subclassTerminateDuration_ms, "] milliseconds on thread [", std::this_thread::get_id(), "]");
+        }
+    }
+};
+
+void
+LmcpObjectNetworkClientBase::notifySubclassTermination()
+{
+    std::lock_guard<std::mutex> lock(m_subclassTerminationMutex);
+    m_isSubclassTerminationNotified = true;
+    m_subclassTerminationCondition.notify_all();
 };
 
 void
@@ -376,7 +627,7 @@ LmcpObjectNetworkClientBase::executeSerializedNetworkClient()
                 UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceEntityId:   [", nextReceivedSerializedLmcpObject->getMessageAttributesReference()->getSourceEntityId(), "]");
                 UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceServiceId:  [", nextReceivedSerializedLmcpObject->getMessageAttributesReference()->getSourceServiceId(), "]");
                 UXAS_LOG_DEBUG_VERBOSE_MESSAGING("AttributesString: [", nextReceivedSerializedLmcpObject->getMessageAttributesReference()->getString(), "]");
-                UXAS_LOG_DEBUG_VERBOSE_MESSAGING("getPayload:       [", nextReceivedSerializedLmcpObject->getPayload(), "]");
+                UXAS_LOG_DEBUG_VERBOSE_MESSAGING("getPayload:       [", nextReceivedSerializedLmcpObject->getPayloadView(), "]");
                 UXAS_LOG_DEBUG_VERBOSE_MESSAGING("getString:        [", nextReceivedSerializedLmcpObject->getString(), "]");
 
                 if (m_isBaseClassKillServiceProcessingPermitted
@@ -384,7 +635,7 @@ LmcpObjectNetworkClientBase::executeSerializedNetworkClient()
                         .rfind(uxas::messages::uxnative::KillService::Subscription) != std::string::npos)
                 {
                     // reconstitute LMCP object
-                    std::shared_ptr<avtas::lmcp::Object> lmcpObject = deserializeMessage(nextReceivedSerializedLmcpObject->getPayload());
+                    std::shared_ptr<avtas::lmcp::Object> lmcpObject = LmcpObjectMessageReceiverPipe::deserializeMessage(nextReceivedSerializedLmcpObject->getPayloadView());
                     // check KillService serviceID == my serviceID
                     if (uxas::messages::uxnative::isKillService(lmcpObject)
                             //&& m_entityIdString.compare(std::static_pointer_cast<uxas::messages::uxnative::KillService>(lmcpObject)->getEntityID()) == 0//TODO check entityID
@@ -440,26 +691,7 @@ LmcpObjectNetworkClientBase::executeSerializedNetworkClient()
 std::shared_ptr<avtas::lmcp::Object>
 LmcpObjectNetworkClientBase::deserializeMessage(const std::string& payload)
 {
-    std::shared_ptr<avtas::lmcp::Object> lmcpObject;
-
-    // allocate memory
-    avtas::lmcp::ByteBuffer lmcpByteBuffer;
-    lmcpByteBuffer.allocate(payload.size());
-    lmcpByteBuffer.rewind();
-
-    for (size_t charIndex = 0; charIndex < payload.size(); charIndex++)
-    {
-        lmcpByteBuffer.putByte(payload[charIndex]); // TODO REVIEW
-    }
-    lmcpByteBuffer.rewind();
-    
-    lmcpObject.reset(avtas::lmcp::Factory::getObject(lmcpByteBuffer));
-    if (!lmcpObject)
-    {
-        UXAS_LOG_ERROR("LmcpObjectMessageReceiverPipe::deserializeMessage failed to convert message payload string into an LMCP object");
-    }
-
-    return (lmcpObject);
+    return (LmcpObjectMessageReceiverPipe::deserializeMessage(payload));
 };
 
 void
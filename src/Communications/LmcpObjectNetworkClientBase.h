@@ -10,16 +10,21 @@
 #ifndef UXAS_MESSAGE_LMCP_OBJECT_NETWORK_CLIENT_BASE_H
 #define UXAS_MESSAGE_LMCP_OBJECT_NETWORK_CLIENT_BASE_H
 
+#include "LmcpObjectInProcessBus.h"
 #include "LmcpObjectMessageReceiverPipe.h"
 #include "LmcpObjectMessageSenderPipe.h"
 
 #include "avtas/lmcp/Factory.h"
 
+#include "UxAS_WorkerPoolExecutor.h"
+
 #include "pugixml.hpp"
 
 #include <atomic>
+#include <condition_variable>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <thread>
@@ -60,6 +65,11 @@ namespace communications
  * <li><i>\u{Threading}</i> consists of a single thread within this class and zero-many 
  * threads in an inheriting class. Inheriting classes that have their own threads 
  * must implement the <B><i>terminate</i></B> virtual method to achieve clean destruction.
+ * Alternatively, if the <b>NetworkClientExecution</b> configuration attribute is 
+ * <b>WorkerPool</b> (on the UxAS node or the network client node), then 
+ * received <b>LMCP</b> objects are processed on a serial strand of the shared 
+ * <B><i>WorkerPoolExecutor</i></B> instead of a dedicated thread (messages are 
+ * still processed one at a time, in order of arrival).
  * 
  * <li><i>\u{Receiving <b>LMCP</b> object messages}</i> are processed by calling either the 
  * <B><i>processReceivedLmcpMessage</i></B> virtual method or the 
@@ -68,12 +78,19 @@ namespace communications
  * configuration of message addresses. 
  * Uni-cast, multi-cast and broadcast messages are supported.
  * 
+ * <li><i>\u{In-process delivery}</i> is enabled by the <b>InProcessLmcpDelivery</b> 
+ * configuration attribute. Network clients that de-serialize received messages 
+ * then receive <b>LMCP</b> objects sent by co-located network clients through 
+ * the <B><i>LmcpObjectInProcessBus</i></B> (each receiver gets its own copy of 
+ * the object, skipping serialization) and messages are only serialized when a bridge subscribes to them.
+ * 
  * <li><i>\u{Sending <b>LMCP</b> object messages}</i> can be performed by inheriting classes 
  * by calling one of three methods: 
  * <B><i>sendLmcpObjectBroadcastMessage</i></B>, 
  * <B><i>sendLmcpObjectLimitedCastMessage</i></B> or 
  * <B><i>sendSerializedLmcpObjectMessage</i></B>. Uni-cast, multi-cast and broadcast 
- * messages are supported.
+ * messages are supported. The sender pipe is not thread-safe: an inheriting class 
+ * that sends from its own thread must not send from any other thread.
  * 
  * <li><i>\u{Termination}</i> can occur in two different ways. If true is returned by either the 
  * <B><i>processReceivedLmcpMessage</i></B> virtual method or the 
@@ -105,6 +122,20 @@ public:
         /** \brief Received <b>LMCP</b> objects are not de-serialized */
         SERIALIZED_LMCP
     };
+
+    /** \class ExecutionType
+     * 
+     * \par Enumeration specifying how received messages are dispatched.
+     * 
+     * \n
+     */
+    enum class ExecutionType
+    {
+        /** \brief Received messages are processed by a thread dedicated to the network client */
+        DEDICATED_THREAD,
+        /** \brief Received <b>LMCP</b> objects are processed on a serial strand of the shared worker pool */
+        WORKER_POOL
+    };
     
     /**
      * s_entityIdPrefix string (leading characters for indicating that an entity ID follows)
@@ -298,6 +329,12 @@ public:
 
 protected:
 
+    /** \brief The <B><i>stopNetworkClient</i></B> method requests termination of 
+     * the network client from any thread. 
+     */
+    void
+    stopNetworkClient();
+
     /** \brief The virtual <B><i>configure</i></B> method is invoked by the 
      * <B><i>LmcpObjectNetworkClientBase</i></B> class after completing its own 
      * configuration. 
@@ -347,6 +384,21 @@ protected:
     virtual
     bool
     processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage) { return (false); };
+
+    /** \brief The virtual <B><i>processReceivedLmcpMessageBatch</i></B> is 
+     * invoked by the <B><i>LmcpObjectNetworkClientBase</i></B> class with all 
+     * <b>LMCP</b> objects that were ready when the network client woke up 
+     * (at most <B><i>m_receiveBatchMaximumCount</i></B>, in receive order). 
+     * Inheriting classes can override it to coalesce work over a burst of 
+     * messages; by default, <B><i>processReceivedLmcpMessage</i></B> is 
+     * invoked for each message.
+     * 
+     * @param receivedLmcpMessages received <b>LMCP</b> objects.
+     * @return true if object is to terminate; false if object is to continue processing.
+     */
+    virtual
+    bool
+    processReceivedLmcpMessageBatch(std::vector< std::unique_ptr<uxas::communications::data::LmcpMessage> >& receivedLmcpMessages);
     
     /** \brief The virtual <B><i>processReceivedSerializedLmcpMessage</i></B> is 
      * repeatedly invoked by the <B><i>LmcpObjectNetworkClientBase</i></B> class in an 
@@ -434,6 +486,14 @@ protected:
     void
     sendSharedLmcpObjectLimitedCastMessage(const std::string& castAddress, const std::shared_ptr<avtas::lmcp::Object>& lmcpObject);
 
+    /** \brief The <B><i>notifySubclassTermination</i></B> method can be invoked 
+     * (any thread) when subclass processing that prevented <B><i>terminate</i></B> 
+     * from succeeding has finished, so that <B><i>terminate</i></B> is invoked 
+     * again without waiting for the attempt period.
+     */
+    void
+    notifySubclassTermination();
+
 private:
     
     /** \brief The <B><i>initializeNetworkClient</i></B> method is invoked by 
@@ -465,6 +525,39 @@ private:
     void
     executeSerializedNetworkClient();
 
+    /** \brief If <B><i>m_executionType</i></B> == 
+     * <B><i>ExecutionType::WORKER_POOL</i></B>, then the 
+     * <B><i>executeNetworkClientTask</i></B> method is posted to the network 
+     * client strand whenever an <b>LMCP</b> object is delivered and invokes 
+     * <B><i>processReceivedLmcpMessage</i></B> for the queued objects.
+     */
+    void
+    executeNetworkClientTask();
+
+    /** \brief Posts <B><i>executeNetworkClientTask</i></B> to the network client 
+     * strand unless it is already posted and has not started receiving, so that 
+     * bursts of deliveries result in a single queued task.
+     */
+    void
+    scheduleNetworkClientTask();
+
+    /** \brief The <B><i>processNextLmcpMessageBatch</i></B> method handles 
+     * <b>KillService</b> messages and passes the messages received before 
+     * it to <B><i>processReceivedLmcpMessageBatch</i></B>.
+     * 
+     * @return true if object is to terminate; false if object is to continue processing.
+     */
+    bool
+    processNextLmcpMessageBatch(std::vector< std::unique_ptr<uxas::communications::data::LmcpMessage> >& receivedLmcpMessages);
+
+    /** \brief The <B><i>terminateSubclass</i></B> method repeatedly invokes 
+     * the <B><i>terminate</i></B> virtual method until it succeeds or the 
+     * abort duration elapses. Between attempts it waits on a condition variable 
+     * (see <B><i>notifySubclassTermination</i></B>) for at most the attempt period.
+     */
+    void
+    terminateSubclass();
+
     /** \brief The <B><i>deserializeMessage</i></B> method deserializes an LMCP 
      * string into an LMCP object.
      * 
@@ -511,6 +604,9 @@ protected:
     uint32_t m_subclassTerminationWarnDuration_ms{3000};
     uint32_t m_subclassTerminationAttemptPeriod_ms{500};
 
+    /** \brief Maximum number of ready <b>LMCP</b> objects processed per wakeup (batch) */
+    uint32_t m_receiveBatchMaximumCount{64};
+
 private:
     
     /** \brief  */
@@ -522,13 +618,36 @@ private:
     /** \brief  this is the unique ID for the entity represented by this instance of the UxAS software, configured in component manager XML*/
     ReceiveProcessingType m_receiveProcessingType;
 
+    /** \brief Dedicated thread or worker pool processing of received messages */
+    ExecutionType m_executionType{ExecutionType::DEDICATED_THREAD};
+
     /** \brief Pointer to the component's thread.  */
     std::unique_ptr<std::thread> m_networkClientThread;
 
+    /** \brief Serial strand on the shared worker pool (worker pool execution only) */
+    std::shared_ptr<uxas::common::WorkerPoolExecutor::Strand> m_executorStrand;
+
+    /** \brief true from posting <B><i>executeNetworkClientTask</i></B> until it starts receiving */
+    std::atomic<bool> m_isNetworkClientTaskScheduled{false};
+
+    /** \brief Number of posted <B><i>executeNetworkClientTask</i></B> tasks that have not finished; 
+     * the destructor waits for zero (guarded by <B><i>m_networkClientTaskMutex</i></B>) */
+    uint32_t m_networkClientTaskCount{0};
+    std::mutex m_networkClientTaskMutex;
+    std::condition_variable m_networkClientTaskCondition;
+
+    /** \brief Set by <B><i>notifySubclassTermination</i></B> (guarded by <B><i>m_subclassTerminationMutex</i></B>) */
+    bool m_isSubclassTerminationNotified{false};
+    std::mutex m_subclassTerminationMutex;
+    std::condition_variable m_subclassTerminationCondition;
+
     uxas::communications::LmcpObjectMessageReceiverPipe m_lmcpObjectMessageReceiverPipe;
     std::set<std::string> m_preStartLmcpSubscriptionAddresses;
 
     uxas::communications::LmcpObjectMessageSenderPipe m_lmcpObjectMessageSenderPipe;
+
+    /** \brief Registration with the in-process bus (only if in-process delivery is enabled) */
+    std::shared_ptr<uxas::communications::LmcpObjectInProcessSubscriber> m_inProcessSubscriber;
     
 };
 
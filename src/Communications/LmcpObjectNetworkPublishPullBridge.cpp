@@ -136,7 +136,7 @@ LmcpObjectNetworkPublishPullBridge::processReceivedSerializedLmcpMessage(std::un
     // send message to the external entity
     UXAS_LOG_DEBUGGING(s_typeName(), "::processReceivedSerializedLmcpMessage before sending serialized message ",
         "having address ", receivedLmcpMessage->getAddress(),
-        " and size ", receivedLmcpMessage->getPayload().size());
+        " and size ", receivedLmcpMessage->getPayloadView().size());
 
     // process messages from a local service (only)
     if (m_entityIdString == receivedLmcpMessage->getMessageAttributesReference()->getSourceEntityId())
@@ -179,7 +179,7 @@ LmcpObjectNetworkPublishPullBridge::executeExternalSerializedLmcpObjectReceivePr
             // send message from the external entity to the local system
             UXAS_LOG_DEBUGGING(s_typeName(), "::executeExternalSerializedLmcpObjectReceiveProcessing before sending serialized message ",
                 "having address ", recvdAddAttMsg->getAddress(),
-                " and size ", recvdAddAttMsg->getPayload().size());
+                " and size ", recvdAddAttMsg->getPayloadView().size());
             if (recvdAddAttMsg->isValid())
             {
                 if (m_nonImportForwardAddresses.find(recvdAddAttMsg->getAddress()) == m_nonImportForwardAddresses.end())
@@ -57,6 +57,26 @@ LmcpObjectNetworkSerialBridge::configure(const pugi::xml_node& bridgeXmlNode)
         UXAS_LOG_INFORM(s_typeName(), "::configure did not find 'ConsiderSelfGenerated' boolean in XML configuration; 'ConsiderSelfGenerated' boolean is ", m_isConsideredSelfGenerated);
     }
 
+    if (!bridgeXmlNode.attribute(uxas::common::StringConstant::FrameFormat().c_str()).empty())
+    {
+        std::string frameFormat = bridgeXmlNode.attribute(uxas::common::StringConstant::FrameFormat().c_str()).value();
+        if (frameFormat == uxas::common::StringConstant::BinaryFormat() || frameFormat == uxas::common::StringConstant::SentinelFormat())
+        {
+            m_isBinaryFrame = (frameFormat == uxas::common::StringConstant::BinaryFormat());
+            UXAS_LOG_INFORM(s_typeName(), "::configure setting frame format to ", frameFormat, " from XML configuration");
+        }
+        else
+        {
+            isSuccess = false;
+            UXAS_LOG_ERROR(s_typeName(), "::configure unknown frame format ", frameFormat, " in XML configuration; expected ",
+                           uxas::common::StringConstant::BinaryFormat(), " or ", uxas::common::StringConstant::SentinelFormat());
+        }
+    }
+    else
+    {
+        UXAS_LOG_INFORM(s_typeName(), "::configure did not find frame format in XML configuration; binary frame boolean is ", m_isBinaryFrame);
+    }
+
     if (isSuccess)
     {
         std::string baudRate = bridgeXmlNode.attribute(uxas::common::StringConstant::BaudRate().c_str()).value();
@@ -151,7 +171,7 @@ LmcpObjectNetworkSerialBridge::processReceivedSerializedLmcpMessage(std::unique_
     // send message to the external entity
     UXAS_LOG_DEBUGGING(s_typeName(), "::processReceivedSerializedLmcpMessage [", m_entityIdNetworkIdUnicastString, 
             "] before processing serialized message having address ", receivedLmcpMessage->getAddress(),
-                  " and size ", receivedLmcpMessage->getPayload().size());
+                  " and size ", receivedLmcpMessage->getPayloadView().size());
 
     // process messages from a local service (only)
     if (m_entityIdString == receivedLmcpMessage->getMessageAttributesReference()->getSourceEntityId())
@@ -161,7 +181,14 @@ LmcpObjectNetworkSerialBridge::processReceivedSerializedLmcpMessage(std::unique_
             UXAS_LOG_INFORM(s_typeName(), "::processReceivedSerializedLmcpMessage processing message with source entity ID ", receivedLmcpMessage->getMessageAttributesReference()->getSourceEntityId());
             try
             {
-                m_serialConnection->write(uxas::common::SentinelSerialBuffer::createSentinelizedString(receivedLmcpMessage->getString()));
+                if (m_isBinaryFrame)
+                {
+                    m_serialConnection->write(uxas::communications::transport::BinaryFrameBuffer::createFrame(*receivedLmcpMessage));
+                }
+                else
+                {
+                    m_serialConnection->write(uxas::common::SentinelSerialBuffer::createSentinelizedString(receivedLmcpMessage->getString()));
+                }
             }
             catch (std::exception& ex)
             {
@@ -198,37 +225,40 @@ LmcpObjectNetworkSerialBridge::executeSerialReceiveProcessing()
                 // check serial connection for inputs
                 UXAS_LOG_DEBUG_VERBOSE(s_typeName(), "::executeSerialReceiveProcessing [", m_entityIdNetworkIdUnicastString,
                                   "] port [", m_serialConnection->getPort(), "] BEFORE serial connection read");
-                std::string serialInput = m_serialConnection->read(static_cast<size_t> (m_serialMaxBytesReadCount));
+                // read directly into the receive (binary frame or sentinel) buffer
+                size_t serialInputSize{0};
+                if (m_isBinaryFrame)
+                {
+                    serialInputSize = m_serialConnection->read(m_receiveSerialBinaryFrameBuffer.getWriteBuffer(static_cast<size_t> (m_serialMaxBytesReadCount)),
+                                                               static_cast<size_t> (m_serialMaxBytesReadCount));
+                    m_receiveSerialBinaryFrameBuffer.commitData(serialInputSize);
+                }
+                else
+                {
+                    serialInputSize = m_serialConnection->read(m_receiveSerialDataBuffer.getWriteBuffer(static_cast<size_t> (m_serialMaxBytesReadCount)),
+                                                               static_cast<size_t> (m_serialMaxBytesReadCount));
+                    m_receiveSerialDataBuffer.commitData(serialInputSize);
+                }
                 UXAS_LOG_DEBUG_VERBOSE(s_typeName(), "::executeSerialReceiveProcessing [", m_entityIdNetworkIdUnicastString,
-                                  "] port [", m_serialConnection->getPort(), "] AFTER serial connection read value [", serialInput, "]");
-                if (!serialInput.empty())
+                                  "] port [", m_serialConnection->getPort(), "] AFTER serial connection read of ", serialInputSize, " bytes");
+                if (serialInputSize > 0)
                 {
-                    UXAS_LOG_DEBUGGING(s_typeName(), "::executeSerialReceiveProcessing [", serialInput, "] before processing received serial string");
-                    std::string recvdSerialDataSegment = m_receiveSerialDataBuffer.getNextPayloadString(serialInput);
-                    while (!recvdSerialDataSegment.empty())
+                    UXAS_LOG_DEBUGGING(s_typeName(), "::executeSerialReceiveProcessing before processing ", serialInputSize, " received serial bytes");
+                    std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdAddAttMsg;
+                    while ((recvdAddAttMsg = getNextReceivedMessage()))
                     {
-                        UXAS_LOG_DEBUGGING(s_typeName(), "::executeSerialReceiveProcessing [", m_entityIdNetworkIdUnicastString, "] processing complete object string segment retrieved from serial buffer");
-                        std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdAddAttMsg = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
-                        if (recvdAddAttMsg->setAddressAttributesAndPayloadFromDelimitedString(std::move(recvdSerialDataSegment)))
+                        if (m_nonImportForwardAddresses.find(recvdAddAttMsg->getAddress()) == m_nonImportForwardAddresses.end())
                         {
-                            if (m_nonImportForwardAddresses.find(recvdAddAttMsg->getAddress()) == m_nonImportForwardAddresses.end())
-                            {
-                                if(m_isConsideredSelfGenerated)
-                                {
-                                    recvdAddAttMsg->updateSourceAttributes("SerialBridge", std::to_string(m_entityId), std::to_string(m_networkId));
-                                }
-                                sendSerializedLmcpObjectMessage(std::move(recvdAddAttMsg));
-                            }
-                            else
+                            if(m_isConsideredSelfGenerated)
                             {
-                                UXAS_LOG_INFORM(s_typeName(), "::executeSerialReceiveProcessing ignoring non-import message with address ", recvdAddAttMsg->getAddress(), ", source entity ID ", recvdAddAttMsg->getMessageAttributesReference()->getSourceEntityId(), " and source service ID ", recvdAddAttMsg->getMessageAttributesReference()->getSourceServiceId());
+                                recvdAddAttMsg->updateSourceAttributes("SerialBridge", std::to_string(m_entityId), std::to_string(m_networkId));
                             }
+                            sendSerializedLmcpObjectMessage(std::move(recvdAddAttMsg));
                         }
                         else
                         {
-                            UXAS_LOG_WARN(s_typeName(), "::executeSerialReceiveProcessing failed to create AddressedAttributedMessage object from serial data buffer string segment");
+                            UXAS_LOG_INFORM(s_typeName(), "::executeSerialReceiveProcessing ignoring non-import message with address ", recvdAddAttMsg->getAddress(), ", source entity ID ", recvdAddAttMsg->getMessageAttributesReference()->getSourceEntityId(), " and source service ID ", recvdAddAttMsg->getMessageAttributesReference()->getSourceServiceId());
                         }
-                        recvdSerialDataSegment = m_receiveSerialDataBuffer.getNextPayloadString("");
                     }
                 }
             }
@@ -253,5 +283,27 @@ LmcpObjectNetworkSerialBridge::executeSerialReceiveProcessing()
     }
 };
 
+std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>
+LmcpObjectNetworkSerialBridge::getNextReceivedMessage()
+{
+    if (m_isBinaryFrame)
+    {
+        return (m_receiveSerialBinaryFrameBuffer.getNextMessage());
+    }
+
+    std::string recvdSerialDataSegment;
+    while (m_receiveSerialDataBuffer.getNextPayload(recvdSerialDataSegment))
+    {
+        UXAS_LOG_DEBUGGING(s_typeName(), "::getNextReceivedMessage [", m_entityIdNetworkIdUnicastString, "] processing complete object string segment retrieved from serial buffer");
+        std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdAddAttMsg = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
+        if (recvdAddAttMsg->setAddressAttributesAndPayloadFromDelimitedString(std::move(recvdSerialDataSegment)))
+        {
+            return (recvdAddAttMsg);
+        }
+        UXAS_LOG_WARN(s_typeName(), "::getNextReceivedMessage failed to create AddressedAttributedMessage object from serial data buffer string segment");
+    }
+    return (nullptr);
+};
+
 }; //namespace communications
 }; //namespace uxas
@@ -12,6 +12,7 @@
 
 #include "LmcpObjectNetworkClientBase.h"
 
+#include "BinaryFrameBuffer.h"
 #include "UxAS_SentinelSerialBuffer.h"
 
 #include "serial/serial.h"
@@ -57,6 +58,13 @@ namespace communications
  * file. The attribute: <B><I>TcpAddress<I/><B/> is used to set the address, 
  * see @ref m_ptr_ZsckTcpConnection.
  * 
+ * <li> Framing -
+ * Messages are framed with text sentinels, by default. If the configuration 
+ * file attribute: <B><I>FrameFormat<I/><B/> is set to "Binary", then compact 
+ * binary frames (see BinaryFrameBuffer) are sent and expected. Both ends of 
+ * the connection must be configured with the same frame format. Frame formats
+ * other than "Binary" and "Sentinel" fail the configuration.
+ * 
  * 
  * 
  * </ul> @n
@@ -106,6 +114,14 @@ private:
     void
     executeSerialReceiveProcessing();
 
+    /** \brief Get the next complete message received from the serial 
+     * connection (binary frame or sentinel buffer), if any.
+     * 
+     * @return message or nullptr if no complete message is buffered.
+     */
+    std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>
+    getNextReceivedMessage();
+
     std::atomic<bool> m_isTerminate{false};
 
     /** \brief External TCP processing thread.  */
@@ -131,6 +147,11 @@ private:
     uint32_t m_serialMaxBytesReadCount{1000};
 
     uxas::common::SentinelSerialBuffer m_receiveSerialDataBuffer;
+
+    /** \brief  If this is set to true, messages are sent and received as binary 
+     frames (FrameFormat="Binary") rather than text sentinel strings. Defaults to false */
+    bool m_isBinaryFrame{false};
+    uxas::communications::transport::BinaryFrameBuffer m_receiveSerialBinaryFrameBuffer;
     
     std::set<std::string> m_externalSubscriptionAddresses;
     std::set<std::string> m_nonImportForwardAddresses;
@@ -54,14 +54,18 @@ void
 LmcpObjectNetworkServer::terminate()
 {
     m_isTerminate = true;
+    m_messageHubRouter.wake();
 }
 
 bool
 LmcpObjectNetworkServer::initialize()
 {
-    m_lmcpObjectMessageReceiverPipe.initializePull(m_entityId, m_networkId);
-    m_lmcpObjectMessageSenderPipe.initializePublish("", m_entityId, m_networkId);
-    UXAS_LOG_INFORM("LmcpObjectNetworkServer initialized LMCP network pull receiver and publish sender pipes");
+    if (!m_messageHubRouter.initialize())
+    {
+        UXAS_LOG_ERROR("LmcpObjectNetworkServer failed to initialize LMCP network message hub router");
+        return (false);
+    }
+    UXAS_LOG_INFORM("LmcpObjectNetworkServer initialized LMCP network pull receiver and router sender sockets");
 
     return (true);
 };
@@ -69,28 +73,21 @@ LmcpObjectNetworkServer::initialize()
 void
 LmcpObjectNetworkServer::executeNetworkServer()
 {
+    // the hub waits on both of its sockets, so the event-driven mode needs no timeout
+    int32_t waitTime_ms = uxas::common::ConfigurationManager::getIsEventDrivenReceive()
+            ? -1 : uxas::common::ConfigurationManager::getZeroMqReceiveSocketPollWaitTime_ms();
     while (!m_isTerminate)
     {
-        // get the next LMCP object message (if any) sent to the LMCP network hub
-        std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> receivedLmcpMessage 
-                = m_lmcpObjectMessageReceiverPipe.getNextSerializedMessage();
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("LmcpObjectNetworkServer::executeNetworkServer RECEIVED serialized message");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("Address:          [", receivedLmcpMessage->getAddress(), "]");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("ContentType:      [", receivedLmcpMessage->getMessageAttributesReference()->getContentType(), "]");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("Descriptor:       [", receivedLmcpMessage->getMessageAttributesReference()->getDescriptor(), "]");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceGroup:      [", receivedLmcpMessage->getMessageAttributesReference()->getSourceGroup(), "]");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceEntityId:   [", receivedLmcpMessage->getMessageAttributesReference()->getSourceEntityId(), "]");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("SourceServiceId:  [", receivedLmcpMessage->getMessageAttributesReference()->getSourceServiceId(), "]");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("AttributesString: [", receivedLmcpMessage->getMessageAttributesReference()->getString(), "]");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("getPayload:       [", receivedLmcpMessage->getPayload(), "]");
-        UXAS_LOG_DEBUG_VERBOSE_MESSAGING("getString:        [", receivedLmcpMessage->getString(), "]");
-
-        if (receivedLmcpMessage)
+        try
+        {
+            m_messageHubRouter.routeReadyMessages(waitTime_ms);
+        }
+        catch (std::exception& ex)
         {
-            m_lmcpObjectMessageSenderPipe.sendSerializedMessage(std::move(receivedLmcpMessage));
-            UXAS_LOG_DEBUG_VERBOSE_MESSAGING("LmcpObjectNetworkServer::executeNetworkServer SENT serialized message");
+            UXAS_LOG_ERROR("LmcpObjectNetworkServer::executeNetworkServer continuing after EXCEPTION: ", ex.what());
         }
     }
+    m_messageHubRouter.logRouteCounters();
     UXAS_LOG_INFORM("LmcpObjectNetworkServer::executeSerializedNetworkClient exiting infinite loop thread [", std::this_thread::get_id(), "]");
 };
 
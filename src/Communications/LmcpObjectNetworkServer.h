@@ -10,9 +10,7 @@
 #ifndef UXAS_MESSAGE_LMCP_OBJECT_NETWORK_SERVER_H
 #define UXAS_MESSAGE_LMCP_OBJECT_NETWORK_SERVER_H
 
-#include "AddressedAttributedMessage.h"
-#include "LmcpObjectMessageReceiverPipe.h"
-#include "LmcpObjectMessageSenderPipe.h"
+#include "ZeroMqMessageHubRouter.h"
 
 #include <atomic>
 #include <memory>
@@ -46,10 +44,12 @@ namespace communications
  * component.
  * 
  * <li> LMCP messaging -
- * The component subscribes to desired messages from the CommunicationHub's
- * ZeroMQ PUB socket and sends messages to the hub using a ZeroMQ PUSH socket.
+ * The component subscribes to desired messages through the hub's ZeroMQ 
+ * ROUTER socket and sends messages to the hub using a ZeroMQ PUSH socket.
  * Each message a component publishes also includes sending service
- * ID and entity ID.
+ * ID and entity ID. The hub keeps a subscription index per component and 
+ * sends each message only to its subscribers, excluding the sender (see 
+ * <B><i>ZeroMqMessageHubRouter</i></B>).
  * </ul>
  * 
  * 
@@ -114,13 +114,9 @@ private:
     /** \brief Pointer to the component's thread.  */
     std::unique_ptr<std::thread> m_thread;
 
-protected:
-
-    uxas::communications::LmcpObjectMessageReceiverPipe m_lmcpObjectMessageReceiverPipe;
-
-    uxas::communications::LmcpObjectMessageSenderPipe m_lmcpObjectMessageSenderPipe;
+    /** \brief Routes messages from network clients to subscribing network clients.  */
+    uxas::communications::transport::ZeroMqMessageHubRouter m_messageHubRouter;
     
-private:
 
     std::atomic<bool> m_isTerminate{false};
 
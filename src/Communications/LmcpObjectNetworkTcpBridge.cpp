@@ -82,6 +82,29 @@ LmcpObjectNetworkTcpBridge::configure(const pugi::xml_node& bridgeXmlNode)
             UXAS_LOG_INFORM(s_typeName(), "::configure did not find 'ConsiderSelfGenerated' boolean in XML configuration; 'ConsiderSelfGenerated' boolean is ", m_isConsideredSelfGenerated);
         }
     }
+
+    if (isSuccess)
+    {
+        if (!bridgeXmlNode.attribute(uxas::common::StringConstant::FrameFormat().c_str()).empty())
+        {
+            std::string frameFormat = bridgeXmlNode.attribute(uxas::common::StringConstant::FrameFormat().c_str()).value();
+            if (frameFormat == uxas::common::StringConstant::BinaryFormat() || frameFormat == uxas::common::StringConstant::SentinelFormat())
+            {
+                m_isBinaryFrame = (frameFormat == uxas::common::StringConstant::BinaryFormat());
+                UXAS_LOG_INFORM(s_typeName(), "::configure setting frame format to ", frameFormat, " from XML configuration");
+            }
+            else
+            {
+                isSuccess = false;
+                UXAS_LOG_ERROR(s_typeName(), "::configure unknown frame format ", frameFormat, " in XML configuration; expected ",
+                               uxas::common::StringConstant::BinaryFormat(), " or ", uxas::common::StringConstant::SentinelFormat());
+            }
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::configure did not find frame format in XML configuration; binary frame boolean is ", m_isBinaryFrame);
+        }
+    }
     
     if (isSuccess)
     {
@@ -129,7 +152,7 @@ bool
 LmcpObjectNetworkTcpBridge::initialize()
 {
     UXAS_LOG_INFORM(s_typeName(), "::initialize - START");
-    m_externalLmcpObjectMessageTcpReceiverSenderPipe.initializeStream(m_entityId, m_networkId, m_tcpReceiveSendAddress, m_isServer);
+    m_externalLmcpObjectMessageTcpReceiverSenderPipe.initializeStream(m_entityId, m_networkId, m_tcpReceiveSendAddress, m_isServer, m_isBinaryFrame);
     UXAS_LOG_INFORM(s_typeName(), "::initialize succeeded");
     return (true);
 };
@@ -170,13 +193,13 @@ LmcpObjectNetworkTcpBridge::processReceivedSerializedLmcpMessage(std::unique_ptr
     UXAS_LOG_DEBUG_VERBOSE_BRIDGE("SourceEntityId:   [", receivedLmcpMessage->getMessageAttributesReference()->getSourceEntityId(), "]");
     UXAS_LOG_DEBUG_VERBOSE_BRIDGE("SourceServiceId:  [", receivedLmcpMessage->getMessageAttributesReference()->getSourceServiceId(), "]");
     UXAS_LOG_DEBUG_VERBOSE_BRIDGE("AttributesString: [", receivedLmcpMessage->getMessageAttributesReference()->getString(), "]");
-    UXAS_LOG_DEBUG_VERBOSE_BRIDGE("getPayload:       [", receivedLmcpMessage->getPayload(), "]");
+    UXAS_LOG_DEBUG_VERBOSE_BRIDGE("getPayload:       [", receivedLmcpMessage->getPayloadView(), "]");
     UXAS_LOG_DEBUG_VERBOSE_BRIDGE("getString:        [", receivedLmcpMessage->getString(), "]");
 
     // send message to the external entity
     UXAS_LOG_DEBUGGING(s_typeName(), "::processReceivedSerializedLmcpMessage [", m_entityIdNetworkIdUnicastString, 
             "] before processing serialized message having address ", receivedLmcpMessage->getAddress(),
-                  " and size ", receivedLmcpMessage->getPayload().size());
+                  " and size ", receivedLmcpMessage->getPayloadView().size());
 
     if (m_nonExportForwardAddresses.find(receivedLmcpMessage->getAddress()) == m_nonExportForwardAddresses.end())
     {
@@ -217,7 +240,7 @@ LmcpObjectNetworkTcpBridge::executeTcpReceiveProcessing()
             UXAS_LOG_DEBUG_VERBOSE_BRIDGE("SourceEntityId:   [", receivedTcpMessage->getMessageAttributesReference()->getSourceEntityId(), "]");
             UXAS_LOG_DEBUG_VERBOSE_BRIDGE("SourceServiceId:  [", receivedTcpMessage->getMessageAttributesReference()->getSourceServiceId(), "]");
             UXAS_LOG_DEBUG_VERBOSE_BRIDGE("AttributesString: [", receivedTcpMessage->getMessageAttributesReference()->getString(), "]");
-            UXAS_LOG_DEBUG_VERBOSE_BRIDGE("getPayload:       [", receivedTcpMessage->getPayload(), "]");
+            UXAS_LOG_DEBUG_VERBOSE_BRIDGE("getPayload:       [", receivedTcpMessage->getPayloadView(), "]");
             UXAS_LOG_DEBUG_VERBOSE_BRIDGE("getString:        [", receivedTcpMessage->getString(), "]");
 
             if (receivedTcpMessage)
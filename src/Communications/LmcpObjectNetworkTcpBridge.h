@@ -66,6 +66,13 @@ namespace communications
  * file. The attribute: <B><I>TcpAddress<I/><B/> is used to set the address, 
  * see @ref m_ptr_ZsckTcpConnection.
  * 
+ * <li> Framing -
+ * Messages are framed with text sentinels, by default. If the configuration 
+ * file attribute: <B><I>FrameFormat<I/><B/> is set to "Binary", then compact 
+ * binary frames (see BinaryFrameBuffer) are sent and expected. Both ends of 
+ * the connection must be configured with the same frame format. Frame formats
+ * other than "Binary" and "Sentinel" fail the configuration.
+ * 
  * 
  * 
  * </ul> @n
@@ -136,6 +143,9 @@ private:
     /** \brief  If this is set to true the TcpBridge connects (binds) as a server. 
      If it is false the TcpBridge connects as a client. Defaults to true */
     bool m_isServer{true};
+    /** \brief  If this is set to true, messages are sent and received as binary 
+     frames (FrameFormat="Binary") rather than text sentinel strings. Defaults to false */
+    bool m_isBinaryFrame{false};
     /** \brief  If this is set to `true`, the TcpBridge service will report all received
      * messages as if they originated from the vehicle hosting the TcpBridge rather
      * than the external sender. This can be used when connected directly to a vehicle 
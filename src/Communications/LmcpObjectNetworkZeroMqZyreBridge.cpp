@@ -216,7 +216,7 @@ LmcpObjectNetworkZeroMqZyreBridge::processReceivedSerializedLmcpMessage(std::uni
     // send message to the external entity
     UXAS_LOG_INFORM_ASSIGNMENT(s_typeName(), "::processReceivedSerializedLmcpMessage [", m_entityIdNetworkIdUnicastString, 
             "] before processing serialized message having address ", receivedLmcpMessage->getAddress(),
-                  " and size ", receivedLmcpMessage->getPayload().size());
+                  " and size ", receivedLmcpMessage->getPayloadView().size());
 
     // process messages from a local service (only)
     if (m_entityIdString == receivedLmcpMessage->getMessageAttributesReference()->getSourceEntityId())
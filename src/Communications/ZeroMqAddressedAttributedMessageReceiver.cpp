@@ -9,6 +9,8 @@
 
 #include "ZeroMqAddressedAttributedMessageReceiver.h"
 
+#include "ZeroMqReceivePoller.h"
+
 #include "UxAS_ConfigurationManager.h"
 #include "UxAS_Time.h"
 
@@ -25,6 +27,62 @@ namespace communications
 namespace transport
 {
 
+ZeroMqAddressedAttributedMessageReceiver::~ZeroMqAddressedAttributedMessageReceiver()
+{
+    if (m_pollerRegistrationId > 0)
+    {
+        ZeroMqReceivePoller::getInstance().unregisterSocket(m_pollerRegistrationId);
+    }
+};
+
+void
+ZeroMqAddressedAttributedMessageReceiver::enableEventDrivenReceive()
+{
+    if (m_zmqSocket && m_pollerRegistrationId == 0)
+    {
+        m_pollerRegistrationId = ZeroMqReceivePoller::getInstance().registerSocket(*m_zmqSocket, [this]()
+        {
+            std::lock_guard<std::mutex> lock(m_readableMutex);
+            m_isReadable = true;
+            m_readableCondition.notify_one();
+        });
+    }
+};
+
+void
+ZeroMqAddressedAttributedMessageReceiver::wake()
+{
+    std::lock_guard<std::mutex> lock(m_readableMutex);
+    m_isWakeRequested = true;
+    m_readableCondition.notify_one();
+};
+
+bool
+ZeroMqAddressedAttributedMessageReceiver::waitUntilReadable()
+{
+    std::unique_lock<std::mutex> lock(m_readableMutex);
+    m_isReadable = false;
+    if (!m_isWakeRequested)
+    {
+        // the poller owns the socket until the readable handler is invoked
+        ZeroMqReceivePoller::getInstance().armSocket(m_pollerRegistrationId);
+        // the receive socket poll wait time bounds the wait in case a readable notification is missed
+        m_readableCondition.wait_for(lock, std::chrono::milliseconds(uxas::common::ConfigurationManager::getZeroMqReceiveSocketPollWaitTime_ms()),
+                                     [this]() { return (m_isReadable || m_isWakeRequested); });
+        if (!m_isReadable)
+        {
+            // woken or timed out - reclaim the socket from the poller before using it again
+            lock.unlock();
+            ZeroMqReceivePoller::getInstance().unregisterSocket(m_pollerRegistrationId);
+            m_pollerRegistrationId = 0;
+            enableEventDrivenReceive();
+            lock.lock();
+        }
+    }
+    m_isWakeRequested = false;
+    return (m_isReadable);
+};
+
 std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>
 ZeroMqAddressedAttributedMessageReceiver::getNextMessage()
 {
@@ -54,117 +112,171 @@ ZeroMqAddressedAttributedMessageReceiver::getNextMessage()
         // immediately. If the value of timeout is -1, zmq_poll() shall block 
         // indefinitely until a requested event has occurred on at least one 
         // zmq_pollitem_t. The resolution of timeout is 1 millisecond.
-        zmq::poll(&pollItems[0], 1, uxas::common::ConfigurationManager::getZeroMqReceiveSocketPollWaitTime_ms()); // wait time units are milliseconds
+        // event-driven receivers only check the socket here; waiting is delegated to the process-wide poller
+        zmq::poll(&pollItems[0], 1, (m_pollerRegistrationId > 0 ? 0 : uxas::common::ConfigurationManager::getZeroMqReceiveSocketPollWaitTime_ms())); // wait time units are milliseconds
+        if (m_pollerRegistrationId > 0 && !(pollItems[0].revents & ZMQ_POLLIN) && waitUntilReadable())
+        {
+            zmq::poll(&pollItems[0], 1, 0);
+        }
         if (pollItems[0].revents & ZMQ_POLLIN)
         {
-            if (m_isTcpStream) // only used for bridging to other entities
+            receiveReadySocketMessages();
+        }
+    } //if(m_zmqSocket)
+
+    if(!m_recvdMsgs.empty())
+    {
+        nextMsg = std::move(m_recvdMsgs[0]);
+        m_recvdMsgs.pop_front();
+    }
+    return (nextMsg);
+};
+
+size_t
+ZeroMqAddressedAttributedMessageReceiver::getNextMessages(std::vector< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> >& messages, size_t maximumMessageCount)
+{
+    if (maximumMessageCount == 0)
+    {
+        return (0);
+    }
+
+    // the first message is received as usual (i.e., may wait)
+    std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> nextMsg = getNextMessage();
+    if (!nextMsg)
+    {
+        return (0);
+    }
+    messages.push_back(std::move(nextMsg));
+    size_t messageCount{1};
+
+    // then drain whatever else is ready without polling
+    while (messageCount < maximumMessageCount)
+    {
+        if (m_recvdMsgs.empty())
+        {
+            if (!isSocketReadable())
+            {
+                break;
+            }
+            receiveReadySocketMessages();
+            continue;
+        }
+        messages.push_back(std::move(m_recvdMsgs[0]));
+        m_recvdMsgs.pop_front();
+        messageCount++;
+    }
+    return (messageCount);
+};
+
+bool
+ZeroMqAddressedAttributedMessageReceiver::isSocketReadable()
+{
+    int events{0};
+    size_t eventsSize = sizeof(events);
+    m_zmqSocket->getsockopt(ZMQ_EVENTS, &events, &eventsSize);
+    return ((events & ZMQ_POLLIN) != 0);
+};
+
+void
+ZeroMqAddressedAttributedMessageReceiver::receiveReadySocketMessages()
+{
+    if (m_isTcpStream) // only used for bridging to other entities
+    {
+        try
+        {
+            while (true)
             {
-                try
+                // single-part AddressedAttributedMessage)
+                UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage BEFORE TCP zframe_recv");
+                zframe_t* frameData = zframe_recv(*m_zmqSocket);
+                UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage BEFORE TCP zframe_data");
+                byte* payloadData = zframe_data(frameData);
+                UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage BEFORE TCP zframe_size");
+                size_t payloadSize = zframe_size(frameData);
+
+                UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage BEFORE TCP appendData of ", payloadSize, " bytes");
+                m_receiveTcpDataBuffer.appendData(payloadData, payloadSize);
+                std::string recvdTcpDataSegment;
+                while (m_receiveTcpDataBuffer.getNextPayload(recvdTcpDataSegment))
                 {
-                    while (true)
+                    UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage processing complete object string segment");
+                    std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdTcpAddAttMsg
+                            = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
+                    if (recvdTcpAddAttMsg->setAddressAttributesAndPayloadFromDelimitedString(std::move(recvdTcpDataSegment)))
+                    {
+                        m_recvdMsgs.push_back( std::move(recvdTcpAddAttMsg) );
+                    }
+                    else
                     {
-                        // single-part AddressedAttributedMessage)
-                        UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage BEFORE TCP zframe_recv");
-                        zframe_t* frameData = zframe_recv(*m_zmqSocket);
-                        UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage BEFORE TCP zframe_data");
-                        byte* payloadData = zframe_data(frameData);
-                        UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage BEFORE TCP zframe_size");
-                        size_t payloadSize = zframe_size(frameData);
-
-                        UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage BEFORE TCP framePayload");
-                        std::string framePayload(reinterpret_cast<const char*> (payloadData), payloadSize);
-                        UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage TCP framePayload is: [", framePayload, "]");
-                        std::string recvdTcpDataSegment = m_receiveTcpDataBuffer.getNextPayloadString(framePayload);
-                        while (!recvdTcpDataSegment.empty())
-                        {
-                            UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage processing complete object string segment");
-                            std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdTcpAddAttMsg
-                                    = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
-                            if (recvdTcpAddAttMsg->setAddressAttributesAndPayloadFromDelimitedString(std::move(recvdTcpDataSegment)))
-                            {
-                                m_recvdMsgs.push_back( std::move(recvdTcpAddAttMsg) );
-                            }
-                            else
-                            {
-                                UXAS_LOG_WARN("ZeroMqAddressedAttributedMessageReceiver::getNextMessage failed to create AddressedAttributedMessage object from TCP stream serial buffer string segment");
-                            }
-                            recvdTcpDataSegment = m_receiveTcpDataBuffer.getNextPayloadString("");
-                        }
-                        UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage BEFORE zframe_destroy");
-                        zframe_destroy(&frameData);
-                        if (nextMsg || uxas::common::ConfigurationManager::getZeroMqReceiveSocketPollWaitTime_ms() > -1)
-                        {
-                            break;
-                        }
+                        UXAS_LOG_WARN("ZeroMqAddressedAttributedMessageReceiver::getNextMessage failed to create AddressedAttributedMessage object from TCP stream serial buffer string segment");
                     }
                 }
-                catch (std::exception& ex)
+                UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage BEFORE zframe_destroy");
+                zframe_destroy(&frameData);
+                if (!m_recvdMsgs.empty() || uxas::common::ConfigurationManager::getZeroMqReceiveSocketPollWaitTime_ms() > -1)
+                {
+                    break;
+                }
+            }
+        }
+        catch (std::exception& ex)
+        {
+            UXAS_LOG_ERROR("ZeroMqAddressedAttributedMessageReceiver::getNextMessage EXCEPTION: ", ex.what());
+        }
+    }
+    else
+    {
+        // not a stream, so should only be a single message
+        if (uxas::common::ConfigurationManager::getIsZeroMqMultipartMessage())
+        {
+            std::string address = n_ZMQ::s_recv(*m_zmqSocket);
+            std::string contentType = n_ZMQ::s_recv(*m_zmqSocket);
+            std::string descriptor = n_ZMQ::s_recv(*m_zmqSocket);
+            std::string sourceGroup = n_ZMQ::s_recv(*m_zmqSocket);
+            std::string sourceEntityId = n_ZMQ::s_recv(*m_zmqSocket);
+            std::string sourceServiceId = n_ZMQ::s_recv(*m_zmqSocket);
+            std::string payload = n_ZMQ::s_recv(*m_zmqSocket);
+            if (m_entityIdString != sourceEntityId || m_serviceIdString != sourceServiceId)
+            {
+                std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdMultipartAddAttMsg
+                        = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
+                if (recvdMultipartAddAttMsg->setAddressAttributesAndPayload(std::move(address), std::move(contentType), std::move(descriptor), std::move(sourceGroup),
+                                                                            std::move(sourceEntityId), std::move(sourceServiceId), std::move(payload)))
+                {
+                    m_recvdMsgs.push_back( std::move(recvdMultipartAddAttMsg) );
+                }
+                else
                 {
-                    UXAS_LOG_ERROR("ZeroMqAddressedAttributedMessageReceiver::getNextMessage EXCEPTION: ", ex.what());
+                    UXAS_LOG_WARN("ZeroMqAddressedAttributedMessageReceiver::getNextMessage failed to create AddressedAttributedMessage object from Zero MQ multi-part message");
                 }
             }
             else
             {
-                // not a stream, so should only be a single message
-                if (uxas::common::ConfigurationManager::getIsZeroMqMultipartMessage())
+                UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage ignoring ", descriptor, " message with entity ID ", m_entityIdString, " and service ID ", m_serviceIdString, " since it matches its own entity ID");
+            }
+        }
+        else
+        {
+            std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdSinglepartAddAttMsg
+                    = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
+            if (recvdSinglepartAddAttMsg->setAddressAttributesAndPayloadFromDelimitedString(n_ZMQ::s_recv(*m_zmqSocket)))
+            {
+                if (m_entityIdString != recvdSinglepartAddAttMsg->getMessageAttributesReference()->getSourceEntityId()
+                        || m_serviceIdString != recvdSinglepartAddAttMsg->getMessageAttributesReference()->getSourceServiceId())
                 {
-                    std::string address = n_ZMQ::s_recv(*m_zmqSocket);
-                    std::string contentType = n_ZMQ::s_recv(*m_zmqSocket);
-                    std::string descriptor = n_ZMQ::s_recv(*m_zmqSocket);
-                    std::string sourceGroup = n_ZMQ::s_recv(*m_zmqSocket);
-                    std::string sourceEntityId = n_ZMQ::s_recv(*m_zmqSocket);
-                    std::string sourceServiceId = n_ZMQ::s_recv(*m_zmqSocket);
-                    std::string payload = n_ZMQ::s_recv(*m_zmqSocket);
-                    if (m_entityIdString != sourceEntityId || m_serviceIdString != sourceServiceId)
-                    {
-                        std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdMultipartAddAttMsg
-                                = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
-                        if (recvdMultipartAddAttMsg->setAddressAttributesAndPayload(std::move(address), std::move(contentType), std::move(descriptor), std::move(sourceGroup),
-                                                                                    std::move(sourceEntityId), std::move(sourceServiceId), std::move(payload)))
-                        {
-                            m_recvdMsgs.push_back( std::move(recvdMultipartAddAttMsg) );
-                        }
-                        else
-                        {
-                            UXAS_LOG_WARN("ZeroMqAddressedAttributedMessageReceiver::getNextMessage failed to create AddressedAttributedMessage object from Zero MQ multi-part message");
-                        }
-                    }
-                    else
-                    {
-                        UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage ignoring ", descriptor, " message with entity ID ", m_entityIdString, " and service ID ", m_serviceIdString, " since it matches its own entity ID");
-                    }
+                    m_recvdMsgs.push_back( std::move(recvdSinglepartAddAttMsg) );
                 }
                 else
                 {
-                    std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdSinglepartAddAttMsg
-                            = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
-                    if (recvdSinglepartAddAttMsg->setAddressAttributesAndPayloadFromDelimitedString(n_ZMQ::s_recv(*m_zmqSocket)))
-                    {
-                        if (m_entityIdString != recvdSinglepartAddAttMsg->getMessageAttributesReference()->getSourceEntityId()
-                                || m_serviceIdString != recvdSinglepartAddAttMsg->getMessageAttributesReference()->getSourceServiceId())
-                        {
-                            m_recvdMsgs.push_back( std::move(recvdSinglepartAddAttMsg) );
-                        }
-                        else
-                        {
-                            UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage ignoring ", recvdSinglepartAddAttMsg->getMessageAttributesReference()->getDescriptor(), " message with entity ID ", m_entityIdString, " and service ID ", m_serviceIdString, " since it matches its own entity ID");
-                        }
-                    }
-                    else
-                    {
-                        UXAS_LOG_WARN("ZeroMqAddressedAttributedMessageReceiver::getNextMessage failed to create AddressedAttributedMessage object from Zero MQ single-part message");
-                    }
+                    UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageReceiver::getNextMessage ignoring ", recvdSinglepartAddAttMsg->getMessageAttributesReference()->getDescriptor(), " message with entity ID ", m_entityIdString, " and service ID ", m_serviceIdString, " since it matches its own entity ID");
                 }
             }
+            else
+            {
+                UXAS_LOG_WARN("ZeroMqAddressedAttributedMessageReceiver::getNextMessage failed to create AddressedAttributedMessage object from Zero MQ single-part message");
+            }
         }
-    } //if(m_zmqSocket)
-
-    if(!m_recvdMsgs.empty())
-    {
-        nextMsg = std::move(m_recvdMsgs[0]);
-        m_recvdMsgs.pop_front();
     }
-    return (nextMsg);
 };
 
 }; //namespace transport
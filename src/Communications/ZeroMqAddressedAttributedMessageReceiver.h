@@ -10,7 +10,10 @@
 #ifndef UXAS_MESSAGE_TRANSPORT_ZERO_MQ_ADDRESSED_ATTRIBUTED_MESSAGE_RECEIVER_H
 #define UXAS_MESSAGE_TRANSPORT_ZERO_MQ_ADDRESSED_ATTRIBUTED_MESSAGE_RECEIVER_H
 
+#include <condition_variable>
 #include <deque>
+#include <mutex>
+#include <vector>
 #include "ZeroMqReceiverBase.h"
 
 #include "AddressedAttributedMessage.h"
@@ -50,7 +53,7 @@ public:
     ZeroMqAddressedAttributedMessageReceiver(bool isTcpStream = false)
     : ZeroMqReceiverBase(), m_isTcpStream(isTcpStream) { };
     
-    ~ZeroMqAddressedAttributedMessageReceiver() { };
+    ~ZeroMqAddressedAttributedMessageReceiver();
 
 private:
 
@@ -83,14 +86,59 @@ public:
      */
     std::unique_ptr<uxas::communications::data::AddressedAttributedMessage>
     getNextMessage();
+
+    /** \brief Get the next AddressedAttributedMessage (waiting as 
+     * <B><i>getNextMessage</i></B> does), then drain further messages that 
+     * are already queued on the socket without polling.
+     * 
+     * @param messages container that received messages are appended to.
+     * @param maximumMessageCount maximum number of messages to append.
+     * @return number of messages appended.
+     */
+    size_t
+    getNextMessages(std::vector< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> >& messages, size_t maximumMessageCount);
+
+    /** \brief Register the socket with the process-wide 
+     * <B><i>ZeroMqReceivePoller</i></B>. Afterwards, <B><i>getNextMessage</i></B> 
+     * waits (without timeout) until a message is ready or <B><i>wake</i></B> 
+     * is invoked, instead of polling with the configured wait time.
+     */
+    void
+    enableEventDrivenReceive();
+
+    /** \brief Return a waiting <B><i>getNextMessage</i></B> call (any thread). */
+    void
+    wake();
     
 private:
 
+    /** \brief Non-blocking check (Zero MQ socket events) for a ready message */
+    bool
+    isSocketReadable();
+
+    /** \brief Receive the ready socket message(s) into the received message queue */
+    void
+    receiveReadySocketMessages();
+
+    /** \brief Arm the socket with the poller and wait for it to become readable.
+     * 
+     * @return true if the socket is readable; false if woken, or the receive socket poll wait time elapsed, without a message.
+     */
+    bool
+    waitUntilReadable();
+
     bool m_isTcpStream{false};
 
     uxas::common::SentinelSerialBuffer m_receiveTcpDataBuffer;
     std::deque< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> > m_recvdMsgs;
 
+    /** \brief <B><i>ZeroMqReceivePoller</i></B> registration (zero if not event-driven) */
+    uint64_t m_pollerRegistrationId{0};
+    std::mutex m_readableMutex;
+    std::condition_variable m_readableCondition;
+    bool m_isReadable{false};
+    bool m_isWakeRequested{false};
+
 };
 
 }; //namespace transport
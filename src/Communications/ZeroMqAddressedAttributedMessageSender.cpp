@@ -70,7 +70,7 @@ ZeroMqAddressedAttributedMessageSender::sendMessage(const std::string& address,
                     n_ZMQ::s_sendmore(*m_zmqSocket, message.getMessageAttributesReference()->getSourceServiceId());
 
                     // message payload)
-                    n_ZMQ::s_send(*m_zmqSocket, message.getPayload());
+                    zmq_send(*m_zmqSocket, message.getPayloadView().data(), message.getPayloadView().size(), 0);
                     UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageSender::sendMessage AFTER sending multi-part message");
                 }
                 else
@@ -151,7 +151,7 @@ ZeroMqAddressedAttributedMessageSender::sendAddressedAttributedMessage(std::uniq
                     n_ZMQ::s_sendmore(*m_zmqSocket, message->getMessageAttributesReference()->getSourceServiceId());
 
                     // message payload)
-                    n_ZMQ::s_send(*m_zmqSocket, message->getPayload());
+                    zmq_send(*m_zmqSocket, message->getPayloadView().data(), message->getPayloadView().size(), 0);
                     UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageSender::sendAddressedAttributedMessage AFTER sending multi-part message");
                 }
                 else
@@ -164,7 +164,6 @@ ZeroMqAddressedAttributedMessageSender::sendAddressedAttributedMessage(std::uniq
                 if (message->isValid())
                 {
                     UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageSender::sendAddressedAttributedMessage BEFORE sending single-part message");
-                    std::string msg = message->getString();
                     n_ZMQ::s_send(*m_zmqSocket, message->getString());
                     UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageSender::sendAddressedAttributedMessage AFTER sending single-part message");
                 }
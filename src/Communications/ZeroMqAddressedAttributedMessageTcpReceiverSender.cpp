@@ -172,24 +172,35 @@ ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage()
                 zframe_destroy(&identityFrame);
 
 
-            UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage BEFORE TCP framePayload");
-            std::string framePayload(reinterpret_cast<const char*> (payloadData), payloadSize);
-            UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage TCP framePayload is: [", framePayload, "]");
-            std::string recvdTcpDataSegment = m_receiveTcpDataBuffer.getNextPayloadString(framePayload);
-            while (!recvdTcpDataSegment.empty())
+            UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage BEFORE TCP appendData of ", payloadSize, " bytes");
+            if (m_isBinaryFrame)
             {
-                UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage processing complete object string segment");
-                std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdTcpAddAttMsg
-                        = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
-                if (recvdTcpAddAttMsg->setAddressAttributesAndPayloadFromDelimitedString(std::move(recvdTcpDataSegment)))
+                m_receiveTcpBinaryFrameBuffer.appendData(payloadData, payloadSize);
+                std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdTcpAddAttMsg = m_receiveTcpBinaryFrameBuffer.getNextMessage();
+                while (recvdTcpAddAttMsg)
                 {
                     m_recvdMsgs.push_back( std::move(recvdTcpAddAttMsg) );
+                    recvdTcpAddAttMsg = m_receiveTcpBinaryFrameBuffer.getNextMessage();
                 }
-                else
+            }
+            else
+            {
+                m_receiveTcpDataBuffer.appendData(payloadData, payloadSize);
+                std::string recvdTcpDataSegment;
+                while (m_receiveTcpDataBuffer.getNextPayload(recvdTcpDataSegment))
                 {
-                    UXAS_LOG_WARN("ZeroMqAddressedAttributedMessageReceiver::getNextMessage failed to create AddressedAttributedMessage object from TCP stream serial buffer string segment");
+                    UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage processing complete object string segment");
+                    std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> recvdTcpAddAttMsg
+                            = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
+                    if (recvdTcpAddAttMsg->setAddressAttributesAndPayloadFromDelimitedString(std::move(recvdTcpDataSegment)))
+                    {
+                        m_recvdMsgs.push_back( std::move(recvdTcpAddAttMsg) );
+                    }
+                    else
+                    {
+                        UXAS_LOG_WARN("ZeroMqAddressedAttributedMessageReceiver::getNextMessage failed to create AddressedAttributedMessage object from TCP stream serial buffer string segment");
+                    }
                 }
-                recvdTcpDataSegment = m_receiveTcpDataBuffer.getNextPayloadString("");
             }
             UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::getNextMessage BEFORE zframe_destroy");
             zframe_destroy(&frameData);
@@ -227,7 +238,8 @@ ZeroMqAddressedAttributedMessageTcpReceiverSender::sendAddressedAttributedMessag
     std::lock_guard<std::mutex> lock(m_data_guard);
     if (m_zmqSocket)
     {
-        std::string sentinelStr = uxas::common::SentinelSerialBuffer::createSentinelizedString(message->getString());
+        std::string framedStr = m_isBinaryFrame ? BinaryFrameBuffer::createFrame(*message)
+                : uxas::common::SentinelSerialBuffer::createSentinelizedString(message->getString());
 
         if(m_zeroMqSocketConfiguration.m_isServerBind)
         {
@@ -237,7 +249,7 @@ ZeroMqAddressedAttributedMessageTcpReceiverSender::sendAddressedAttributedMessag
                 // first part of message must be client identity
                 zmq_send(*m_zmqSocket, zframe_data(c), zframe_size(c), ZMQ_SNDMORE);
                 UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::sendAddressedAttributedMessage BEFORE sending TCP stream single-part message");
-                zmq_send(*m_zmqSocket, sentinelStr.c_str(), sentinelStr.size(), 0);
+                zmq_send(*m_zmqSocket, framedStr.c_str(), framedStr.size(), 0);
                 UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::sendAddressedAttributedMessage AFTER sending TCP stream single-part message");
             }
         }
@@ -249,7 +261,7 @@ ZeroMqAddressedAttributedMessageTcpReceiverSender::sendAddressedAttributedMessag
 
             zmq_send(*m_zmqSocket, serverid, serveridsize, ZMQ_SNDMORE);
             UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::sendAddressedAttributedMessage BEFORE sending TCP stream single-part message");
-            zmq_send(*m_zmqSocket, sentinelStr.c_str(), sentinelStr.size(), 0);
+            zmq_send(*m_zmqSocket, framedStr.c_str(), framedStr.size(), 0);
             UXAS_LOG_DEBUG_VERBOSE("ZeroMqAddressedAttributedMessageTcpReceiverSender::sendAddressedAttributedMessage AFTER sending TCP stream single-part message");
         }
     }
@@ -16,6 +16,7 @@
 #include "czmq.h"
 #include "ZeroMqReceiverBase.h"
 #include "AddressedAttributedMessage.h"
+#include "BinaryFrameBuffer.h"
 #include "UxAS_SentinelSerialBuffer.h"
 
 namespace uxas
@@ -29,7 +30,9 @@ namespace transport
  * 
  * \par Description:
  * <B><i>ZeroMqAddressedAttributedMessageTcpReceiverSender</i></B> receives 
- * and sends AddressedAttributedMessage data objects via a Zero MQ TCP transport
+ * and sends AddressedAttributedMessage data objects via a Zero MQ TCP transport.
+ * Messages are framed with text sentinels (default) or binary frames (see 
+ * <B><i>setIsBinaryFrame</i></B>).
  * 
  * \par Threading:
  * <B><i>ZeroMqAddressedAttributedMessageTcpReceiverSender</i></B> is not designed for multi-threaded use.  
@@ -72,9 +75,18 @@ public:
     void
     sendAddressedAttributedMessage(std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> message);
 
+    /** \brief Select binary framing (<B><i>BinaryFrameBuffer</i></B>) instead 
+     * of text sentinel framing for sent and received messages. The peer must 
+     * use the same framing.
+     */
+    void
+    setIsBinaryFrame(bool isBinaryFrame) { m_isBinaryFrame = isBinaryFrame; };
+
 private:
 
+    bool m_isBinaryFrame{false};
     uxas::common::SentinelSerialBuffer m_receiveTcpDataBuffer;
+    BinaryFrameBuffer m_receiveTcpBinaryFrameBuffer;
     std::deque< std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> > m_recvdMsgs;
     std::string m_sourceGroup;
     
@@ -76,6 +76,11 @@ ZeroMqFabric::createSocket(ZeroMqSocketConfiguration& socketConfiguration)
     }
     
     UXAS_LOG_DEBUGGING("ZeroMqFabric::createSocket new ZMQ socket successfully created with type ", socketConfiguration.m_zmqSocketType);
+    if (!socketConfiguration.m_identity.empty())
+    {
+        UXAS_LOG_DEBUGGING("ZeroMqFabric::createSocket setting socket identity to ", socketConfiguration.m_identity);
+        zmqSocket->setsockopt(ZMQ_IDENTITY, socketConfiguration.m_identity.data(), socketConfiguration.m_identity.size());
+    }
     if (socketConfiguration.m_isServerBind)
     {
         UXAS_LOG_DEBUGGING("ZeroMqFabric::createSocket BINDING socket to ", socketConfiguration.m_socketAddress.c_str());
@@ -0,0 +1,437 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#include "ZeroMqMessageHubRouter.h"
+
+#include "AddressedMessage.h"
+#include "TransportBase.h"
+#include "ZeroMqFabric.h"
+#include "ZeroMqSocketConfiguration.h"
+
+#include "UxAS_Log.h"
+#include "Constants/UxAS_String.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace uxas
+{
+namespace communications
+{
+namespace transport
+{
+
+namespace
+{
+
+/** \brief Find the address and source IDs of a single-part (delimited string) message:
+ * address$contentType|descriptor|sourceGroup|sourceEntityId|sourceServiceId$payload
+ */
+bool
+parseSinglePartMessage(const char* data, size_t size, size_t& addressSize,
+                       const char*& sourceEntityId, size_t& sourceEntityIdSize,
+                       const char*& sourceServiceId, size_t& sourceServiceIdSize)
+{
+    const char addressAttributesDelimiter = *(uxas::communications::data::AddressedMessage::s_addressAttributesDelimiter().c_str());
+    const char fieldDelimiter = *(uxas::communications::data::AddressedMessage::s_fieldDelimiter().c_str());
+
+    const char* addressEnd = static_cast<const char*>(std::memchr(data, addressAttributesDelimiter, size));
+    if (addressEnd == nullptr)
+    {
+        return (false);
+    }
+    addressSize = addressEnd - data;
+
+    // fields 3 and 4 (zero-based) of the attributes are the source entity and service IDs
+    const char* fieldStart = addressEnd + 1;
+    const char* end = data + size;
+    for (uint32_t fieldIndex = 0; fieldIndex < 5; fieldIndex++)
+    {
+        const char* fieldEnd = fieldStart;
+        while (fieldEnd < end && *fieldEnd != fieldDelimiter && *fieldEnd != addressAttributesDelimiter)
+        {
+            fieldEnd++;
+        }
+        if (fieldEnd == end)
+        {
+            return (false);
+        }
+        if (fieldIndex == 3)
+        {
+            sourceEntityId = fieldStart;
+            sourceEntityIdSize = fieldEnd - fieldStart;
+        }
+        else if (fieldIndex == 4)
+        {
+            sourceServiceId = fieldStart;
+            sourceServiceIdSize = fieldEnd - fieldStart;
+        }
+        fieldStart = fieldEnd + 1;
+    }
+    return (true);
+}
+
+bool
+isSourceIdentity(const std::string& identity, const char* sourceEntityId, size_t sourceEntityIdSize,
+                 const char* sourceServiceId, size_t sourceServiceIdSize)
+{
+    // identity is "<entity ID>.<service ID>"
+    return (identity.size() == sourceEntityIdSize + 1 + sourceServiceIdSize
+            && std::memcmp(identity.data(), sourceEntityId, sourceEntityIdSize) == 0
+            && identity[sourceEntityIdSize] == '.'
+            && std::memcmp(identity.data() + sourceEntityIdSize + 1, sourceServiceId, sourceServiceIdSize) == 0);
+}
+
+}
+
+ZeroMqMessageHubRouter::~ZeroMqMessageHubRouter()
+{
+    closeFrames();
+    int lingerDuration_ms(0);
+    for (auto socket : {&m_pullSocket, &m_routerSocket})
+    {
+        if (*socket)
+        {
+            (*socket)->setsockopt(ZMQ_LINGER, &lingerDuration_ms, sizeof(lingerDuration_ms));
+            (*socket)->close();
+            socket->reset();
+        }
+    }
+};
+
+bool
+ZeroMqMessageHubRouter::initialize()
+{
+    int32_t zmqhighWaterMark{100000};
+    try
+    {
+        ZeroMqSocketConfiguration pullSocketConfiguration(NETWORK_NAME::zmqLmcpNetwork(),
+                                                          uxas::common::LmcpNetworkSocketAddress::strGetInProc_ToMessageHub(),
+                                                          ZMQ_PULL, true, true, zmqhighWaterMark, zmqhighWaterMark);
+        m_pullSocket = ZeroMqFabric::getInstance().createSocket(pullSocketConfiguration);
+
+        ZeroMqSocketConfiguration routerSocketConfiguration(NETWORK_NAME::zmqLmcpNetwork(),
+                                                            uxas::common::LmcpNetworkSocketAddress::strGetInProc_FromMessageHub(),
+                                                            ZMQ_ROUTER, true, false, zmqhighWaterMark, zmqhighWaterMark);
+        m_routerSocket = ZeroMqFabric::getInstance().createSocket(routerSocketConfiguration);
+    }
+    catch (std::exception& ex)
+    {
+        UXAS_LOG_ERROR("ZeroMqMessageHubRouter::initialize, create socket EXCEPTION: ", ex.what());
+        return (false);
+    }
+    m_nextRouteCounterLogTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_routeCounterLogPeriod_ms);
+    return (m_pullSocket && m_routerSocket);
+};
+
+void
+ZeroMqMessageHubRouter::routeReadyMessages(int32_t waitTime_ms)
+{
+    zmq::pollitem_t pollItems [] = {
+        { *m_routerSocket, 0, ZMQ_POLLIN, 0},
+        { *m_pullSocket, 0, ZMQ_POLLIN, 0},
+    };
+    zmq::poll(&pollItems[0], 2, waitTime_ms);
+
+    // apply subscription changes before routing
+    if (pollItems[0].revents & ZMQ_POLLIN)
+    {
+        while (receiveFrames(*m_routerSocket))
+        {
+            processSubscriptionMessage();
+        }
+    }
+
+    if (pollItems[1].revents & ZMQ_POLLIN)
+    {
+        // bounded so that subscription changes are not delayed by a burst
+        for (uint32_t messageCount = 0; messageCount < 1024 && receiveFrames(*m_pullSocket); messageCount++)
+        {
+            routeMessage();
+        }
+    }
+
+    if (m_isRouteCounterChanged && std::chrono::steady_clock::now() >= m_nextRouteCounterLogTime)
+    {
+        logRouteCounters();
+        m_nextRouteCounterLogTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_routeCounterLogPeriod_ms);
+    }
+};
+
+void
+ZeroMqMessageHubRouter::wake()
+{
+    // an empty single-part message is ignored by the router
+    ZeroMqSocketConfiguration wakeSocketConfiguration(NETWORK_NAME::zmqLmcpNetwork(),
+                                                      uxas::common::LmcpNetworkSocketAddress::strGetInProc_ToMessageHub(),
+                                                      ZMQ_PUSH, false, false, 1, 1);
+    std::unique_ptr<zmq::socket_t> wakeSocket = ZeroMqFabric::getInstance().createSocket(wakeSocketConfiguration);
+    if (wakeSocket)
+    {
+        zmq_send(*wakeSocket, "", 0, ZMQ_DONTWAIT);
+    }
+};
+
+void
+ZeroMqMessageHubRouter::logRouteCounters()
+{
+    for (const auto& routeCounters : m_routeCounters)
+    {
+        if (routeCounters.second.m_messageCount > 0)
+        {
+            UXAS_LOG_INFORM("ZeroMqMessageHubRouter route [", routeCounters.first, "] messages ", routeCounters.second.m_messageCount,
+                            " deliveries ", routeCounters.second.m_deliveryCount,
+                            " fan-out ", static_cast<double>(routeCounters.second.m_deliveryCount) / static_cast<double>(routeCounters.second.m_messageCount),
+                            " suppressed loopbacks ", routeCounters.second.m_loopbackSuppressedCount);
+        }
+    }
+    m_isRouteCounterChanged = false;
+};
+
+void
+ZeroMqMessageHubRouter::processSubscriptionMessage()
+{
+    // [identity][control byte + subscription address]
+    if (m_frameCount != 2 || zmq_msg_size(&m_frames[1]) < 1)
+    {
+        UXAS_LOG_WARN("ZeroMqMessageHubRouter::processSubscriptionMessage ignoring invalid subscription message with ", m_frameCount, " frames");
+        return;
+    }
+    std::string identity(static_cast<const char*>(zmq_msg_data(&m_frames[0])), zmq_msg_size(&m_frames[0]));
+    const char* control = static_cast<const char*>(zmq_msg_data(&m_frames[1]));
+    std::string address(control + 1, zmq_msg_size(&m_frames[1]) - 1);
+
+    if (*control == s_subscribeControl)
+    {
+        m_subscriberIdentitiesByAddress[address].insert(identity);
+        UXAS_LOG_DEBUGGING("ZeroMqMessageHubRouter::processSubscriptionMessage [", identity, "] subscribed to [", address, "]");
+    }
+    else if (*control == s_unsubscribeControl)
+    {
+        auto subscriberIdentitiesIt = m_subscriberIdentitiesByAddress.find(address);
+        if (subscriberIdentitiesIt != m_subscriberIdentitiesByAddress.end())
+        {
+            subscriberIdentitiesIt->second.erase(identity);
+            if (subscriberIdentitiesIt->second.empty())
+            {
+                m_subscriberIdentitiesByAddress.erase(subscriberIdentitiesIt);
+            }
+        }
+        UXAS_LOG_DEBUGGING("ZeroMqMessageHubRouter::processSubscriptionMessage [", identity, "] unsubscribed from [", address, "]");
+    }
+    else if (*control == s_disconnectControl)
+    {
+        auto subscriberIdentitiesIt = m_subscriberIdentitiesByAddress.begin();
+        while (subscriberIdentitiesIt != m_subscriberIdentitiesByAddress.end())
+        {
+            subscriberIdentitiesIt->second.erase(identity);
+            if (subscriberIdentitiesIt->second.empty())
+            {
+                subscriberIdentitiesIt = m_subscriberIdentitiesByAddress.erase(subscriberIdentitiesIt);
+            }
+            else
+            {
+                subscriberIdentitiesIt++;
+            }
+        }
+        UXAS_LOG_DEBUGGING("ZeroMqMessageHubRouter::processSubscriptionMessage [", identity, "] disconnected");
+    }
+    else
+    {
+        UXAS_LOG_WARN("ZeroMqMessageHubRouter::processSubscriptionMessage ignoring unknown control [", static_cast<int32_t>(*control), "] from [", identity, "]");
+        return;
+    }
+
+    buildSubscriptionIndex();
+    for (auto& route : m_routes)
+    {
+        buildRouteSubscribers(route.first, route.second);
+    }
+};
+
+void
+ZeroMqMessageHubRouter::routeMessage()
+{
+    const char* address{nullptr};
+    size_t addressSize{0};
+    const char* sourceEntityId{nullptr};
+    size_t sourceEntityIdSize{0};
+    const char* sourceServiceId{nullptr};
+    size_t sourceServiceIdSize{0};
+
+    if (m_frameCount >= 7)
+    {
+        // multi-part: address, content type, descriptor, source group, source entity ID, source service ID, payload
+        address = static_cast<const char*>(zmq_msg_data(&m_frames[0]));
+        addressSize = zmq_msg_size(&m_frames[0]);
+        sourceEntityId = static_cast<const char*>(zmq_msg_data(&m_frames[4]));
+        sourceEntityIdSize = zmq_msg_size(&m_frames[4]);
+        sourceServiceId = static_cast<const char*>(zmq_msg_data(&m_frames[5]));
+        sourceServiceIdSize = zmq_msg_size(&m_frames[5]);
+    }
+    else if (m_frameCount == 1 && zmq_msg_size(&m_frames[0]) > 0)
+    {
+        address = static_cast<const char*>(zmq_msg_data(&m_frames[0]));
+        if (!parseSinglePartMessage(address, zmq_msg_size(&m_frames[0]), addressSize,
+                                    sourceEntityId, sourceEntityIdSize, sourceServiceId, sourceServiceIdSize))
+        {
+            UXAS_LOG_WARN("ZeroMqMessageHubRouter::routeMessage ignoring message that could not be parsed");
+            return;
+        }
+    }
+    else
+    {
+        if (m_frameCount > 1)
+        {
+            UXAS_LOG_WARN("ZeroMqMessageHubRouter::routeMessage ignoring message with ", m_frameCount, " frames");
+        }
+        return;
+    }
+
+    Route& route = getRoute(address, addressSize);
+    route.m_counters->m_messageCount++;
+    m_isRouteCounterChanged = true;
+    for (const auto& subscriberIdentity : route.m_subscriberIdentities)
+    {
+        // never send a message back to its source
+        if (isSourceIdentity(subscriberIdentity, sourceEntityId, sourceEntityIdSize, sourceServiceId, sourceServiceIdSize))
+        {
+            route.m_counters->m_loopbackSuppressedCount++;
+            continue;
+        }
+
+        zmq_send(*m_routerSocket, subscriberIdentity.data(), subscriberIdentity.size(), ZMQ_SNDMORE);
+        for (size_t frameIndex = 0; frameIndex < m_frameCount; frameIndex++)
+        {
+            // large frames are shared (reference counted), not copied
+            zmq_msg_t frame;
+            zmq_msg_init(&frame);
+            zmq_msg_copy(&frame, &m_frames[frameIndex]);
+            zmq_msg_send(&frame, *m_routerSocket, (frameIndex + 1 < m_frameCount) ? ZMQ_SNDMORE : 0);
+            zmq_msg_close(&frame);
+        }
+        route.m_counters->m_deliveryCount++;
+    }
+};
+
+bool
+ZeroMqMessageHubRouter::receiveFrames(void* socket)
+{
+    closeFrames();
+    int isMore{0};
+    do
+    {
+        zmq_msg_t* frame = &m_frames[(m_frameCount < s_maximumFrameCount) ? m_frameCount : (s_maximumFrameCount - 1)];
+        if (m_frameCount >= s_maximumFrameCount)
+        {
+            // discard frames beyond the maximum (message is ignored)
+            zmq_msg_close(frame);
+        }
+        zmq_msg_init(frame);
+        if (zmq_msg_recv(frame, socket, (m_frameCount == 0) ? ZMQ_DONTWAIT : 0) < 0)
+        {
+            zmq_msg_close(frame);
+            return (false);
+        }
+        isMore = zmq_msg_more(frame);
+        m_frameCount++;
+    }
+    while (isMore);
+
+    if (m_frameCount > s_maximumFrameCount)
+    {
+        UXAS_LOG_WARN("ZeroMqMessageHubRouter::receiveFrames ignoring message with ", m_frameCount, " frames");
+        m_frameCount = s_maximumFrameCount;
+        closeFrames();
+    }
+    return (true);
+};
+
+ZeroMqMessageHubRouter::Route&
+ZeroMqMessageHubRouter::getRoute(const char* address, size_t addressSize)
+{
+    m_routeKey.assign(address, addressSize);
+    auto routeIt = m_routes.find(m_routeKey);
+    if (routeIt == m_routes.end())
+    {
+        routeIt = m_routes.emplace(m_routeKey, Route()).first;
+        routeIt->second.m_counters = &m_routeCounters[m_routeKey];
+        buildRouteSubscribers(routeIt->first, routeIt->second);
+    }
+    return (routeIt->second);
+};
+
+void
+ZeroMqMessageHubRouter::buildRouteSubscribers(const std::string& address, Route& route)
+{
+    // consistent with Zero MQ subscriptions, a subscription address matches
+    // all message addresses that it is a prefix of. Starting from the whole
+    // address, the greatest index entry not after the searched prefix is
+    // either a matching prefix or shares its longest possible match with it.
+    route.m_subscriberIdentities.clear();
+    size_t prefixSize = address.size();
+    while (!m_subscriptionIndex.empty())
+    {
+        auto entryIt = std::upper_bound(m_subscriptionIndex.begin(), m_subscriptionIndex.end(), prefixSize,
+                                        [&address](size_t size, const std::pair<std::string, std::vector<std::string> >& entry)
+                                        { return (address.compare(0, size, entry.first) < 0); });
+        if (entryIt == m_subscriptionIndex.begin())
+        {
+            break;
+        }
+        entryIt--;
+        const std::string& subscriptionAddress = entryIt->first;
+        size_t matchSize{0};
+        while (matchSize < subscriptionAddress.size() && matchSize < prefixSize && subscriptionAddress[matchSize] == address[matchSize])
+        {
+            matchSize++;
+        }
+        if (matchSize < subscriptionAddress.size())
+        {
+            prefixSize = matchSize;
+            continue;
+        }
+        route.m_subscriberIdentities.insert(route.m_subscriberIdentities.end(), entryIt->second.begin(), entryIt->second.end());
+        if (subscriptionAddress.empty())
+        {
+            break;
+        }
+        prefixSize = subscriptionAddress.size() - 1;
+    }
+    // a network client subscribed to several matching prefixes receives the message once
+    std::sort(route.m_subscriberIdentities.begin(), route.m_subscriberIdentities.end());
+    route.m_subscriberIdentities.erase(std::unique(route.m_subscriberIdentities.begin(), route.m_subscriberIdentities.end()),
+                                       route.m_subscriberIdentities.end());
+};
+
+void
+ZeroMqMessageHubRouter::buildSubscriptionIndex()
+{
+    m_subscriptionIndex.clear();
+    for (const auto& subscriberIdentities : m_subscriberIdentitiesByAddress)
+    {
+        m_subscriptionIndex.emplace_back(subscriberIdentities.first,
+                                         std::vector<std::string>(subscriberIdentities.second.begin(), subscriberIdentities.second.end()));
+    }
+    std::sort(m_subscriptionIndex.begin(), m_subscriptionIndex.end());
+};
+
+void
+ZeroMqMessageHubRouter::closeFrames()
+{
+    for (size_t frameIndex = 0; frameIndex < m_frameCount; frameIndex++)
+    {
+        zmq_msg_close(&m_frames[frameIndex]);
+    }
+    m_frameCount = 0;
+};
+
+}; //namespace transport
+}; //namespace communications
+}; //namespace uxas
@@ -0,0 +1,176 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#ifndef UXAS_MESSAGE_TRANSPORT_ZERO_MQ_MESSAGE_HUB_ROUTER_H
+#define UXAS_MESSAGE_TRANSPORT_ZERO_MQ_MESSAGE_HUB_ROUTER_H
+
+#include "UxAS_ZeroMQ.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace uxas
+{
+namespace communications
+{
+namespace transport
+{
+
+/** \class ZeroMqMessageHubRouter
+ *
+ * \par Description:
+ * Message routing of the <b>LMCP</b> network hub. Network clients push
+ * messages to the hub (PULL socket) and receive messages from the hub
+ * through a DEALER socket whose identity is "<entity ID>.<service ID>"
+ * (ROUTER socket). Subscription changes are sent by the DEALER sockets as
+ * single-frame control messages (see <B><i>s_subscribeControl</i></B>,
+ * <B><i>s_unsubscribeControl</i></B> and <B><i>s_disconnectControl</i></B>
+ * followed by the subscription address) and are kept in a subscription index.
+ *
+ * Each received message is sent only to the network clients that subscribed
+ * to an address prefix of the message address, never back to its source
+ * network client. Message frames are forwarded as received Zero MQ messages
+ * (reference counted copies), without conversion to strings.
+ *
+ * Counters of received messages, deliveries and suppressed loopbacks are
+ * kept per message address (route).
+ *
+ * \par Threading:
+ * All methods except <B><i>wake</i></B> must be invoked by the hub thread.
+ *
+ * \n
+ */
+class ZeroMqMessageHubRouter final
+{
+public:
+
+    static const char s_subscribeControl{1};
+    static const char s_unsubscribeControl{0};
+    static const char s_disconnectControl{2};
+
+    /** \brief Per-route (message address) counters */
+    struct RouteCounters
+    {
+        /** \brief number of messages received for the route */
+        uint64_t m_messageCount{0};
+        /** \brief number of messages sent to subscribers */
+        uint64_t m_deliveryCount{0};
+        /** \brief number of deliveries back to the message source that were not sent */
+        uint64_t m_loopbackSuppressedCount{0};
+    };
+
+    ZeroMqMessageHubRouter() { };
+
+    ~ZeroMqMessageHubRouter();
+
+private:
+
+    /** \brief Copy construction not permitted */
+    ZeroMqMessageHubRouter(ZeroMqMessageHubRouter const&) = delete;
+
+    /** \brief Copy assignment operation not permitted */
+    void operator=(ZeroMqMessageHubRouter const&) = delete;
+
+public:
+
+    /** \brief Bind the hub PULL and ROUTER sockets.
+     *
+     * @return true if both sockets were created.
+     */
+    bool
+    initialize();
+
+    /** \brief Wait for (at most <B><i>waitTime_ms</i></B>, -1 implies no
+     * timeout) and process ready subscription changes and messages.
+     */
+    void
+    routeReadyMessages(int32_t waitTime_ms);
+
+    /** \brief Return a waiting <B><i>routeReadyMessages</i></B> call (any thread). */
+    void
+    wake();
+
+    /** \brief Log the route counters of all routes that have received messages. */
+    void
+    logRouteCounters();
+
+    const std::unordered_map<std::string, RouteCounters>&
+    getRouteCounters() const { return (m_routeCounters); };
+
+private:
+
+    struct Route
+    {
+        std::vector<std::string> m_subscriberIdentities;
+        RouteCounters* m_counters{nullptr};
+    };
+
+    void
+    processSubscriptionMessage();
+
+    void
+    routeMessage();
+
+    bool
+    receiveFrames(void* socket);
+
+    Route&
+    getRoute(const char* address, size_t addressSize);
+
+    void
+    buildRouteSubscribers(const std::string& address, Route& route);
+
+    /** \brief Rebuild the sorted subscription index from the subscription addresses */
+    void
+    buildSubscriptionIndex();
+
+    void
+    closeFrames();
+
+    std::unique_ptr<zmq::socket_t> m_pullSocket;
+    std::unique_ptr<zmq::socket_t> m_routerSocket;
+
+    /** \brief subscription address prefix -> subscribing network client identities */
+    std::unordered_map<std::string, std::unordered_set<std::string> > m_subscriberIdentitiesByAddress;
+
+    /** \brief subscription address prefixes and their subscriber identities, sorted by address */
+    std::vector< std::pair<std::string, std::vector<std::string> > > m_subscriptionIndex;
+
+    /** \brief message address -> subscriber identities (rebuilt when subscriptions change) */
+    std::unordered_map<std::string, Route> m_routes;
+
+    /** \brief message address -> counters (retained when subscriptions change) */
+    std::unordered_map<std::string, RouteCounters> m_routeCounters;
+
+    /** \brief maximum number of frames of a routed message (multi-part messages have seven) */
+    static const size_t s_maximumFrameCount{8};
+
+    /** \brief received frames of the current message */
+    zmq_msg_t m_frames[s_maximumFrameCount];
+    size_t m_frameCount{0};
+
+    /** \brief route look-up key (re-used to avoid per-message allocation) */
+    std::string m_routeKey;
+
+    uint32_t m_routeCounterLogPeriod_ms{60000};
+    std::chrono::steady_clock::time_point m_nextRouteCounterLogTime;
+    bool m_isRouteCounterChanged{false};
+
+};
+
+}; //namespace transport
+}; //namespace communications
+}; //namespace uxas
+
+#endif /* UXAS_MESSAGE_TRANSPORT_ZERO_MQ_MESSAGE_HUB_ROUTER_H */
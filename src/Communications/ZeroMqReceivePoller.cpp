@@ -0,0 +1,218 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#include "ZeroMqReceivePoller.h"
+
+#include "UxAS_ConfigurationManager.h"
+#include "UxAS_Log.h"
+
+#include "stdUniquePtr.h"
+
+#include <vector>
+
+#ifdef LINUX
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+namespace uxas
+{
+namespace communications
+{
+namespace transport
+{
+
+ZeroMqReceivePoller&
+ZeroMqReceivePoller::getInstance()
+{
+    // first time/one time creation, thread-safe initialization of a function-local static
+    static ZeroMqReceivePoller s_instance;
+    return s_instance;
+};
+
+ZeroMqReceivePoller::ZeroMqReceivePoller()
+{
+#ifdef LINUX
+    m_controlEventFd = eventfd(0, EFD_NONBLOCK);
+#endif
+    if (m_controlEventFd < 0)
+    {
+        UXAS_LOG_WARN("ZeroMqReceivePoller control event unavailable - bounding poll wait by the receive socket poll wait time");
+    }
+    m_thread = uxas::stduxas::make_unique<std::thread>(&ZeroMqReceivePoller::executePoller, this);
+    UXAS_LOG_INFORM("ZeroMqReceivePoller started poller thread [", m_thread->get_id(), "]");
+};
+
+ZeroMqReceivePoller::~ZeroMqReceivePoller()
+{
+    m_isTerminate = true;
+    signalControlEvent();
+    if (m_thread && m_thread->joinable())
+    {
+        m_thread->join();
+    }
+#ifdef LINUX
+    if (m_controlEventFd >= 0)
+    {
+        close(m_controlEventFd);
+    }
+#endif
+};
+
+uint64_t
+ZeroMqReceivePoller::registerSocket(zmq::socket_t& socket, std::function<void()> readableHandler)
+{
+    std::lock_guard<std::mutex> lock(m_registrationMutex);
+    uint64_t registrationId = m_nextRegistrationId++;
+    Registration& registration = m_registrations[registrationId];
+    registration.m_socket = &socket;
+    registration.m_readableHandler = std::move(readableHandler);
+    return (registrationId);
+};
+
+void
+ZeroMqReceivePoller::unregisterSocket(uint64_t registrationId)
+{
+    std::unique_lock<std::mutex> lock(m_registrationMutex);
+    auto registrationIt = m_registrations.find(registrationId);
+    if (registrationIt == m_registrations.end())
+    {
+        return;
+    }
+    m_registrations.erase(registrationIt);
+    if (std::this_thread::get_id() != m_thread->get_id())
+    {
+        // wait for the poller to finish the poll cycle (including readable 
+        // handler invocations) that may still reference the registration
+        uint64_t pollCycle = m_pollCycle;
+        signalControlEvent();
+        m_pollCycleCondition.wait_for(lock, std::chrono::milliseconds(1000), [this, pollCycle]() { return (m_pollCycle != pollCycle || m_isTerminate); });
+    }
+};
+
+void
+ZeroMqReceivePoller::armSocket(uint64_t registrationId)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_registrationMutex);
+        auto registrationIt = m_registrations.find(registrationId);
+        if (registrationIt == m_registrations.end() || registrationIt->second.m_isArmed)
+        {
+            return;
+        }
+        registrationIt->second.m_isArmed = true;
+    }
+    signalControlEvent();
+};
+
+void
+ZeroMqReceivePoller::signalControlEvent()
+{
+#ifdef LINUX
+    if (m_controlEventFd >= 0)
+    {
+        uint64_t increment{1};
+        ssize_t writeCount = write(m_controlEventFd, &increment, sizeof(increment));
+        (void)writeCount; // counter saturation (EAGAIN) still leaves the event signaled
+    }
+#endif
+};
+
+void
+ZeroMqReceivePoller::clearControlEvent()
+{
+#ifdef LINUX
+    if (m_controlEventFd >= 0)
+    {
+        uint64_t count{0};
+        ssize_t readCount = read(m_controlEventFd, &count, sizeof(count));
+        (void)readCount;
+    }
+#endif
+};
+
+void
+ZeroMqReceivePoller::executePoller()
+{
+    std::vector<zmq::pollitem_t> pollItems;
+    std::vector<uint64_t> pollRegistrationIds;
+    std::vector< std::function<void()> > readableHandlers;
+    long pollWaitTime_ms = (m_controlEventFd >= 0) ? -1 : uxas::common::ConfigurationManager::getZeroMqReceiveSocketPollWaitTime_ms();
+
+    while (!m_isTerminate)
+    {
+        pollItems.clear();
+        pollRegistrationIds.clear();
+        if (m_controlEventFd >= 0)
+        {
+            pollItems.push_back({nullptr, m_controlEventFd, ZMQ_POLLIN, 0});
+            pollRegistrationIds.push_back(0);
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_registrationMutex);
+            for (const auto& registration : m_registrations)
+            {
+                if (registration.second.m_isArmed)
+                {
+                    pollItems.push_back({static_cast<void*>(*registration.second.m_socket), 0, ZMQ_POLLIN, 0});
+                    pollRegistrationIds.push_back(registration.first);
+                }
+            }
+        }
+
+        try
+        {
+            zmq::poll(pollItems.data(), pollItems.size(), pollWaitTime_ms);
+        }
+        catch (std::exception& ex)
+        {
+            UXAS_LOG_ERROR("ZeroMqReceivePoller::executePoller poll EXCEPTION: ", ex.what());
+        }
+
+        readableHandlers.clear();
+        {
+            std::lock_guard<std::mutex> lock(m_registrationMutex);
+            for (size_t itemIndex = 0; itemIndex < pollItems.size(); itemIndex++)
+            {
+                if (!(pollItems[itemIndex].revents & ZMQ_POLLIN))
+                {
+                    continue;
+                }
+                if (pollRegistrationIds[itemIndex] == 0)
+                {
+                    clearControlEvent();
+                    continue;
+                }
+                // disarm until the owner has drained the socket
+                auto registrationIt = m_registrations.find(pollRegistrationIds[itemIndex]);
+                if (registrationIt != m_registrations.end() && registrationIt->second.m_isArmed)
+                {
+                    registrationIt->second.m_isArmed = false;
+                    readableHandlers.push_back(registrationIt->second.m_readableHandler);
+                }
+            }
+        }
+
+        for (auto& readableHandler : readableHandlers)
+        {
+            readableHandler();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_registrationMutex);
+            m_pollCycle++;
+        }
+        m_pollCycleCondition.notify_all();
+    }
+    m_pollCycleCondition.notify_all();
+};
+
+}; //namespace transport
+}; //namespace communications
+}; //namespace uxas
@@ -0,0 +1,135 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#ifndef UXAS_MESSAGE_TRANSPORT_ZERO_MQ_RECEIVE_POLLER_H
+#define UXAS_MESSAGE_TRANSPORT_ZERO_MQ_RECEIVE_POLLER_H
+
+#include "UxAS_ZeroMQ.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace uxas
+{
+namespace communications
+{
+namespace transport
+{
+
+/** \class ZeroMqReceivePoller
+ *
+ * \par Description:
+ * Process-wide, event-driven replacement for per-receiver poll timeouts. A
+ * single thread blocks (without timeout) in one multiplexed Zero MQ poll over
+ * every armed, registered socket plus a control event descriptor. When a
+ * socket becomes readable it is disarmed and its readable handler is invoked;
+ * the owner then receives everything that is ready on its own thread and
+ * re-arms the socket before waiting again. Idle receivers therefore consume
+ * no CPU and are woken as soon as a message arrives.
+ *
+ * \par Threading:
+ * A registered socket is only polled while armed; its owner must not use it
+ * between <B><i>armSocket</i></B> and the readable handler invocation.
+ *
+ * \par Singleton pattern
+ *
+ * \n
+ */
+class ZeroMqReceivePoller final
+{
+public:
+
+    static ZeroMqReceivePoller&
+    getInstance();
+
+    ~ZeroMqReceivePoller();
+
+private:
+
+    /** \brief Public, direct construction not permitted (singleton pattern) */
+    ZeroMqReceivePoller();
+
+    /** \brief Copy construction not permitted */
+    ZeroMqReceivePoller(ZeroMqReceivePoller const&) = delete;
+
+    /** \brief Copy assignment operation not permitted */
+    void operator=(ZeroMqReceivePoller const&) = delete;
+
+public:
+
+    /** \brief Register a socket (initially disarmed).
+     *
+     * @param socket Zero MQ socket to be polled.
+     * @param readableHandler function invoked by the poller thread when the armed socket is readable.
+     * @return registration ID.
+     */
+    uint64_t
+    registerSocket(zmq::socket_t& socket, std::function<void()> readableHandler);
+
+    /** \brief Remove a registration. Returns after the poller thread has
+     * stopped using the socket (so that the socket can then be closed).
+     *
+     * @param registrationId ID returned by <B><i>registerSocket</i></B>.
+     */
+    void
+    unregisterSocket(uint64_t registrationId);
+
+    /** \brief Resume polling a registered socket (invoked by the socket owner
+     * after it has received all ready messages).
+     *
+     * @param registrationId ID returned by <B><i>registerSocket</i></B>.
+     */
+    void
+    armSocket(uint64_t registrationId);
+
+private:
+
+    struct Registration
+    {
+        zmq::socket_t* m_socket{nullptr};
+        std::function<void()> m_readableHandler;
+        bool m_isArmed{false};
+    };
+
+    void
+    executePoller();
+
+    /** \brief Interrupt the blocking poll so that registration changes take effect */
+    void
+    signalControlEvent();
+
+    void
+    clearControlEvent();
+
+    std::mutex m_registrationMutex;
+    std::condition_variable m_pollCycleCondition;
+    std::unordered_map<uint64_t, Registration> m_registrations;
+    uint64_t m_nextRegistrationId{1};
+    uint64_t m_pollCycle{0};
+
+    /** \brief control event descriptor (eventfd); -1 if unavailable, in which
+     * case the poll wait is bounded by the Zero MQ receive socket poll wait time */
+    int m_controlEventFd{-1};
+
+    std::atomic<bool> m_isTerminate{false};
+    std::unique_ptr<std::thread> m_thread;
+
+};
+
+}; //namespace transport
+}; //namespace communications
+}; //namespace uxas
+
+#endif /* UXAS_MESSAGE_TRANSPORT_ZERO_MQ_RECEIVE_POLLER_H */
@@ -10,6 +10,7 @@
 #include "ZeroMqReceiverBase.h"
 
 #include "ZeroMqFabric.h"
+#include "ZeroMqMessageHubRouter.h"
 #include "UxAS_Log.h"
 
 #include <chrono>
@@ -28,6 +29,15 @@ ZeroMqReceiverBase::~ZeroMqReceiverBase()
     uint32_t lingerDuration_ms(0);
     if (m_zmqSocket)
     {
+        if (m_zeroMqSocketConfiguration.m_zmqSocketType == ZMQ_DEALER)
+        {
+            // remove all subscriptions of this socket from the message hub; a short
+            // linger lets the queued control frame reach the hub before the socket closes
+            if (sendSubscriptionControl(ZeroMqMessageHubRouter::s_disconnectControl, ""))
+            {
+                lingerDuration_ms = 100;
+            }
+        }
         m_zmqSocket->setsockopt(ZMQ_LINGER, &lingerDuration_ms, sizeof(lingerDuration_ms));
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
         m_zmqSocket->close();
@@ -67,6 +77,10 @@ ZeroMqReceiverBase::addSubscriptionAddressToSocket(const std::string& address)
         m_zmqSocket->setsockopt(ZMQ_SUBSCRIBE, address.c_str(), address.size());
         isAdded = true;
     }
+    else if (m_zeroMqSocketConfiguration.m_zmqSocketType == ZMQ_DEALER)
+    {
+        isAdded = sendSubscriptionControl(ZeroMqMessageHubRouter::s_subscribeControl, address);
+    }
     return (isAdded);
 };
 
@@ -79,9 +93,27 @@ ZeroMqReceiverBase::removeSubscriptionAddressFromSocket(const std::string& addre
         m_zmqSocket->setsockopt(ZMQ_UNSUBSCRIBE, address.c_str(), address.size());
         isRemoved = true;
     }
+    else if (m_zeroMqSocketConfiguration.m_zmqSocketType == ZMQ_DEALER)
+    {
+        isRemoved = sendSubscriptionControl(ZeroMqMessageHubRouter::s_unsubscribeControl, address);
+    }
     return (isRemoved);
 };
 
+bool
+ZeroMqReceiverBase::sendSubscriptionControl(char control, const std::string& address)
+{
+    // DEALER sockets subscribe through the message hub subscription index
+    // (queued by the socket until the message hub connection is established)
+    std::string subscriptionControl = control + address;
+    if (zmq_send(*m_zmqSocket, subscriptionControl.data(), subscriptionControl.size(), 0) < 0)
+    {
+        UXAS_LOG_ERROR("ZeroMqReceiverBase::sendSubscriptionControl failed to send subscription control for address [", address, "]");
+        return (false);
+    }
+    return (true);
+};
+
 }; //namespace transport
 }; //namespace communications
 }; //namespace uxas
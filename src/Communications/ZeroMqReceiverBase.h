@@ -73,6 +73,12 @@ public:
     bool
     removeSubscriptionAddressFromSocket(const std::string& address) override;
 
+private:
+
+    /** \brief Send a subscription control message (see <B><i>ZeroMqMessageHubRouter</i></B>) */
+    bool
+    sendSubscriptionControl(char control, const std::string& address);
+
 protected:
 
     std::string m_entityIdString;
@@ -47,6 +47,9 @@ public:
     int32_t m_receiveHighWaterMark{0};
     int32_t m_sendHighWaterMark{0};
 
+    /** \brief socket identity (ZMQ_IDENTITY) set before bind/connect; not set if empty */
+    std::string m_identity;
+
 };
 
 }; //namespace transport
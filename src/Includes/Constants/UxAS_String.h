@@ -24,28 +24,43 @@ public:
 //
     static const std::string& Alias() { static std::string s_string("Alias"); return(s_string); };
     static const std::string& AlwaysSendPosition() { static std::string s_string("AlwaysSendPosition"); return(s_string); };
+    static const std::string& AsyncLogOverflowPolicy() { static std::string s_string("AsyncLogOverflowPolicy"); return(s_string); };
+    static const std::string& AsyncLogRecordCapacity() { static std::string s_string("AsyncLogRecordCapacity"); return(s_string); };
     static const std::string& BaudRate() { static std::string s_string("BaudRate"); return(s_string); };
+    static const std::string& BinaryFormat() { static std::string s_string("Binary"); return(s_string); };
     static const std::string& Bridge() { static std::string s_string("Bridge"); return(s_string); };
     static const std::string& Component() { static std::string s_string("Component"); return(s_string); };
     static const std::string& ComponentManager() { static std::string s_string("ComponentManager"); return(s_string); };
     static const std::string& Components() { static std::string s_string("Components"); return(s_string); };
     static const std::string& ConsoleLoggerSeverityLevel() { static std::string s_string("ConsoleLoggerSeverityLevel"); return(s_string); };
+    static const std::string& DatabaseBatchPeriod_ms() { static std::string s_string("DatabaseBatchPeriod_ms"); return(s_string); };
+    static const std::string& DatabaseBatchRowCount() { static std::string s_string("DatabaseBatchRowCount"); return(s_string); };
+    static const std::string& DatabaseFormat() { static std::string s_string("Database"); return(s_string); };
+    static const std::string& EndTime_ms() { static std::string s_string("EndTime_ms"); return(s_string); };
     static const std::string& EntityID() { static std::string s_string("EntityID"); return(s_string); };
     static const std::string& EntityType() { static std::string s_string("EntityType"); return(s_string); };
     static const std::string& FilterType() { static std::string s_string("FilterType"); return(s_string); };
+    static const std::string& FrameFormat() { static std::string s_string("FrameFormat"); return(s_string); };
     static const std::string& GapTime_ms() { static std::string s_string("GapTime_ms"); return(s_string); };
+    static const std::string& InProcessLmcpDelivery() { static std::string s_string("InProcessLmcpDelivery"); return(s_string); };
+    static const std::string& isAsyncLogging() { static std::string s_string("isAsyncLogging"); return(s_string); };
+    static const std::string& isEventDrivenReceive() { static std::string s_string("isEventDrivenReceive"); return(s_string); };
     static const std::string& isDataTimestamp() { static std::string s_string("isDataTimestamp"); return(s_string); };
     static const std::string& isLoggingThreadId() { static std::string s_string("isLoggingThreadId"); return(s_string); };
     static const std::string& LogFileMessageCountLimit() { static std::string s_string("LogFileMessageCountLimit"); return(s_string); };
+    static const std::string& LogFormat() { static std::string s_string("LogFormat"); return(s_string); };
+    static const std::string& LogPath() { static std::string s_string("LogPath"); return(s_string); };
     static const std::string& MainFileLoggerSeverityLevel() { static std::string s_string("MainFileLoggerSeverityLevel"); return(s_string); };
     static const std::string& MessageGroup() { static std::string s_string("MessageGroup"); return(s_string); };
     static const std::string& MessageType() { static std::string s_string("MessageType"); return(s_string); };
+    static const std::string& NetworkClientExecution() { static std::string s_string("NetworkClientExecution"); return(s_string); };
     static const std::string& NetworkDevice() { static std::string s_string("NetworkDevice"); return(s_string); };
     static const std::string& ZyreEndpoint() { static std::string s_string("ZyreEndpoint"); return(s_string); };
     static const std::string& GossipEndpoint() { static std::string s_string("GossipEndpoint"); return(s_string); };
     static const std::string& GossipBind() { static std::string s_string("GossipBind"); return(s_string); };
     static const std::string& ReceiveEntityId() { static std::string s_string("ReceiveEntityId"); return(s_string); };
     static const std::string& RunDuration_s() { static std::string s_string("RunDuration_s"); return(s_string); };
+    static const std::string& SegmentSize_MB() { static std::string s_string("SegmentSize_MB"); return(s_string); };
     static const std::string& SendAddress() { static std::string s_string("SendAddress"); return(s_string); };
     static const std::string& SendContentType() { static std::string s_string("SendContentType"); return(s_string); };
     static const std::string& SendDescriptor() { static std::string s_string("SendDescriptor"); return(s_string); };
@@ -53,19 +68,23 @@ public:
     static const std::string& SendSourceEntityId() { static std::string s_string("SendSourceEntityId"); return(s_string); };
     static const std::string& SendSourceGroup() { static std::string s_string("SendSourceGroup"); return(s_string); };
     static const std::string& SendSourceServiceId() { static std::string s_string("SendSourceServiceId"); return(s_string); };
+    static const std::string& SentinelFormat() { static std::string s_string("Sentinel"); return(s_string); };
     static const std::string& SerialPortAddress() { static std::string s_string("SerialPortAddress"); return(s_string); };
     static const std::string& SerialPollWaitTime_us() { static std::string s_string("SerialPollWaitTime_us"); return(s_string); };
     static const std::string& SerialTimeout_ms() { static std::string s_string("SerialTimeout_ms"); return(s_string); };
     static const std::string& Server() { static std::string s_string("Server"); return(s_string); };
     static const std::string& Service() { static std::string s_string("Service"); return(s_string); };
     static const std::string& StartDelay_ms() { static std::string s_string("StartDelay_ms"); return(s_string); };
+    static const std::string& StartTime_ms() { static std::string s_string("StartTime_ms"); return(s_string); };
     static const std::string& SubscribeToExternalMessage() { static std::string s_string("SubscribeToExternalMessage"); return(s_string); };
     static const std::string& SubscribeToMessage() { static std::string s_string("SubscribeToMessage"); return(s_string); };
     static const std::string& TcpAddress() { static std::string s_string("TcpAddress"); return(s_string); };
+    static const std::string& TimeScale() { static std::string s_string("TimeScale"); return(s_string); };
     static const std::string& TransformReceivedMessage() { static std::string s_string("TransformReceivedMessage"); return(s_string); };
     static const std::string& Type() { static std::string s_string("Type"); return(s_string); };
     static const std::string& UAV() { static std::string s_string("UAV"); return(s_string); };
     static const std::string& UxAS() { static std::string s_string("UxAS"); return(s_string); };
+    static const std::string& WorkerPoolThreadCount() { static std::string s_string("WorkerPoolThreadCount"); return(s_string); };
 
 };
 
@@ -91,6 +110,22 @@ public:
     static const std::string& PartialAirVehicleState() { static std::string s_string("PartialAirVehicleState"); return(s_string); };
 };
 
+class AsyncLogOverflowPolicy
+{
+public:
+
+    static const std::string& Block() { static std::string s_string("Block"); return(s_string); };
+    static const std::string& Drop() { static std::string s_string("Drop"); return(s_string); };
+};
+
+class NetworkClientExecution
+{
+public:
+
+    static const std::string& DedicatedThread() { static std::string s_string("DedicatedThread"); return(s_string); };
+    static const std::string& WorkerPool() { static std::string s_string("WorkerPool"); return(s_string); };
+};
+
 class LmcpNetworkSocketAddress
 {
 public:
@@ -83,10 +83,10 @@ public:    //constructors/destructors
     };
 
 public:    //methods/functions
-    bool bFindIntersection(const CPosition& posPointA1, const CPosition& posPointA2, const CPosition& posPointB1, const CPosition& posPointB2, CPosition& posIntersectionPoint = cnst_posDefault);
-    bool bIntersection(const V_POSITION_t& cVertexContainer, const CPosition& posThatB1, const CPosition& posThatB2,const n_Const::PlanCost_t& i32IndexA=-1,const n_Const::PlanCost_t& i32IndexB=-1,CPosition& posIntersectionPoint=cnst_posDefault);
-    bool bIntersection(const V_POSITION_t& cVertexContainer,const CEdge& eThat,CPosition& posIntersectionPoint=cnst_posDefault);
-    bool bIntersection(const V_POSITON_ID_t& cVertexContainer,const CEdge& eThat,CPosition& posIntersectionPoint=cnst_posDefault);
+    bool bFindIntersection(const CPosition& posPointA1, const CPosition& posPointA2, const CPosition& posPointB1, const CPosition& posPointB2, CPosition& posIntersectionPoint = cnst_posDefault)const;
+    bool bIntersection(const V_POSITION_t& cVertexContainer, const CPosition& posThatB1, const CPosition& posThatB2,const n_Const::PlanCost_t& i32IndexA=-1,const n_Const::PlanCost_t& i32IndexB=-1,CPosition& posIntersectionPoint=cnst_posDefault)const;
+    bool bIntersection(const V_POSITION_t& cVertexContainer,const CEdge& eThat,CPosition& posIntersectionPoint=cnst_posDefault)const;
+    bool bIntersection(const V_POSITON_ID_t& cVertexContainer,const CEdge& eThat,CPosition& posIntersectionPoint=cnst_posDefault)const;
 
 public:    //accessors
 
@@ -0,0 +1,203 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+// EdgeGrid.cpp: implementation of the CEdgeGrid class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "EdgeGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+
+namespace n_FrameworkLib
+{
+
+#define EDGE_GRID_MAX_CELLS_PER_SIDE (1024)
+#define EDGE_GRID_EPSILON (1.0e-9)     //in cells, segments are widened by this amount so cell boundaries are not missed
+
+    template <typename FUNCTION>
+    bool CEdgeGrid::bVisitCells(const CPosition& posPoint1, const CPosition& posPoint2, FUNCTION fnVisit) const
+    {
+        if ((m_iNumberRows <= 0) || (m_iNumberColumns <= 0))
+        {
+            return (false);
+        }
+
+        // segment in cell units
+        double dNorth1((posPoint1.m_north_m - m_dMinNorth_m) / m_dCellSize_m);
+        double dEast1((posPoint1.m_east_m - m_dMinEast_m) / m_dCellSize_m);
+        double dNorth2((posPoint2.m_north_m - m_dMinNorth_m) / m_dCellSize_m);
+        double dEast2((posPoint2.m_east_m - m_dMinEast_m) / m_dCellSize_m);
+
+        double dEastLow(std::min(dEast1, dEast2) - EDGE_GRID_EPSILON);
+        double dEastHigh(std::max(dEast1, dEast2) + EDGE_GRID_EPSILON);
+        if ((dEastHigh < 0.0) || (dEastLow >= m_iNumberColumns))
+        {
+            return (false); // outside of the grid, i.e. no edges
+        }
+        int32_t iColumnBegin = static_cast<int32_t> (std::max(0.0, std::floor(dEastLow)));
+        int32_t iColumnEnd = static_cast<int32_t> (std::min(m_iNumberColumns - 1.0, std::floor(dEastHigh)));
+        bool bVertical(std::fabs(dEast2 - dEast1) <= EDGE_GRID_EPSILON);
+
+        for (int32_t iColumn = iColumnBegin; iColumn <= iColumnEnd; iColumn++)
+        {
+            // north extent of the part of the segment in this column
+            double dNorthA(dNorth1);
+            double dNorthB(dNorth2);
+            if (!bVertical)
+            {
+                double dSlope((dNorth2 - dNorth1) / (dEast2 - dEast1));
+                dNorthA = dNorth1 + dSlope * (std::max(dEastLow, static_cast<double> (iColumn)) - dEast1);
+                dNorthB = dNorth1 + dSlope * (std::min(dEastHigh, iColumn + 1.0) - dEast1);
+            }
+            double dNorthLow(std::min(dNorthA, dNorthB) - EDGE_GRID_EPSILON);
+            double dNorthHigh(std::max(dNorthA, dNorthB) + EDGE_GRID_EPSILON);
+            if ((dNorthHigh < 0.0) || (dNorthLow >= m_iNumberRows))
+            {
+                continue;
+            }
+            int32_t iRowBegin = static_cast<int32_t> (std::max(0.0, std::floor(dNorthLow)));
+            int32_t iRowEnd = static_cast<int32_t> (std::min(m_iNumberRows - 1.0, std::floor(dNorthHigh)));
+            for (int32_t iRow = iRowBegin; iRow <= iRowEnd; iRow++)
+            {
+                if (fnVisit(static_cast<size_t> (iRow) * m_iNumberColumns + iColumn))
+                {
+                    return (true);
+                }
+            }
+        }
+        return (false);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CEdgeGrid::Build(const V_POSITION_t& vposVertexContainer, const CEdge::V_EDGE_t& veEdges)
+    {
+        clear();
+        if (veEdges.empty())
+        {
+            return;
+        }
+        m_veEdges = veEdges;
+
+        double dMaxNorth_m(vposVertexContainer[static_cast<size_t> (m_veEdges.front().first)].m_north_m);
+        double dMaxEast_m(vposVertexContainer[static_cast<size_t> (m_veEdges.front().first)].m_east_m);
+        m_dMinNorth_m = dMaxNorth_m;
+        m_dMinEast_m = dMaxEast_m;
+        for (auto itEdge = m_veEdges.begin(); itEdge != m_veEdges.end(); itEdge++)
+        {
+            for (auto iVertex : {itEdge->first, itEdge->second})
+            {
+                const CPosition& posVertex = vposVertexContainer[static_cast<size_t> (iVertex)];
+                m_dMinNorth_m = std::min(m_dMinNorth_m, posVertex.m_north_m);
+                m_dMinEast_m = std::min(m_dMinEast_m, posVertex.m_east_m);
+                dMaxNorth_m = std::max(dMaxNorth_m, posVertex.m_north_m);
+                dMaxEast_m = std::max(dMaxEast_m, posVertex.m_east_m);
+            }
+        }
+
+        // about one cell per edge
+        double dExtentNorth_m(dMaxNorth_m - m_dMinNorth_m);
+        double dExtentEast_m(dMaxEast_m - m_dMinEast_m);
+        m_dCellSize_m = std::sqrt(dExtentNorth_m * dExtentEast_m / m_veEdges.size());
+        m_dCellSize_m = std::max(m_dCellSize_m, std::max(dExtentNorth_m, dExtentEast_m) / (EDGE_GRID_MAX_CELLS_PER_SIDE - 1));
+        if (!(m_dCellSize_m > 0.0))
+        {
+            m_dCellSize_m = 1.0;
+        }
+        m_iNumberRows = std::min(static_cast<int32_t> (dExtentNorth_m / m_dCellSize_m) + 1, EDGE_GRID_MAX_CELLS_PER_SIDE);
+        m_iNumberColumns = std::min(static_cast<int32_t> (dExtentEast_m / m_dCellSize_m) + 1, EDGE_GRID_MAX_CELLS_PER_SIDE);
+        size_t szNumberCells(static_cast<size_t> (m_iNumberRows) * m_iNumberColumns);
+
+        // count the edges in each cell, then fill the cells
+        m_vuiCellOffsets.assign(szNumberCells + 1, 0);
+        for (auto itEdge = m_veEdges.begin(); itEdge != m_veEdges.end(); itEdge++)
+        {
+            bVisitCells(vposVertexContainer[static_cast<size_t> (itEdge->first)], vposVertexContainer[static_cast<size_t> (itEdge->second)],
+                    [this](const size_t & szCell)
+                    {
+                        m_vuiCellOffsets[szCell + 1]++;
+                        return (false);
+                    });
+        }
+        for (size_t szCell = 0; szCell < szNumberCells; szCell++)
+        {
+            m_vuiCellOffsets[szCell + 1] += m_vuiCellOffsets[szCell];
+        }
+        m_vuiCellEdges.resize(m_vuiCellOffsets.back());
+        std::vector<uint32_t> vuiCellNext(m_vuiCellOffsets.begin(), m_vuiCellOffsets.end() - 1);
+        for (uint32_t uiEdge = 0; uiEdge < m_veEdges.size(); uiEdge++)
+        {
+            bVisitCells(vposVertexContainer[static_cast<size_t> (m_veEdges[uiEdge].first)], vposVertexContainer[static_cast<size_t> (m_veEdges[uiEdge].second)],
+                    [this, uiEdge, &vuiCellNext](const size_t & szCell)
+                    {
+                        m_vuiCellEdges[vuiCellNext[szCell]++] = uiEdge;
+                        return (false);
+                    });
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CEdgeGrid::clear()
+    {
+        m_veEdges.clear();
+        m_vuiCellOffsets.clear();
+        m_vuiCellEdges.clear();
+        m_iNumberRows = 0;
+        m_iNumberColumns = 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool CEdgeGrid::bIntersection(const V_POSITION_t& vposVertexContainer, const CEdge& eThat) const
+    {
+        // edges that cross several cells may be tested more than once
+        CPosition posIntersection;
+        return (bVisitCells(vposVertexContainer[static_cast<size_t> (eThat.first)], vposVertexContainer[static_cast<size_t> (eThat.second)],
+                [this, &vposVertexContainer, &eThat, &posIntersection](const size_t & szCell)
+                {
+                    for (uint32_t uiIndex = m_vuiCellOffsets[szCell]; uiIndex < m_vuiCellOffsets[szCell + 1]; uiIndex++)
+                    {
+                        if (m_veEdges[m_vuiCellEdges[uiIndex]].bIntersection(vposVertexContainer, eThat, posIntersection))
+                        {
+                            return (true);
+                        }
+                    }
+                    return (false);
+                }));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool CEdgeGrid::bIntersection(const V_POSITION_t& vposVertexContainer, const CPosition& posThatB1, const CPosition& posThatB2,
+            const n_Const::PlanCost_t& i32IndexA, const n_Const::PlanCost_t& i32IndexB) const
+    {
+        CPosition posIntersection;
+        return (bVisitCells(posThatB1, posThatB2,
+                [this, &vposVertexContainer, &posThatB1, &posThatB2, &i32IndexA, &i32IndexB, &posIntersection](const size_t & szCell)
+                {
+                    for (uint32_t uiIndex = m_vuiCellOffsets[szCell]; uiIndex < m_vuiCellOffsets[szCell + 1]; uiIndex++)
+                    {
+                        if (m_veEdges[m_vuiCellEdges[uiIndex]].bIntersection(vposVertexContainer, posThatB1, posThatB2, i32IndexA, i32IndexB, posIntersection))
+                        {
+                            return (true);
+                        }
+                    }
+                    return (false);
+                }));
+    }
+
+}; //namespace n_FrameworkLib
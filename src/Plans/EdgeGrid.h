@@ -0,0 +1,73 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+// EdgeGrid.h: interface for the CEdgeGrid class.
+//
+//  Uniform grid spatial index over a set of (polygon) edges. Each edge is
+//  listed in every cell that it passes through; a segment intersection query
+//  only tests the edges listed in the cells that the segment passes through.
+//  Cells are stored in compressed form (cell offsets into one edge index
+//  vector). The grid is read-only after it is built, so queries can be made
+//  from several threads.
+//
+//////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Position.h"
+#include "Edge.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace n_FrameworkLib
+{
+
+    class CEdgeGrid
+    {
+    public: //constructors/destructors
+        CEdgeGrid() { };
+
+    public: //methods/functions
+        /** index the edges, "vposVertexContainer" must be the container used for the queries */
+        void Build(const V_POSITION_t& vposVertexContainer, const CEdge::V_EDGE_t& veEdges);
+
+        void clear();
+
+        bool empty() const
+        {
+            return (m_veEdges.empty());
+        };
+
+        /** true if one of the indexed edges intersects "eThat" (edges with a common vertex do not intersect) */
+        bool bIntersection(const V_POSITION_t& vposVertexContainer, const CEdge& eThat) const;
+
+        /** true if one of the indexed edges intersects the segment from "posThatB1" to "posThatB2", see CEdge::bIntersection */
+        bool bIntersection(const V_POSITION_t& vposVertexContainer, const CPosition& posThatB1, const CPosition& posThatB2,
+                const n_Const::PlanCost_t& i32IndexA = -1, const n_Const::PlanCost_t& i32IndexB = -1) const;
+
+    protected:
+        /** calls "fnVisit(szCell)" for each cell the segment passes through, stops when "fnVisit" returns true */
+        template <typename FUNCTION>
+        bool bVisitCells(const CPosition& posPoint1, const CPosition& posPoint2, FUNCTION fnVisit) const;
+
+    protected: //storage
+        CEdge::V_EDGE_t m_veEdges;
+        /** edges of cell "c" are m_vuiCellEdges[m_vuiCellOffsets[c]] to m_vuiCellEdges[m_vuiCellOffsets[c+1]-1] */
+        std::vector<uint32_t> m_vuiCellOffsets;
+        std::vector<uint32_t> m_vuiCellEdges;
+
+        double m_dMinNorth_m{0.0};
+        double m_dMinEast_m{0.0};
+        double m_dCellSize_m{1.0};
+        int32_t m_iNumberRows{0};
+        int32_t m_iNumberColumns{0};
+    };
+
+}; //namespace n_FrameworkLib
@@ -367,7 +367,7 @@ void CPolygon::FindPolygonBoundingBox(V_POSITION_t& vposVertexContainer,stringst
         return(errReturn);
     };
 
-CPolygon::enError CPolygon::errFindVisibleEdges(V_POSITION_t& vposVertexContainer,const V_POLYGON_CONST_IT_t& itPolygonThat,V_EDGE_t& veEdgesVisible)
+CPolygon::enError CPolygon::errFindVisibleEdges(V_POSITION_t& vposVertexContainer,const V_POLYGON_CONST_IT_t& itPolygonThat,V_EDGE_t& veEdgesVisible,const CEdgeGrid* pegEdgeGrid)
     {
         enError errReturn(errNoError);
 
@@ -400,17 +400,24 @@ CPolygon::enError CPolygon::errFindVisibleEdges(V_POSITION_t& vposVertexContaine
                 {
                     bool bIntersectionFound(false);
                     CEdge edgeNew(*itVertexThis,*itVertexThat);
-                    for(MMAP_INT_ITPOLYGON_IT_t itIntPolygon=mmapiitGetSortedDistancesToOtherPolygons().begin();
-                        itIntPolygon!=mmapiitGetSortedDistancesToOtherPolygons().end();
-                        itIntPolygon++)
+                    if(pegEdgeGrid)
                     {
-                        V_POLYGON_IT_t itPolygonCheck = itIntPolygon->second;
-                        if(itPolygonCheck->bCheckForIntersection(vposVertexContainer,edgeNew))
+                        bIntersectionFound = pegEdgeGrid->bIntersection(vposVertexContainer,edgeNew);
+                    }
+                    else
+                    {
+                        for(MMAP_INT_ITPOLYGON_IT_t itIntPolygon=mmapiitGetSortedDistancesToOtherPolygons().begin();
+                            itIntPolygon!=mmapiitGetSortedDistancesToOtherPolygons().end();
+                            itIntPolygon++)
                         {
-                            bIntersectionFound = true;
-                            break;
-                        }
-                    }        //for(V_POLYGON_CONST_IT_t itPolygon=itPolygonAllBegin;itPolygon!=itPolygonAllEnd;itPolygon++)
+                            V_POLYGON_IT_t itPolygonCheck = itIntPolygon->second;
+                            if(itPolygonCheck->bCheckForIntersection(vposVertexContainer,edgeNew))
+                            {
+                                bIntersectionFound = true;
+                                break;
+                            }
+                        }        //for(V_POLYGON_CONST_IT_t itPolygon=itPolygonAllBegin;itPolygon!=itPolygonAllEnd;itPolygon++)
+                    }
                     if(!bIntersectionFound)
                     {
                         edgeNew.iGetLength() = static_cast<int>(vposVertexContainer[*itVertexThis].relativeDistance2D_m(vposVertexContainer[*itVertexThat]));
@@ -424,7 +431,7 @@ CPolygon::enError CPolygon::errFindVisibleEdges(V_POSITION_t& vposVertexContaine
         return(errReturn);
     };
 
-CPolygon::enError CPolygon::errAddExtraVisibleEdges(V_POSITION_t& vposVertexContainer,const V_POLYGON_CONST_IT_t& itPolygonThat,V_EDGE_t& veEdgesVisible)
+CPolygon::enError CPolygon::errAddExtraVisibleEdges(V_POSITION_t& vposVertexContainer,const V_POLYGON_CONST_IT_t& itPolygonThat,V_EDGE_t& veEdgesVisible,const CEdgeGrid* pegEdgeGrid)
     {
         enError errReturn(errNoError);
 
@@ -456,17 +463,24 @@ CPolygon::enError CPolygon::errAddExtraVisibleEdges(V_POSITION_t& vposVertexCont
                 if(bGoodEdge)
                 {
                     bool bIntersectionFound(false);
-                    for(MMAP_INT_ITPOLYGON_IT_t itIntPolygon=mmapiitGetSortedDistancesToOtherPolygons().begin();
-                        itIntPolygon!=mmapiitGetSortedDistancesToOtherPolygons().end();
-                        itIntPolygon++)
+                    if(pegEdgeGrid)
                     {
-                        V_POLYGON_IT_t itPolygonCheck = itIntPolygon->second;
-                        if(itPolygonCheck->bCheckForIntersection(vposVertexContainer,*itEdge))
+                        bIntersectionFound = pegEdgeGrid->bIntersection(vposVertexContainer,*itEdge);
+                    }
+                    else
+                    {
+                        for(MMAP_INT_ITPOLYGON_IT_t itIntPolygon=mmapiitGetSortedDistancesToOtherPolygons().begin();
+                            itIntPolygon!=mmapiitGetSortedDistancesToOtherPolygons().end();
+                            itIntPolygon++)
                         {
-                            bIntersectionFound = true;
-                            break;
-                        }
-                    }        //for(V_POLYGON_CONST_IT_t itPolygon=itPolygonAllBegin;itPolygon!=itPolygonAllEnd;itPolygon++)
+                            V_POLYGON_IT_t itPolygonCheck = itIntPolygon->second;
+                            if(itPolygonCheck->bCheckForIntersection(vposVertexContainer,*itEdge))
+                            {
+                                bIntersectionFound = true;
+                                break;
+                            }
+                        }        //for(V_POLYGON_CONST_IT_t itPolygon=itPolygonAllBegin;itPolygon!=itPolygonAllEnd;itPolygon++)
+                    }
                     if(!bIntersectionFound)
                     {
                         itEdge->iGetLength() = static_cast<int>(vposVertexContainer[static_cast<unsigned int>(itEdge->first)].relativeDistance2D_m(vposVertexContainer[static_cast<unsigned int>(itEdge->second)]));
@@ -40,6 +40,7 @@
 
 #include "Position.h"
 #include "Edge.h"
+#include "EdgeGrid.h"
 #include "CGrid.h"
 #include "visilibity.h"     //polygon expansion
 
@@ -53,6 +54,7 @@
 #endif//_WIN32
 
 #include "boost/dynamic_bitset.hpp"    //use  id bits for local ID
+#include <algorithm>
 #include <unordered_map>
 #include <list>
 #include <utility>    //pair
@@ -355,6 +357,9 @@ public:    //constructors/destructors
         GridUpdateNeeded = true;
         BBUpdateNeeded = true;
         dynbsGetLocalID() = rhs.dynbsGetLocalID();
+        posmaxBBoxPoint = rhs.posmaxBBoxPoint;
+        posminBBoxPoint = rhs.posminBBoxPoint;
+        BBUpdateNeeded = rhs.BBUpdateNeeded;
     };
 
 public:    //methods/functions
@@ -432,6 +437,14 @@ public:    //methods/functions
 
         ResetPolygon();
 
+        //the bounding box is used to cull intersection tests, update it (and the "InPolygon" grid) now
+        if(!viGetVerticies().empty())
+        {
+            stringstream sstrErrorMessage;
+            FindPolygonBoundingBox(vposVertexContainer,sstrErrorMessage);
+            GridUpdateNeeded = true;
+        }
+
         errReturn = errCalculateCentroid(vposVertexContainer,cntrdType);
         errReturn = errCheckForConcavity(vposVertexContainer);
 
@@ -595,9 +608,24 @@ public:    //methods/functions
     {
         bool bIntersectionFound(false);
 
+        //all of the polygon edges are inside of the bounding box
+        if(!BBUpdateNeeded)
+        {
+            const CPosition& posThat1 = vposVertexContainer[static_cast<size_t>(eThatEdge.first)];
+            const CPosition& posThat2 = vposVertexContainer[static_cast<size_t>(eThatEdge.second)];
+            if((std::max(posThat1.m_north_m,posThat2.m_north_m) < posminBBoxPoint.m_north_m)||
+                (std::min(posThat1.m_north_m,posThat2.m_north_m) > posmaxBBoxPoint.m_north_m)||
+                (std::max(posThat1.m_east_m,posThat2.m_east_m) < posminBBoxPoint.m_east_m)||
+                (std::min(posThat1.m_east_m,posThat2.m_east_m) > posmaxBBoxPoint.m_east_m))
+            {
+                return(bIntersectionFound);
+            }
+        }
+
+        CPosition posIntersection;
         for(V_EDGE_IT_t itEdge=veGetPolygonEdges().begin();itEdge!=veGetPolygonEdges().end();itEdge++)
         {
-            if(itEdge->bIntersection(vposVertexContainer,eThatEdge))
+            if(itEdge->bIntersection(vposVertexContainer,eThatEdge,posIntersection))
             {
                 bIntersectionFound = true;
                 break;
@@ -621,8 +649,9 @@ public:    //methods/functions
 
     enError errCheckForConcavity(V_POSITION_t& vposVerticies);
     enError errFindSelfVisibleEdges(V_POSITION_t& vposVertexContainer);
-    enError errFindVisibleEdges(V_POSITION_t& vposVertexContainer,const V_POLYGON_CONST_IT_t& itPolygonThat,V_EDGE_t& veEdgesVisible);
-    enError errAddExtraVisibleEdges(V_POSITION_t& vposVertexContainer,const V_POLYGON_CONST_IT_t& itPolygonThat,V_EDGE_t& veEdgesVisible);
+    //if "pegEdgeGrid" is given, it must index the edges of all of the polygons and is used in place of the polygon intersection checks
+    enError errFindVisibleEdges(V_POSITION_t& vposVertexContainer,const V_POLYGON_CONST_IT_t& itPolygonThat,V_EDGE_t& veEdgesVisible,const CEdgeGrid* pegEdgeGrid=0);
+    enError errAddExtraVisibleEdges(V_POSITION_t& vposVertexContainer,const V_POLYGON_CONST_IT_t& itPolygonThat,V_EDGE_t& veEdgesVisible,const CEdgeGrid* pegEdgeGrid=0);
 
 
 
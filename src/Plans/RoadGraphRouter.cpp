@@ -0,0 +1,296 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+// RoadGraphRouter.cpp: implementation of the CRoadGraphRouter class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "RoadGraphRouter.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+
+namespace n_FrameworkLib
+{
+
+#define ROAD_GRAPH_UNREACHED ((std::numeric_limits<int32_t>::max)())
+
+    void CRoadGraphRouter::clear()
+    {
+        m_vuiOffsets.clear();
+        m_vuiTargets.clear();
+        m_vi32Lengths.clear();
+        m_uiNumberLandmarks = 0;
+        m_vi32LandmarkCosts.clear();
+    }
+
+    void CRoadGraphRouter::Build(const CEdge::V_EDGE_t& veEdges, uint32_t uiNumberVertices, uint32_t uiNumberLandmarks)
+    {
+        clear();
+
+        for (auto itEdge = veEdges.begin(); itEdge != veEdges.end(); itEdge++)
+        {
+            if ((itEdge->first >= 0) && (itEdge->second >= 0))
+            {
+                uiNumberVertices = (std::max)(uiNumberVertices, static_cast<uint32_t> ((std::max)(itEdge->first, itEdge->second)) + 1);
+            }
+        }
+        if (uiNumberVertices == 0)
+        {
+            return;
+        }
+
+        // 1) compressed adjacency, each undirected edge is stored in both directions
+        m_vuiOffsets.assign(uiNumberVertices + 1, 0);
+        for (auto itEdge = veEdges.begin(); itEdge != veEdges.end(); itEdge++)
+        {
+            if ((itEdge->first >= 0) && (itEdge->second >= 0) && (itEdge->first != itEdge->second))
+            {
+                m_vuiOffsets[itEdge->first + 1]++;
+                m_vuiOffsets[itEdge->second + 1]++;
+            }
+        }
+        for (uint32_t uiVertex = 0; uiVertex < uiNumberVertices; uiVertex++)
+        {
+            m_vuiOffsets[uiVertex + 1] += m_vuiOffsets[uiVertex];
+        }
+        m_vuiTargets.resize(m_vuiOffsets.back());
+        m_vi32Lengths.resize(m_vuiOffsets.back());
+        std::vector<uint32_t> vuiNext(m_vuiOffsets.begin(), m_vuiOffsets.end() - 1);
+        for (auto itEdge = veEdges.begin(); itEdge != veEdges.end(); itEdge++)
+        {
+            if ((itEdge->first >= 0) && (itEdge->second >= 0) && (itEdge->first != itEdge->second))
+            {
+                int32_t i32Length = (std::max)(itEdge->iGetLength(), 0);
+                m_vuiTargets[vuiNext[itEdge->first]] = itEdge->second;
+                m_vi32Lengths[vuiNext[itEdge->first]++] = i32Length;
+                m_vuiTargets[vuiNext[itEdge->second]] = itEdge->first;
+                m_vi32Lengths[vuiNext[itEdge->second]++] = i32Length;
+            }
+        }
+
+        // 2) landmarks, farthest point selection: each new landmark is the vertex
+        // farthest from the landmarks already selected. Vertices not reached from
+        // any landmark are the farthest, so every connected component gets a landmark
+        // before any component gets a second one.
+        uint32_t uiFirstVertex(0);
+        while ((uiFirstVertex < uiNumberVertices) && (m_vuiOffsets[uiFirstVertex] == m_vuiOffsets[uiFirstVertex + 1]))
+        {
+            uiFirstVertex++;
+        }
+        if (uiFirstVertex >= uiNumberVertices)
+        {
+            return; // no edges
+        }
+        std::vector<int32_t> vi32Costs;
+        CalculateCostsFrom(uiFirstVertex, vi32Costs);
+        std::vector<int32_t> vi32MinCosts(uiNumberVertices, ROAD_GRAPH_UNREACHED);
+        std::vector<std::vector<int32_t> > vvi32LandmarkCosts;
+        uint32_t uiLandmark = uiFirstVertex;
+        for (uint32_t uiVertex = 0; uiVertex < uiNumberVertices; uiVertex++)
+        {
+            if ((vi32Costs[uiVertex] != ROAD_GRAPH_UNREACHED) && (vi32Costs[uiVertex] > vi32Costs[uiLandmark]))
+            {
+                uiLandmark = uiVertex;
+            }
+        }
+        while (vvi32LandmarkCosts.size() < uiNumberLandmarks)
+        {
+            CalculateCostsFrom(uiLandmark, vi32Costs);
+            vvi32LandmarkCosts.push_back(vi32Costs);
+
+            int32_t i32FarthestCost(0);
+            for (uint32_t uiVertex = 0; uiVertex < uiNumberVertices; uiVertex++)
+            {
+                vi32MinCosts[uiVertex] = (std::min)(vi32MinCosts[uiVertex], vi32Costs[uiVertex]);
+                if ((vi32MinCosts[uiVertex] > i32FarthestCost) && (m_vuiOffsets[uiVertex] != m_vuiOffsets[uiVertex + 1]))
+                {
+                    i32FarthestCost = vi32MinCosts[uiVertex];
+                    uiLandmark = uiVertex;
+                }
+            }
+            if (i32FarthestCost == 0)
+            {
+                break; // every vertex is a landmark
+            }
+        }
+
+        // interleave the landmark costs, a query reads all landmarks of one vertex at a time
+        m_uiNumberLandmarks = static_cast<uint32_t> (vvi32LandmarkCosts.size());
+        m_vi32LandmarkCosts.resize(static_cast<size_t> (uiNumberVertices) * m_uiNumberLandmarks);
+        for (uint32_t uiLandmarkIndex = 0; uiLandmarkIndex < m_uiNumberLandmarks; uiLandmarkIndex++)
+        {
+            for (uint32_t uiVertex = 0; uiVertex < uiNumberVertices; uiVertex++)
+            {
+                m_vi32LandmarkCosts[static_cast<size_t> (uiVertex) * m_uiNumberLandmarks + uiLandmarkIndex] = vvi32LandmarkCosts[uiLandmarkIndex][uiVertex];
+            }
+        }
+    }
+
+    void CRoadGraphRouter::CalculateCostsFrom(const uint32_t& uiSource, std::vector<int32_t>& vi32Costs) const
+    {
+        vi32Costs.assign(uiGetNumberVertices(), ROAD_GRAPH_UNREACHED);
+        std::vector<std::pair<int32_t, uint32_t> > vpairOpen;
+        std::greater<std::pair<int32_t, uint32_t> > fnGreater;
+
+        vi32Costs[uiSource] = 0;
+        vpairOpen.push_back(std::make_pair(0, uiSource));
+        while (!vpairOpen.empty())
+        {
+            std::pop_heap(vpairOpen.begin(), vpairOpen.end(), fnGreater);
+            int32_t i32Cost = vpairOpen.back().first;
+            uint32_t uiVertex = vpairOpen.back().second;
+            vpairOpen.pop_back();
+            if (i32Cost != vi32Costs[uiVertex])
+            {
+                continue; // superseded entry
+            }
+            for (uint32_t uiNeighbor = m_vuiOffsets[uiVertex]; uiNeighbor < m_vuiOffsets[uiVertex + 1]; uiNeighbor++)
+            {
+                int64_t i64Cost = static_cast<int64_t> (i32Cost) + m_vi32Lengths[uiNeighbor];
+                uint32_t uiTarget = m_vuiTargets[uiNeighbor];
+                if (i64Cost < vi32Costs[uiTarget])
+                {
+                    vi32Costs[uiTarget] = static_cast<int32_t> (i64Cost);
+                    vpairOpen.push_back(std::make_pair(vi32Costs[uiTarget], uiTarget));
+                    std::push_heap(vpairOpen.begin(), vpairOpen.end(), fnGreater);
+                }
+            }
+        }
+    }
+
+    bool CRoadGraphRouter::bFindShortestPath(const uint32_t& uiStart, const uint32_t& uiGoal,
+            int32_t& i32PathCost, std::vector<uint32_t>& vuiPath) const
+    {
+        static thread_local s_SearchBuffers searchBuffers;
+        return (bFindShortestPath(uiStart, uiGoal, i32PathCost, vuiPath, searchBuffers));
+    }
+
+    bool CRoadGraphRouter::bFindShortestPath(const uint32_t& uiStart, const uint32_t& uiGoal,
+            int32_t& i32PathCost, std::vector<uint32_t>& vuiPath, s_SearchBuffers& searchBuffers) const
+    {
+        uint32_t uiNumberVertices = uiGetNumberVertices();
+        vuiPath.clear();
+        if ((uiStart >= uiNumberVertices) || (uiGoal >= uiNumberVertices))
+        {
+            return (false);
+        }
+
+        if (searchBuffers.m_vuiGeneration.size() < uiNumberVertices)
+        {
+            searchBuffers.m_vuiGeneration.assign(uiNumberVertices, 0);
+            searchBuffers.m_vi32CostToCome.resize(uiNumberVertices);
+            searchBuffers.m_vi32CostToGoalBound.resize(uiNumberVertices);
+            searchBuffers.m_vuiParent.resize(uiNumberVertices);
+            searchBuffers.m_uiGeneration = 0;
+        }
+        searchBuffers.m_uiGeneration++;
+        if (searchBuffers.m_uiGeneration == 0)
+        {
+            std::fill(searchBuffers.m_vuiGeneration.begin(), searchBuffers.m_vuiGeneration.end(), 0);
+            searchBuffers.m_uiGeneration = 1;
+        }
+        const uint32_t uiGeneration = searchBuffers.m_uiGeneration;
+
+        searchBuffers.m_vi32LandmarkToGoal.assign(m_vi32LandmarkCosts.begin() + static_cast<size_t> (uiGoal) * m_uiNumberLandmarks,
+                m_vi32LandmarkCosts.begin() + static_cast<size_t> (uiGoal + 1) * m_uiNumberLandmarks);
+
+        // lower bound on the cost from "uiVertex" to the goal, negative if the goal can not be reached
+        auto i32CostToGoalBound = [&](const uint32_t& uiVertex) -> int32_t
+        {
+            int32_t i32Bound(0);
+            const int32_t* pi32LandmarkCosts = m_vi32LandmarkCosts.data() + static_cast<size_t> (uiVertex) * m_uiNumberLandmarks;
+            for (uint32_t uiLandmark = 0; uiLandmark < m_uiNumberLandmarks; uiLandmark++)
+            {
+                int32_t i32LandmarkToGoal = searchBuffers.m_vi32LandmarkToGoal[uiLandmark];
+                if ((pi32LandmarkCosts[uiLandmark] == ROAD_GRAPH_UNREACHED) || (i32LandmarkToGoal == ROAD_GRAPH_UNREACHED))
+                {
+                    if (pi32LandmarkCosts[uiLandmark] != i32LandmarkToGoal)
+                    {
+                        return (-1); // different connected components
+                    }
+                    continue;
+                }
+                i32Bound = (std::max)(i32Bound, std::abs(i32LandmarkToGoal - pi32LandmarkCosts[uiLandmark]));
+            }
+            return (i32Bound);
+        };
+
+        std::vector<std::pair<int64_t, uint32_t> >& vpairOpen = searchBuffers.m_vpairOpen;
+        std::greater<std::pair<int64_t, uint32_t> > fnGreater;
+        vpairOpen.clear();
+
+        int32_t i32StartBound = i32CostToGoalBound(uiStart);
+        if (i32StartBound < 0)
+        {
+            return (false);
+        }
+        searchBuffers.m_vuiGeneration[uiStart] = uiGeneration;
+        searchBuffers.m_vi32CostToCome[uiStart] = 0;
+        searchBuffers.m_vi32CostToGoalBound[uiStart] = i32StartBound;
+        searchBuffers.m_vuiParent[uiStart] = uiStart;
+        vpairOpen.push_back(std::make_pair(static_cast<int64_t> (i32StartBound), uiStart));
+
+        bool bFoundGoal(false);
+        while (!vpairOpen.empty())
+        {
+            std::pop_heap(vpairOpen.begin(), vpairOpen.end(), fnGreater);
+            int64_t i64Estimate = vpairOpen.back().first;
+            uint32_t uiVertex = vpairOpen.back().second;
+            vpairOpen.pop_back();
+            int32_t i32CostToCome = searchBuffers.m_vi32CostToCome[uiVertex];
+            if (i64Estimate != static_cast<int64_t> (i32CostToCome) + searchBuffers.m_vi32CostToGoalBound[uiVertex])
+            {
+                continue; // superseded entry
+            }
+            if (uiVertex == uiGoal)
+            {
+                bFoundGoal = true;
+                break;
+            }
+            for (uint32_t uiNeighbor = m_vuiOffsets[uiVertex]; uiNeighbor < m_vuiOffsets[uiVertex + 1]; uiNeighbor++)
+            {
+                uint32_t uiTarget = m_vuiTargets[uiNeighbor];
+                int64_t i64CostToCome = static_cast<int64_t> (i32CostToCome) + m_vi32Lengths[uiNeighbor];
+                if (searchBuffers.m_vuiGeneration[uiTarget] != uiGeneration)
+                {
+                    // first visit during this search
+                    searchBuffers.m_vuiGeneration[uiTarget] = uiGeneration;
+                    searchBuffers.m_vi32CostToGoalBound[uiTarget] = i32CostToGoalBound(uiTarget);
+                    searchBuffers.m_vi32CostToCome[uiTarget] = ROAD_GRAPH_UNREACHED;
+                }
+                if ((searchBuffers.m_vi32CostToGoalBound[uiTarget] >= 0) && (i64CostToCome < searchBuffers.m_vi32CostToCome[uiTarget]))
+                {
+                    searchBuffers.m_vi32CostToCome[uiTarget] = static_cast<int32_t> (i64CostToCome);
+                    searchBuffers.m_vuiParent[uiTarget] = uiVertex;
+                    vpairOpen.push_back(std::make_pair(i64CostToCome + searchBuffers.m_vi32CostToGoalBound[uiTarget], uiTarget));
+                    std::push_heap(vpairOpen.begin(), vpairOpen.end(), fnGreater);
+                }
+            }
+        }
+
+        if (bFoundGoal)
+        {
+            i32PathCost = searchBuffers.m_vi32CostToCome[uiGoal];
+            for (uint32_t uiVertex = uiGoal;; uiVertex = searchBuffers.m_vuiParent[uiVertex])
+            {
+                vuiPath.push_back(uiVertex);
+                if (uiVertex == uiStart)
+                {
+                    break;
+                }
+            }
+            std::reverse(vuiPath.begin(), vuiPath.end());
+        }
+        return (bFoundGoal);
+    }
+
+}; //namespace n_FrameworkLib
@@ -0,0 +1,98 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+// RoadGraphRouter.h: interface for the CRoadGraphRouter class.
+//
+//  Shortest path queries on an undirected road graph using A* with landmark
+//  (ALT) lower bounds. When the graph is built, the edges are stored in
+//  compressed (CSR) form and the distances from a small set of landmark
+//  vertices, selected by farthest point selection, to all vertices are
+//  computed. By the triangle inequality |d(L,goal) - d(L,v)| is a lower bound
+//  on d(v,goal) for every landmark L, which guides the search much better than
+//  a straight line distance on road networks. The graph is read-only after it
+//  is built, so queries can be made from several threads; each thread reuses
+//  its own search buffers.
+//
+//////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Edge.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace n_FrameworkLib
+{
+
+    class CRoadGraphRouter
+    {
+    public: //typedefs
+        /** search buffers, entries are only valid when their generation matches the current search */
+        struct s_SearchBuffers
+        {
+            uint32_t m_uiGeneration{0};
+            std::vector<uint32_t> m_vuiGeneration;
+            std::vector<int32_t> m_vi32CostToCome;
+            std::vector<int32_t> m_vi32CostToGoalBound;
+            std::vector<uint32_t> m_vuiParent;
+            std::vector<int32_t> m_vi32LandmarkToGoal;
+            /** open set, binary min-heap of (cost to come + cost to goal bound, vertex) */
+            std::vector<std::pair<int64_t, uint32_t> > m_vpairOpen;
+        };
+
+    public: //constructors/destructors
+        CRoadGraphRouter() { };
+
+    public: //methods/functions
+        /** build the graph from "veEdges" (vertex indices, integer lengths) and select up to "uiNumberLandmarks" landmarks */
+        void Build(const CEdge::V_EDGE_t& veEdges, uint32_t uiNumberVertices, uint32_t uiNumberLandmarks = 8);
+
+        void clear();
+
+        bool empty() const
+        {
+            return (m_vuiOffsets.empty());
+        };
+
+        uint32_t uiGetNumberVertices() const
+        {
+            return (m_vuiOffsets.empty() ? 0 : static_cast<uint32_t> (m_vuiOffsets.size() - 1));
+        };
+
+        uint32_t uiGetNumberLandmarks() const
+        {
+            return (m_uiNumberLandmarks);
+        };
+
+        /** find the shortest path, "vuiPath" returns the vertices from "uiStart" to "uiGoal". Uses this thread's search buffers. */
+        bool bFindShortestPath(const uint32_t& uiStart, const uint32_t& uiGoal,
+                int32_t& i32PathCost, std::vector<uint32_t>& vuiPath) const;
+
+        /** find the shortest path using the given search buffers */
+        bool bFindShortestPath(const uint32_t& uiStart, const uint32_t& uiGoal,
+                int32_t& i32PathCost, std::vector<uint32_t>& vuiPath, s_SearchBuffers& searchBuffers) const;
+
+    protected:
+        /** single source shortest path costs from "uiSource" to all vertices */
+        void CalculateCostsFrom(const uint32_t& uiSource, std::vector<int32_t>& vi32Costs) const;
+
+    protected: //storage
+        /** neighbors of vertex "v" are m_vuiTargets[m_vuiOffsets[v]] to m_vuiTargets[m_vuiOffsets[v+1]-1] */
+        std::vector<uint32_t> m_vuiOffsets;
+        std::vector<uint32_t> m_vuiTargets;
+        std::vector<int32_t> m_vi32Lengths;
+
+        uint32_t m_uiNumberLandmarks{0};
+        /** cost from landmark "l" to vertex "v" is m_vi32LandmarkCosts[v * m_uiNumberLandmarks + l] */
+        std::vector<int32_t> m_vi32LandmarkCosts;
+    };
+
+}; //namespace n_FrameworkLib
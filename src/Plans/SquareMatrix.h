@@ -0,0 +1,78 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+// SquareMatrix.h: interface for the CSquareMatrix class.
+//
+//  N x N matrix stored in a single, row-major vector. Rows are indexed like
+//  a vector of vectors (matrix[iRow][iColumn]); row storage is contiguous so
+//  a row can be filled in place (e.g., as a distance map).
+//
+//////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace n_FrameworkLib
+{
+
+    template <typename TYPE>
+    class CSquareMatrix
+    {
+    public: //constructors/destructors
+        CSquareMatrix() { };
+
+        CSquareMatrix(const size_t& szSize, const TYPE& tValue = TYPE())
+        {
+            resize(szSize, tValue);
+        };
+
+    public: //methods/functions
+        void resize(const size_t& szSize, const TYPE& tValue = TYPE())
+        {
+            m_szSize = szSize;
+            m_vtData.assign(szSize * szSize, tValue);
+            m_vtData.shrink_to_fit();
+        };
+
+        void clear()
+        {
+            m_szSize = 0;
+            m_vtData.clear();
+            m_vtData.shrink_to_fit();
+        };
+
+        /** number of rows (and columns) */
+        size_t size() const
+        {
+            return (m_szSize);
+        };
+
+        bool empty() const
+        {
+            return (m_szSize == 0);
+        };
+
+        TYPE* operator[](const size_t& szRow)
+        {
+            return (m_vtData.data() + szRow * m_szSize);
+        };
+
+        const TYPE* operator[](const size_t& szRow) const
+        {
+            return (m_vtData.data() + szRow * m_szSize);
+        };
+
+    protected: //storage
+        size_t m_szSize{0};
+        std::vector<TYPE> m_vtData;
+    };
+
+}; //namespace n_FrameworkLib
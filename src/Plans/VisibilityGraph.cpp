@@ -36,9 +36,12 @@
 #include "visilibity.h"
 #include "Waypoint.h"
 #include "PlanningParameters.h"     //polygon expansion
+#include "UxAS_WorkerPoolExecutor.h"
 
 #include <pugixml.hpp>
 
+#include <algorithm>
+
 
 namespace n_FrameworkLib
 {
@@ -53,6 +56,10 @@ namespace n_FrameworkLib
 #define CCA_CERR_FILE_LINE(MESSAGE) std::cerr << "VG-VG-VG-VG CVisibilityGraph:: " << __FILE__ << ":" << __LINE__ << ":" << MESSAGE << std::endl;std::cerr.flush();
 #define CCA_COUT_FILE_LINE(MESSAGE) std::cout << "VG-VG-VG-VG CVisibilityGraph:: " << __FILE__ << ":" << __LINE__ << ":" << MESSAGE << std::endl;std::cout.flush();
 
+    // smaller polygon edge sets and graphs are searched on the calling thread
+    static const size_t szParallelEdgeCountMinimum(128);
+    static const size_t szParallelVertexCountMinimum(128);
+
     
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////        
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////    
@@ -185,7 +192,7 @@ namespace n_FrameworkLib
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////        
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////    
 
-    CVisibilityGraph::enError CVisibilityGraph::errBuildVisibilityGraph(void)
+    CVisibilityGraph::enError CVisibilityGraph::errBuildVisibilityGraph(const uint32_t& uiThreadCount)
     {
         PRINT_DEBUG("*DEBUG*")
         //TODO:: what to do aboout errors?????
@@ -276,17 +283,50 @@ namespace n_FrameworkLib
             itPolygon->errCalculateDistanceToOtherPolygons(itPolygonBegin, itPolygonEnd);
         }
 
+        // index all of the polygon edges, line segments are only checked against the edges near them
+        V_EDGE_t vePolygonEdges;
+        for (V_POLYGON_IT_t itPolygon = vplygnGetPolygons().begin(); itPolygon != vplygnGetPolygons().end(); itPolygon++)
+        {
+            vePolygonEdges.insert(vePolygonEdges.end(), itPolygon->veGetPolygonEdges().begin(), itPolygon->veGetPolygonEdges().end());
+        }
+        egGetEdgeGrid().Build(vposGetVerticiesBase(), vePolygonEdges);
+
         //based on order of polygons:
         //    create line segments using vertices from current polygon to every other polygon
         //    for each line segment check all polygon edges for intersections
         if (!vplygnGetPolygons().empty())
         {
-            for (V_POLYGON_IT_t itPolygons1 = vplygnGetPolygons().begin(); itPolygons1 != (vplygnGetPolygons().end() - 1); itPolygons1++)
+            // each polygon (only that polygon is modified, by InPolygon) finds its visible edges
+            // to the polygons after it. The edges are added in polygon order, i.e. the same
+            // serially or on the worker pool.
+            const size_t szNumberPolygons(vplygnGetPolygons().size());
+            std::vector<V_EDGE_t> vveEdgesVisible(szNumberPolygons);
+            auto FindVisibleEdges = [this, &vveEdgesVisible](uint32_t uiPolygon)
             {
+                V_POLYGON_IT_t itPolygons1 = vplygnGetPolygons().begin() + uiPolygon;
                 for (V_POLYGON_IT_t itPolygons2 = (itPolygons1 + 1); itPolygons2 != vplygnGetPolygons().end(); itPolygons2++)
                 {
-                    itPolygons1->errFindVisibleEdges(vposGetVerticiesBase(), itPolygons2, veGetEdgesVisibleBase());
+                    itPolygons1->errFindVisibleEdges(vposGetVerticiesBase(), itPolygons2, vveEdgesVisible[uiPolygon], &egGetEdgeGrid());
                 }
+            };
+
+            // small polygon sets are not worth the worker pool hand off
+            const uint32_t uiNumberSearches(static_cast<uint32_t> (szNumberPolygons - 1));
+            if (uiThreadCount == 1 || vePolygonEdges.size() < szParallelEdgeCountMinimum)
+            {
+                for (uint32_t uiPolygon = 0; uiPolygon < uiNumberSearches; uiPolygon++)
+                {
+                    FindVisibleEdges(uiPolygon);
+                }
+            }
+            else
+            {
+                uxas::common::WorkerPoolExecutor::getInstance().parallelFor(uiNumberSearches, FindVisibleEdges);
+            }
+
+            for (auto itEdgesVisible = vveEdgesVisible.begin(); itEdgesVisible != vveEdgesVisible.end(); itEdgesVisible++)
+            {
+                veGetEdgesVisibleBase().insert(veGetEdgesVisibleBase().end(), itEdgesVisible->begin(), itEdgesVisible->end());
             }
         }
 
@@ -301,7 +341,7 @@ namespace n_FrameworkLib
                 {
                     if (itPolygons2 != itPolygons1)
                     {
-                        itPolygons1->errAddExtraVisibleEdges(vposGetVerticiesBase(), itPolygons2, veGetEdgesVisibleBase());
+                        itPolygons1->errAddExtraVisibleEdges(vposGetVerticiesBase(), itPolygons2, veGetEdgesVisibleBase(), &egGetEdgeGrid());
                     }
                 }
             }
@@ -309,12 +349,12 @@ namespace n_FrameworkLib
             itPolygons1 = vplygnGetPolygons().end() - 1;
             for (V_POLYGON_IT_t itPolygons2 = vplygnGetPolygons().begin(); itPolygons2 != (vplygnGetPolygons().end() - 1); itPolygons2++)
             {
-                itPolygons1->errAddExtraVisibleEdges(vposGetVerticiesBase(), itPolygons2, veGetEdgesVisibleBase());
+                itPolygons1->errAddExtraVisibleEdges(vposGetVerticiesBase(), itPolygons2, veGetEdgesVisibleBase(), &egGetEdgeGrid());
             }
         }
         else if (!vplygnGetPolygons().empty()) //if(vplygnGetPolygons().size() > 1)
         {
-            vplygnGetPolygons().begin()->errAddExtraVisibleEdges(vposGetVerticiesBase(), vplygnGetPolygons().begin(), veGetEdgesVisibleBase());
+            vplygnGetPolygons().begin()->errAddExtraVisibleEdges(vposGetVerticiesBase(), vplygnGetPolygons().begin(), veGetEdgesVisibleBase(), &egGetEdgeGrid());
         }
         PRINT_DEBUG("*DEBUG*")
         return (errReturn);
@@ -332,6 +372,7 @@ namespace n_FrameworkLib
 
         std::map<uint32_t, int> muiiIdToIndex;
         //use predefined graph region as the base graph
+        egGetEdgeGrid().clear();
 
         //1) add the nodes (vposGetVerticiesBase()) and create IDs (veGetEdgesVisibleBase())
         vposGetVerticiesBase().clear();
@@ -389,6 +430,7 @@ namespace n_FrameworkLib
 
         uxas::common::utilities::CUnitConversions cUnitConversions;
         vposGetVerticiesBase().clear();
+        egGetEdgeGrid().clear();
 
         pugi::xml_document xmldocConfiguration;
         std::ifstream ifsOperatorXML(osmFile);
@@ -545,54 +587,64 @@ namespace n_FrameworkLib
     
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////        
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////    
-    CVisibilityGraph::enError CVisibilityGraph::errInitializeGraphBase()
+    CVisibilityGraph::enError CVisibilityGraph::errInitializeGraphBase(const uint32_t& uiThreadCount)
     {
         enError errReturn(errNoError);
         PRINT_DEBUG("*DEBUG*")
 
         //TODO:: is there a better way to do this?
         std::vector<int32_t> viEdgeLengths;
+        viEdgeLengths.reserve(veGetEdgesVisibleBase().size());
         for (CEdge::V_EDGE_CONST_IT_t itEdge = veGetEdgesVisibleBase().begin(); itEdge != veGetEdgesVisibleBase().end(); itEdge++)
         {
             viEdgeLengths.push_back(itEdge->iGetLength());
         }
 
         PRINT_DEBUG("*DEBUG*")
+        if (pedglstvecGetGraph())
+        {
+            delete pedglstvecGetGraph();
+        }
         pedglstvecGetGraph() = new GRAPH_LIST_VEC_t(veGetEdgesVisibleBase().begin(),
                 veGetEdgesVisibleBase().end(),
                 viEdgeLengths.begin(),
                 vposGetVerticiesBase().size());
 
-        PRINT_DEBUG("*DEBUG* num_vertices(edglstvecGetGraph())[" << num_vertices(edglstvecGetGraph()) << "]")
-
-        //reintialize the vertex parents
-        vvvtxGetVertexParentBase().clear();
-        V_VERTEX_DESCRIPTOR_t vvtxTemp(num_vertices(edglstvecGetGraph()));
-        vvvtxGetVertexParentBase().resize(num_vertices(edglstvecGetGraph()), vvtxTemp);
+        const size_t szNumberVerticies(num_vertices(edglstvecGetGraph()));
+        PRINT_DEBUG("*DEBUG* num_vertices(edglstvecGetGraph())[" << szNumberVerticies << "]")
 
-        PRINT_DEBUG("*DEBUG* num_vertices(edglstvecGetGraph())[" << num_vertices(edglstvecGetGraph()) << "]")
-        //reintialize the distance matrix
-        vviGetVertexDistancesBase().clear();
-        std::vector<int32_t> viTemp(num_vertices(edglstvecGetGraph()), 0);
-        vviGetVertexDistancesBase().resize(num_vertices(edglstvecGetGraph()), viTemp);
+        //reintialize the vertex parents and the distance matrix (flat, row-major)
+        vvvtxGetVertexParentBase().resize(szNumberVerticies, 0);
+        vviGetVertexDistancesBase().resize(szNumberVerticies, 0);
 
-        PRINT_DEBUG("*DEBUG* num_vertices(edglstvecGetGraph())[" << num_vertices(edglstvecGetGraph()) << "]")
-        for (size_t szCountVerticies = 0; szCountVerticies < num_vertices(edglstvecGetGraph()); szCountVerticies++)
+        // one single source search per vertex. The (read-only) graph is shared by the 
+        // searches, each search fills the source rows of the distance and parent matrices.
+        auto SearchFromSource = [this, szNumberVerticies](uint32_t uiSourceVertex)
         {
-            V_VERTEX_DESCRIPTOR_t vtxParents(num_vertices(edglstvecGetGraph()));
-            std::vector<int32_t> viDistances(num_vertices(edglstvecGetGraph()));
+            V_VERTEX_DESCRIPTOR_t vtxParents(szNumberVerticies);
+            vertex_descriptor vtxCurrent = vertex(uiSourceVertex, edglstvecGetGraph());
+            boost::dijkstra_shortest_paths(edglstvecGetGraph(), vtxCurrent,
+                    boost::predecessor_map(&vtxParents[0]).distance_map(vviGetVertexDistancesBase()[uiSourceVertex]));
 
-            vertex_descriptor vtxCurrent = vertex(szCountVerticies, edglstvecGetGraph());
-            boost::dijkstra_shortest_paths(edglstvecGetGraph(), vtxCurrent, boost::predecessor_map(&vtxParents[0]).distance_map(&viDistances[0]));
-
-            vvvtxGetVertexParentBase()[szCountVerticies] = vtxParents;
+            uint32_t* puiParentRow = vvvtxGetVertexParentBase()[uiSourceVertex];
+            for (size_t szCountVerticies = 0; szCountVerticies < szNumberVerticies; szCountVerticies++)
+            {
+                puiParentRow[szCountVerticies] = static_cast<uint32_t> (vtxParents[szCountVerticies]);
+            }
+        };
 
-            //TODO:: need to calculate the a vector of the distance matrix using distances and parents
-            for (size_t szCountVerticies2 = 0; szCountVerticies2 < num_vertices(edglstvecGetGraph()); szCountVerticies2++)
+        // small graphs are not worth the worker pool hand off
+        if (uiThreadCount == 1 || szNumberVerticies < szParallelVertexCountMinimum)
+        {
+            for (uint32_t uiSourceVertex = 0; uiSourceVertex < szNumberVerticies; uiSourceVertex++)
             {
-                vviGetVertexDistancesBase()[szCountVerticies][szCountVerticies2] = viDistances[szCountVerticies2];
-            } //for(int szCountVerticies2=0;szCountVerticies2<num_vertices(edglstvecGetGraph());szCountVerticies2++)
-        } //for(int szCountVerticies=0;szCountVerticies<num_vertices(edglstvecGetGraph());szCountVerticies++)
+                SearchFromSource(uiSourceVertex);
+            }
+        }
+        else
+        {
+            uxas::common::WorkerPoolExecutor::getInstance().parallelFor(static_cast<uint32_t> (szNumberVerticies), SearchFromSource);
+        }
         PRINT_DEBUG("*DEBUG*")
         return (errReturn);
     }
@@ -604,6 +656,11 @@ namespace n_FrameworkLib
     bool CVisibilityGraph::bFindIntersection(const V_POSITION_t&vposVerticiesBase, V_POLYGON_t& vPolygons, const CPosition& posPositionA, const CPosition& posPositionB,
             const int32_t& i32IndexA, const int32_t& i32IndexB)
     {
+        if ((&vPolygons == &vplygnGetPolygons()) && (&vposVerticiesBase == &vposGetVerticiesBase()) && !egGetEdgeGrid().empty())
+        {
+            return (egGetEdgeGrid().bIntersection(vposVerticiesBase, posPositionA, posPositionB, i32IndexA, i32IndexB));
+        }
+
         bool bIntersects(false);
         for (auto itPolygons = vPolygons.begin(); itPolygons != vPolygons.end(); itPolygons++)
         {
@@ -692,7 +749,7 @@ namespace n_FrameworkLib
             CPathInformation pthShortestPath = (*ptr_mipthDistanceMapStart)[i32IdEnd];
             if (pthShortestPath.iGetIndexBaseBegin() >= 0)
             {
-                int iSanityCheck(static_cast<int> (vvvtxGetVertexParentBase()[pthShortestPath.iGetIndexBaseBegin()].size()));
+                int iSanityCheck(static_cast<int> (vvvtxGetVertexParentBase().size()));
                 vertex_descriptor vtxBegin = static_cast<vertex_descriptor> (pthShortestPath.iGetIndexBaseBegin());
                 vertex_descriptor vtxCurrent = vvvtxGetVertexParentBase()[pthShortestPath.iGetIndexBaseBegin()][pthShortestPath.iGetIndexBaseEnd()];
                 while (vtxCurrent != vtxBegin)
@@ -877,7 +934,7 @@ namespace n_FrameworkLib
             CPathInformation pthShortestPath = (*ptr_mipthDistanceMapStart)[i32IdEnd];
             if (pthShortestPath.iGetIndexBaseBegin() >= 0)
             {
-                int iSanityCheck(static_cast<int> (vvvtxGetVertexParentBase()[pthShortestPath.iGetIndexBaseBegin()].size()));
+                int iSanityCheck(static_cast<int> (vvvtxGetVertexParentBase().size()));
                 vertex_descriptor vtxBegin = static_cast<vertex_descriptor> (pthShortestPath.iGetIndexBaseBegin());
                 vertex_descriptor vtxCurrent = vvvtxGetVertexParentBase()[pthShortestPath.iGetIndexBaseBegin()][pthShortestPath.iGetIndexBaseEnd()];
                 while (vtxCurrent != vtxBegin)
@@ -1436,7 +1493,7 @@ namespace n_FrameworkLib
                 posLastVertexBeforeObjective = vposGetVerticiesBase()[static_cast<vertex_descriptor> (pthifPath.iGetIndexBaseEnd())];
                 dposPathPositions.push_front(vposGetVerticiesBase()[static_cast<vertex_descriptor> (pthifPath.iGetIndexBaseEnd())]);
 
-                int iSanityCheck(static_cast<int> (vvvtxGetVertexParentBase()[pthifPath.iGetIndexBaseBegin()].size()));
+                int iSanityCheck(static_cast<int> (vvvtxGetVertexParentBase().size()));
                 vertex_descriptor vtxBegin = static_cast<vertex_descriptor> (pthifPath.iGetIndexBaseBegin());
                 vertex_descriptor vtxCurrent = vvvtxGetVertexParentBase()[pthifPath.iGetIndexBaseBegin()][pthifPath.iGetIndexBaseEnd()];
                 while (vtxCurrent != vtxBegin)
@@ -34,6 +34,7 @@
 #include "PlanningParameters.h"
 #include "TrajectoryParameters.h"
 #include "PathInformation.h"
+#include "SquareMatrix.h"
 
 #include "uxas/messages/route/GraphRegion.h"
 
@@ -86,6 +87,9 @@ namespace n_FrameworkLib
         typedef std::vector<V_VERTEX_DESCRIPTOR_t>::iterator V_V_VERTEX_DESCRIPTOR_IT_t;
         typedef std::vector<V_VERTEX_DESCRIPTOR_t>::const_iterator V_V_VERTEX_DESCRIPTOR_CONST_IT_t;
 
+        typedef CSquareMatrix<int32_t> SQM_I32_DISTANCE_t;     //[u][v] => shortest distance from u to v
+        typedef CSquareMatrix<uint32_t> SQM_UI32_PARENT_t;     //[u][v] => index of the parent vertex of v on the shortest path from u
+
 
     typedef boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS, boost::no_property, boost::property<boost::edge_weight_t, int, boost::property<boost::edge_weight2_t, int> > > GRAPH_VEC_VEC_t;
         //    typedef std::pair<int,int> Edge;
@@ -134,6 +138,7 @@ namespace n_FrameworkLib
             veGetEdgesVisibleBase() = rhs.veGetEdgesVisibleBase();
             vviGetVertexDistancesBase() = rhs.vviGetVertexDistancesBase();
             vvvtxGetVertexParentBase() = rhs.vvvtxGetVertexParentBase();
+            egGetEdgeGrid() = rhs.egGetEdgeGrid();
             if (pedglstvecGetGraph()) {
                 delete pedglstvecGetGraph();
             }
@@ -145,7 +150,8 @@ namespace n_FrameworkLib
 
     public: //methods/functions
         enError errExpandAndMergePolygons(void);
-        enError errBuildVisibilityGraph(void);
+        /** builds the visible edges between the polygons on the shared worker pool (uiThreadCount == 1 => on the calling thread) */
+        enError errBuildVisibilityGraph(const uint32_t& uiThreadCount = 0);
         enError errBuildVisibilityGraph(PTR_GRAPH_REGION_t& ptr_GraphRegion);
         enError errBuildVisibilityGraphWithOsm(const string& osmFile);
         
@@ -165,7 +171,10 @@ namespace n_FrameworkLib
 #endif  //STEVETEST
 
         
-        enError errInitializeGraphBase();
+        /** build the base graph and the all-pairs shortest path distances and
+         * parents (one single source search per vertex, searches run in parallel
+         * on the shared worker pool). uiThreadCount == 1 => on the calling thread */
+        enError errInitializeGraphBase(const uint32_t& uiThreadCount = 0);
         bool bBoundaryViolationExists(const V_WAYPOINT_t& vWaypoints, stringstream& sstrErrorMessage);
 
         enError errSmoothPath(D_POSITION_t& dposPath, const double& dTurnRadius_m,
@@ -214,6 +223,7 @@ namespace n_FrameworkLib
 
         enError errAddPolygon(const int& iUniqueID, V_POSITION_IT_t itBegin, V_POSITION_IT_t itEnd, bool bKeepInZone = true, double dPolygonExpansionDistance = 0.0) {
             enError errReturn(errNoError);
+            egGetEdgeGrid().clear(); // rebuilt with the visibility graph
 
             // if there is a polygon with this ID, then delete it and insert this one
             bool bExistingID(false);
@@ -269,6 +279,7 @@ namespace n_FrameworkLib
 
         enError errFinalizePolygons(void) {
             enError errReturn(errNoError);
+            egGetEdgeGrid().clear(); // rebuilt with the visibility graph
 
             //merge must be after finalize, cause finalize expands polygons
             errReturn = errExpandAndMergePolygons();
@@ -733,22 +744,30 @@ namespace n_FrameworkLib
             return (m_veEdgesVisibleBase);
         };
 
-        std::vector<std::vector<int32_t>>& vviGetVertexDistancesBase() {
+        SQM_I32_DISTANCE_t& vviGetVertexDistancesBase() {
             return (m_vviVertexDistancesBase);
         };
 
-        const std::vector<std::vector<int32_t>>& vviGetVertexDistancesBase()const {
+        const SQM_I32_DISTANCE_t& vviGetVertexDistancesBase()const {
             return (m_vviVertexDistancesBase);
         };
 
-        V_V_VERTEX_DESCRIPTOR_t& vvvtxGetVertexParentBase() {
+        SQM_UI32_PARENT_t& vvvtxGetVertexParentBase() {
             return (m_vvvtxVertexParentBase);
         };
 
-        const V_V_VERTEX_DESCRIPTOR_t& vvvtxGetVertexParentBase()const {
+        const SQM_UI32_PARENT_t& vvvtxGetVertexParentBase()const {
             return (m_vvvtxVertexParentBase);
         };
 
+        CEdgeGrid& egGetEdgeGrid() {
+            return (m_egEdgeGrid);
+        };
+
+        const CEdgeGrid& egGetEdgeGrid()const {
+            return (m_egEdgeGrid);
+        };
+
         GRAPH_LIST_VEC_t& edglstvecGetGraph() {
             return (*m_pedglstvecGraph);
         };
@@ -785,8 +804,9 @@ namespace n_FrameworkLib
 
         //visibility graph storage
         V_EDGE_t m_veEdgesVisibleBase;
-        std::vector<std::vector<int32_t>> m_vviVertexDistancesBase; //m_viVertexDistances[u][v] => shortest distance from u to v
-        V_V_VERTEX_DESCRIPTOR_t m_vvvtxVertexParentBase; //m_viVertexParent[u][v] => index of the parent vertex of v on route to the shortest path ro u
+        SQM_I32_DISTANCE_t m_vviVertexDistancesBase; //m_viVertexDistances[u][v] => shortest distance from u to v (flat, row-major)
+        SQM_UI32_PARENT_t m_vvvtxVertexParentBase; //m_viVertexParent[u][v] => index of the parent vertex of v on route to the shortest path ro u (flat, row-major)
+        CEdgeGrid m_egEdgeGrid; //spatial index of the polygon edges, built with the visible edges (empty => check all polygon edges)
         GRAPH_LIST_VEC_t* m_pedglstvecGraph;
 
         // storage for generating waypoint paths
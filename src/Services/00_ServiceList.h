@@ -64,6 +64,7 @@
 
 // data
 #include "MessageLoggerDataService.h"
+#include "MessageLogReplayService.h"
 #include "AutomationDiagramDataService.h"
 #ifdef AFRL_INTERNAL_ENABLED
 #include "VicsLoggerDataService.h"
@@ -143,6 +144,7 @@
 
 // data
 {auto svc = uxas::stduxas::make_unique<uxas::service::data::MessageLoggerDataService>();}
+{auto svc = uxas::stduxas::make_unique<uxas::service::data::MessageLogReplayService>();}
 {auto svc = uxas::stduxas::make_unique<uxas::service::data::AutomationDiagramDataService>();}
 
 // task
@@ -0,0 +1,711 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   AssignmentSolverEngines.cpp
+ */
+
+#include "AssignmentSolverEngines.h"
+
+#include "UxAS_WorkerPoolExecutor.h"
+
+#include <algorithm>  // sort, remove
+#include <cmath>      // exp, pow
+#include <cstdint>
+#include <map>
+#include <set>
+
+namespace uxas
+{
+namespace service
+{
+
+/*! \brief  weight of the total time in the annealing energy, the maximum time is minimized first*/
+static const double s_totalTimeWeight = 0.01;
+/*! \brief  maximum insertion noise, relative to the maximum time of the initial assignment*/
+static const double s_insertionNoiseFactor = 0.3;
+
+//////////////////////////////////////////////////////////////////////////
+// large neighborhood search
+//////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<c_Node_Base> c_Node_LargeNeighborhoodSearch::clone()
+{
+    return (std::unique_ptr<c_Node_Base>(new c_Node_LargeNeighborhoodSearch(*this)));
+}
+
+c_Node_LargeNeighborhoodSearch::c_Node_LargeNeighborhoodSearch(const c_Node_LargeNeighborhoodSearch & rhs) //copy constructor
+: c_Node_Base(rhs) { };
+
+void c_Node_LargeNeighborhoodSearch::ExpandNode()
+{
+    auto rootNode = initializeSearch();
+
+    uint32_t numberChains = (std::max)(getNumberSearchThreads(), static_cast<uint32_t> (1));
+    if (numberChains <= 1)
+    {
+        searchChain(*rootNode, 0);
+    }
+    else
+    {
+        // the chains only share the candidate assignment, chain "n" always uses the same
+        // random numbers, so the result does not depend on the scheduling of the threads
+        std::vector<std::unique_ptr<c_Node_LargeNeighborhoodSearch> > searchNodes;
+        for (uint32_t chain = 0; chain < numberChains; chain++)
+        {
+            searchNodes.push_back(std::unique_ptr<c_Node_LargeNeighborhoodSearch>(new c_Node_LargeNeighborhoodSearch(*this)));
+            searchNodes.back()->m_nodeArena.initialize(static_cast<uint32_t> (m_staticAssignmentParameters->m_vehicleIds.size()));
+        }
+        uxas::common::WorkerPoolExecutor::getInstance().parallelFor(numberChains,
+            [&](uint32_t chain)
+            {
+                searchNodes[chain]->searchChain(*rootNode, chain);
+            });
+    }
+    addNodeCounts();
+
+    m_nodeArena.release(0);
+}
+
+void c_Node_LargeNeighborhoodSearch::searchChain(const c_AssignmentNode& rootNode, const uint32_t& chainIndex)
+{
+    size_t numberVehicles = m_staticAssignmentParameters->m_vehicleIds.size();
+    m_subtreeIndex = chainIndex;
+    m_generator.seed(chainIndex + 1);
+    m_initialTimes_ms.assign(rootNode.m_vehicleTravelTimeTotal_ms, rootNode.m_vehicleTravelTimeTotal_ms + numberVehicles);
+    m_isNextTaskOption.assign(m_staticAssignmentParameters->m_taskOptionIds.size(), 0);
+
+    // initial assignment, cheapest insertion
+    c_VehicleRoutes currentRoutes;
+    currentRoutes.m_routes.resize(numberVehicles);
+    m_insertionNoiseMaximum_ms = 0.0;
+    if (!isRepaired(currentRoutes))
+    {
+        addReasonForNoAssignment("ASSIGNMENT_WARNING:: large neighborhood search did not find a feasible assignment!");
+        addNodeCounts();
+        return;
+    }
+    m_insertionNoiseMaximum_ms = s_insertionNoiseFactor * static_cast<double> (currentRoutes.m_maximumTime_ms);
+    m_numberNodesVisited++;
+    offerCandidateAssignment(rootNode);
+
+    // simulated annealing on the maximum time, the weighted total time breaks ties
+    auto energy = [](const c_VehicleRoutes & vehicleRoutes)
+    {
+        return (static_cast<double> (vehicleRoutes.m_maximumTime_ms) + static_cast<double> (vehicleRoutes.m_totalTime_ms) * s_totalTimeWeight);
+    };
+    double temperatureStart = 0.1 * (std::max)(static_cast<double> (currentRoutes.m_maximumTime_ms), 1.0);
+    double temperatureEnd = 0.01 * temperatureStart;
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    int64_t numberIterations = m_staticAssignmentParameters->m_numberSolverIterations;
+    for (int64_t iteration = 0; (iteration < numberIterations) && !m_staticAssignmentParameters->m_isStopCondition; iteration++)
+    {
+        m_numberNodesVisited++;
+        c_VehicleRoutes candidateRoutes = currentRoutes;
+        destroyRoutes(candidateRoutes);
+        if (isRepaired(candidateRoutes))
+        {
+            m_numberNodesAdded++;
+            // the route times do not include waiting for prerequisites, every repaired
+            // assignment is offered (m_sequence is its order), the best true cost is kept
+            offerCandidateAssignment(rootNode);
+            double temperature = temperatureStart * std::pow(temperatureEnd / temperatureStart, static_cast<double> (iteration) / numberIterations);
+            double energyIncrease = energy(candidateRoutes) - energy(currentRoutes);
+            if ((energyIncrease <= 0.0) || (uniform(m_generator) < std::exp(-energyIncrease / temperature)))
+            {
+                currentRoutes = std::move(candidateRoutes);
+            }
+        }
+        else
+        {
+            m_numberNodesPruned++;
+        }
+        addNodeCounts();
+    }
+    addNodeCounts();
+}
+
+bool c_Node_LargeNeighborhoodSearch::isSequenced(const c_VehicleRoutes& vehicleRoutes, const size_t& numberSequenced)
+{
+    size_t numberVehicles = vehicleRoutes.m_routes.size();
+    m_sequence.resize((std::min)(numberSequenced, m_sequence.size()));
+    m_assignedTaskOptions.clear();
+    m_isAssignedTaskOption.assign(m_staticAssignmentParameters->m_compiledAlgebra.getNumberWords(), 0);
+    m_routePositions.assign(numberVehicles, 0);
+    std::vector<int64_t> vehicleTimes_ms(m_initialTimes_ms);
+    auto addTaskOption = [&](const uint32_t & vehicle)
+    {
+        uint32_t position = m_routePositions[vehicle];
+        uint32_t taskOption = vehicleRoutes.m_routes[vehicle][position];
+        uint32_t fromLocation = (position == 0) ? (0) : (vehicleRoutes.m_routes[vehicle][position - 1] + 1);
+        vehicleTimes_ms[vehicle] += (std::max)(m_staticAssignmentParameters->getTravelTime_ms(vehicle, fromLocation, taskOption), static_cast<int64_t> (0)) +
+                (std::max)(m_staticAssignmentParameters->getTaskTime_ms(vehicle, taskOption), static_cast<int64_t> (0));
+        m_routePositions[vehicle]++;
+        return (taskOption);
+    };
+    for (auto itAssignment = m_sequence.begin(); itAssignment != m_sequence.end(); itAssignment++)
+    {
+        pushAssignedTaskOption(addTaskOption(itAssignment->first));
+    }
+
+    uint32_t numberTaskOptions = static_cast<uint32_t> (m_staticAssignmentParameters->m_taskOptionIds.size());
+    while (true)
+    {
+        searchNextTaskOptions(m_nextTaskOptions);
+        // process algebra actions without task option information can not be assigned
+        m_nextTaskOptions.erase(std::remove_if(m_nextTaskOptions.begin(), m_nextTaskOptions.end(),
+                                               [numberTaskOptions](const uint32_t & taskOption)
+                                               {
+                                                   return (taskOption >= numberTaskOptions);
+                                               }), m_nextTaskOptions.end());
+        for (auto itTaskOption = m_nextTaskOptions.begin(); itTaskOption != m_nextTaskOptions.end(); itTaskOption++)
+        {
+            m_isNextTaskOption[*itTaskOption] = 1;
+        }
+        if (m_nextTaskOptions.empty())
+        {
+            return (true);
+        }
+
+        // the vehicle that gets to its next (accepted) task option first
+        uint32_t nextVehicle = UINT32_MAX;
+        for (uint32_t vehicle = 0; vehicle < numberVehicles; vehicle++)
+        {
+            const auto& route = vehicleRoutes.m_routes[vehicle];
+            if ((m_routePositions[vehicle] < route.size()) && (m_isNextTaskOption[route[m_routePositions[vehicle]]] != 0) &&
+                    ((nextVehicle == UINT32_MAX) || (vehicleTimes_ms[vehicle] < vehicleTimes_ms[nextVehicle])))
+            {
+                nextVehicle = vehicle;
+            }
+        }
+        for (auto itTaskOption = m_nextTaskOptions.begin(); itTaskOption != m_nextTaskOptions.end(); itTaskOption++)
+        {
+            m_isNextTaskOption[*itTaskOption] = 0;
+        }
+        if (nextVehicle == UINT32_MAX)
+        {
+            return (false);
+        }
+
+        uint32_t taskOption = addTaskOption(nextVehicle);
+        m_sequence.push_back(std::make_pair(nextVehicle, taskOption));
+        pushAssignedTaskOption(taskOption);
+    }
+}
+
+size_t c_Node_LargeNeighborhoodSearch::getNumberSequencedBefore(const uint32_t& vehicleIndex, const size_t& position) const
+{
+    if (position <= m_routePositions[vehicleIndex])
+    {
+        size_t numberTaken = 0;
+        for (size_t step = 0; step < m_sequence.size(); step++)
+        {
+            if (numberTaken == position)
+            {
+                return (step);
+            }
+            numberTaken += (m_sequence[step].first == vehicleIndex) ? (1) : (0);
+        }
+    }
+    return (m_sequence.size());
+}
+
+bool c_Node_LargeNeighborhoodSearch::isRepaired(c_VehicleRoutes& vehicleRoutes)
+{
+    // half of the repairs insert at the cheapest positions, the others with noisy costs
+    m_insertionNoise_ms = (std::uniform_int_distribution<uint32_t>(0, 1)(m_generator) == 0) ? (0.0) : (m_insertionNoiseMaximum_ms);
+    size_t numberAttempts = 4 * m_staticAssignmentParameters->m_taskOptionIds.size() + 16;
+    bool isComplete = isSequenced(vehicleRoutes, 0);
+    for (size_t attempt = 0; attempt < numberAttempts; attempt++)
+    {
+        if (isComplete)
+        {
+            // task options not taken are not needed, e.g. alternatives of a task that was assigned
+            for (uint32_t vehicle = 0; vehicle < vehicleRoutes.m_routes.size(); vehicle++)
+            {
+                vehicleRoutes.m_routes[vehicle].resize(m_routePositions[vehicle]);
+            }
+            return (isTimesCalculated(vehicleRoutes));
+        }
+        isTimesCalculated(vehicleRoutes);
+
+        // insert at the cheapest position. If the routes then can not be sequenced further,
+        // insert after the sequenced task options instead, that always makes progress
+        // the sequence is resumed from the part the insertion does not change
+        c_VehicleRoutes savedRoutes = vehicleRoutes;
+        std::vector<std::pair<uint32_t, uint32_t> > sequence = m_sequence;
+        std::vector<uint32_t> routePositions = m_routePositions;
+        std::vector<uint32_t> nextTaskOptions = m_nextTaskOptions;
+        size_t numberSequenced(0);
+        if (!isInserted(vehicleRoutes, false, numberSequenced))
+        {
+            return (false);
+        }
+        isComplete = isSequenced(vehicleRoutes, numberSequenced);
+        if (!isComplete && (m_sequence.size() <= sequence.size()))
+        {
+            vehicleRoutes = std::move(savedRoutes);
+            m_sequence = std::move(sequence);
+            m_routePositions = std::move(routePositions);
+            m_nextTaskOptions = std::move(nextTaskOptions);
+            if (!isInserted(vehicleRoutes, true, numberSequenced))
+            {
+                return (false);
+            }
+            isComplete = isSequenced(vehicleRoutes, numberSequenced);
+        }
+    }
+    return (false);
+}
+
+bool c_Node_LargeNeighborhoodSearch::isInserted(c_VehicleRoutes& vehicleRoutes, const bool& isAfterSequenced, size_t& numberSequenced)
+{
+    std::uniform_real_distribution<double> noise(-m_insertionNoise_ms, m_insertionNoise_ms);
+    bool isFound(false);
+    double bestCost_ms(0.0);
+    uint32_t bestTaskOption(0);
+    uint32_t bestVehicle(0);
+    size_t bestPosition(0);
+    for (auto itTaskOption = m_nextTaskOptions.begin(); itTaskOption != m_nextTaskOptions.end(); itTaskOption++)
+    {
+        uint32_t taskOption = *itTaskOption;
+        for (uint32_t vehicle = 0; vehicle < vehicleRoutes.m_routes.size(); vehicle++)
+        {
+            int64_t taskTime_ms = m_staticAssignmentParameters->getTaskTime_ms(vehicle, taskOption);
+            if ((m_staticAssignmentParameters->m_isVehicleInformation[vehicle] == 0) || (taskTime_ms < 0))
+            {
+                continue;
+            }
+            const auto& route = vehicleRoutes.m_routes[vehicle];
+            int64_t maxVehicleTravelTime_ms = m_staticAssignmentParameters->m_maxVehicleTravelTimes_ms[vehicle];
+            size_t firstPosition = (isAfterSequenced) ? (m_routePositions[vehicle]) : (0);
+            for (size_t position = firstPosition; position <= route.size(); position++)
+            {
+                uint32_t fromLocation = (position == 0) ? (0) : (route[position - 1] + 1);
+                int64_t travelTime_ms = m_staticAssignmentParameters->getTravelTime_ms(vehicle, fromLocation, taskOption);
+                if (travelTime_ms < 0)
+                {
+                    continue;
+                }
+                int64_t increase_ms = travelTime_ms + taskTime_ms;
+                if (position < route.size())
+                {
+                    int64_t travelTimeToNext_ms = m_staticAssignmentParameters->getTravelTime_ms(vehicle, taskOption + 1, route[position]);
+                    if (travelTimeToNext_ms < 0)
+                    {
+                        continue;
+                    }
+                    increase_ms += travelTimeToNext_ms -
+                            (std::max)(m_staticAssignmentParameters->getTravelTime_ms(vehicle, fromLocation, route[position]), static_cast<int64_t> (0));
+                }
+                int64_t routeTime_ms = vehicleRoutes.m_routeTimes_ms[vehicle] + increase_ms;
+                if ((maxVehicleTravelTime_ms >= 0) && (routeTime_ms >= maxVehicleTravelTime_ms))
+                {
+                    continue;
+                }
+                // increase of the annealing energy (maximum time, the weighted total time breaks ties)
+                int64_t maximumTime_ms = (std::max)(routeTime_ms, vehicleRoutes.m_maximumTime_ms);
+                double cost_ms = static_cast<double> (maximumTime_ms - vehicleRoutes.m_maximumTime_ms) + static_cast<double> (increase_ms) * s_totalTimeWeight;
+                if (m_insertionNoise_ms > 0.0)
+                {
+                    cost_ms = (std::max)(cost_ms + noise(m_generator), 0.0);
+                }
+                if (!isFound || (cost_ms < bestCost_ms))
+                {
+                    isFound = true;
+                    bestCost_ms = cost_ms;
+                    bestTaskOption = taskOption;
+                    bestVehicle = vehicle;
+                    bestPosition = position;
+                }
+            }
+        }
+    }
+
+    if (isFound)
+    {
+        numberSequenced = getNumberSequencedBefore(bestVehicle, bestPosition);
+        // the task option is moved if it is already in one of the routes, after the sequenced task options
+        for (uint32_t vehicle = 0; vehicle < vehicleRoutes.m_routes.size(); vehicle++)
+        {
+            auto& route = vehicleRoutes.m_routes[vehicle];
+            auto itTaskOption = std::find(route.begin(), route.end(), bestTaskOption);
+            if (itTaskOption != route.end())
+            {
+                numberSequenced = (std::min)(numberSequenced, getNumberSequencedBefore(vehicle, itTaskOption - route.begin()));
+                if ((vehicle == bestVehicle) && (static_cast<size_t> (itTaskOption - route.begin()) < bestPosition))
+                {
+                    bestPosition--;
+                }
+                route.erase(itTaskOption);
+            }
+        }
+        auto& route = vehicleRoutes.m_routes[bestVehicle];
+        route.insert(route.begin() + bestPosition, bestTaskOption);
+    }
+    return (isFound);
+}
+
+void c_Node_LargeNeighborhoodSearch::destroyRoutes(c_VehicleRoutes& vehicleRoutes)
+{
+    std::vector<std::pair<uint32_t, uint32_t> > routeItems; // (vehicle, position)
+    for (uint32_t vehicle = 0; vehicle < vehicleRoutes.m_routes.size(); vehicle++)
+    {
+        for (uint32_t position = 0; position < vehicleRoutes.m_routes[vehicle].size(); position++)
+        {
+            routeItems.push_back(std::make_pair(vehicle, position));
+        }
+    }
+    if (routeItems.empty())
+    {
+        return;
+    }
+    size_t numberRemovedMaximum = (std::min)(routeItems.size(), (std::max)(static_cast<size_t> (4), (3 * routeItems.size()) / 10));
+    size_t numberRemoved = std::uniform_int_distribution<size_t>(1, numberRemovedMaximum)(m_generator);
+
+    // the items are ordered so that the first "numberRemoved" are removed
+    std::shuffle(routeItems.begin(), routeItems.end(), m_generator);
+    switch (std::uniform_int_distribution<uint32_t>(0, 2)(m_generator))
+    {
+        default:
+            // random task options
+            break;
+        case 1:
+        {
+            // task options of the vehicle with the longest route first
+            uint32_t longestVehicle = static_cast<uint32_t> (std::max_element(vehicleRoutes.m_routeTimes_ms.begin(), vehicleRoutes.m_routeTimes_ms.end()) -
+                    vehicleRoutes.m_routeTimes_ms.begin());
+            std::stable_partition(routeItems.begin(), routeItems.end(),
+                                  [longestVehicle](const std::pair<uint32_t, uint32_t>& routeItem)
+                                  {
+                                      return (routeItem.first == longestVehicle);
+                                  });
+            break;
+        }
+        case 2:
+        {
+            // a random task option and the task options closest to it
+            uint32_t seedVehicle = routeItems.front().first;
+            uint32_t seedTaskOption = vehicleRoutes.m_routes[seedVehicle][routeItems.front().second];
+            std::vector<std::pair<int64_t, std::pair<uint32_t, uint32_t> > > distanceVsRouteItem;
+            for (auto itRouteItem = routeItems.begin() + 1; itRouteItem != routeItems.end(); itRouteItem++)
+            {
+                int64_t travelTime_ms = m_staticAssignmentParameters->getTravelTime_ms(seedVehicle, seedTaskOption + 1, vehicleRoutes.m_routes[itRouteItem->first][itRouteItem->second]);
+                distanceVsRouteItem.push_back(std::make_pair((travelTime_ms < 0) ? (INT64_MAX) : (travelTime_ms), *itRouteItem));
+            }
+            std::sort(distanceVsRouteItem.begin(), distanceVsRouteItem.end());
+            for (size_t item = 0; item < distanceVsRouteItem.size(); item++)
+            {
+                routeItems[item + 1] = distanceVsRouteItem[item].second;
+            }
+            break;
+        }
+    }
+
+    for (size_t item = 0; item < numberRemoved; item++)
+    {
+        vehicleRoutes.m_routes[routeItems[item].first][routeItems[item].second] = UINT32_MAX;
+    }
+    for (auto itRoute = vehicleRoutes.m_routes.begin(); itRoute != vehicleRoutes.m_routes.end(); itRoute++)
+    {
+        itRoute->erase(std::remove(itRoute->begin(), itRoute->end(), UINT32_MAX), itRoute->end());
+    }
+    isTimesCalculated(vehicleRoutes);
+}
+
+bool c_Node_LargeNeighborhoodSearch::isTimesCalculated(c_VehicleRoutes& vehicleRoutes)
+{
+    bool isFeasible(true);
+    vehicleRoutes.m_routeTimes_ms.resize(vehicleRoutes.m_routes.size());
+    vehicleRoutes.m_maximumTime_ms = 0;
+    vehicleRoutes.m_totalTime_ms = 0;
+    for (uint32_t vehicle = 0; vehicle < vehicleRoutes.m_routes.size(); vehicle++)
+    {
+        int64_t routeTime_ms = m_initialTimes_ms[vehicle];
+        uint32_t fromLocation = 0;
+        for (auto itTaskOption = vehicleRoutes.m_routes[vehicle].begin(); itTaskOption != vehicleRoutes.m_routes[vehicle].end(); itTaskOption++)
+        {
+            int64_t travelTime_ms = m_staticAssignmentParameters->getTravelTime_ms(vehicle, fromLocation, *itTaskOption);
+            int64_t taskTime_ms = m_staticAssignmentParameters->getTaskTime_ms(vehicle, *itTaskOption);
+            isFeasible = isFeasible && (travelTime_ms >= 0) && (taskTime_ms >= 0);
+            routeTime_ms += (std::max)(travelTime_ms, static_cast<int64_t> (0)) + (std::max)(taskTime_ms, static_cast<int64_t> (0));
+            fromLocation = *itTaskOption + 1;
+        }
+        int64_t maxVehicleTravelTime_ms = m_staticAssignmentParameters->m_maxVehicleTravelTimes_ms[vehicle];
+        if (!vehicleRoutes.m_routes[vehicle].empty() && (maxVehicleTravelTime_ms >= 0) && (routeTime_ms >= maxVehicleTravelTime_ms))
+        {
+            isFeasible = false;
+        }
+        vehicleRoutes.m_routeTimes_ms[vehicle] = routeTime_ms;
+        vehicleRoutes.m_maximumTime_ms = (std::max)(vehicleRoutes.m_maximumTime_ms, routeTime_ms);
+        vehicleRoutes.m_totalTime_ms += routeTime_ms;
+    }
+    return (isFeasible);
+}
+
+void c_Node_LargeNeighborhoodSearch::offerCandidateAssignment(const c_AssignmentNode& rootNode)
+{
+    size_t numberNodes = m_nodeArena.size();
+    const c_AssignmentNode* node = &rootNode;
+    for (auto itAssignment = m_sequence.begin(); (node != nullptr) && (itAssignment != m_sequence.end()); itAssignment++)
+    {
+        node = appendAssignment(*node, itAssignment->first, itAssignment->second);
+    }
+    if (node != nullptr)
+    {
+        acceptCandidateAssignment(*node);
+    }
+    m_nodeArena.release(numberNodes);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Hungarian
+//////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<c_Node_Base> c_Node_Hungarian::clone()
+{
+    return (std::unique_ptr<c_Node_Base>(new c_Node_Hungarian(*this)));
+}
+
+c_Node_Hungarian::c_Node_Hungarian(const c_Node_Hungarian & rhs) //copy constructor
+: c_Node_Base(rhs) { };
+
+bool c_Node_Hungarian::isApplicable(const size_t& numberVehicles)
+{
+    std::set<int64_t> taskIds;
+    for (auto itTaskOptionInformation = m_staticAssignmentParameters->m_taskOptionIdVsInformation.begin();
+            itTaskOptionInformation != m_staticAssignmentParameters->m_taskOptionIdVsInformation.end(); itTaskOptionInformation++)
+    {
+        taskIds.insert(c_TaskAssignmentState::getTaskID(itTaskOptionInformation->first));
+    }
+    if (taskIds.empty() || (taskIds.size() > numberVehicles))
+    {
+        return (false);
+    }
+    // without ordering constraints every task option can be the first
+    std::vector<int64_t> executedTaskOptionIds;
+    std::vector<int64_t> nextTaskOptionIds;
+    m_staticAssignmentParameters->algebra.searchNext(executedTaskOptionIds, nextTaskOptionIds);
+    return (nextTaskOptionIds.size() == m_staticAssignmentParameters->m_taskOptionIdVsInformation.size());
+}
+
+void c_Node_Hungarian::ExpandNode()
+{
+    auto rootNode = initializeSearch();
+    size_t numberVehicles = m_staticAssignmentParameters->m_vehicleIds.size();
+
+    // cost of each task for each vehicle, using the task's best option for the vehicle
+    std::map<int64_t, std::vector<uint32_t> > taskIdVsTaskOptions;
+    for (uint32_t taskOption = 0; taskOption < m_staticAssignmentParameters->m_taskOptionIds.size(); taskOption++)
+    {
+        taskIdVsTaskOptions[c_TaskAssignmentState::getTaskID(m_staticAssignmentParameters->m_taskOptionIds[taskOption])].push_back(taskOption);
+    }
+    std::vector<std::vector<int64_t> > costs;
+    std::vector<std::vector<uint32_t> > bestTaskOptions;
+    std::vector<int64_t> thresholds;
+    for (auto itTaskOptions = taskIdVsTaskOptions.begin(); itTaskOptions != taskIdVsTaskOptions.end(); itTaskOptions++)
+    {
+        costs.push_back(std::vector<int64_t>(numberVehicles, MAX_COST_MS));
+        bestTaskOptions.push_back(std::vector<uint32_t>(numberVehicles, 0));
+        for (uint32_t vehicle = 0; vehicle < numberVehicles; vehicle++)
+        {
+            int64_t maxVehicleTravelTime_ms = m_staticAssignmentParameters->m_maxVehicleTravelTimes_ms[vehicle];
+            for (auto itTaskOption = itTaskOptions->second.begin(); itTaskOption != itTaskOptions->second.end(); itTaskOption++)
+            {
+                int64_t travelTime_ms = m_staticAssignmentParameters->getTravelTime_ms(vehicle, 0, *itTaskOption);
+                int64_t taskTime_ms = m_staticAssignmentParameters->getTaskTime_ms(vehicle, *itTaskOption);
+                int64_t cost = rootNode->m_vehicleTravelTimeTotal_ms[vehicle] + travelTime_ms + taskTime_ms;
+                if ((m_staticAssignmentParameters->m_isVehicleInformation[vehicle] != 0) && (travelTime_ms >= 0) && (taskTime_ms >= 0) &&
+                        ((maxVehicleTravelTime_ms < 0) || (cost < maxVehicleTravelTime_ms)) && (cost < costs.back()[vehicle]))
+                {
+                    costs.back()[vehicle] = cost;
+                    bestTaskOptions.back()[vehicle] = *itTaskOption;
+                }
+            }
+            if (costs.back()[vehicle] < MAX_COST_MS)
+            {
+                thresholds.push_back(costs.back()[vehicle]);
+            }
+        }
+    }
+    std::sort(thresholds.begin(), thresholds.end());
+    thresholds.erase(std::unique(thresholds.begin(), thresholds.end()), thresholds.end());
+
+    std::vector<int32_t> vehicleTasks;
+    bool isAssigned = !thresholds.empty() && isMatched(costs, thresholds.back(), vehicleTasks);
+    if (isAssigned)
+    {
+        // smallest maximum cost (bottleneck), then the smallest total cost without exceeding it. The
+        // vehicles that are not assigned keep their initial times, so lower thresholds do not help
+        size_t lower = 0;
+        size_t upper = thresholds.size() - 1;
+        while (lower < upper)
+        {
+            size_t middle = (lower + upper) / 2;
+            if (isMatched(costs, thresholds[middle], vehicleTasks))
+            {
+                upper = middle;
+            }
+            else
+            {
+                lower = middle + 1;
+            }
+        }
+        int64_t threshold = thresholds[lower];
+        for (uint32_t vehicle = 0; vehicle < numberVehicles; vehicle++)
+        {
+            threshold = (std::max)(threshold, rootNode->m_vehicleTravelTimeTotal_ms[vehicle]);
+        }
+        minimizeTotalCost(costs, threshold, vehicleTasks);
+
+        // the process algebra must accept the assignment
+        const c_AssignmentNode* node = rootNode;
+        std::vector<uint32_t> nextTaskOptions;
+        for (uint32_t vehicle = 0; isAssigned && (vehicle < numberVehicles); vehicle++)
+        {
+            if (vehicleTasks[vehicle] >= 0)
+            {
+                uint32_t taskOption = bestTaskOptions[vehicleTasks[vehicle]][vehicle];
+                searchNextTaskOptions(nextTaskOptions);
+                node = (std::find(nextTaskOptions.begin(), nextTaskOptions.end(), taskOption) != nextTaskOptions.end()) ?
+                        (appendAssignment(*node, vehicle, taskOption)) : (nullptr);
+                isAssigned = (node != nullptr);
+                pushAssignedTaskOption(taskOption);
+                m_numberNodesVisited++;
+            }
+        }
+        if (isAssigned)
+        {
+            searchNextTaskOptions(nextTaskOptions);
+            isAssigned = nextTaskOptions.empty() && acceptCandidateAssignment(*node);
+        }
+    }
+    addNodeCounts();
+    m_nodeArena.release(0);
+
+    if (!isAssigned)
+    {
+        UXAS_LOG_INFORM("ASSIGNMENT SOLVER: HUNGARIAN did not find an assignment, using BRANCH_AND_BOUND");
+        c_Node_Base::ExpandNode();
+    }
+}
+
+/*! \brief  augmenting path search for isMatched, true if "task" was assigned*/
+static bool isAugmented(const std::vector<std::vector<int64_t> >& costs, const int64_t& threshold, const size_t& task,
+                        std::vector<uint8_t>& isVisited, std::vector<int32_t>& vehicleTasks)
+{
+    for (size_t vehicle = 0; vehicle < vehicleTasks.size(); vehicle++)
+    {
+        if ((costs[task][vehicle] <= threshold) && (isVisited[vehicle] == 0))
+        {
+            isVisited[vehicle] = 1;
+            if ((vehicleTasks[vehicle] < 0) || isAugmented(costs, threshold, vehicleTasks[vehicle], isVisited, vehicleTasks))
+            {
+                vehicleTasks[vehicle] = static_cast<int32_t> (task);
+                return (true);
+            }
+        }
+    }
+    return (false);
+}
+
+bool c_Node_Hungarian::isMatched(const std::vector<std::vector<int64_t> >& costs, const int64_t& threshold, std::vector<int32_t>& vehicleTasks)
+{
+    vehicleTasks.assign(costs.front().size(), -1);
+    std::vector<uint8_t> isVisited;
+    for (size_t task = 0; task < costs.size(); task++)
+    {
+        isVisited.assign(vehicleTasks.size(), 0);
+        if (!isAugmented(costs, threshold, task, isVisited, vehicleTasks))
+        {
+            return (false);
+        }
+    }
+    return (true);
+}
+
+void c_Node_Hungarian::minimizeTotalCost(const std::vector<std::vector<int64_t> >& costs, const int64_t& threshold, std::vector<int32_t>& vehicleTasks)
+{
+    // Hungarian algorithm with potentials, tasks (rows 1..n) to vehicles (columns 1..m), n <= m.
+    // Costs above the threshold are replaced by a cost larger than any assignment within it.
+    size_t numberTasks = costs.size();
+    size_t numberVehicles = costs.front().size();
+    int64_t excludedCost = (threshold + 1) * static_cast<int64_t> (numberTasks + 1);
+    const int64_t infinity = INT64_MAX / 4;
+    std::vector<int64_t> taskPotentials(numberTasks + 1, 0);
+    std::vector<int64_t> vehiclePotentials(numberVehicles + 1, 0);
+    std::vector<size_t> vehicleTask(numberVehicles + 1, 0);
+    std::vector<size_t> previousVehicle(numberVehicles + 1, 0);
+    for (size_t task = 1; task <= numberTasks; task++)
+    {
+        vehicleTask[0] = task;
+        size_t vehicle0 = 0;
+        std::vector<int64_t> minimumSlack(numberVehicles + 1, infinity);
+        std::vector<uint8_t> isUsed(numberVehicles + 1, 0);
+        do
+        {
+            isUsed[vehicle0] = 1;
+            size_t task0 = vehicleTask[vehicle0];
+            int64_t delta = infinity;
+            size_t vehicle1 = 0;
+            for (size_t vehicle = 1; vehicle <= numberVehicles; vehicle++)
+            {
+                if (isUsed[vehicle] == 0)
+                {
+                    int64_t cost = costs[task0 - 1][vehicle - 1];
+                    cost = (cost > threshold) ? (excludedCost) : (cost);
+                    int64_t slack = cost - taskPotentials[task0] - vehiclePotentials[vehicle];
+                    if (slack < minimumSlack[vehicle])
+                    {
+                        minimumSlack[vehicle] = slack;
+                        previousVehicle[vehicle] = vehicle0;
+                    }
+                    if (minimumSlack[vehicle] < delta)
+                    {
+                        delta = minimumSlack[vehicle];
+                        vehicle1 = vehicle;
+                    }
+                }
+            }
+            for (size_t vehicle = 0; vehicle <= numberVehicles; vehicle++)
+            {
+                if (isUsed[vehicle] != 0)
+                {
+                    taskPotentials[vehicleTask[vehicle]] += delta;
+                    vehiclePotentials[vehicle] -= delta;
+                }
+                else
+                {
+                    minimumSlack[vehicle] -= delta;
+                }
+            }
+            vehicle0 = vehicle1;
+        }
+        while (vehicleTask[vehicle0] != 0);
+        do
+        {
+            size_t vehicle1 = previousVehicle[vehicle0];
+            vehicleTask[vehicle0] = vehicleTask[vehicle1];
+            vehicle0 = vehicle1;
+        }
+        while (vehicle0 != 0);
+    }
+    vehicleTasks.assign(numberVehicles, -1);
+    for (size_t vehicle = 1; vehicle <= numberVehicles; vehicle++)
+    {
+        if (vehicleTask[vehicle] != 0)
+        {
+            vehicleTasks[vehicle - 1] = static_cast<int32_t> (vehicleTask[vehicle] - 1);
+        }
+    }
+}
+
+}; //namespace service
+}; //namespace uxas
@@ -0,0 +1,156 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   AssignmentSolverEngines.h
+ *
+ * Assignment solvers that can be used in place of the branch and bound tree
+ * search (see AssignmentTreeBranchBoundBase, "SolverEngine" option). They use
+ * the same inputs (c_StaticAssignmentParameters, process algebra), report
+ * complete assignments the same way (candidate assignment, anytime results)
+ * and use the MINMAX cost, i.e. the largest vehicle travel time.
+ */
+
+#ifndef UXAS_SERVICE_ASSIGNMENT_SOLVER_ENGINES_H
+#define UXAS_SERVICE_ASSIGNMENT_SOLVER_ENGINES_H
+
+#include "AssignmentTreeBranchBoundBase.h"
+
+#include <random>
+#include <utility>
+
+namespace uxas
+{
+namespace service
+{
+
+/*! \brief  large neighborhood search. Each vehicle has a route (ordered task
+ * options). Starting from a cheapest insertion solution, parts of the routes
+ * are removed (random, from the longest route or related task options) and
+ * re-inserted at their cheapest positions (half of the repairs with noisy
+ * insertion costs), the new routes are accepted by
+ * simulated annealing. The routes are feasible when they can be interleaved
+ * in an order accepted by the process algebra, the task options that are
+ * needed (e.g. one of the alternatives) are found from the process algebra
+ * while the routes are repaired. Independent search chains, one per search
+ * thread, run on the worker pool. */
+class c_Node_LargeNeighborhoodSearch : public c_Node_Base
+{
+public: //constructors/destructors
+
+    c_Node_LargeNeighborhoodSearch() { };
+
+    virtual ~c_Node_LargeNeighborhoodSearch() { };
+
+public: //member functions - prototypes
+    virtual void ExpandNode() override;
+
+protected: //member functions - prototypes
+    virtual std::unique_ptr<c_Node_Base> clone() override;
+
+private:
+    /*! \brief  task options assigned to the vehicles and the resulting times*/
+    class c_VehicleRoutes
+    {
+    public:
+        /*! \brief  vehicle index -> task option indices, in order*/
+        std::vector<std::vector<uint32_t> > m_routes;
+        /*! \brief  vehicle index -> vehicle's travel time total at the end of its route*/
+        std::vector<int64_t> m_routeTimes_ms;
+        int64_t m_maximumTime_ms = {0};
+        int64_t m_totalTime_ms = {0};
+    };
+
+private: // member functions - prototypes
+    /*! \brief  runs search chain "chainIndex" from the root node's vehicle states*/
+    void searchChain(const c_AssignmentNode& rootNode, const uint32_t& chainIndex);
+    /*! \brief  interleaves the routes in an order accepted by the process algebra, true if
+     * the assignment is complete. The (vehicle, task option) order is returned in m_sequence,
+     * on return m_routePositions are the number of task options taken from each route and
+     * m_nextTaskOptions are the task options the process algebra accepts next. The first
+     * "numberSequenced" entries of m_sequence are kept, they must still be valid for the routes */
+    bool isSequenced(const c_VehicleRoutes& vehicleRoutes, const size_t& numberSequenced);
+    /*! \brief  adds the task options needed to complete the assignment, false if it is not possible*/
+    bool isRepaired(c_VehicleRoutes& vehicleRoutes);
+    /*! \brief  inserts one of m_nextTaskOptions at its cheapest route position, at or after
+     * the route positions in m_routePositions if "isAfterSequenced". False if there is no feasible insertion.
+     * The cost of an insertion is the increase of the annealing energy plus a random amount of up to
+     * +/- m_insertionNoise_ms, so that repairs explore other insertions than the greedy ones.
+     * "numberSequenced" returns the number of entries of m_sequence that are not changed by the insertion */
+    bool isInserted(c_VehicleRoutes& vehicleRoutes, const bool& isAfterSequenced, size_t& numberSequenced);
+    /*! \brief  number of entries of m_sequence before the vehicle's route position "position" is reached*/
+    size_t getNumberSequencedBefore(const uint32_t& vehicleIndex, const size_t& position) const;
+    /*! \brief  removes task options from the routes*/
+    void destroyRoutes(c_VehicleRoutes& vehicleRoutes);
+    /*! \brief  calculates the route times, false if a travel time is missing or a maximum travel time is exceeded*/
+    bool isTimesCalculated(c_VehicleRoutes& vehicleRoutes);
+    /*! \brief  builds the assignment nodes for m_sequence and offers them as the candidate assignment*/
+    void offerCandidateAssignment(const c_AssignmentNode& rootNode);
+
+private:
+    /*! \brief  random numbers for this search chain*/
+    std::mt19937 m_generator;
+    /*! \brief  noise added to the insertion costs of the current repair, 0 or m_insertionNoiseMaximum_ms*/
+    double m_insertionNoise_ms = {0.0};
+    /*! \brief  insertion noise of the noisy repairs, 0 while constructing the initial assignment*/
+    double m_insertionNoiseMaximum_ms = {0.0};
+    /*! \brief  vehicle index -> travel time total before any assignments*/
+    std::vector<int64_t> m_initialTimes_ms;
+    /*! \brief  storage used by isSequenced*/
+    std::vector<std::pair<uint32_t, uint32_t> > m_sequence;
+    std::vector<uint32_t> m_routePositions;
+    std::vector<uint32_t> m_nextTaskOptions;
+    std::vector<uint8_t> m_isNextTaskOption;
+
+private:
+    c_Node_LargeNeighborhoodSearch(const c_Node_LargeNeighborhoodSearch& rhs);
+    c_Node_LargeNeighborhoodSearch& operator=(const c_Node_LargeNeighborhoodSearch&) = delete; //no copying
+};
+
+/*! \brief  fast path for assignments without ordering constraints where there are
+ * no more tasks than vehicles: each task is assigned to a different vehicle (using
+ * the task's best option for the vehicle). The largest travel time is minimized
+ * (bottleneck matching), then the total travel time with the Hungarian algorithm.
+ * Falls back to the tree search if no such assignment is found.
+ * A vehicle is assigned at most one task, so the assignment is not optimal when
+ * one vehicle should do several tasks, e.g. two tasks next to one vehicle and far
+ * from the other. It is only used when selected, AUTO never selects it. */
+class c_Node_Hungarian : public c_Node_Base
+{
+public: //constructors/destructors
+
+    c_Node_Hungarian() { };
+
+    virtual ~c_Node_Hungarian() { };
+
+public: //member functions - prototypes
+    virtual void ExpandNode() override;
+
+    /*! \brief  true if all task options can be started first and there are at most "numberVehicles" tasks*/
+    static bool isApplicable(const size_t& numberVehicles);
+
+protected: //member functions - prototypes
+    virtual std::unique_ptr<c_Node_Base> clone() override;
+
+private: // member functions - prototypes
+    /*! \brief  finds the task (row) to vehicle (column) assignment with all costs at or below "threshold",
+     * false if there is none. "vehicleTasks" returns the task assigned to each vehicle, -1 -> none */
+    static bool isMatched(const std::vector<std::vector<int64_t> >& costs, const int64_t& threshold, std::vector<int32_t>& vehicleTasks);
+    /*! \brief  minimum total cost assignment of the tasks (rows) to vehicles (columns), costs above "threshold" are not used*/
+    static void minimizeTotalCost(const std::vector<std::vector<int64_t> >& costs, const int64_t& threshold, std::vector<int32_t>& vehicleTasks);
+
+private:
+    c_Node_Hungarian(const c_Node_Hungarian& rhs);
+    c_Node_Hungarian& operator=(const c_Node_Hungarian&) = delete; //no copying
+};
+
+}; //namespace service
+}; //namespace uxas
+
+#endif /* UXAS_SERVICE_ASSIGNMENT_SOLVER_ENGINES_H */
@@ -16,8 +16,11 @@
 
 
 #include "AssignmentTreeBranchBoundBase.h"
+#include "AssignmentSolverEngines.h"
 
 #include "TimeUtilities.h"
+#include "UxAS_WorkerPoolExecutor.h"
+#include "stdUniquePtr.h"
 #include "Constants/Constant_Strings.h"
 
 #include "afrl/cmasi/ServiceStatus.h"
@@ -35,6 +38,8 @@
 #include <cstdint>      //int64_t
 #include <memory>       // make_unique
 #include <set>       // set
+#include <algorithm>  // sort
+#include <new>        // placement new
 
 
 #define STRING_COMPONENT_NAME "AssignmentTreeBB"
@@ -46,6 +51,11 @@
 
 #define STRING_XML_NUMBER_NODES_MAXIMUM "NumberNodesMaximum"
 #define STRING_XML_COST_FUNCTION "CostFunction"
+#define STRING_XML_NUMBER_SEARCH_THREADS "NumberSearchThreads"
+#define STRING_XML_SEARCH_TIME_MAXIMUM_MS "SearchTimeMaximum_ms"
+#define STRING_XML_ANYTIME_PUBLISH_PERIOD_MS "AnytimePublishPeriod_ms"
+#define STRING_XML_SOLVER_ENGINE "SolverEngine"
+#define STRING_XML_SOLVER_ITERATIONS "SolverIterations"
 
 #define COUT_INFO_MSG(MESSAGE) std::cout << MESSAGE << std::endl;std::cout.flush();
 #define COUT_FILE_LINE_MSG(MESSAGE) std::cout << "<>AssignmentTreeBB:" << __FILE__ << ":" << __LINE__ << ":" << MESSAGE << std::endl;std::cout.flush();
@@ -58,7 +68,7 @@ namespace service
 {
 
 
-bool c_Node_Base::m_isFinalAssignmentCalculated = false;
+std::atomic<bool> c_Node_Base::m_isFinalAssignmentCalculated{false};
 #ifdef AFRL_INTERNAL_ENABLED
 uxas::project::pisr::AssignmentType::AssignmentType c_Node_Base::m_assignmentType{uxas::project::pisr::AssignmentType::MinMaxTime};
 #endif
@@ -70,11 +80,22 @@ AssignmentTreeBranchBoundBase::~AssignmentTreeBranchBoundBase() { };
 
 bool AssignmentTreeBranchBoundBase::start()
 {
+    m_assignmentThread = uxas::stduxas::make_unique<std::thread>(&AssignmentTreeBranchBoundBase::executeAssignments, this);
     return (isStartAssignment());
 }
 
 bool AssignmentTreeBranchBoundBase::terminate()
 {
+    {
+        std::lock_guard<std::mutex> lock(m_assignmentMutex);
+        m_isTerminateAssignments = true;
+        cancelAssignments(-1);
+    }
+    m_assignmentCondition.notify_all();
+    if (m_assignmentThread && m_assignmentThread->joinable())
+    {
+        m_assignmentThread->join();
+    }
     return (isTerminateAssignment());
 }
 
@@ -96,6 +117,47 @@ AssignmentTreeBranchBoundBase::configure(const pugi::xml_node& ndComponent)
         m_numberNodesMaximum = ndComponent.attribute(STRING_XML_NUMBER_NODES_MAXIMUM).as_int64();
     }
 
+    if (!ndComponent.attribute(STRING_XML_NUMBER_SEARCH_THREADS).empty())
+    {
+        m_numberSearchThreads = ndComponent.attribute(STRING_XML_NUMBER_SEARCH_THREADS).as_uint();
+    }
+
+    if (!ndComponent.attribute(STRING_XML_SEARCH_TIME_MAXIMUM_MS).empty())
+    {
+        m_searchTimeMaximum_ms = ndComponent.attribute(STRING_XML_SEARCH_TIME_MAXIMUM_MS).as_int64();
+    }
+
+    if (!ndComponent.attribute(STRING_XML_ANYTIME_PUBLISH_PERIOD_MS).empty())
+    {
+        m_anytimePublishPeriod_ms = ndComponent.attribute(STRING_XML_ANYTIME_PUBLISH_PERIOD_MS).as_int64();
+    }
+
+    if (!ndComponent.attribute(STRING_XML_SOLVER_ENGINE).empty())
+    {
+        std::string solverEngineString = ndComponent.attribute(STRING_XML_SOLVER_ENGINE).value();
+        if (solverEngineString == "LARGE_NEIGHBORHOOD_SEARCH")
+        {
+            m_solverEngine = c_StaticAssignmentParameters::SolverEngine::LARGE_NEIGHBORHOOD_SEARCH;
+        }
+        else if (solverEngineString == "HUNGARIAN")
+        {
+            m_solverEngine = c_StaticAssignmentParameters::SolverEngine::HUNGARIAN;
+        }
+        else if (solverEngineString == "AUTO")
+        {
+            m_solverEngine = c_StaticAssignmentParameters::SolverEngine::AUTO;
+        }
+        else
+        {
+            m_solverEngine = c_StaticAssignmentParameters::SolverEngine::BRANCH_AND_BOUND;
+        }
+    }
+
+    if (!ndComponent.attribute(STRING_XML_SOLVER_ITERATIONS).empty())
+    {
+        m_numberSolverIterations = ndComponent.attribute(STRING_XML_SOLVER_ITERATIONS).as_int64();
+    }
+
     if (!ndComponent.attribute(STRING_XML_COST_FUNCTION).empty())
     {
         std::string costFunctionString = ndComponent.attribute(STRING_XML_COST_FUNCTION).value();
@@ -133,6 +195,11 @@ AssignmentTreeBranchBoundBase::processReceivedLmcpMessage(std::unique_ptr<uxas::
     if (uxas::messages::task::isUniqueAutomationRequest(receivedLmcpMessage->m_object.get()))
     {
         auto uniqueAutomationRequest = std::static_pointer_cast<uxas::messages::task::UniqueAutomationRequest>(receivedLmcpMessage->m_object);
+        {
+            // the newer request supersedes the requests being assigned
+            std::lock_guard<std::mutex> lock(m_assignmentMutex);
+            cancelAssignments(uniqueAutomationRequest->getRequestID());
+        }
         if (m_idVsAssigmentPrerequisites.find(uniqueAutomationRequest->getRequestID()) == m_idVsAssigmentPrerequisites.end())
         {
             m_idVsAssigmentPrerequisites.insert(std::make_pair(uniqueAutomationRequest->getRequestID(), std::make_shared<AssigmentPrerequisites>()));
@@ -197,8 +264,7 @@ AssignmentTreeBranchBoundBase::processReceivedLmcpMessage(std::unique_ptr<uxas::
     }
     if (assigmentPrerequisites)
     {
-        runCalculateAssignment(assigmentPrerequisites);
-        c_Node_Base::m_staticAssignmentParameters.reset(new c_StaticAssignmentParameters);
+        queueAssignment(assigmentPrerequisites);
     }
 
     processReceivedLmcpMessageAssignment(std::move(receivedLmcpMessage));
@@ -206,6 +272,58 @@ AssignmentTreeBranchBoundBase::processReceivedLmcpMessage(std::unique_ptr<uxas::
     return (false); // always false implies never terminating service from here
 };
 
+void AssignmentTreeBranchBoundBase::queueAssignment(const std::shared_ptr<AssigmentPrerequisites>& assigmentPrerequisites)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_assignmentMutex);
+        m_assignmentQueue.push_back(assigmentPrerequisites);
+    }
+    m_assignmentCondition.notify_one();
+}
+
+void AssignmentTreeBranchBoundBase::cancelAssignments(const int64_t& requestId)
+{
+    for (auto itAssignment = m_assignmentQueue.begin(); itAssignment != m_assignmentQueue.end(); itAssignment++)
+    {
+        if ((*itAssignment)->m_uniqueAutomationRequest->getRequestID() != requestId)
+        {
+            (*itAssignment)->m_isCancelled = true;
+        }
+    }
+    if (m_runningAssignment && (m_runningAssignment->m_uniqueAutomationRequest->getRequestID() != requestId))
+    {
+        m_runningAssignment->m_isCancelled = true;
+    }
+}
+
+void AssignmentTreeBranchBoundBase::executeAssignments()
+{
+    while (true)
+    {
+        std::shared_ptr<AssigmentPrerequisites> assigmentPrerequisites;
+        {
+            std::unique_lock<std::mutex> lock(m_assignmentMutex);
+            m_runningAssignment.reset();
+            m_assignmentCondition.wait(lock, [this]() { return (m_isTerminateAssignments || !m_assignmentQueue.empty()); });
+            if (m_isTerminateAssignments)
+            {
+                break;
+            }
+            assigmentPrerequisites = m_assignmentQueue.front();
+            m_assignmentQueue.pop_front();
+            m_runningAssignment = assigmentPrerequisites;
+        }
+
+        if (assigmentPrerequisites->m_isCancelled)
+        {
+            UXAS_LOG_INFORM("ASSIGNMENT CANCELLED: RequestID[", assigmentPrerequisites->m_uniqueAutomationRequest->getRequestID(), "]");
+            continue;
+        }
+        runCalculateAssignment(assigmentPrerequisites);
+        c_Node_Base::m_staticAssignmentParameters.reset(new c_StaticAssignmentParameters);
+    }
+}
+
 bool AssignmentTreeBranchBoundBase::AssigmentPrerequisites::isAssignmentReady(const bool& isUsingAssignmentTypes)
 {
     bool isHavePrerequisites(false);
@@ -274,6 +392,29 @@ void AssignmentTreeBranchBoundBase::sendErrorMsg(std::string& errStr)
     sendSharedLmcpObjectBroadcastMessage(serviceStatus);
 }
 
+void AssignmentTreeBranchBoundBase::sendTaskAssignmentSummary(const std::shared_ptr<AssigmentPrerequisites>& assigmentPrerequisites,
+                                                              const std::unordered_map<int64_t, std::unique_ptr<c_VehicleAssignmentState> >& vehicleIdVsAssignmentState)
+{
+    auto taskAssignmentSummary = std::make_shared<uxas::messages::task::TaskAssignmentSummary>();
+
+    taskAssignmentSummary->setOperatingRegion(assigmentPrerequisites->m_uniqueAutomationRequest->getOriginalRequest()->getOperatingRegion());
+    taskAssignmentSummary->setCorrespondingAutomationRequestID(assigmentPrerequisites->m_uniqueAutomationRequest->getRequestID());
+
+    for (auto itVehicleAssignments = vehicleIdVsAssignmentState.begin();
+            itVehicleAssignments != vehicleIdVsAssignmentState.end();
+            itVehicleAssignments++)
+    {
+        for (auto itTaskAssignment = itVehicleAssignments->second->m_taskAssignments.begin();
+                itTaskAssignment != itVehicleAssignments->second->m_taskAssignments.end();
+                itTaskAssignment++)
+        {
+            taskAssignmentSummary->getTaskList().push_back((*itTaskAssignment)->clone());
+        }
+    }
+    auto newMessage = std::static_pointer_cast<avtas::lmcp::Object>(taskAssignmentSummary);
+    sendSharedLmcpObjectBroadcastMessage(newMessage);
+}
+
 bool AssignmentTreeBranchBoundBase::isInitializeAlgebra(const std::shared_ptr<AssigmentPrerequisites>& assigmentPrerequisites)
 {
     bool isSuccess(true);
@@ -505,6 +646,32 @@ void AssignmentTreeBranchBoundBase::calculateAssignment(std::unique_ptr<c_Node_B
     nodeAssignment->m_staticAssignmentParameters.reset(new c_StaticAssignmentParameters);
     nodeAssignment->m_staticAssignmentParameters->m_CostFunction = m_CostFunction;
     nodeAssignment->m_staticAssignmentParameters->m_numberNodesMaximum = m_numberNodesMaximum;
+    nodeAssignment->m_staticAssignmentParameters->m_numberSearchThreads = m_numberSearchThreads;
+    nodeAssignment->m_staticAssignmentParameters->m_numberSolverIterations = m_numberSolverIterations;
+    nodeAssignment->m_staticAssignmentParameters->m_isCancelled = &assigmentPrerequisites->m_isCancelled;
+    if (m_anytimePublishPeriod_ms > 0)
+    {
+        // anytime results are reported as status, only the final assignment is sent as a
+        // TaskAssignmentSummary (each summary starts planning and answers the automation request)
+        auto staticAssignmentParameters = nodeAssignment->m_staticAssignmentParameters.get();
+        staticAssignmentParameters->m_publishPeriod_ms = m_anytimePublishPeriod_ms;
+        staticAssignmentParameters->m_publishCandidateAssignment = [this, staticAssignmentParameters, assigmentPrerequisites]()
+        {
+            UXAS_LOG_INFORM("ASSIGNMENT UPDATE: cost[", staticAssignmentParameters->m_minimumAssignmentCostCandidate.load(), "]");
+            auto serviceStatus = std::make_shared<afrl::cmasi::ServiceStatus>();
+            serviceStatus->setStatusType(afrl::cmasi::ServiceStatusType::Information);
+            auto keyValuePair = new afrl::cmasi::KeyValuePair;
+            keyValuePair->setKey(std::string("AssignmentUpdate"));
+            keyValuePair->setValue(std::to_string(assigmentPrerequisites->m_uniqueAutomationRequest->getRequestID()));
+            serviceStatus->getInfo().push_back(keyValuePair);
+            keyValuePair = new afrl::cmasi::KeyValuePair;
+            keyValuePair->setKey(std::string("AssignmentCost"));
+            keyValuePair->setValue(std::to_string(staticAssignmentParameters->m_minimumAssignmentCostCandidate.load()));
+            serviceStatus->getInfo().push_back(keyValuePair);
+            keyValuePair = nullptr;
+            sendSharedLmcpObjectBroadcastMessage(serviceStatus);
+        };
+    }
 #ifdef AFRL_INTERNAL_ENABLED
     nodeAssignment->m_assignmentType = assigmentPrerequisites->m_assignmentType;
 #endif
@@ -559,6 +726,7 @@ void AssignmentTreeBranchBoundBase::calculateAssignment(std::unique_ptr<c_Node_B
 
         //TODO:: need to calculate "m_maximumVehicleCost" for the c_VehicleCostsStatic's map
 
+        selectSolverEngine(nodeAssignment);
 
         /////////////////////////////////////////////////////////
         /////////  RUN THE ASSIGNMENT ALGORITHM
@@ -568,10 +736,21 @@ void AssignmentTreeBranchBoundBase::calculateAssignment(std::unique_ptr<c_Node_B
         //  Note: (1)load Objectives and vehicles (2) run allocation algorithm (3)  the function GetWaypoints_m or GetWaypoints_LatLong_rad to return the results
         /////////////////////////////////////////////////////////////////////////////////////////////////////////
         nodeAssignment->m_staticAssignmentParameters->m_assignmentStartTime_ms = uxas::common::utilities::c_TimeUtilities::getTimeNow_ms();
+        if (m_searchTimeMaximum_ms > 0)
+        {
+            nodeAssignment->m_staticAssignmentParameters->m_searchDeadline_ms = nodeAssignment->m_staticAssignmentParameters->m_assignmentStartTime_ms + m_searchTimeMaximum_ms;
+        }
+        nodeAssignment->m_staticAssignmentParameters->m_nextPublishTime_ms = nodeAssignment->m_staticAssignmentParameters->m_assignmentStartTime_ms + m_anytimePublishPeriod_ms;
         nodeAssignment->ExpandNode();
         nodeAssignment->printStatus("INFO::FINAL:  ");
+        bool isCancelled = assigmentPrerequisites->m_isCancelled;
 
-        if (nodeAssignment->m_staticAssignmentParameters->m_numberCompleteAssignments <= 0)
+        if (isCancelled)
+        {
+            // superseded, no one is waiting for this assignment
+            UXAS_LOG_INFORM("ASSIGNMENT CANCELLED: RequestID[", assigmentPrerequisites->m_uniqueAutomationRequest->getRequestID(), "]");
+        }
+        else if (nodeAssignment->m_staticAssignmentParameters->m_numberCompleteAssignments <= 0)
         {
             auto serviceStatus = std::make_shared<afrl::cmasi::ServiceStatus>();
             serviceStatus->setStatusType(afrl::cmasi::ServiceStatusType::Error);
@@ -598,26 +777,13 @@ void AssignmentTreeBranchBoundBase::calculateAssignment(std::unique_ptr<c_Node_B
         /////////////////////////////////////////////////////////
         /////////  Return the results
         /////////////////////////////////////////////////////////
-        if (!nodeAssignment->m_staticAssignmentParameters->m_candidateVehicleIdVsAssignmentState.empty())
+        if (isCancelled)
         {
-            auto taskAssignmentSummary = std::make_shared<uxas::messages::task::TaskAssignmentSummary>();
-
-            taskAssignmentSummary->setOperatingRegion(assigmentPrerequisites->m_uniqueAutomationRequest->getOriginalRequest()->getOperatingRegion());
-            taskAssignmentSummary->setCorrespondingAutomationRequestID(assigmentPrerequisites->m_uniqueAutomationRequest->getRequestID());
-
-            for (auto itVehicleAssignments = nodeAssignment->m_staticAssignmentParameters->m_candidateVehicleIdVsAssignmentState.begin();
-                    itVehicleAssignments != nodeAssignment->m_staticAssignmentParameters->m_candidateVehicleIdVsAssignmentState.end();
-                    itVehicleAssignments++)
-            {
-                for (auto itTaskAssignment = itVehicleAssignments->second->m_taskAssignments.begin();
-                        itTaskAssignment != itVehicleAssignments->second->m_taskAssignments.end();
-                        itTaskAssignment++)
-                {
-                    taskAssignmentSummary->getTaskList().push_back((*itTaskAssignment)->clone());
-                }
-            }
-            auto newMessage = std::static_pointer_cast<avtas::lmcp::Object>(taskAssignmentSummary);
-            sendSharedLmcpObjectBroadcastMessage(newMessage);
+            // nothing to return
+        }
+        else if (!nodeAssignment->m_staticAssignmentParameters->m_candidateVehicleIdVsAssignmentState.empty())
+        {
+            sendTaskAssignmentSummary(assigmentPrerequisites, nodeAssignment->m_staticAssignmentParameters->m_candidateVehicleIdVsAssignmentState);
             UXAS_LOG_INFORM("ASSIGNMENT COMPLETE!");
         }
         else
@@ -631,6 +797,46 @@ void AssignmentTreeBranchBoundBase::calculateAssignment(std::unique_ptr<c_Node_B
     nodeAssignment.reset();
 } //void AssignmentTreeBranchBoundBase::CalculateAssignment()
 
+void AssignmentTreeBranchBoundBase::selectSolverEngine(std::unique_ptr<c_Node_Base>& nodeAssignment)
+{
+    auto solverEngine = m_solverEngine;
+    size_t numberVehicles = nodeAssignment->m_vehicleIdVsAssignmentState.size();
+    if (solverEngine == c_StaticAssignmentParameters::SolverEngine::AUTO)
+    {
+        // HUNGARIAN is not selected, it assigns at most one task per vehicle (see AssignmentSolverEngines.h)
+        if (nodeAssignment->m_staticAssignmentParameters->m_taskOptionIdVsInformation.size() > 16)
+        {
+            solverEngine = c_StaticAssignmentParameters::SolverEngine::LARGE_NEIGHBORHOOD_SEARCH;
+        }
+        else
+        {
+            solverEngine = c_StaticAssignmentParameters::SolverEngine::BRANCH_AND_BOUND;
+        }
+    }
+    else if ((solverEngine == c_StaticAssignmentParameters::SolverEngine::HUNGARIAN) && !c_Node_Hungarian::isApplicable(numberVehicles))
+    {
+        UXAS_LOG_WARN("ASSIGNMENT_WARNING:: HUNGARIAN solver does not apply (ordering constraints or more tasks than vehicles), using BRANCH_AND_BOUND");
+        solverEngine = c_StaticAssignmentParameters::SolverEngine::BRANCH_AND_BOUND;
+    }
+
+    std::unique_ptr<c_Node_Base> solverNode;
+    if (solverEngine == c_StaticAssignmentParameters::SolverEngine::HUNGARIAN)
+    {
+        UXAS_LOG_INFORM("ASSIGNMENT SOLVER: HUNGARIAN");
+        solverNode.reset(new c_Node_Hungarian);
+    }
+    else if (solverEngine == c_StaticAssignmentParameters::SolverEngine::LARGE_NEIGHBORHOOD_SEARCH)
+    {
+        UXAS_LOG_INFORM("ASSIGNMENT SOLVER: LARGE_NEIGHBORHOOD_SEARCH");
+        solverNode.reset(new c_Node_LargeNeighborhoodSearch);
+    }
+    if (solverNode)
+    {
+        solverNode->m_vehicleIdVsAssignmentState = std::move(nodeAssignment->m_vehicleIdVsAssignmentState);
+        nodeAssignment = std::move(solverNode);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 c_VehicleInformationStatic::c_VehicleInformationStatic(const int64_t & vehicleId)
@@ -698,6 +904,91 @@ c_TaskAssignmentState::c_TaskAssignmentState(const c_TaskAssignmentState & rhs)
 }
 
 
+void c_StaticAssignmentParameters::initializeDenseTables(const std::vector<int64_t>& vehicleIds)
+{
+    m_vehicleIds = vehicleIds;
+    m_taskOptionIds.clear();
+    m_taskOptionIdVsIndex.clear();
+    for (auto itTaskOptionInformation = m_taskOptionIdVsInformation.begin(); itTaskOptionInformation != m_taskOptionIdVsInformation.end(); itTaskOptionInformation++)
+    {
+        m_taskOptionIds.push_back(itTaskOptionInformation->first);
+    }
+    std::sort(m_taskOptionIds.begin(), m_taskOptionIds.end());
+    for (uint32_t taskOption = 0; taskOption < m_taskOptionIds.size(); taskOption++)
+    {
+        m_taskOptionIdVsIndex[m_taskOptionIds[taskOption]] = taskOption;
+    }
+    m_compiledAlgebra.compile(algebra, m_taskOptionIds);
+
+    size_t numberVehicles = m_vehicleIds.size();
+    size_t numberTaskOptions = m_taskOptionIds.size();
+    m_maxVehicleTravelTimes_ms.assign(numberVehicles, -1);
+    m_isVehicleInformation.assign(numberVehicles, 0);
+    m_travelTimes_ms.assign(numberVehicles * (numberTaskOptions + 1) * numberTaskOptions, -1);
+    m_taskTimes_ms.assign(numberVehicles * numberTaskOptions, -1);
+    for (uint32_t vehicle = 0; vehicle < numberVehicles; vehicle++)
+    {
+        for (uint32_t taskOption = 0; taskOption < numberTaskOptions; taskOption++)
+        {
+            m_taskTimes_ms[vehicle * numberTaskOptions + taskOption] = m_taskOptionIdVsInformation[m_taskOptionIds[taskOption]]->getTravelTime_ms(m_vehicleIds[vehicle]);
+        }
+        auto itVehicleInformation = m_vehicleIdVsInformation.find(m_vehicleIds[vehicle]);
+        if (itVehicleInformation != m_vehicleIdVsInformation.end())
+        {
+            m_isVehicleInformation[vehicle] = 1;
+            m_maxVehicleTravelTimes_ms[vehicle] = itVehicleInformation->second->m_maxVehicleTravelTime_ms;
+            for (uint32_t fromLocation = 0; fromLocation <= numberTaskOptions; fromLocation++)
+            {
+                int64_t fromId = (fromLocation == 0) ? (m_vehicleIds[vehicle]) : (m_taskOptionIds[fromLocation - 1]);
+                for (uint32_t toOption = 0; toOption < numberTaskOptions; toOption++)
+                {
+                    m_travelTimes_ms[(vehicle * (numberTaskOptions + 1) + fromLocation) * numberTaskOptions + toOption] =
+                            itVehicleInformation->second->getTravelTime_ms(fromId, m_taskOptionIds[toOption]);
+                }
+            }
+        }
+    }
+}
+
+void c_NodeArena::initialize(const uint32_t& numberVehicles)
+{
+    size_t nodeSize_words = (sizeof (c_AssignmentNode) + sizeof (int64_t) - 1) / sizeof (int64_t);
+    size_t recordSize_words = nodeSize_words + numberVehicles + (numberVehicles + 1) / 2;
+    if (recordSize_words != m_recordSize_words)
+    {
+        m_blocks.clear();
+    }
+    m_numberVehicles = numberVehicles;
+    m_recordSize_words = recordSize_words;
+    m_nodesPerBlock = (std::max)(static_cast<size_t> (1), static_cast<size_t> (65536) / m_recordSize_words);
+    m_numberNodes = 0;
+}
+
+c_AssignmentNode* c_NodeArena::allocateNode()
+{
+    size_t block = m_numberNodes / m_nodesPerBlock;
+    if (block >= m_blocks.size())
+    {
+        m_blocks.push_back(std::unique_ptr<int64_t[]>(new int64_t[m_nodesPerBlock * m_recordSize_words]));
+    }
+    int64_t* record = m_blocks[block].get() + (m_numberNodes % m_nodesPerBlock) * m_recordSize_words;
+    m_numberNodes++;
+
+    auto node = new (record) c_AssignmentNode;
+    size_t nodeSize_words = (sizeof (c_AssignmentNode) + sizeof (int64_t) - 1) / sizeof (int64_t);
+    node->m_vehicleTravelTimeTotal_ms = record + nodeSize_words;
+    node->m_vehicleLastLocation = reinterpret_cast<uint32_t*> (record + nodeSize_words + m_numberVehicles);
+    return (node);
+}
+
+
+/*! \brief  order in which sibling nodes are searched: lowest evaluation order cost first, ties in the order the nodes were added*/
+static bool isEvaluatedBefore(const c_AssignmentNode* node1, const c_AssignmentNode* node2)
+{
+    return ((node1->m_evaluationOrderCost < node2->m_evaluationOrderCost) ||
+            ((node1->m_evaluationOrderCost == node2->m_evaluationOrderCost) && (node1->m_childIndex < node2->m_childIndex)));
+}
+
 std::unique_ptr<c_StaticAssignmentParameters> c_Node_Base::m_staticAssignmentParameters(new c_StaticAssignmentParameters);
 
 c_Node_Base::c_Node_Base() //this is used for the root node
@@ -718,26 +1009,15 @@ std::unique_ptr<c_Node_Base> c_Node_Base::clone()
 
 //copy constructor
 
-c_Node_Base::c_Node_Base(const c_Node_Base & rhs) //copy constructor
-: m_travelTimeTotal_ms(rhs.m_travelTimeTotal_ms),
-m_isPruneable(rhs.m_isPruneable),
-m_isLeafNode(rhs.m_isLeafNode)
+c_Node_Base::c_Node_Base(const c_Node_Base & rhs) //copy constructor, used to make the parallel search objects
 {
-    m_staticAssignmentParameters->m_numberNodesVisited++;
     for (auto itVehicleAssignmentState = rhs.m_vehicleIdVsAssignmentState.begin();
             itVehicleAssignmentState != rhs.m_vehicleIdVsAssignmentState.end();
             itVehicleAssignmentState++)
     {
         m_vehicleIdVsAssignmentState[itVehicleAssignmentState->first] = itVehicleAssignmentState->second->clone();
     }
-    for (auto itTaskAssignmentState = rhs.m_taskIdVsAssignmentState.begin();
-            itTaskAssignmentState != rhs.m_taskIdVsAssignmentState.end();
-            itTaskAssignmentState++)
-    {
-        m_taskIdVsAssignmentState[itTaskAssignmentState->first] = itTaskAssignmentState->second->clone();
-    }
-    m_viObjectiveIDs_Assigned = rhs.m_viObjectiveIDs_Assigned;
-    // do not copy children !!!!!!!!
+    // do not copy the search storage !!!!!!!!
 };
 
 void c_Node_Base::printStatus(const std::string& Message)
@@ -746,192 +1026,404 @@ void c_Node_Base::printStatus(const std::string& Message)
             m_staticAssignmentParameters->m_assignmentStartTime_ms) / 1000.0;
     UXAS_LOG_INFORM(Message
                   , "timeSinceStart_s[" , timeSinceStart_s
-                  , "] m_vehicleID[" , m_vehicleID
-                  , "] cost[" , m_staticAssignmentParameters->m_minimumAssignmentCostCandidate
-                  , "] numberNodesVisited[" , m_staticAssignmentParameters->m_numberNodesVisited
-                  , "] numberNodesRemoved[" , m_staticAssignmentParameters->m_numberNodesRemoved
-                  , "] Number Current Nodes[" , (m_staticAssignmentParameters->m_numberNodesVisited - m_staticAssignmentParameters->m_numberNodesRemoved)
-                  , "] numberNodesAdded[" , m_staticAssignmentParameters->m_numberNodesAdded
-                  , "] numberNodesPruned[" , m_staticAssignmentParameters->m_numberNodesPruned
+                  , "] cost[" , m_staticAssignmentParameters->m_minimumAssignmentCostCandidate.load()
+                  , "] numberNodesVisited[" , m_staticAssignmentParameters->m_numberNodesVisited.load()
+                  , "] numberNodesRemoved[" , m_staticAssignmentParameters->m_numberNodesRemoved.load()
+                  , "] Number Current Nodes[" , m_nodeArena.size()
+                  , "] numberNodesAdded[" , m_staticAssignmentParameters->m_numberNodesAdded.load()
+                  , "] numberNodesPruned[" , m_staticAssignmentParameters->m_numberNodesPruned.load()
                   , "]" );
     UXAS_LOG_INFORM_ASSIGNMENT("timeSinceStart_s[", timeSinceStart_s,
-                                  "] cost[", m_staticAssignmentParameters->m_minimumAssignmentCostCandidate,
-                                  "] numberNodesVisited[", m_staticAssignmentParameters->m_numberNodesVisited, "]");
+                                  "] cost[", m_staticAssignmentParameters->m_minimumAssignmentCostCandidate.load(),
+                                  "] numberNodesVisited[", m_staticAssignmentParameters->m_numberNodesVisited.load(), "]");
+}
+
+c_AssignmentNode* c_Node_Base::initializeSearch()
+{
+    std::vector<int64_t> vehicleIds;
+    for (auto itVehicleAssignmentState = m_vehicleIdVsAssignmentState.begin(); itVehicleAssignmentState != m_vehicleIdVsAssignmentState.end(); itVehicleAssignmentState++)
+    {
+        vehicleIds.push_back(itVehicleAssignmentState->first);
+    }
+    m_staticAssignmentParameters->initializeDenseTables(vehicleIds);
+
+    m_nodeArena.initialize(static_cast<uint32_t> (vehicleIds.size()));
+    m_assignedTaskOptions.clear();
+    m_isAssignedTaskOption.assign(m_staticAssignmentParameters->m_compiledAlgebra.getNumberWords(), 0);
+    auto rootNode = m_nodeArena.allocateNode();
+    for (uint32_t vehicle = 0; vehicle < vehicleIds.size(); vehicle++)
+    {
+        rootNode->m_vehicleTravelTimeTotal_ms[vehicle] = m_vehicleIdVsAssignmentState[vehicleIds[vehicle]]->m_travelTimeTotal_ms;
+        rootNode->m_vehicleLastLocation[vehicle] = 0;
+    }
+    return (rootNode);
+}
+
+uint32_t c_Node_Base::getNumberSearchThreads()
+{
+    uint32_t numberSearchThreads = m_staticAssignmentParameters->m_numberSearchThreads;
+    if (numberSearchThreads == 0)
+    {
+        // the worker pool also executes the services' message strands, leave at least one worker
+        // for them (the assignment thread is one of the search threads, see WorkerPoolExecutor::parallelFor)
+        uint32_t workerCount = uxas::common::WorkerPoolExecutor::getInstance().getWorkerCount();
+        numberSearchThreads = (workerCount > 1) ? (workerCount - 1) : 1;
+    }
+    return (numberSearchThreads);
 }
 
 void c_Node_Base::ExpandNode()
+{
+    //////////////////////////////////////////////////////////////////////////////////
+    // build the dense tables and the root node from the vehicles' initial states
+    //////////////////////////////////////////////////////////////////////////////////
+    auto rootNode = initializeSearch();
+
+    uint32_t numberSearchThreads = getNumberSearchThreads();
+    if (numberSearchThreads <= 1)
+    {
+        searchSubtree(*rootNode, 0);
+    }
+    else
+    {
+        //////////////////////////////////////////////////////////////////////////////////
+        // split the tree into subtrees, enough to keep the search threads busy
+        //////////////////////////////////////////////////////////////////////////////////
+        std::vector<const c_AssignmentNode*> subtreeRoots;
+        buildSubtreeRoots(*rootNode, 8 * static_cast<size_t> (numberSearchThreads), subtreeRoots);
+
+        // until there is a complete assignment the subtrees are searched in order, so the
+        // first complete assignment (e.g. NumberNodesMaximum = 0) is the same as the serial search's
+        uint32_t subtreeIndex = 0;
+        while ((subtreeIndex < subtreeRoots.size()) && (m_staticAssignmentParameters->m_numberCompleteAssignments <= 0) &&
+                !m_staticAssignmentParameters->m_isStopCondition)
+        {
+            searchSubtree(*subtreeRoots[subtreeIndex], subtreeIndex);
+            subtreeIndex++;
+        }
+
+        if ((subtreeIndex < subtreeRoots.size()) && !m_staticAssignmentParameters->m_isStopCondition)
+        {
+            // each thread has its own search object (arena, assigned task options), the 
+            // subtrees are taken in order, so the good (low cost) subtrees are searched first
+            std::vector<std::unique_ptr<c_Node_Base> > searchNodes;
+            for (uint32_t thread = 0; thread < numberSearchThreads; thread++)
+            {
+                searchNodes.push_back(clone());
+                searchNodes.back()->m_nodeArena.initialize(static_cast<uint32_t> (m_staticAssignmentParameters->m_vehicleIds.size()));
+            }
+            std::atomic<uint32_t> nextSubtreeIndex{subtreeIndex};
+            uxas::common::WorkerPoolExecutor::getInstance().parallelFor(numberSearchThreads,
+                [&](uint32_t thread)
+                {
+                    uint32_t index;
+                    while (!m_staticAssignmentParameters->m_isStopCondition &&
+                            ((index = nextSubtreeIndex.fetch_add(1)) < subtreeRoots.size()))
+                    {
+                        searchNodes[thread]->searchSubtree(*subtreeRoots[index], index);
+                    }
+                });
+        }
+    }
+    addNodeCounts();
+
+    m_nodeArena.release(0);
+} //void c_Node_Base::ExpandNode(
+
+void c_Node_Base::buildSubtreeRoots(const c_AssignmentNode& rootNode, const size_t& numberSubtreesTarget, std::vector<const c_AssignmentNode*>& subtreeRoots)
+{
+    subtreeRoots.assign(1, &rootNode);
+    std::vector<uint32_t> nextTaskOptions;
+    std::vector<c_AssignmentNode*> children;
+    bool isExpanded(true);
+    while (isExpanded && (subtreeRoots.size() < numberSubtreesTarget) && !m_staticAssignmentParameters->m_isStopCondition)
+    {
+        isExpanded = false;
+        std::vector<const c_AssignmentNode*> nextSubtreeRoots;
+        for (auto itSubtreeRoot = subtreeRoots.begin(); itSubtreeRoot != subtreeRoots.end(); itSubtreeRoot++)
+        {
+            setAssignedTaskOptions(**itSubtreeRoot);
+            searchNextTaskOptions(nextTaskOptions);
+            if (nextTaskOptions.empty())
+            {
+                // leaf node, searched as its own subtree
+                nextSubtreeRoots.push_back(*itSubtreeRoot);
+                continue;
+            }
+            children.clear();
+            for (auto itTaskOption = nextTaskOptions.begin(); itTaskOption != nextTaskOptions.end(); itTaskOption++)
+            {
+                int64_t taskOptionId = m_staticAssignmentParameters->m_compiledAlgebra.getActionID(*itTaskOption);
+                for (uint32_t vehicle = 0; vehicle < m_staticAssignmentParameters->m_vehicleIds.size(); vehicle++)
+                {
+                    NodeAssignment(**itSubtreeRoot, vehicle, taskOptionId, -1, children);
+                }
+            }
+            // same order as the depth first search
+            std::sort(children.begin(), children.end(), isEvaluatedBefore);
+            nextSubtreeRoots.insert(nextSubtreeRoots.end(), children.begin(), children.end());
+            m_numberNodesRemoved += children.size();
+            isExpanded = true;
+        }
+        subtreeRoots.swap(nextSubtreeRoots);
+    }
+    addNodeCounts();
+}
+
+void c_Node_Base::searchSubtree(const c_AssignmentNode& subtreeRoot, const uint32_t& subtreeIndex)
+{
+    m_subtreeIndex = subtreeIndex;
+    setAssignedTaskOptions(subtreeRoot);
+    searchNode(subtreeRoot);
+    addNodeCounts();
+}
+
+void c_Node_Base::setAssignedTaskOptions(const c_AssignmentNode& node)
+{
+    m_assignedTaskOptions.clear();
+    m_isAssignedTaskOption.assign(m_staticAssignmentParameters->m_compiledAlgebra.getNumberWords(), 0);
+    for (auto assignmentNode = &node; assignmentNode->m_parent != nullptr; assignmentNode = assignmentNode->m_parent)
+    {
+        pushAssignedTaskOption(assignmentNode->m_taskOptionIndex);
+    }
+    std::reverse(m_assignedTaskOptions.begin(), m_assignedTaskOptions.end());
+}
+
+void c_Node_Base::addNodeCounts()
+{
+    int64_t numberNodesVisited = m_staticAssignmentParameters->m_numberNodesVisited.fetch_add(m_numberNodesVisited);
+    m_staticAssignmentParameters->m_numberNodesAdded += m_numberNodesAdded;
+    m_staticAssignmentParameters->m_numberNodesPruned += m_numberNodesPruned;
+    m_staticAssignmentParameters->m_numberNodesRemoved += m_numberNodesRemoved;
+    bool isPrintStatus = ((numberNodesVisited / 100000) != ((numberNodesVisited + m_numberNodesVisited) / 100000));
+    m_numberNodesVisited = 0;
+    m_numberNodesAdded = 0;
+    m_numberNodesPruned = 0;
+    m_numberNodesRemoved = 0;
+    if (isPrintStatus)
+    {
+        printStatus("INFO::UPDATE: ");
+    }
+
+    if ((m_staticAssignmentParameters->m_isCancelled != nullptr) && *m_staticAssignmentParameters->m_isCancelled)
+    {
+        m_staticAssignmentParameters->m_isStopCondition = true;
+    }
+    if ((m_staticAssignmentParameters->m_searchDeadline_ms > 0) || m_staticAssignmentParameters->m_publishCandidateAssignment)
+    {
+        int64_t timeNow_ms = uxas::common::utilities::c_TimeUtilities::getTimeNow_ms();
+        if ((m_staticAssignmentParameters->m_searchDeadline_ms > 0) && (timeNow_ms >= m_staticAssignmentParameters->m_searchDeadline_ms) &&
+                (m_staticAssignmentParameters->m_numberCompleteAssignments > 0))
+        {
+            m_staticAssignmentParameters->m_isStopCondition = true;
+        }
+        if (m_staticAssignmentParameters->m_publishCandidateAssignment && !m_staticAssignmentParameters->m_isStopCondition)
+        {
+            // the other search threads do not wait for the candidate assignment to be published
+            std::unique_lock<std::mutex> lock(m_staticAssignmentParameters->m_mutex, std::try_to_lock);
+            if (lock.owns_lock() && (timeNow_ms >= m_staticAssignmentParameters->m_nextPublishTime_ms) &&
+                    (m_staticAssignmentParameters->m_numberCompleteAssignments > m_staticAssignmentParameters->m_numberCompleteAssignmentsPublished))
+            {
+                m_staticAssignmentParameters->m_nextPublishTime_ms = timeNow_ms + m_staticAssignmentParameters->m_publishPeriod_ms;
+                m_staticAssignmentParameters->m_numberCompleteAssignmentsPublished = m_staticAssignmentParameters->m_numberCompleteAssignments;
+                m_staticAssignmentParameters->m_publishCandidateAssignment();
+            }
+        }
+    }
+}
+
+void c_Node_Base::addReasonForNoAssignment(const std::string& reason)
+{
+    std::lock_guard<std::mutex> lock(m_staticAssignmentParameters->m_mutex);
+    m_staticAssignmentParameters->m_reasonsForNoAssignment << reason << std::endl;
+}
+
+void c_Node_Base::searchNode(const c_AssignmentNode& node)
 {
     //////////////////////////////////////////////////////////////////////////////////
     // check assignment viability and find lower bound on costs of child nodes
     //////////////////////////////////////////////////////////////////////////////////
     bool bTaskAvailable = false; //if there are no tasks to do then this is the final assignment node
 
+    size_t depth = m_assignedTaskOptions.size();
+    while (m_childrenByDepth.size() <= depth)
+    {
+        m_nextTaskOptionsByDepth.push_back(std::vector<uint32_t>());
+        m_childrenByDepth.push_back(std::vector<c_AssignmentNode*>());
+    }
+    std::vector<uint32_t>& nextTaskOptions = m_nextTaskOptionsByDepth[depth];
+    std::vector<c_AssignmentNode*>& children = m_childrenByDepth[depth];
+    children.clear();
+    size_t numberNodesInUse = m_nodeArena.size();
+
     // investigate child nodes
-    std::vector<int64_t> vectorOfNextObjectiveIDs;
-    m_staticAssignmentParameters->algebra.searchNext(m_viObjectiveIDs_Assigned, vectorOfNextObjectiveIDs);
+    searchNextTaskOptions(nextTaskOptions);
 
-    for (auto itObjectiveID = vectorOfNextObjectiveIDs.begin(); itObjectiveID != vectorOfNextObjectiveIDs.end(); itObjectiveID++) // ALGEBRA:: New for loop
+    for (auto itTaskOption = nextTaskOptions.begin(); itTaskOption != nextTaskOptions.end(); itTaskOption++) // ALGEBRA:: New for loop
     {
         bTaskAvailable = true;
+        int64_t taskOptionId = m_staticAssignmentParameters->m_compiledAlgebra.getActionID(*itTaskOption);
 
         //TODO:: find the prerequsite task
         int64_t prerequisiteTaskOptionId(-1);
         //searchPred (const v_action_t &executedAtomicObjectives, int AtomicObjectiveIn)
 
-        for (auto itVehicleAssignmentState = m_vehicleIdVsAssignmentState.begin(); itVehicleAssignmentState != m_vehicleIdVsAssignmentState.end(); itVehicleAssignmentState++)
+        for (uint32_t vehicle = 0; vehicle < m_staticAssignmentParameters->m_vehicleIds.size(); vehicle++)
         {
-            NodeAssignment(itVehicleAssignmentState->second, *itObjectiveID, prerequisiteTaskOptionId);
-            if (!itVehicleAssignmentState->second->m_isAcceptingNewAssignments)
-            {
-                UXAS_LOG_INFORM("Vehicle ID[" + std::to_string(itVehicleAssignmentState->first) + "] is finished!");
-            }
+            NodeAssignment(node, vehicle, taskOptionId, prerequisiteTaskOptionId, children);
         }
-    } //for(V_INT_IT_t itObjectiveID = vectorOfNextObjectiveIDs.begin(); itObjectiveID != vectorOfNextObjectiveIDs.end(); itObjectiveID++)
+    } //for(auto itTaskOption = nextTaskOptions.begin(); itTaskOption != nextTaskOptions.end(); itTaskOption++)
 
     if (!m_staticAssignmentParameters->m_isStopCondition)
     {
         //if there are valid assignments and there are child nodes, then expand them 
-        //if (bTaskAvailable && bVehicleAvailable)
-        if (!m_costVsChildren.empty())
+        if (!children.empty())
         {
             //////////////////////////////////////////////////////////////////////////////////
-            //expand the children
+            //expand the children, lowest evaluation order cost first
             //////////////////////////////////////////////////////////////////////////////////
+            std::sort(children.begin(), children.end(), isEvaluatedBefore);
 #ifdef STEVETEST
-            std::cout << std::endl << "<>AssignmentTreeBB:m_costVsChildren [" << m_costVsChildren.size() << "] # Previous Assignments[" << m_viObjectiveIDs_Assigned.size() << "]";
-#endif  //#ifdef STEVETEST
-#ifdef STEVETEST
-            for (auto& itChild : m_costVsChildren)
+            std::cout << std::endl << "<>AssignmentTreeBB:children [" << children.size() << "] # Previous Assignments[" << depth << "]";
+            for (auto& child : children)
             {
-                std::cout << " (" << itChild.second->m_vehicleID << ", " << itChild.second->m_taskOptionID << ", " << itChild.first << ")";
+                std::cout << " (" << m_staticAssignmentParameters->m_vehicleIds[child->m_vehicleIndex] << ", "
+                        << m_staticAssignmentParameters->m_taskOptionIds[child->m_taskOptionIndex] << ", " << child->m_evaluationOrderCost << ")";
             }
             std::cout << "]" << std::endl;
             std::cout.flush();
 #endif  //#ifdef STEVETEST
 
-            for (auto itChild = m_costVsChildren.begin(); itChild != m_costVsChildren.end(); itChild++)
+            for (auto itChild = children.begin(); itChild != children.end(); itChild++)
             {
                 // other children may have found lower costs or a stop condition
-                if ((itChild->second->m_nodeCost < m_staticAssignmentParameters->m_minimumAssignmentCostCandidate) && !m_staticAssignmentParameters->m_isStopCondition)
+                if (isPromising((*itChild)->m_nodeCost) && !m_staticAssignmentParameters->m_isStopCondition)
                 {
-#ifdef STEVETEST
-                    std::cout << "  #Prev[" << m_viObjectiveIDs_Assigned.size() << "](" << itChild->second->m_vehicleID << ", "
-                            << itChild->second->m_taskOptionID << ", " << itChild->first << ", " << itChild->second->m_nodeCost << ")";
-#endif  //#ifdef STEVETEST
-                    itChild->second->ExpandNode();
+                    //tell the algebra function that we have accounted for this objective
+                    pushAssignedTaskOption((*itChild)->m_taskOptionIndex);
+                    searchNode(**itChild);
+                    popAssignedTaskOption();
                 }
                 else
                 {
-                    itChild->second->m_isPruneable = true;
+                    m_numberNodesPruned++;
                 }
             } //for(L_CHILD_IT_t itChild=lnodeitGe ......
-            PruneChildren();
         }
         else //if(((bTaskAvailable)&&(bVehicleAvailable))
         {
             // have all of the tasks been accounted for?
+            // (if not, not all of the tasks could be assigned below this node)
             if (!bTaskAvailable)
             {
-                // check to see if this leaf node is better than the candidate optimal
-                if (m_nodeCost < m_staticAssignmentParameters->m_minimumAssignmentCostCandidate)
-                {
-                    ////////////////  NEW LEAF NODE  ///////////////////////////
-                    // this is the new minimum (feasible) leaf node
-                    m_isLeafNode = true;
-                    m_staticAssignmentParameters->m_numberCompleteAssignments++;
-                    m_staticAssignmentParameters->m_minimumAssignmentCostCandidate = m_nodeCost;
-                    m_staticAssignmentParameters->m_candidateVehicleIdVsAssignmentState.clear();
-                    for (auto itVehicleAssignment = m_vehicleIdVsAssignmentState.begin(); itVehicleAssignment != m_vehicleIdVsAssignmentState.end(); itVehicleAssignment++)
-                    {
-                        m_staticAssignmentParameters->m_candidateVehicleIdVsAssignmentState[itVehicleAssignment->first] = itVehicleAssignment->second->clone();
-                    }
-                    printStatus("INFO::NEW LEAF: ");
-                }
-                else //if (m_nodeCost < m_staticAssignmentParameters->m_minimumAssignmentCostCandidate)
-                {
-                    //COUT_INFO_MSG("(!bTaskAvailable)")
-                    // this is a node that is not optimal and needs to be pruned
-                    m_isLeafNode = true;
-                    m_isPruneable = true;
-                } //if (m_nodeCost < m_staticAssignmentParameters->m_minimumAssignmentCostCandidate)
+                acceptCandidateAssignment(node);
             }
-            else //if(!bTaskAvailable)
-            {
-                //COUT_INFO_MSG("(bTaskAvailable && !bVehicleAvailable)")
-                // not all of the tasks were assigned!!!!!
-                //TODO:: let them know why this set of assignments didn't work???
-                // this is a node that is not optimal and needs to be pruned
-                m_isLeafNode = true;
-                m_isPruneable = true;
-            } //if(!bTaskAvailable)
         } //if(((bTaskAvailable)&&(bVehicleAvailable)))
     }
 
     if (m_staticAssignmentParameters->m_isStopCondition)
     {
         // got a stop condition, time to get out
-        if (!m_isFinalAssignmentCalculated)
+        if (!m_isFinalAssignmentCalculated.exchange(true))
         {
             //COUT_INFO_MSG("calculateFinalAssignment()!")
             calculateFinalAssignment();
-            m_isFinalAssignmentCalculated = true;
         }
-        // dump the children
-        m_costVsChildren.clear();
-
     } //if(m_staticAssignmentParameters->m_isStopCondition)
-} //void CNode::ExpandNode(
 
-void c_Node_Base::PruneChildren()
-{
-    bool isPruneParent(true); //if any of the nodes below this are not pruned then don't allow this one to be pruned
+    // dump the children
+    m_numberNodesRemoved += children.size();
+    m_nodeArena.release(numberNodesInUse);
+} //void c_Node_Base::searchNode(
 
-    if (!m_costVsChildren.empty())
+bool c_Node_Base::acceptCandidateAssignment(const c_AssignmentNode& node)
+{
+    bool isAccepted(false);
+    if (isPromising(node.m_nodeCost))
     {
-        for (auto itChild = m_costVsChildren.begin(); itChild != m_costVsChildren.end(); itChild++)
+        std::lock_guard<std::mutex> lock(m_staticAssignmentParameters->m_mutex);
+        // another search thread may have found a better assignment
+        if (isPromising(node.m_nodeCost))
         {
-            itChild->second->PruneChildren();
+            ////////////////  NEW LEAF NODE  ///////////////////////////
+            // this is the new minimum (feasible) leaf node
+            m_staticAssignmentParameters->m_numberCompleteAssignments++;
+            m_staticAssignmentParameters->m_candidateSubtreeIndex = m_subtreeIndex;
+            m_staticAssignmentParameters->m_minimumAssignmentCostCandidate = node.m_nodeCost;
+            setCandidateAssignment(node);
+            printStatus("INFO::NEW LEAF: ");
+            isAccepted = true;
         }
-        while (1)
-        {
-            auto itChild = m_costVsChildren.begin();
-            for (; itChild != m_costVsChildren.end(); itChild++)
-            {
-                if (itChild->second->m_isPruneable)
-                {
-                    m_costVsChildren.erase(itChild);
-                    itChild = m_costVsChildren.begin();
-                    m_staticAssignmentParameters->m_numberNodesPruned++;
-                    break;
-                }
-                else
-                {
-                    isPruneParent = false;
-                }
+    }
+    return (isAccepted);
+}
 
-            }
-            if (itChild == m_costVsChildren.end())
-            {
-                break;
-            }
-        } //while(1)
+c_AssignmentNode* c_Node_Base::appendAssignment(const c_AssignmentNode& parentNode, const uint32_t& vehicleIndex, const uint32_t& taskOptionIndex)
+{
+    c_AssignmentNode* newNode(nullptr);
+    int64_t taskTime_ms = m_staticAssignmentParameters->getTaskTime_ms(vehicleIndex, taskOptionIndex);
+    int64_t travelTime_ms = m_staticAssignmentParameters->getTravelTime_ms(vehicleIndex, parentNode.m_vehicleLastLocation[vehicleIndex], taskOptionIndex);
+    if (travelTime_ms >= 0)
+    {
+        int64_t travelTimeTotalToEnd_ms = taskTime_ms + travelTime_ms + parentNode.m_vehicleTravelTimeTotal_ms[vehicleIndex];
+        newNode = m_nodeArena.allocateNode();
+        calculateAssignmentCostBase(parentNode, vehicleIndex, m_staticAssignmentParameters->m_taskOptionIds[taskOptionIndex],
+                                    taskTime_ms, travelTime_ms,
+                                    newNode->m_nodeCost, newNode->m_evaluationOrderCost);
+        newNode->m_parent = &parentNode;
+        newNode->m_taskCompletionTime_ms = travelTimeTotalToEnd_ms;
+        newNode->m_vehicleIndex = vehicleIndex;
+        newNode->m_taskOptionIndex = taskOptionIndex;
+        size_t numberVehicles = m_staticAssignmentParameters->m_vehicleIds.size();
+        std::copy(parentNode.m_vehicleTravelTimeTotal_ms, parentNode.m_vehicleTravelTimeTotal_ms + numberVehicles, newNode->m_vehicleTravelTimeTotal_ms);
+        std::copy(parentNode.m_vehicleLastLocation, parentNode.m_vehicleLastLocation + numberVehicles, newNode->m_vehicleLastLocation);
+        newNode->m_vehicleTravelTimeTotal_ms[vehicleIndex] = travelTimeTotalToEnd_ms;
+        newNode->m_vehicleLastLocation[vehicleIndex] = taskOptionIndex + 1;
     }
-    else if ((m_nodeCost < m_staticAssignmentParameters->m_minimumAssignmentCostCandidate) && m_isLeafNode)
+    return (newNode);
+}
+
+void c_Node_Base::setCandidateAssignment(const c_AssignmentNode& node)
+{
+    // only the best assignment found so far is converted to TaskAssignment messages
+    m_staticAssignmentParameters->m_candidateVehicleIdVsAssignmentState.clear();
+    for (uint32_t vehicle = 0; vehicle < m_staticAssignmentParameters->m_vehicleIds.size(); vehicle++)
     {
-        isPruneParent = false;
+        int64_t vehicleId = m_staticAssignmentParameters->m_vehicleIds[vehicle];
+        auto vehicleAssignmentState = m_vehicleIdVsAssignmentState[vehicleId]->clone();
+        vehicleAssignmentState->m_travelTimeTotal_ms = node.m_vehicleTravelTimeTotal_ms[vehicle];
+        m_staticAssignmentParameters->m_candidateVehicleIdVsAssignmentState[vehicleId] = std::move(vehicleAssignmentState);
+    }
+
+    std::vector<const c_AssignmentNode*> assignmentNodes;
+    for (auto assignmentNode = &node; assignmentNode->m_parent != nullptr; assignmentNode = assignmentNode->m_parent)
+    {
+        assignmentNodes.push_back(assignmentNode);
+    }
+    for (auto itNode = assignmentNodes.rbegin(); itNode != assignmentNodes.rend(); itNode++)
+    {
+        int64_t vehicleId = m_staticAssignmentParameters->m_vehicleIds[(*itNode)->m_vehicleIndex];
+        int64_t taskOptionId = m_staticAssignmentParameters->m_taskOptionIds[(*itNode)->m_taskOptionIndex];
+        auto taskAssignment = std::unique_ptr<uxas::messages::task::TaskAssignment>(new uxas::messages::task::TaskAssignment());
+        taskAssignment->setTaskID(c_TaskAssignmentState::getTaskID(taskOptionId));
+        taskAssignment->setOptionID(c_TaskAssignmentState::getOptionID(taskOptionId));
+        taskAssignment->setAssignedVehicle(vehicleId);
+        taskAssignment->setTimeThreshold((*itNode)->m_timeThreshold_ms);
+        taskAssignment->setTimeTaskCompleted((*itNode)->m_taskCompletionTime_ms);
+        m_staticAssignmentParameters->m_candidateVehicleIdVsAssignmentState[vehicleId]->m_taskAssignments.push_back(std::move(taskAssignment));
     }
-    m_isPruneable = isPruneParent;
 }
 
-void c_Node_Base::NodeAssignment(std::unique_ptr<c_VehicleAssignmentState>& vehicleAssignmentState, const int64_t& taskOptionId, const int64_t & prerequisiteTaskOptionId)
+void c_Node_Base::NodeAssignment(const c_AssignmentNode& parentNode, const uint32_t& vehicleIndex, const int64_t& taskOptionId,
+                                 const int64_t& prerequisiteTaskOptionId, std::vector<c_AssignmentNode*>& children)
 {
-    if (((m_staticAssignmentParameters->m_numberNodesVisited % 100000) == 0) && (m_staticAssignmentParameters->m_numberNodesVisited > 0))
+    if (m_numberNodesVisited >= 1024)
     {
-        printStatus("INFO::UPDATE: ");
+        addNodeCounts();
     }
 
     if ((m_staticAssignmentParameters->m_numberNodesMaximum >= 0) &&
-            (m_staticAssignmentParameters->m_numberNodesVisited >= m_staticAssignmentParameters->m_numberNodesMaximum) &&
+            ((m_staticAssignmentParameters->m_numberNodesVisited + m_numberNodesVisited) >= m_staticAssignmentParameters->m_numberNodesMaximum) &&
             (m_staticAssignmentParameters->m_numberCompleteAssignments > 0))
     {
         m_staticAssignmentParameters->m_isStopCondition = true;
@@ -939,26 +1431,34 @@ void c_Node_Base::NodeAssignment(std::unique_ptr<c_VehicleAssignmentState>& vehi
 
     bool isError(false);
 
-    int64_t vehicleId = vehicleAssignmentState->m_vehicleId;
+    int64_t vehicleId = m_staticAssignmentParameters->m_vehicleIds[vehicleIndex];
     // find the prerequisite cost, if there is one
     int64_t prerequisiteTime_ms(0);
     if (prerequisiteTaskOptionId > 0)
     {
-        auto itTaskAssignmentState = m_taskIdVsAssignmentState.find(prerequisiteTaskOptionId);
-        if (itTaskAssignmentState != m_taskIdVsAssignmentState.end())
+        isError = true;
+        auto itPrerequisiteIndex = m_staticAssignmentParameters->m_taskOptionIdVsIndex.find(prerequisiteTaskOptionId);
+        if (itPrerequisiteIndex != m_staticAssignmentParameters->m_taskOptionIdVsIndex.end())
         {
-            prerequisiteTime_ms = itTaskAssignmentState->second->m_taskCompletionTime_ms;
+            for (auto assignmentNode = &parentNode; assignmentNode->m_parent != nullptr; assignmentNode = assignmentNode->m_parent)
+            {
+                if (assignmentNode->m_taskOptionIndex == itPrerequisiteIndex->second)
+                {
+                    prerequisiteTime_ms = assignmentNode->m_taskCompletionTime_ms;
+                    isError = false;
+                    break;
+                }
+            }
         }
-        else
+        if (isError)
         {
 	UXAS_LOG_ERROR("ASSIGNMENT_ERROR:: required prerequisite TaskOptionId[", prerequisiteTaskOptionId, "] not found");
-            m_staticAssignmentParameters->m_reasonsForNoAssignment << "ASSIGNMENT_ERROR:: required prerequisite TaskOptionId[" << prerequisiteTaskOptionId << "] not found!" << std::endl;
-            isError = true;
+            addReasonForNoAssignment("ASSIGNMENT_ERROR:: required prerequisite TaskOptionId[" + std::to_string(prerequisiteTaskOptionId) + "] not found!");
         }
     }
 
-    auto itVehicleInformation = m_staticAssignmentParameters->m_vehicleIdVsInformation.find(vehicleId);
-    auto itTaskOptionInformation = m_staticAssignmentParameters->m_taskOptionIdVsInformation.find(taskOptionId);
+    bool isVehicleInformation = (m_staticAssignmentParameters->m_isVehicleInformation[vehicleIndex] != 0);
+    auto itTaskOptionIndex = m_staticAssignmentParameters->m_taskOptionIdVsIndex.find(taskOptionId);
 
     /* NOTE:: local travel time variables
      * taskTime_ms - the time required to perform the task
@@ -969,25 +1469,18 @@ void c_Node_Base::NodeAssignment(std::unique_ptr<c_VehicleAssignmentState>& vehi
      * travelTimeTotalToEnd_ms - the total travel time from the vehicle's starting position
      *      to the end of the current task, including all task times.
      * */
-    if (!isError &&
-            (itVehicleInformation != m_staticAssignmentParameters->m_vehicleIdVsInformation.end()) &&
-            (itTaskOptionInformation != m_staticAssignmentParameters->m_taskOptionIdVsInformation.end()) &&
-            (vehicleAssignmentState->m_isAcceptingNewAssignments))
-    {
-        int64_t taskTime_ms = itTaskOptionInformation->second->getTravelTime_ms(vehicleId);
-        int64_t startingLocationId = vehicleId;
-        if (!vehicleAssignmentState->m_taskAssignments.empty())
-        {
-            auto lastTaskId = vehicleAssignmentState->m_taskAssignments.back()->getTaskID();
-            auto lastOptionId = vehicleAssignmentState->m_taskAssignments.back()->getOptionID();
-            startingLocationId = c_TaskAssignmentState::getTaskAndOptionId(lastTaskId, lastOptionId);
-        }
+    if (!isError && isVehicleInformation &&
+            (itTaskOptionIndex != m_staticAssignmentParameters->m_taskOptionIdVsIndex.end()))
+    {
+        uint32_t taskOptionIndex = itTaskOptionIndex->second;
+        int64_t taskTime_ms = m_staticAssignmentParameters->getTaskTime_ms(vehicleIndex, taskOptionIndex);
         // increment from last task to this one
-        int64_t travelTime_ms = itVehicleInformation->second->getTravelTime_ms(startingLocationId, taskOptionId);
+        int64_t travelTime_ms = m_staticAssignmentParameters->getTravelTime_ms(vehicleIndex, parentNode.m_vehicleLastLocation[vehicleIndex], taskOptionIndex);
         if (travelTime_ms >= 0)
         {
+            int64_t vehicleTravelTimeTotal_ms = parentNode.m_vehicleTravelTimeTotal_ms[vehicleIndex];
             // travel from starting location to beginning of this task
-            int64_t travelTimeTotalToBegin_ms = travelTime_ms + vehicleAssignmentState->m_travelTimeTotal_ms;
+            int64_t travelTimeTotalToBegin_ms = travelTime_ms + vehicleTravelTimeTotal_ms;
 
             // make sure the new task doesn't get stated before the prerequisite cost
             if ((prerequisiteTime_ms > 0) && (travelTimeTotalToBegin_ms < prerequisiteTime_ms))
@@ -996,122 +1489,110 @@ void c_Node_Base::NodeAssignment(std::unique_ptr<c_VehicleAssignmentState>& vehi
             }
 
             // travel from starting location to end of this task
-            int64_t travelTimeTotalToEnd_ms = taskTime_ms + travelTime_ms + vehicleAssignmentState->m_travelTimeTotal_ms;
+            int64_t travelTimeTotalToEnd_ms = taskTime_ms + travelTime_ms + vehicleTravelTimeTotal_ms;
 
             // check vehicle's max travel time parameter
-            int64_t maxVehicleTravelTime_ms = itVehicleInformation->second->m_maxVehicleTravelTime_ms;
+            int64_t maxVehicleTravelTime_ms = m_staticAssignmentParameters->m_maxVehicleTravelTimes_ms[vehicleIndex];
 
             if ((maxVehicleTravelTime_ms < 0) || (travelTimeTotalToEnd_ms < maxVehicleTravelTime_ms))
             {
-                // create new child for cost calculation
-                auto newChild = std::unique_ptr<c_Node_Base>(clone());
+                m_numberNodesVisited++;
                 // calculate assignment cost
                 int64_t nodeCost(INT64_MAX);
                 int64_t evaluationOrderCost(INT64_MAX);
-                newChild->calculateAssignmentCostBase(vehicleAssignmentState, taskOptionId,
-                                                      taskTime_ms, travelTime_ms,
-                                                      nodeCost, evaluationOrderCost);
-                if (nodeCost < m_staticAssignmentParameters->m_minimumAssignmentCostCandidate)
+                calculateAssignmentCostBase(parentNode, vehicleIndex, taskOptionId,
+                                            taskTime_ms, travelTime_ms,
+                                            nodeCost, evaluationOrderCost);
+                if (isPromising(nodeCost))
                 {
                     // add new child
+                    auto newChild = m_nodeArena.allocateNode();
+                    newChild->m_parent = &parentNode;
                     newChild->m_nodeCost = nodeCost;
-                    //COUT_INFO_MSG("nodeCost[" << nodeCost << "]")
-                    newChild->m_travelTimeTotal_ms = travelTimeTotalToEnd_ms;
-                    newChild->m_vehicleID = vehicleId;
-                    newChild->m_taskOptionID = taskOptionId;
-                    //tell the algebra function that we have accounted for this objective
-                    newChild->m_viObjectiveIDs_Assigned.push_back(taskOptionId);
-
-                    //////// update the task //////////
-                    if (newChild->m_taskIdVsAssignmentState.find(taskOptionId) == newChild->m_taskIdVsAssignmentState.end())
-                    {
-                        newChild->m_taskIdVsAssignmentState[taskOptionId] = std::unique_ptr<c_TaskAssignmentState>(new c_TaskAssignmentState(taskOptionId));
-                    }
-                    newChild->m_taskIdVsAssignmentState[taskOptionId]->m_taskCompletionTime_ms = travelTimeTotalToEnd_ms;
+                    newChild->m_evaluationOrderCost = evaluationOrderCost;
+                    newChild->m_timeThreshold_ms = prerequisiteTime_ms;
+                    newChild->m_taskCompletionTime_ms = travelTimeTotalToEnd_ms;
+                    newChild->m_vehicleIndex = vehicleIndex;
+                    newChild->m_taskOptionIndex = taskOptionIndex;
+                    newChild->m_childIndex = static_cast<uint32_t> (children.size());
                     //////// update the vehicle //////////
-                    newChild->m_vehicleIdVsAssignmentState[vehicleAssignmentState->m_vehicleId]->m_travelTimeTotal_ms = travelTimeTotalToEnd_ms;
-                    // add the assignment
-                    auto taskAssignment = std::unique_ptr<uxas::messages::task::TaskAssignment>(new uxas::messages::task::TaskAssignment());
-                    taskAssignment->setTaskID(c_TaskAssignmentState::getTaskID(taskOptionId));
-                    taskAssignment->setOptionID(c_TaskAssignmentState::getOptionID(taskOptionId));
-                    taskAssignment->setAssignedVehicle(vehicleId);
-                    taskAssignment->setTimeThreshold(prerequisiteTime_ms);
-                    taskAssignment->setTimeTaskCompleted(travelTimeTotalToEnd_ms);
-                    newChild->m_vehicleIdVsAssignmentState[vehicleAssignmentState->m_vehicleId]->m_taskAssignments.push_back(std::move(taskAssignment));
-                    m_costVsChildren.insert(std::pair<int64_t, std::unique_ptr<c_Node_Base> >(evaluationOrderCost, std::move(newChild)));
-                    m_staticAssignmentParameters->m_numberNodesAdded++;
+                    size_t numberVehicles = m_staticAssignmentParameters->m_vehicleIds.size();
+                    std::copy(parentNode.m_vehicleTravelTimeTotal_ms, parentNode.m_vehicleTravelTimeTotal_ms + numberVehicles, newChild->m_vehicleTravelTimeTotal_ms);
+                    std::copy(parentNode.m_vehicleLastLocation, parentNode.m_vehicleLastLocation + numberVehicles, newChild->m_vehicleLastLocation);
+                    newChild->m_vehicleTravelTimeTotal_ms[vehicleIndex] = travelTimeTotalToEnd_ms;
+                    newChild->m_vehicleLastLocation[vehicleIndex] = taskOptionIndex + 1;
+                    children.push_back(newChild);
+                    m_numberNodesAdded++;
                 }
                 else
                 {
-                    newChild.reset();
+                    m_numberNodesRemoved++;
                 }
             }
             else
             {
-                m_staticAssignmentParameters->m_reasonsForNoAssignment << "ASSIGNMENT_WARNING:: Vehicle[" << vehicleId << "] exceeded travel time[" << maxVehicleTravelTime_ms << "]!" << std::endl;
+                addReasonForNoAssignment("ASSIGNMENT_WARNING:: Vehicle[" + std::to_string(vehicleId) + "] exceeded travel time[" + std::to_string(maxVehicleTravelTime_ms) + "]!");
             }
         }
         else //if (travelTime_ms > 0)
         {
             //UXAS_LOG_WARN("ASSIGNMENT_WARNING:: No TravelTime_ms[", startingLocationId, ",", taskOptionId, "] found.");
-            m_staticAssignmentParameters->m_reasonsForNoAssignment << "ASSIGNMENT_WARNING:: No TravelTime_ms[" << startingLocationId << "," << taskOptionId << "] found.!" << std::endl;
+            int64_t startingLocationId = (parentNode.m_vehicleLastLocation[vehicleIndex] == 0) ? (vehicleId) :
+                    (m_staticAssignmentParameters->m_taskOptionIds[parentNode.m_vehicleLastLocation[vehicleIndex] - 1]);
+            addReasonForNoAssignment("ASSIGNMENT_WARNING:: No TravelTime_ms[" + std::to_string(startingLocationId) + "," + std::to_string(taskOptionId) + "] found.!");
         } //if (travelTime_ms > 0)
     }
-    else //if ( !isError && (itVehicleAssignmentState != m_vehicleIdVsAssignmentState.end()) &&  ... 
+    else //if ( !isError && isVehicleInformation &&  ... 
     {
-        if (itVehicleInformation == m_staticAssignmentParameters->m_vehicleIdVsInformation.end())
+        if (!isVehicleInformation)
         {
-            m_staticAssignmentParameters->m_reasonsForNoAssignment << "ASSIGNMENT_ERROR:: could not find information for VehilceId[" << vehicleId << "]!" << std::endl;
+            addReasonForNoAssignment("ASSIGNMENT_ERROR:: could not find information for VehilceId[" + std::to_string(vehicleId) + "]!");
         }
-        if (itTaskOptionInformation == m_staticAssignmentParameters->m_taskOptionIdVsInformation.end())
+        if (itTaskOptionIndex == m_staticAssignmentParameters->m_taskOptionIdVsIndex.end())
         {
-            m_staticAssignmentParameters->m_reasonsForNoAssignment << "ASSIGNMENT_ERROR:: could not find information for TaskOptionId[" << taskOptionId << "]!" << std::endl;
+            addReasonForNoAssignment("ASSIGNMENT_ERROR:: could not find information for TaskOptionId[" + std::to_string(taskOptionId) + "]!");
         }
     }
 }
 
-void c_Node_Base::calculateAssignmentCostBase(std::unique_ptr<c_VehicleAssignmentState>& vehicleAssignmentState, const int64_t& taskOptionId,
+void c_Node_Base::calculateAssignmentCostBase(const c_AssignmentNode& parentNode, const uint32_t& vehicleIndex, const int64_t& taskOptionId,
                                               const int64_t& taskTime_ms, const int64_t& travelTime_ms,
                                               int64_t& nodeCost, int64_t& evaluationOrderCost)
 {
     nodeCost = MAX_COST_MS;
     evaluationOrderCost = MAX_COST_MS;
+    size_t numberVehicles = m_staticAssignmentParameters->m_vehicleIds.size();
 
 #ifdef AFRL_INTERNAL_ENABLED
     switch (m_assignmentType)
     {
         default:
 //COUT_FILE_LINE_MSG("")
-            calculateAssignmentCost(vehicleAssignmentState, taskOptionId,
+            calculateAssignmentCost(parentNode, vehicleIndex, taskOptionId,
                                     taskTime_ms, travelTime_ms,
                                     nodeCost, evaluationOrderCost);
             break;
         case uxas::project::pisr::AssignmentType::MinMaxTime:
 //COUT_FILE_LINE_MSG("")
 
-            nodeCost = taskTime_ms + travelTime_ms + vehicleAssignmentState->m_travelTimeTotal_ms;
-            for (auto itVehicle = m_vehicleIdVsAssignmentState.begin(); itVehicle != m_vehicleIdVsAssignmentState.end(); itVehicle++)
+            nodeCost = taskTime_ms + travelTime_ms + parentNode.m_vehicleTravelTimeTotal_ms[vehicleIndex];
+            for (uint32_t vehicle = 0; vehicle < numberVehicles; vehicle++)
             {
-                int64_t travelTimeTotalLocal_ms = nodeCost;
-                if (itVehicle->first != vehicleAssignmentState->m_vehicleId)
+                if ((vehicle != vehicleIndex) && (parentNode.m_vehicleTravelTimeTotal_ms[vehicle] > nodeCost))
                 {
-                    travelTimeTotalLocal_ms = itVehicle->second->m_travelTimeTotal_ms;
-                }
-                if (travelTimeTotalLocal_ms > nodeCost)
-                {
-                    nodeCost = travelTimeTotalLocal_ms;
+                    nodeCost = parentNode.m_vehicleTravelTimeTotal_ms[vehicle];
                 }
             }
             evaluationOrderCost = nodeCost;
             break;
         case uxas::project::pisr::AssignmentType::MinCumlativeTime:
 //COUT_FILE_LINE_MSG("")
-            nodeCost = taskTime_ms + travelTime_ms + vehicleAssignmentState->m_travelTimeTotal_ms;
-            for (auto itVehicle = m_vehicleIdVsAssignmentState.begin(); itVehicle != m_vehicleIdVsAssignmentState.end(); itVehicle++)
+            nodeCost = taskTime_ms + travelTime_ms + parentNode.m_vehicleTravelTimeTotal_ms[vehicleIndex];
+            for (uint32_t vehicle = 0; vehicle < numberVehicles; vehicle++)
             {
-                if (itVehicle->first != vehicleAssignmentState->m_vehicleId)
+                if (vehicle != vehicleIndex)
                 {
-                    nodeCost += itVehicle->second->m_travelTimeTotal_ms;
+                    nodeCost += parentNode.m_vehicleTravelTimeTotal_ms[vehicle];
                 }
             }
             evaluationOrderCost = nodeCost;
@@ -1119,17 +1600,12 @@ void c_Node_Base::calculateAssignmentCostBase(std::unique_ptr<c_VehicleAssignmen
     }
 #else
     // MINMAX
-    nodeCost = taskTime_ms + travelTime_ms + vehicleAssignmentState->m_travelTimeTotal_ms;
-    for (auto itVehicle = m_vehicleIdVsAssignmentState.begin(); itVehicle != m_vehicleIdVsAssignmentState.end(); itVehicle++)
+    nodeCost = taskTime_ms + travelTime_ms + parentNode.m_vehicleTravelTimeTotal_ms[vehicleIndex];
+    for (uint32_t vehicle = 0; vehicle < numberVehicles; vehicle++)
     {
-        int64_t travelTimeTotalLocal_ms = nodeCost;
-        if (itVehicle->first != vehicleAssignmentState->m_vehicleId)
-        {
-            travelTimeTotalLocal_ms = itVehicle->second->m_travelTimeTotal_ms;
-        }
-        if (travelTimeTotalLocal_ms > nodeCost)
+        if ((vehicle != vehicleIndex) && (parentNode.m_vehicleTravelTimeTotal_ms[vehicle] > nodeCost))
         {
-            nodeCost = travelTimeTotalLocal_ms;
+            nodeCost = parentNode.m_vehicleTravelTimeTotal_ms[vehicle];
         }
     }
     evaluationOrderCost = nodeCost;
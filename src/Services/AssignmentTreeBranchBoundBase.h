@@ -30,8 +30,15 @@
 #include "uxas/project/pisr/AssignmentType.h"
 #endif
 
+#include <atomic>
+#include <condition_variable>
 #include <cstdint> // int64_t
+#include <deque>
+#include <functional>
 #include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #define MAX_COST_MS (INT64_MAX / 10000)
 
@@ -129,6 +136,15 @@ public:
         CUMULATIVE,
         MINMAX
     };
+
+    /*! \brief  algorithm used to calculate the assignment, see AssignmentSolverEngines.h*/
+    enum class SolverEngine
+    {
+        BRANCH_AND_BOUND,
+        LARGE_NEIGHBORHOOD_SEARCH,
+        HUNGARIAN,
+        AUTO
+    };
 public:
 
     c_StaticAssignmentParameters() { };
@@ -138,19 +154,43 @@ public:
 public:
     std::unordered_map<int64_t, std::unique_ptr<c_VehicleInformationStatic>> m_vehicleIdVsInformation;
     std::unordered_map<int64_t, std::unique_ptr<c_TaskInformationStatic>> m_taskOptionIdVsInformation;
-    int64_t m_minimumAssignmentCostCandidate = {INT64_MAX};
+    std::atomic<int64_t> m_minimumAssignmentCostCandidate{INT64_MAX};
     int64_t m_minimumAssignmentTravelTimeCandidate_ms = {INT64_MAX};
-    int64_t m_numberNodesVisited = {0};
-    int64_t m_numberNodesAdded = {0};
-    int64_t m_numberNodesPruned = {0};
-    int64_t m_numberNodesRemoved = {0};
-    int64_t m_numberCompleteAssignments = {0};
+    std::atomic<int64_t> m_numberNodesVisited{0};
+    std::atomic<int64_t> m_numberNodesAdded{0};
+    std::atomic<int64_t> m_numberNodesPruned{0};
+    std::atomic<int64_t> m_numberNodesRemoved{0};
+    std::atomic<int64_t> m_numberCompleteAssignments{0};
 
     uxas::common::utilities::CAlgebra algebra; // ALGEBRA:: Algebra class definition
+    /*! \brief  "algebra" compiled for the search, its action indices are the task option indices (see initializeDenseTables)*/
+    uxas::common::utilities::CCompiledAlgebra m_compiledAlgebra;
 
-    bool m_isStopCondition = {false};
+    std::atomic<bool> m_isStopCondition{false};
 
     int64_t m_numberNodesMaximum = {0};  // default to best-first search
+    /*! \brief  iterations of each large neighborhood search chain*/
+    int64_t m_numberSolverIterations = {1000};
+    /*! \brief  number of threads used to search subtrees in parallel (the assignment thread and
+     * worker pool threads), 0 -> one less than the number of worker pool threads*/
+    uint32_t m_numberSearchThreads = {1};
+    /*! \brief  index of the subtree of the candidate assignment. Between assignments with
+     * equal costs the one from the first subtree (in depth first order) is kept, so
+     * the parallel search returns the same assignment as the serial search */
+    std::atomic<uint32_t> m_candidateSubtreeIndex{UINT32_MAX};
+    /*! \brief  guards the candidate assignment and m_reasonsForNoAssignment during parallel searches*/
+    std::mutex m_mutex;
+    /*! \brief  the search stops when this flag is set, e.g. the request was superseded*/
+    const std::atomic<bool>* m_isCancelled = {nullptr};
+    /*! \brief  the search stops at this time (ms) once there is a complete assignment, 0 -> no deadline*/
+    int64_t m_searchDeadline_ms = {0};
+    /*! \brief  anytime results: while searching, "m_publishCandidateAssignment" is called
+     * at most every "m_publishPeriod_ms" when there is a new candidate assignment (m_mutex is locked).
+     * It reports the candidate's cost, the assignment itself is only sent when the search ends*/
+    std::function<void()> m_publishCandidateAssignment;
+    int64_t m_publishPeriod_ms = {0};
+    int64_t m_nextPublishTime_ms = {0};
+    int64_t m_numberCompleteAssignmentsPublished = {0};
     CostFunction m_CostFunction = {CostFunction::MINMAX};
     int64_t m_assignmentStartTime_ms = {0};
 
@@ -159,6 +199,41 @@ public:
     /*! \brief  these are vehicle assignment parameters that do change during the assignment*/
     std::unordered_map<int64_t, std::unique_ptr< c_VehicleAssignmentState> > m_candidateVehicleIdVsAssignmentState;
 
+public:
+    /*! \brief  builds the dense (index based) tables used by the search from
+     * the vehicle and task option information maps and compiles the process
+     * algebra. The vehicle indices follow the order of "vehicleIds" */
+    void initializeDenseTables(const std::vector<int64_t>& vehicleIds);
+
+    /*! \brief  travel time from location "fromLocation" (0 -> vehicle's initial
+     * position, k+1 -> task option index k) to task option index "toOption", -1 -> no travel time*/
+    int64_t getTravelTime_ms(const uint32_t& vehicleIndex, const uint32_t& fromLocation, const uint32_t& toOption) const
+    {
+        return (m_travelTimes_ms[(static_cast<size_t> (vehicleIndex) * (m_taskOptionIds.size() + 1) + fromLocation) * m_taskOptionIds.size() + toOption]);
+    };
+
+    /*! \brief  time for the vehicle to perform the task option, -1 -> not available*/
+    int64_t getTaskTime_ms(const uint32_t& vehicleIndex, const uint32_t& taskOption) const
+    {
+        return (m_taskTimes_ms[static_cast<size_t> (vehicleIndex) * m_taskOptionIds.size() + taskOption]);
+    };
+
+    /*! \brief  vehicle index -> vehicle ID*/
+    std::vector<int64_t> m_vehicleIds;
+    /*! \brief  vehicle index -> maximum mission travel time (ms), -1 -> no maximum travel time*/
+    std::vector<int64_t> m_maxVehicleTravelTimes_ms;
+    /*! \brief  vehicle index -> true if information was found for the vehicle*/
+    std::vector<uint8_t> m_isVehicleInformation;
+    /*! \brief  task option index -> task option ID*/
+    std::vector<int64_t> m_taskOptionIds;
+    std::unordered_map<int64_t, uint32_t> m_taskOptionIdVsIndex;
+
+private:
+    /*! \brief  [vehicle index][from location][to task option index], see getTravelTime_ms*/
+    std::vector<int64_t> m_travelTimes_ms;
+    /*! \brief  [vehicle index][task option index], see getTaskTime_ms*/
+    std::vector<int64_t> m_taskTimes_ms;
+
 private:
     /*! @name Private: No Copying*/
     c_StaticAssignmentParameters(const c_StaticAssignmentParameters& rhs) = delete; //no copying
@@ -208,6 +283,78 @@ private:
 ////////////////////////////////////////////////////
 ////////////////////////////////////////////////////
 
+/*! \brief  a node of the search tree. Each node records one assignment (vehicle
+ * to task option), the assignments of the node's ancestors are found through the
+ * parent links, i.e. a child shares its assignment prefix with its parent. Nodes
+ * are allocated from a c_NodeArena and are released with their siblings. */
+class c_AssignmentNode
+{
+public:
+    /*! \brief  parent node, nullptr for the root node (no assignment)*/
+    const c_AssignmentNode* m_parent = {nullptr};
+    /*! \brief  vehicle index -> total travel time of the vehicle's assignments (including this node)*/
+    int64_t* m_vehicleTravelTimeTotal_ms = {nullptr};
+    /*! \brief  vehicle index -> location of the vehicle's last assignment, see c_StaticAssignmentParameters::getTravelTime_ms*/
+    uint32_t* m_vehicleLastLocation = {nullptr};
+    int64_t m_nodeCost = {0};
+    int64_t m_evaluationOrderCost = {0};
+    /*! \brief  prerequisite time of this node's assignment*/
+    int64_t m_timeThreshold_ms = {0};
+    /*! \brief  time this node's assignment is complete*/
+    int64_t m_taskCompletionTime_ms = {0};
+    uint32_t m_vehicleIndex = {0};
+    uint32_t m_taskOptionIndex = {0};
+    /*! \brief  order in which the node was added to its siblings, used to break cost ties*/
+    uint32_t m_childIndex = {0};
+};
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*! \brief  stack allocator for search nodes. Nodes, including their per vehicle
+ * arrays, are stored in fixed size records in large blocks. Since the search is
+ * depth first, nodes are released in the reverse order of allocation, so
+ * releasing is resetting the number of nodes in use. The blocks are kept for
+ * reuse until the arena is destroyed. */
+class c_NodeArena
+{
+public:
+    c_NodeArena() { };
+
+    /*! \brief  sets the number of vehicles (size of the per vehicle arrays), releases all nodes*/
+    void initialize(const uint32_t& numberVehicles);
+
+    /*! \brief  returns a default initialized node with uninitialized per vehicle arrays*/
+    c_AssignmentNode* allocateNode();
+
+    /*! \brief  number of nodes in use*/
+    size_t size() const
+    {
+        return (m_numberNodes);
+    };
+
+    /*! \brief  releases the nodes allocated after the arena had "numberNodes" nodes in use*/
+    void release(const size_t& numberNodes)
+    {
+        m_numberNodes = numberNodes;
+    };
+
+private:
+    uint32_t m_numberVehicles = {0};
+    size_t m_recordSize_words = {0};
+    size_t m_nodesPerBlock = {0};
+    size_t m_numberNodes = {0};
+    std::vector<std::unique_ptr<int64_t[]> > m_blocks;
+
+private:
+    /*! @name Private: No Copying*/
+    c_NodeArena(const c_NodeArena& rhs) = delete; //no copying
+    c_NodeArena& operator=(const c_NodeArena&) = delete; //no copying
+};
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 class c_Node_Base
 {
 public: //constructors/destructors
@@ -218,21 +365,75 @@ public: //constructors/destructors
     c_Node_Base(const c_Node_Base& rhs);
     
 public: //member functions - prototypes
+    /*! \brief  runs the (depth first) branch and bound search from the vehicles' states in m_vehicleIdVsAssignmentState.
+     * With more than one search thread, the top of the tree is split into subtrees
+     * that are searched on the worker pool, sharing the candidate assignment's cost for pruning.*/
     virtual void ExpandNode();
 protected: //member functions - prototypes
     virtual std::unique_ptr<c_Node_Base> clone();
-    virtual void NodeAssignment(std::unique_ptr<c_VehicleAssignmentState>& vehicleAssignmentState, const int64_t& taskOptionId, const int64_t& prerequisiteTaskOptionId);
-    virtual void calculateAssignmentCost(std::unique_ptr<c_VehicleAssignmentState>& vehicleAssignmentState, const int64_t& taskOptionId,
+    virtual void NodeAssignment(const c_AssignmentNode& parentNode, const uint32_t& vehicleIndex, const int64_t& taskOptionId,
+                                const int64_t& prerequisiteTaskOptionId, std::vector<c_AssignmentNode*>& children);
+    /*! \brief  cost of adding the assignment of "taskOptionId" to vehicle "vehicleIndex" to the assignments of "parentNode"*/
+    virtual void calculateAssignmentCost(const c_AssignmentNode& parentNode, const uint32_t& vehicleIndex, const int64_t& taskOptionId,
                                             const int64_t& taskTime_ms, const int64_t& travelTime_ms,
                                             int64_t& nodeCost, int64_t& evaluationOrderCost){};
     virtual void calculateFinalAssignment(){};                                        
 
 public: // member functions - prototypes
-    void PruneChildren();
     void printStatus(const std::string& Message);
 
+protected:
+    /*! \brief  builds the dense tables from the static parameters and m_vehicleIdVsAssignmentState,
+     * returns the root node (vehicles' initial states, no assignments) */
+    c_AssignmentNode* initializeSearch();
+    /*! \brief  number of search threads, see c_StaticAssignmentParameters::m_numberSearchThreads*/
+    uint32_t getNumberSearchThreads();
+    /*! \brief  expands the tree, breadth first, until there are at least "numberSubtreesTarget"
+     * subtree roots (or no more nodes to expand). "subtreeRoots" are in depth first order */
+    void buildSubtreeRoots(const c_AssignmentNode& rootNode, const size_t& numberSubtreesTarget, std::vector<const c_AssignmentNode*>& subtreeRoots);
+    /*! \brief  searches the subtree below "subtreeRoot", "subtreeIndex" is its depth first order*/
+    void searchSubtree(const c_AssignmentNode& subtreeRoot, const uint32_t& subtreeIndex);
+    /*! \brief  expands "node" and searches the subtrees of its children*/
+    void searchNode(const c_AssignmentNode& node);
+    /*! \brief  copies the assignments of the leaf node "node" to m_candidateVehicleIdVsAssignmentState*/
+    void setCandidateAssignment(const c_AssignmentNode& node);
+    /*! \brief  makes the complete assignment "node" the candidate assignment, if it is better (see isPromising)*/
+    bool acceptCandidateAssignment(const c_AssignmentNode& node);
+    /*! \brief  adds the assignment of task option "taskOptionIndex" to vehicle "vehicleIndex" to the
+     * assignments of "parentNode", nullptr if there is no travel time (no limits are checked) */
+    c_AssignmentNode* appendAssignment(const c_AssignmentNode& parentNode, const uint32_t& vehicleIndex, const uint32_t& taskOptionIndex);
+    /*! \brief  true if an assignment with cost "cost", in this subtree, would replace the candidate assignment*/
+    bool isPromising(const int64_t& cost) const
+    {
+        int64_t minimumAssignmentCost = m_staticAssignmentParameters->m_minimumAssignmentCostCandidate;
+        return ((cost < minimumAssignmentCost) ||
+                ((cost == minimumAssignmentCost) && (m_subtreeIndex < m_staticAssignmentParameters->m_candidateSubtreeIndex)));
+    };
+    /*! \brief  sets m_assignedTaskOptions to the task options assigned from the root to "node"*/
+    void setAssignedTaskOptions(const c_AssignmentNode& node);
+    void pushAssignedTaskOption(const uint32_t& taskOptionIndex)
+    {
+        m_assignedTaskOptions.push_back(taskOptionIndex);
+        uxas::common::utilities::CCompiledAlgebra::setBit(m_isAssignedTaskOption, taskOptionIndex);
+    };
+    void popAssignedTaskOption()
+    {
+        uxas::common::utilities::CCompiledAlgebra::clearBit(m_isAssignedTaskOption, m_assignedTaskOptions.back());
+        m_assignedTaskOptions.pop_back();
+    };
+    /*! \brief  the action indices (task option indices, see c_StaticAssignmentParameters::m_compiledAlgebra)
+     * the process algebra accepts after m_assignedTaskOptions*/
+    void searchNextTaskOptions(std::vector<uint32_t>& nextTaskOptions)
+    {
+        m_staticAssignmentParameters->m_compiledAlgebra.searchNext(m_isAssignedTaskOption, nextTaskOptions, m_algebraBuffers);
+    };
+    /*! \brief  adds this search's node counts to the totals in m_staticAssignmentParameters
+     * and checks for cancellation, the search deadline and anytime results*/
+    void addNodeCounts();
+    void addReasonForNoAssignment(const std::string& reason);
+
 private:    // base member functions
-    void calculateAssignmentCostBase(std::unique_ptr<c_VehicleAssignmentState>& vehicleAssignmentState, const int64_t& taskOptionId,
+    void calculateAssignmentCostBase(const c_AssignmentNode& parentNode, const uint32_t& vehicleIndex, const int64_t& taskOptionId,
                                             const int64_t& taskTime_ms, const int64_t& travelTime_ms,
                                             int64_t& nodeCost, int64_t& evaluationOrderCost);
     
@@ -240,34 +441,33 @@ public:
     /*! \brief  these are assignment parameters that do not change during the assignment*/
     static std::unique_ptr<c_StaticAssignmentParameters> m_staticAssignmentParameters;
     /*! \brief  this flag controls calling the calculateFinalAssignment function only once */
-    static bool m_isFinalAssignmentCalculated;
-    /*! \brief  these are vehicle assignment parameters that do change during the assignment*/
-    std::unordered_map<int64_t, std::unique_ptr< c_VehicleAssignmentState> > m_vehicleIdVsAssignmentState; //available vehicle and their state for this node
-    /*! \brief  these are task assignment parameters that do change during the assignment*/
-    std::unordered_map<int64_t, std::unique_ptr< c_TaskAssignmentState> > m_taskIdVsAssignmentState; //tasks and their state for this node
+    static std::atomic<bool> m_isFinalAssignmentCalculated;
+    /*! \brief  the vehicles available for assignment and their initial state*/
+    std::unordered_map<int64_t, std::unique_ptr< c_VehicleAssignmentState> > m_vehicleIdVsAssignmentState;
 #ifdef AFRL_INTERNAL_ENABLED
     /*! \brief  this is used to determine the type of cost calculation to call */
     static uxas::project::pisr::AssignmentType::AssignmentType m_assignmentType;
 #endif
     
 protected: //member storage
-    /*! \brief map of children of this node, sorted by cost */
-    std::multimap<int64_t, std::unique_ptr<c_Node_Base> > m_costVsChildren;
-    std::vector<int64_t> m_viObjectiveIDs_Assigned;
-
-    // added for information
-    int64_t m_vehicleID{0};
-    int64_t m_taskOptionID{0};
-    
-    /*! \brief  this is the travel time of the assignments, including this node and
-     *  it's predecessors from the trunk to the current node*/
-    int64_t m_travelTimeTotal_ms = {0};
-    
-    bool m_isPruneable = {true}; //can this node be pruned
-    bool m_isLeafNode = {false}; //is this a leaf node
-
-    int64_t m_nodeCost{0};
-    
+    /*! \brief  storage for the nodes of the search tree*/
+    c_NodeArena m_nodeArena;
+    /*! \brief  the task option indices assigned by the nodes from the root to the node being expanded, in order*/
+    std::vector<uint32_t> m_assignedTaskOptions;
+    /*! \brief  bitset of m_assignedTaskOptions, the executed actions of the compiled process algebra*/
+    std::vector<uint64_t> m_isAssignedTaskOption;
+    /*! \brief  this search's storage for evaluating the compiled process algebra*/
+    uxas::common::utilities::CCompiledAlgebra::s_SearchBuffers m_algebraBuffers;
+    /*! \brief  per tree depth storage for the next task options and children of the node being expanded*/
+    std::deque<std::vector<uint32_t> > m_nextTaskOptionsByDepth;
+    std::deque<std::vector<c_AssignmentNode*> > m_childrenByDepth;
+    /*! \brief  depth first order of the subtree being searched*/
+    uint32_t m_subtreeIndex = {0};
+    /*! \brief  node counts not yet added to m_staticAssignmentParameters, see addNodeCounts*/
+    int64_t m_numberNodesVisited = {0};
+    int64_t m_numberNodesAdded = {0};
+    int64_t m_numberNodesPruned = {0};
+    int64_t m_numberNodesRemoved = {0};
     
 private:
     /*! @name Private: No Copying*/
@@ -286,7 +486,15 @@ private:
  * Configuration String: 
  * 
  * Options:
- *  - 
+ *  - SearchTimeMaximum_ms - stop the search this long after it starts, once it has a complete assignment (0 -> no limit)
+ *  - AnytimePublishPeriod_ms - while searching, report the cost of improved assignments at this period (ServiceStatus "AssignmentUpdate"/"AssignmentCost", 0 -> no reports).
+ *    Only the final assignment is sent as a TaskAssignmentSummary
+ *  - SolverEngine - BRANCH_AND_BOUND, LARGE_NEIGHBORHOOD_SEARCH, HUNGARIAN (no ordering constraints, no more tasks than vehicles;
+ *    assigns at most one task to each vehicle, which can be far from optimal) or AUTO (LARGE_NEIGHBORHOOD_SEARCH for more than
+ *    16 task options, otherwise BRANCH_AND_BOUND, never HUNGARIAN)
+ *  - SolverIterations - iterations of each LARGE_NEIGHBORHOOD_SEARCH chain (one chain per search thread)
+ *  - NumberSearchThreads - threads searching in parallel, the assignment thread and worker pool threads
+ *    (0 -> one less than the number of worker pool threads, so a worker is left for message processing)
  * 
  * Subscribed Messages:
  *  - 
@@ -294,6 +502,12 @@ private:
  * Sent Messages:
  *  - 
  * 
+ * Assignments are calculated, one request at a time, on the service's
+ * assignment thread, so the service keeps processing messages while it
+ * searches. A newer UniqueAutomationRequest cancels the assignments of the
+ * older requests (the request validator has given up on them). All messages
+ * sent by this class are sent from the assignment thread.
+ * 
  */
 
 
@@ -344,6 +558,8 @@ protected: //virtual
         std::shared_ptr<uxas::messages::task::AssignmentCostMatrix> m_assignmentCostMatrix;
         std::unordered_map<int64_t, std::shared_ptr < uxas::messages::task::TaskPlanOptions>> m_taskIdVsTaskPlanOptions;
         bool m_isNewAssignmentType{false};
+        /** brief set to stop the assignment of this request */
+        std::atomic<bool> m_isCancelled{false};
     };
     
     /** brief Children classes can override this to perform
@@ -365,6 +581,19 @@ protected: //virtual
     /** brief starts the branch and bound assignment. */
     virtual void calculateAssignment(std::unique_ptr<c_Node_Base> nodeAssignment,const std::shared_ptr<AssigmentPrerequisites>& assigmentPrerequisites);
     void sendErrorMsg(std::string& errStr);
+    /** brief sends the assignments in "vehicleIdVsAssignmentState" as the TaskAssignmentSummary of the request */
+    void sendTaskAssignmentSummary(const std::shared_ptr<AssigmentPrerequisites>& assigmentPrerequisites,
+                                   const std::unordered_map<int64_t, std::unique_ptr<c_VehicleAssignmentState> >& vehicleIdVsAssignmentState);
+
+private:
+    /** brief queues the assignment of a request on the assignment thread */
+    void queueAssignment(const std::shared_ptr<AssigmentPrerequisites>& assigmentPrerequisites);
+    /** brief cancels the queued and running assignments of requests other than "requestId" */
+    void cancelAssignments(const int64_t& requestId);
+    /** brief assignment thread, calculates the queued assignments in order */
+    void executeAssignments();
+    /** brief replaces the tree search node with the node of the configured solver engine, if it applies */
+    void selectSolverEngine(std::unique_ptr<c_Node_Base>& nodeAssignment);
 
 
 protected:
@@ -373,8 +602,22 @@ protected:
     bool m_isUsingAssignmentTypes{false};
     std::unordered_map<int64_t,std::shared_ptr<AssigmentPrerequisites> > m_idVsAssigmentPrerequisites;
     int64_t m_numberNodesMaximum = {0}; // default to best-first search
+    uint32_t m_numberSearchThreads = {1};
+    int64_t m_searchTimeMaximum_ms = {0};
+    int64_t m_anytimePublishPeriod_ms = {0};
+    c_StaticAssignmentParameters::SolverEngine m_solverEngine = {c_StaticAssignmentParameters::SolverEngine::BRANCH_AND_BOUND};
+    int64_t m_numberSolverIterations = {1000};
     c_StaticAssignmentParameters::CostFunction m_CostFunction = {c_StaticAssignmentParameters::CostFunction::MINMAX};
 
+private:
+    std::unique_ptr<std::thread> m_assignmentThread;
+    /*! \brief  guards m_assignmentQueue, m_runningAssignment and m_isTerminateAssignments*/
+    std::mutex m_assignmentMutex;
+    std::condition_variable m_assignmentCondition;
+    std::deque<std::shared_ptr<AssigmentPrerequisites> > m_assignmentQueue;
+    std::shared_ptr<AssigmentPrerequisites> m_runningAssignment;
+    bool m_isTerminateAssignments{false};
+
 };
 }; //namespace service
 }; //namespace uxas
@@ -58,7 +58,7 @@ std::unique_ptr<c_Node_Base> c_Node_TreeBranchAndBound::clone()
 c_Node_TreeBranchAndBound::c_Node_TreeBranchAndBound(const c_Node_TreeBranchAndBound & rhs) //copy constructor
 : c_Node_Base(rhs) { };
 
-void c_Node_TreeBranchAndBound::calculateAssignmentCost(std::unique_ptr<c_VehicleAssignmentState>& vehicleAssignmentState, const int64_t& taskOptionId,
+void c_Node_TreeBranchAndBound::calculateAssignmentCost(const c_AssignmentNode& parentNode, const uint32_t& vehicleIndex, const int64_t& taskOptionId,
                                                            const int64_t& taskTime_ms, const int64_t& travelTime_ms,
                                                             int64_t& nodeCost, int64_t& evaluationOrderCost)
 {
@@ -37,7 +37,7 @@ public: //constructors/destructors
 protected: //member functions - prototypes
     /** brief used by the base class to make copies of this object */
     virtual std::unique_ptr<c_Node_Base> clone() override;
-    void calculateAssignmentCost(std::unique_ptr<c_VehicleAssignmentState>& vehicleAssignmentState, const int64_t& taskOptionId,
+    void calculateAssignmentCost(const c_AssignmentNode& parentNode, const uint32_t& vehicleIndex, const int64_t& taskOptionId,
                                     const int64_t& taskTime_ms, const int64_t& travelTime_ms,
                                             int64_t& nodeCost, int64_t& evaluationOrderCost) override;
 
@@ -52,11 +52,18 @@ private:
  *\brief This service calculates assignments of vehicles to tasks based on cost inputs. 
  * 
  * Configuration String: 
- *  <Service Type="AssignmentTreeBranchBoundService" NumberNodesMaximum="0",CostFunction="MINMAX" />
+ *  <Service Type="AssignmentTreeBranchBoundService" NumberNodesMaximum="0",CostFunction="MINMAX" NumberSearchThreads="1" SearchTimeMaximum_ms="0" AnytimePublishPeriod_ms="0" SolverEngine="BRANCH_AND_BOUND" SolverIterations="1000" />
  * 
  * Options:
  *  - NumberNodesMaximum
  *  - CostFunction
+ *  - NumberSearchThreads - threads searching the assignment tree in parallel, 0 -> one less than the number of worker pool threads
+ *  - SearchTimeMaximum_ms - stop the search this long after it starts, once it has a complete assignment (0 -> no limit)
+ *  - AnytimePublishPeriod_ms - while searching, report the cost of improved assignments at this period (0 -> no reports),
+ *    only the final assignment is sent
+ *  - SolverEngine - BRANCH_AND_BOUND, LARGE_NEIGHBORHOOD_SEARCH, HUNGARIAN or AUTO, see AssignmentSolverEngines.h.
+ *    HUNGARIAN assigns at most one task to each vehicle and is never selected by AUTO
+ *  - SolverIterations - iterations of each LARGE_NEIGHBORHOOD_SEARCH chain
  * 
  * Subscribed Messages:
  *  - uxas::messages::task::UniqueAutomationRequest
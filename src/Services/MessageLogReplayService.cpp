@@ -0,0 +1,264 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#include "MessageLogReplayService.h"
+
+#include "BinaryMessageLog.h"
+
+#include "avtas/lmcp/Factory.h"
+#include "avtas/lmcp/LmcpXMLReader.h"
+#include "uxas/messages/uxnative/StartupComplete.h"
+
+#include "UxAS_Log.h"
+#include "Constants/UxAS_String.h"
+#include "stdUniquePtr.h"
+
+#include <SQLiteCpp/Database.h>
+#include <SQLiteCpp/SQLiteCpp.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace uxas
+{
+namespace service
+{
+namespace data
+{
+
+MessageLogReplayService::ServiceBase::CreationRegistrar<MessageLogReplayService>
+        MessageLogReplayService::s_registrar(MessageLogReplayService::s_registryServiceTypeNames());
+
+MessageLogReplayService::MessageLogReplayService()
+: ServiceBase(MessageLogReplayService::s_typeName(), MessageLogReplayService::s_directoryName())
+{
+};
+
+MessageLogReplayService::~MessageLogReplayService()
+{
+    terminate();
+};
+
+bool
+MessageLogReplayService::configure(const pugi::xml_node& serviceXmlNode)
+{
+    m_logPath = serviceXmlNode.attribute(uxas::common::StringConstant::LogPath().c_str()).value();
+    if (m_logPath.empty())
+    {
+        UXAS_LOG_ERROR(s_typeName(), "::configure failed to find ", uxas::common::StringConstant::LogPath(), " in XML");
+        return (false);
+    }
+
+    if (!serviceXmlNode.attribute(uxas::common::StringConstant::LogFormat().c_str()).empty())
+    {
+        std::string logFormat = serviceXmlNode.attribute(uxas::common::StringConstant::LogFormat().c_str()).value();
+        if (logFormat == uxas::common::StringConstant::BinaryFormat() || logFormat == uxas::common::StringConstant::DatabaseFormat())
+        {
+            m_isBinaryLog = (logFormat == uxas::common::StringConstant::BinaryFormat());
+            UXAS_LOG_INFORM(s_typeName(), "::configure set log format to ", logFormat, " from XML");
+        }
+        else
+        {
+            UXAS_LOG_WARN(s_typeName(), "::configure retaining Database log format; ignoring invalid value ", logFormat, " from XML");
+        }
+    }
+
+    if (!serviceXmlNode.attribute(uxas::common::StringConstant::TimeScale().c_str()).empty())
+    {
+        double timeScale = serviceXmlNode.attribute(uxas::common::StringConstant::TimeScale().c_str()).as_double();
+        if (timeScale >= 0.0)
+        {
+            m_timeScale = timeScale;
+            UXAS_LOG_INFORM(s_typeName(), "::configure set m_timeScale value to ", m_timeScale, " from XML");
+        }
+        else
+        {
+            UXAS_LOG_WARN(s_typeName(), "::configure retaining m_timeScale value ", m_timeScale, "; ignoring invalid value from XML");
+        }
+    }
+
+    if (!serviceXmlNode.attribute(uxas::common::StringConstant::StartTime_ms().c_str()).empty())
+    {
+        m_startTime_ms = serviceXmlNode.attribute(uxas::common::StringConstant::StartTime_ms().c_str()).as_int64();
+        UXAS_LOG_INFORM(s_typeName(), "::configure set m_startTime_ms value to ", m_startTime_ms, " from XML");
+    }
+
+    if (!serviceXmlNode.attribute(uxas::common::StringConstant::EndTime_ms().c_str()).empty())
+    {
+        m_endTime_ms = serviceXmlNode.attribute(uxas::common::StringConstant::EndTime_ms().c_str()).as_int64();
+        UXAS_LOG_INFORM(s_typeName(), "::configure set m_endTime_ms value to ", m_endTime_ms, " from XML");
+    }
+
+    for (pugi::xml_node currentXmlNode = serviceXmlNode.first_child(); currentXmlNode; currentXmlNode = currentXmlNode.next_sibling())
+    {
+        if (std::string("ReplayMessage") == currentXmlNode.name())
+        {
+            std::string messageType = currentXmlNode.attribute(uxas::common::StringConstant::MessageType().c_str()).value();
+            if (!messageType.empty())
+            {
+                m_replayMessageTypes.push_back(messageType);
+            }
+        }
+    }
+
+    addSubscriptionAddress(uxas::messages::uxnative::StartupComplete::Subscription);
+
+    return (true);
+};
+
+bool
+MessageLogReplayService::terminate()
+{
+    m_isTerminate = true;
+    if (m_replayThread && m_replayThread->joinable())
+    {
+        m_replayThread->join();
+    }
+    return (true);
+};
+
+bool
+MessageLogReplayService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
+{
+    if (!m_replayThread && uxas::messages::uxnative::isStartupComplete(receivedLmcpMessage->m_object.get()))
+    {
+        m_replayThread = uxas::stduxas::make_unique<std::thread>(&MessageLogReplayService::executeReplay, this);
+        UXAS_LOG_INFORM(s_typeName(), "::processReceivedLmcpMessage started replay of ", m_logPath, " on thread [", m_replayThread->get_id(), "]");
+    }
+
+    return (false); // always false implies never terminating service from here
+};
+
+void
+MessageLogReplayService::executeReplay()
+{
+    auto startTime = std::chrono::steady_clock::now();
+    uint64_t replayedMessageCount = m_isBinaryLog ? replayBinaryLog() : replayDatabaseLog();
+    double duration_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    UXAS_LOG_INFORM(s_typeName(), "::executeReplay replayed ", replayedMessageCount, " messages in ", duration_s, " seconds (",
+                    (duration_s > 0.0 ? replayedMessageCount / duration_s : 0.0), " messages/s)", (m_isTerminate ? " before termination" : ""));
+};
+
+bool
+MessageLogReplayService::replayMessage(int64_t time_ms, std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> message)
+{
+    if (m_isTerminate)
+    {
+        return (false);
+    }
+
+    if (m_isFirstMessage)
+    {
+        m_isFirstMessage = false;
+        m_firstMessageTime_ms = time_ms;
+        m_replayStartTime = std::chrono::steady_clock::now();
+    }
+    else if (m_timeScale > 0.0)
+    {
+        // wait in short steps - termination is checked while waiting for sparse messages
+        auto replayTime = m_replayStartTime + std::chrono::microseconds(static_cast<int64_t>((time_ms - m_firstMessageTime_ms) * 1000.0 / m_timeScale));
+        while (std::chrono::steady_clock::now() < replayTime)
+        {
+            if (m_isTerminate)
+            {
+                return (false);
+            }
+            std::this_thread::sleep_until(std::min(replayTime, std::chrono::steady_clock::now() + std::chrono::milliseconds(100)));
+        }
+    }
+
+    // the replay thread is the only thread of this service that sends messages
+    sendSerializedLmcpObjectMessage(std::move(message));
+    return (true);
+};
+
+uint64_t
+MessageLogReplayService::replayBinaryLog()
+{
+    uint64_t replayedMessageCount{0};
+    uxas::communications::data::BinaryMessageLogReader binaryLogReader;
+    if (!binaryLogReader.open(m_logPath))
+    {
+        UXAS_LOG_ERROR(s_typeName(), "::replayBinaryLog failed to open binary message log ", m_logPath);
+        return (replayedMessageCount);
+    }
+    // the time range and message types are selected by the log index
+    binaryLogReader.setTimeRange(m_startTime_ms, m_endTime_ms);
+    binaryLogReader.setMessageTypes(m_replayMessageTypes);
+
+    uxas::communications::data::BinaryMessageLogReader::Record record;
+    while (binaryLogReader.readNext(record))
+    {
+        if (!replayMessage(record.m_time_ms, std::move(record.m_message)))
+        {
+            break;
+        }
+        replayedMessageCount++;
+    }
+
+    return (replayedMessageCount);
+};
+
+uint64_t
+MessageLogReplayService::replayDatabaseLog()
+{
+    uint64_t replayedMessageCount{0};
+    try
+    {
+        SQLite::Database database(m_logPath, SQLITE_OPEN_READONLY);
+        SQLite::Statement query(database, "SELECT time_ms,descriptor,groupID,entityID,serviceID,xml FROM msg"
+                " WHERE time_ms >= ? AND time_ms <= ? ORDER BY id");
+        query.bind(1, static_cast<sqlite3_int64>(m_startTime_ms));
+        query.bind(2, static_cast<sqlite3_int64>(m_endTime_ms));
+
+        while (query.executeStep())
+        {
+            std::string descriptor = query.getColumn(1).getText();
+            if (!m_replayMessageTypes.empty()
+                    && std::find(m_replayMessageTypes.begin(), m_replayMessageTypes.end(), descriptor) == m_replayMessageTypes.end())
+            {
+                continue;
+            }
+
+            std::unique_ptr<avtas::lmcp::Object> lmcpObject(avtas::lmcp::xml::readXML(query.getColumn(5).getText()));
+            if (!lmcpObject)
+            {
+                UXAS_LOG_WARN(s_typeName(), "::replayDatabaseLog failed to create ", descriptor, " LMCP object from logged XML");
+                continue;
+            }
+            avtas::lmcp::ByteBuffer* lmcpByteBuffer = avtas::lmcp::Factory::packMessage(lmcpObject.get(), true);
+            std::string serializedPayload(reinterpret_cast<char*>(lmcpByteBuffer->array()), lmcpByteBuffer->capacity());
+            delete lmcpByteBuffer;
+
+            auto message = uxas::stduxas::make_unique<uxas::communications::data::AddressedAttributedMessage>();
+            if (!message->setAddressAttributesAndPayload(descriptor, uxas::common::ContentType::lmcp(), descriptor,
+                                                         query.getColumn(2).getText(), query.getColumn(3).getText(),
+                                                         query.getColumn(4).getText(), serializedPayload))
+            {
+                continue;
+            }
+            if (!replayMessage(query.getColumn(0).getInt64(), std::move(message)))
+            {
+                break;
+            }
+            replayedMessageCount++;
+        }
+    }
+    catch (std::exception& ex)
+    {
+        UXAS_LOG_ERROR(s_typeName(), "::replayDatabaseLog failed to read database ", m_logPath, " EXCEPTION: ", ex.what());
+    }
+
+    return (replayedMessageCount);
+};
+
+}; //namespace data
+}; //namespace service
+}; //namespace uxas
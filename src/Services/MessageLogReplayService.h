@@ -0,0 +1,155 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#ifndef UXAS_SERVICE_DATA_MESSAGE_LOG_REPLAY_SERVICE_H
+#define UXAS_SERVICE_DATA_MESSAGE_LOG_REPLAY_SERVICE_H
+
+#include "ServiceBase.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace uxas
+{
+namespace service
+{
+namespace data
+{
+
+/*! \class MessageLogReplayService
+ *\brief Description:
+ * The <B><i>MessageLogReplayService</i></B> republishes messages recorded by
+ * the <B><i>MessageLoggerDataService</i></B> onto the <b>LMCP</b> network.
+ * Messages are read from either a binary message log (LogFormat="Binary") or
+ * the "msg" table of a message log database (LogFormat="Database") and sent
+ * with their recorded source group, entity ID and service ID.
+ *
+ * Replay starts when the <B><i>StartupComplete</i></B> message is received.
+ * Messages are sent in recorded order by a single replay thread (causal order
+ * is preserved at every time scale); the time between messages is the
+ * recorded time between messages divided by the time scale. A time scale of
+ * 0 sends messages as fast as possible. The sender pipe is not thread-safe;
+ * the replay thread is the only thread that sends (received messages only
+ * start the replay), so sends are not marshalled onto the service thread.
+ *
+ * Configuration String:
+ *  <Service Type="MessageLogReplayService" LogPath="./datawork/SavedMessages/messageLog" LogFormat="Binary" TimeScale="10.0">
+ *      <ReplayMessage MessageType="afrl.cmasi.AirVehicleState" />
+ *  </Service>
+ *
+ * Options:
+ *  - LogPath
+ *     (binary message log path prefix or database file path)
+ *  - LogFormat
+ *     ("Database" (default, as for the MessageLoggerDataService) or "Binary")
+ *  - TimeScale
+ *     (1.0 (default) - real-time; N - N times faster than real-time;
+ *      0 - as fast as possible)
+ *  - StartTime_ms, EndTime_ms
+ *     (replay only messages recorded within the time range)
+ *  - ReplayMessage
+ *     (replay only messages of the "MessageType" entries; default all)
+ *
+ * Subscribed Messages:
+ *  - uxas::messages::uxnative::StartupComplete
+ *
+ * Sent Messages:
+ *  - recorded messages
+ *
+ */
+class MessageLogReplayService : public ServiceBase
+{
+public:
+
+    static const std::string&
+    s_typeName() { static std::string s_string("MessageLogReplayService"); return (s_string); };
+
+    static const std::vector<std::string>
+    s_registryServiceTypeNames()
+    {
+        std::vector<std::string> registryServiceTypeNames = {s_typeName()};
+        return (registryServiceTypeNames);
+    };
+
+    static const std::string&
+    s_directoryName() { static std::string s_string("MessageLogReplay"); return (s_string); };
+
+    static ServiceBase*
+    create() { return new MessageLogReplayService; };
+
+    MessageLogReplayService();
+
+    virtual
+    ~MessageLogReplayService();
+
+private:
+
+    static
+    ServiceBase::CreationRegistrar<MessageLogReplayService> s_registrar;
+
+    /** \brief Copy construction not permitted */
+    MessageLogReplayService(MessageLogReplayService const&) = delete;
+
+    /** \brief Copy assignment operation not permitted */
+    void operator=(MessageLogReplayService const&) = delete;
+
+    bool
+    configure(const pugi::xml_node& serviceXmlNode) override;
+
+    bool
+    terminate() override;
+
+    bool
+    processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage) override;
+
+    /** \brief Replay thread function */
+    void
+    executeReplay();
+
+    /** \brief Send a recorded message at its (scaled) replay time.
+     *
+     * @return false if replay is terminating.
+     */
+    bool
+    replayMessage(int64_t time_ms, std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> message);
+
+    uint64_t
+    replayBinaryLog();
+
+    uint64_t
+    replayDatabaseLog();
+
+    std::string m_logPath;
+    bool m_isBinaryLog{false};
+    double m_timeScale{1.0};
+    int64_t m_startTime_ms{INT64_MIN};
+    int64_t m_endTime_ms{INT64_MAX};
+    /** \brief message types to replay (empty implies all) */
+    std::vector<std::string> m_replayMessageTypes;
+
+    std::unique_ptr<std::thread> m_replayThread;
+    std::atomic<bool> m_isTerminate{false};
+
+    /** \brief recorded time of the first replayed message */
+    int64_t m_firstMessageTime_ms{0};
+    /** \brief replay start (steady clock) */
+    std::chrono::steady_clock::time_point m_replayStartTime;
+    bool m_isFirstMessage{true};
+};
+
+}; //namespace data
+}; //namespace service
+}; //namespace uxas
+
+#endif /* UXAS_SERVICE_DATA_MESSAGE_LOG_REPLAY_SERVICE_H */
@@ -9,11 +9,14 @@
 
 #include "MessageLoggerDataService.h"
 
+#include "LmcpObjectMessageReceiverPipe.h"
 #include "UxAS_DatabaseLogger.h"
 #include "UxAS_FileLogger.h"
 #include "UxAS_Log.h"
+#include "UxAS_Time.h"
 #include "Constants/UxAS_String.h"
 #include "UxAS_XmlUtil.h"
+#include "stdUniquePtr.h"
 
 #include "FileSystemUtilities.h"
 
@@ -34,10 +37,17 @@ MessageLoggerDataService::ServiceBase::CreationRegistrar<MessageLoggerDataServic
 MessageLoggerDataService::MessageLoggerDataService()
 : ServiceBase(MessageLoggerDataService::s_typeName(), MessageLoggerDataService::s_directoryName())
 {
+    // log messages as received (de-serialize only for database/file logging)
+    m_receiveProcessingType = uxas::communications::LmcpObjectNetworkClientBase::ReceiveProcessingType::SERIALIZED_LMCP;
 };
 
 MessageLoggerDataService::~MessageLoggerDataService()
 {
+    if (m_binaryLogger)
+    {
+        m_binaryLogger->close();
+    }
+
     if (m_databaseLogger)
     {
         m_databaseLogger->closeStream();
@@ -52,6 +62,35 @@ MessageLoggerDataService::~MessageLoggerDataService()
 bool
 MessageLoggerDataService::configure(const pugi::xml_node& serviceXmlNode)
 {
+    if (!serviceXmlNode.attribute(uxas::common::StringConstant::LogFormat().c_str()).empty())
+    {
+        std::string logFormat = serviceXmlNode.attribute(uxas::common::StringConstant::LogFormat().c_str()).value();
+        if (logFormat == uxas::common::StringConstant::BinaryFormat() || logFormat == uxas::common::StringConstant::DatabaseFormat())
+        {
+            isBinaryLogger = (logFormat == uxas::common::StringConstant::BinaryFormat());
+            isDatabaseLogger = !isBinaryLogger;
+            UXAS_LOG_INFORM(s_typeName(), "::configure set log format to ", logFormat, " from XML");
+        }
+        else
+        {
+            UXAS_LOG_WARN(s_typeName(), "::configure retaining Database log format; ignoring invalid value ", logFormat, " from XML");
+        }
+    }
+
+    if (!serviceXmlNode.attribute(uxas::common::StringConstant::SegmentSize_MB().c_str()).empty())
+    {
+        uint32_t segmentSize_MB = serviceXmlNode.attribute(uxas::common::StringConstant::SegmentSize_MB().c_str()).as_uint();
+        if (segmentSize_MB > 0)
+        {
+            m_segmentSize_MB = segmentSize_MB;
+            UXAS_LOG_INFORM(s_typeName(), "::configure set m_segmentSize_MB value to ", m_segmentSize_MB, " from XML");
+        }
+        else
+        {
+            UXAS_LOG_WARN(s_typeName(), "::configure retaining m_segmentSize_MB value ", m_segmentSize_MB, "; ignoring invalid value from XML");
+        }
+    }
+
     if (!serviceXmlNode.attribute(uxas::common::StringConstant::LogFileMessageCountLimit().c_str()).empty())
     {
         uint32_t logFileMsgCntLimFromXml = serviceXmlNode.attribute(uxas::common::StringConstant::LogFileMessageCountLimit().c_str()).as_uint();
@@ -66,6 +105,26 @@ MessageLoggerDataService::configure(const pugi::xml_node& serviceXmlNode)
         }
     }
     
+    if (!serviceXmlNode.attribute(uxas::common::StringConstant::DatabaseBatchRowCount().c_str()).empty())
+    {
+        uint32_t databaseBatchRowCount = serviceXmlNode.attribute(uxas::common::StringConstant::DatabaseBatchRowCount().c_str()).as_uint();
+        if (databaseBatchRowCount > 0)
+        {
+            m_databaseBatchRowCount = databaseBatchRowCount;
+            UXAS_LOG_INFORM(s_typeName(), "::configure set m_databaseBatchRowCount value to ", m_databaseBatchRowCount, " from XML");
+        }
+        else
+        {
+            UXAS_LOG_WARN(s_typeName(), "::configure retaining m_databaseBatchRowCount value ", m_databaseBatchRowCount, "; ignoring invalid value from XML");
+        }
+    }
+
+    if (!serviceXmlNode.attribute(uxas::common::StringConstant::DatabaseBatchPeriod_ms().c_str()).empty())
+    {
+        m_databaseBatchPeriod_ms = serviceXmlNode.attribute(uxas::common::StringConstant::DatabaseBatchPeriod_ms().c_str()).as_uint();
+        UXAS_LOG_INFORM(s_typeName(), "::configure set m_databaseBatchPeriod_ms value to ", m_databaseBatchPeriod_ms, " from XML");
+    }
+    
     for (pugi::xml_node currentXmlNode = serviceXmlNode.first_child(); currentXmlNode; currentXmlNode = currentXmlNode.next_sibling())
     {
         if (std::string("LogMessage") == currentXmlNode.name())
@@ -84,9 +143,28 @@ MessageLoggerDataService::configure(const pugi::xml_node& serviceXmlNode)
 bool
 MessageLoggerDataService::initialize()
 {
-    bool isDatabaseLoggerSuccess{true};
     auto isTimeStamp = uxas::common::ConfigurationManager::getIsDataTimeStamp();
 
+    bool isBinaryLoggerSuccess{true};
+    if (isBinaryLogger)
+    {
+        m_binaryLogger = uxas::stduxas::make_unique<uxas::communications::data::BinaryMessageLogWriter>();
+        m_logFilePath = m_workDirectoryPath + "messageLog"
+                + (isTimeStamp ? ('_' + std::to_string(uxas::common::Time::getInstance().getUtcTimeSinceEpoch_ms())) : "");
+        isBinaryLoggerSuccess = m_binaryLogger->open(m_logFilePath, static_cast<uint64_t>(m_segmentSize_MB) * 1024 * 1024);
+
+        if (isBinaryLoggerSuccess)
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::initialize instantiated BinaryMessageLogWriter");
+        }
+        else
+        {
+            UXAS_LOG_ERROR(s_typeName(), "::initialize failed to instantiate BinaryMessageLogWriter");
+        }
+    }
+
+    bool isDatabaseLoggerSuccess{true};
+
     if (isDatabaseLogger)
     {
         m_databaseLogger = uxas::common::log::LoggerBase::instantiateLogger(uxas::common::log::DatabaseLogger::s_typeName());
@@ -94,7 +172,8 @@ MessageLoggerDataService::initialize()
 
         if (isDatabaseLoggerSuccess)
         {
-            std::string dbTableColumnNames{"id,time_ms,descriptor,groupID,entityID,serviceID,xml"};
+            // (id is assigned by SQLite)
+            std::string dbTableColumnNames{"time_ms,descriptor,groupID,entityID,serviceID,xml"};
 
             std::string dbTableName{"msg"};
 
@@ -108,6 +187,7 @@ MessageLoggerDataService::initialize()
             dbTableCreate.append(", xml BLOB NOT NULL)");
 
             isDatabaseLoggerSuccess = static_cast<uxas::common::log::DatabaseLogger*>(m_databaseLogger.get())->configureDatabase(dbTableCreate, dbTableName, dbTableColumnNames);
+            static_cast<uxas::common::log::DatabaseLogger*>(m_databaseLogger.get())->configureBatching(m_databaseBatchRowCount, m_databaseBatchPeriod_ms);
         }
 
         if (isDatabaseLoggerSuccess)
@@ -146,34 +226,53 @@ MessageLoggerDataService::initialize()
         }
     }
     
-    return (isDatabaseLoggerSuccess && isFileLoggerSuccess);
+    return (isBinaryLoggerSuccess && isDatabaseLoggerSuccess && isFileLoggerSuccess);
 };
 
 bool
-MessageLoggerDataService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
+MessageLoggerDataService::processReceivedSerializedLmcpMessage(std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> receivedSerializedLmcpMessage)
 {
-    UXAS_LOG_DEBUG_VERBOSE(s_typeName(), "::processReceivedLmcpMessage BEFORE logging received message");
+    UXAS_LOG_DEBUG_VERBOSE(s_typeName(), "::processReceivedSerializedLmcpMessage BEFORE logging received message");
+
+    int64_t time_ms = uxas::common::Time::getInstance().getUtcTimeSinceEpoch_ms();
     
-    if (m_databaseLogger)
+    if (m_binaryLogger)
     {
-        std::string XML = receivedLmcpMessage->m_object->toXML();
-        //uxas::common::XmlUtil::escapeXmlQuoteApostropheChars(XML);
-        m_databaseLogger->outputTextToStream("NULL,'" +
-                std::to_string(uxas::common::Time::getInstance().getUtcTimeSinceEpoch_ms()) + "','" +
-                receivedLmcpMessage->m_attributes->getDescriptor() + "','" +
-                receivedLmcpMessage->m_attributes->getSourceGroup() + "','" +
-                receivedLmcpMessage->m_attributes->getSourceEntityId() + "','" +
-                receivedLmcpMessage->m_attributes->getSourceServiceId() + "','" +
-                XML + "'");
+        m_binaryLogger->write(time_ms, *receivedSerializedLmcpMessage);
     }
     
-    if (m_fileLogger)
+    if (m_databaseLogger || m_fileLogger)
     {
-        m_fileLogger->outputTimeTextToStream(receivedLmcpMessage->m_attributes->getString());
-        m_fileLogger->outputTextToStream(receivedLmcpMessage->m_object->toXML());
+        std::unique_ptr<avtas::lmcp::Object> lmcpObject = uxas::communications::LmcpObjectMessageReceiverPipe::deserializeMessage(receivedSerializedLmcpMessage->getPayloadView());
+        if (!lmcpObject)
+        {
+            UXAS_LOG_WARN(s_typeName(), "::processReceivedSerializedLmcpMessage failed to de-serialize ", receivedSerializedLmcpMessage->getMessageAttributesReference()->getDescriptor(), " message");
+            return (false);
+        }
+        std::string xml = lmcpObject->toXML();
+        const std::unique_ptr<uxas::communications::data::MessageAttributes>& attributes = receivedSerializedLmcpMessage->getMessageAttributesReference();
+
+        if (m_fileLogger)
+        {
+            m_fileLogger->outputTimeTextToStream(attributes->getString());
+            m_fileLogger->outputTextToStream(xml);
+        }
+
+        if (m_databaseLogger)
+        {
+            std::vector<std::string> rowValues;
+            rowValues.reserve(6);
+            rowValues.push_back(std::to_string(time_ms));
+            rowValues.push_back(attributes->getDescriptor());
+            rowValues.push_back(attributes->getSourceGroup());
+            rowValues.push_back(attributes->getSourceEntityId());
+            rowValues.push_back(attributes->getSourceServiceId());
+            rowValues.push_back(std::move(xml));
+            static_cast<uxas::common::log::DatabaseLogger*>(m_databaseLogger.get())->outputRowToStream(std::move(rowValues));
+        }
     }
     
-    UXAS_LOG_DEBUG_VERBOSE(s_typeName(), "::processReceivedLmcpMessage AFTER logging received message");
+    UXAS_LOG_DEBUG_VERBOSE(s_typeName(), "::processReceivedSerializedLmcpMessage AFTER logging received message");
 
     return (false); // always false implies never terminating service from here
 };
@@ -13,6 +13,7 @@
 
 
 #include "ServiceBase.h"
+#include "BinaryMessageLog.h"
 
 #include "UxAS_DatabaseLogger.h"
 #include "UxAS_FileLogger.h"
@@ -33,6 +34,15 @@ namespace data
  * UxAS services to a files in a directory.  Logging can be configured to log 
  * either all or a subset of service messages.
  * 
+ * Messages are received serialized. In "Database" log format, each message is 
+ * de-serialized once and logged as XML. In "Binary" log format, the received 
+ * serialized message (address, attributes and <b>LMCP</b> payload) is appended 
+ * to an indexed, segmented <B><i>BinaryMessageLog</i></B> without 
+ * de-serialization; the UxASMessageLogConverter utility converts a binary 
+ * log to the database (and/or text) form. Like the database file name, the 
+ * binary log location ("messageLog") is suffixed with the start time when 
+ * the configuration requests time stamped data.
+ * 
  * 
  * Configuration String: 
  *  <Service Type="MessageLoggerDataService" LogFileMessageCountLimit="10000">
@@ -40,9 +50,20 @@ namespace data
  *  </Service>
  *
  * Options:
+ *  - LogFormat
+ *     ("Database" (default) - XML rows of an SQLite database; "Binary" - 
+ *      serialized messages of a binary message log)
+ *  - SegmentSize_MB
+ *     (binary message log segment file size limit, default 64 MB)
  *  - LogFileMessageCountLimit
  *     (if provided, turns on additional plain text file logging with each
  *      file containing 'LogFileMessageCountLimit' number of messages)
+ *  - DatabaseBatchRowCount
+ *     (number of messages committed to the database in one transaction, 
+ *      default 500)
+ *  - DatabaseBatchPeriod_ms
+ *     (maximum time a message waits to be committed to the database, 
+ *      default 100 ms)
  * 
  * Subscribed Messages:
  *  - all those in "LogMessage" entries
@@ -99,12 +120,17 @@ private:
     initialize() override;
 
     bool
-    processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage) override;
+    processReceivedSerializedLmcpMessage(std::unique_ptr<uxas::communications::data::AddressedAttributedMessage> receivedSerializedLmcpMessage) override;
 
-    bool isDatabaseLogger{true};  // always save to database log
+    bool isBinaryLogger{false};   // save serialized messages to binary log (instead of database log)
+    bool isDatabaseLogger{true};  // save to database log unless binary log format
     bool isFileLogger{false};     // only save to file if message count limit provided
     uint32_t m_logDatabaseMessageCountLimit{UINT32_MAX};
     uint32_t m_logFileMessageCountLimit{0};
+    uint32_t m_databaseBatchRowCount{500};
+    uint32_t m_databaseBatchPeriod_ms{100};
+    uint32_t m_segmentSize_MB{64};
+    std::unique_ptr<uxas::communications::data::BinaryMessageLogWriter> m_binaryLogger;
     std::unique_ptr<uxas::common::log::LoggerBase> m_databaseLogger;
     std::unique_ptr<uxas::common::log::LoggerBase> m_fileLogger;
 
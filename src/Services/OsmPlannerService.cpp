@@ -45,6 +45,7 @@
 #define STRING_XML_MAP_EDGES_FILE "MapEdgesFile"
 #define STRING_XML_SHORTEST_PATH_FILE "ShortestPathFile"
 #define STRING_XML_METRICS_FILE "MetricsFile"
+#define STRING_XML_NUMBER_LANDMARKS "NumberLandmarks"
 
 
 #define CIRCLE_BOUNDARY_INCREMENT (_PI_O_10)
@@ -116,6 +117,19 @@ OsmPlannerService::configure(const pugi::xml_node& ndComponent)
         }
     }
 
+    if (!ndComponent.attribute(STRING_XML_ROUTE_CACHE_CAPACITY).empty())
+    {
+        m_routePlanCache.setCapacity(ndComponent.attribute(STRING_XML_ROUTE_CACHE_CAPACITY).as_uint());
+    }
+    if (!ndComponent.attribute(STRING_XML_ROUTE_CACHE_TOLERANCE_M).empty())
+    {
+        m_routePlanCache.setTolerance(ndComponent.attribute(STRING_XML_ROUTE_CACHE_TOLERANCE_M).as_double());
+    }
+    if (!ndComponent.attribute(STRING_XML_NUMBER_LANDMARKS).empty())
+    {
+        m_numberLandmarks = ndComponent.attribute(STRING_XML_NUMBER_LANDMARKS).as_uint();
+    }
+
     if (!ndComponent.attribute(STRING_XML_OSM_FILE).empty())
     {
         m_osmFileName = ndComponent.attribute(STRING_XML_OSM_FILE).value();
@@ -157,6 +171,17 @@ OsmPlannerService::initialize()
     return (isSuccess);
 };
 
+bool
+OsmPlannerService::terminate()
+{
+    // route cache counters since the last (throttled) status
+    if (m_routePlanCache.isStatusDue(0))
+    {
+        sendSharedLmcpObjectBroadcastMessage(m_routePlanCache.getServiceStatus());
+    }
+    return (true);
+}
+
 bool
 OsmPlannerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
 //example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->m_object.get()))
@@ -179,6 +204,10 @@ OsmPlannerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communicatio
                                                                                   ),
                                                    newResponse);
 
+            if (m_routePlanCache.isStatusDue())
+            {
+                sendSharedLmcpObjectBroadcastMessage(m_routePlanCache.getServiceStatus());
+            }
         }
     }
     else if (uxas::messages::route::isRoadPointsRequest(receivedLmcpMessage->m_object))
@@ -290,7 +319,7 @@ bool OsmPlannerService::bProcessRoutePlanRequest(const std::shared_ptr<uxas::mes
         routePlan->setRouteID((*itRequest)->getRouteID());
         routePlan->setRouteCost(-1);
 
-        if (m_graph && m_planningIndexVsNodeId && m_idVsNode)
+        if (!m_roadGraphRouter.empty() && m_planningIndexVsNodeId && m_idVsNode)
         {
             auto startTime = std::chrono::system_clock::now();
 
@@ -308,11 +337,24 @@ bool OsmPlannerService::bProcessRoutePlanRequest(const std::shared_ptr<uxas::mes
             int64_t nodeIdEnd(-1);
             double lengthFromNodeToEnd(-1.0);
 
+            std::stringstream sstrPlannerParameters;
+            sstrPlannerParameters << speed << "," << routePlanRequest->getIsCostOnlyRequest();
+            std::shared_ptr<uxas::messages::route::RoutePlan> cachedRoutePlan;
+            bool isCachedRoute = m_routePlanCache.find(routePlanRequest->getOperatingRegion(), sstrPlannerParameters.str(),
+                                                       positionStart.m_north_m, positionStart.m_east_m,
+                                                       positionEnd.m_north_m, positionEnd.m_east_m, cachedRoutePlan);
+
             // start node Id
-            bool isFoundNodeIdStart = isFindClosestNodeId(positionStart, m_cellVsPlanningNodeIds, nodeIdStart, lengthFromStartToNode);
+            bool isFoundNodeIdStart = !isCachedRoute && isFindClosestNodeId(positionStart, m_cellVsPlanningNodeIds, nodeIdStart, lengthFromStartToNode);
             // end node Id
-            bool isFoundNodeIdEnd = isFindClosestNodeId(positionEnd, m_cellVsPlanningNodeIds, nodeIdEnd, lengthFromNodeToEnd);
-            if (isFoundNodeIdStart && isFoundNodeIdEnd)
+            bool isFoundNodeIdEnd = !isCachedRoute && isFindClosestNodeId(positionEnd, m_cellVsPlanningNodeIds, nodeIdEnd, lengthFromNodeToEnd);
+            if (isCachedRoute)
+            {
+                delete routePlan;
+                routePlan = cachedRoutePlan->clone();
+                routePlan->setRouteID((*itRequest)->getRouteID());
+            }
+            else if (isFoundNodeIdStart && isFoundNodeIdEnd)
             {
                 int32_t numberWaypoints(-1); // for metrics
                 int32_t pathCost(0);
@@ -446,6 +488,10 @@ bool OsmPlannerService::bProcessRoutePlanRequest(const std::shared_ptr<uxas::mes
                         waypoint = nullptr; // gave up ownership
                     }
                     numberWaypoints = routePlan->getWaypoints().size();
+                    m_routePlanCache.insert(routePlanRequest->getOperatingRegion(), sstrPlannerParameters.str(),
+                                            positionStart.m_north_m, positionStart.m_east_m,
+                                            positionEnd.m_north_m, positionEnd.m_east_m,
+                                            std::shared_ptr<uxas::messages::route::RoutePlan>(routePlan->clone()));
                 }
                 else
                 {
@@ -518,7 +564,7 @@ bool OsmPlannerService::bProcessRoutePlanRequest(const std::shared_ptr<uxas::mes
                 UXAS_LOG_WARN("bProcessRoutePlanRequest:: could not find graph indices for RouteRequestId[", (*itRequest)->getRouteID(), "].");
                 isSuccess = false;
             } //if(isFindClosestIndices(positionStart,positionEnd,indexIdStart,index  ...
-        } //if(m_graph && m_planningIndexVsNodeId && m_idVsNode)
+        } //if(!m_roadGraphRouter.empty() && m_planningIndexVsNodeId && m_idVsNode)
         routePlanResponse->getRouteResponses().push_back(routePlan);
         routePlan = nullptr; //gave it up
     } //for (auto itRequest = routePlanRequest->getRouteRequests()
@@ -530,7 +576,7 @@ bool OsmPlannerService::isProcessRoadPointsRequest(const std::shared_ptr<uxas::m
                                                    std::shared_ptr<uxas::messages::route::RoadPointsResponse>& roadPointsResponse)
 {
     bool isSuccess(true);
-    if (m_graph && m_planningIndexVsNodeId && m_idVsNode)
+    if (!m_roadGraphRouter.empty() && m_planningIndexVsNodeId && m_idVsNode)
     {
         roadPointsResponse->setResponseID(roadPointsRequest->getRequestID());
         for (auto itRequest = roadPointsRequest->getRoadPointsRequests().begin();
@@ -909,7 +955,7 @@ bool OsmPlannerService::isProcessRoadPointsRequest(const std::shared_ptr<uxas::m
                 isSuccess = false;
             }
         } //for (auto itRequest = roadPoints
-    } //if(m_graph && m_planningIndexVsNodeId && m_idVsNode)
+    } //if(!m_roadGraphRouter.empty() && m_planningIndexVsNodeId && m_idVsNode)
 
     return (isSuccess);
 }
@@ -1372,6 +1418,9 @@ bool OsmPlannerService::isBuildGraph(const std::unordered_set<int64_t>& planning
 {
     bool isSuccess(true);
 
+    // routes of the previous graph are no longer valid
+    m_routePlanCache.invalidate();
+
     //3) build edges
 
     m_edges = std::vector<n_FrameworkLib::CEdge>();
@@ -1460,15 +1509,11 @@ bool OsmPlannerService::isBuildGraph(const std::unordered_set<int64_t>& planning
         }
     }
 
-    std::vector<int32_t> edgeLengths;
-    edgeLengths.reserve(m_edges.size());
-    for (auto itEdge = m_edges.begin(); itEdge != m_edges.end(); itEdge++)
-    {
-        edgeLengths.push_back(static_cast<int32_t> (itEdge->iGetLength()));
-    }
-
-    m_graph = std::make_shared<Graph_t>(m_edges.begin(), m_edges.end(),
-            edgeLengths.begin(), planningNodeIds.size());
+    // planning indices start at 1
+    auto startTime = std::chrono::system_clock::now();
+    m_roadGraphRouter.Build(m_edges, static_cast<uint32_t> (planningNodeIds.size()) + 1, m_numberLandmarks);
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - startTime;
+    UXAS_LOG_INFORM("OSM FILE:: built road graph with [", m_roadGraphRouter.uiGetNumberLandmarks(), "] landmarks, Elapsed Seconds[", elapsed_seconds.count(), "]");
 
 #ifdef EUCLIDEAN_PLOT    
     if (!m_mapEdgesFileName.empty())
@@ -1528,42 +1573,22 @@ bool OsmPlannerService::isFindShortestRoute(const int64_t& startNodeId, const in
             (itEndNodeIndex != m_nodeIdVsPlanningIndex.end()) &&
             (itEndNode != m_idVsNode->end()))
     {
-        VertexDescriptor_t start(itStartNodeIndex->second);
-        VertexDescriptor_t goal(itEndNodeIndex->second);
-        std::vector<int32_t> d(num_vertices(*m_graph));
-
-        std::vector<VertexDescriptor_t> p(num_vertices(*m_graph));
-        try
-        {
-            // call astar named parameter interface
-            boost::astar_search
-                    (*m_graph, start,
-                     //manhattan_distance_heuristic(m_idVsNode,m_planningIndexVsNodeId,*(itEndNode->second)),
-                     euclidean_distance_heuristic(m_idVsNode, m_planningIndexVsNodeId, *(itEndNode->second)),
-                     predecessor_map(boost::make_iterator_property_map(p.begin(), boost::get(boost::vertex_index, *m_graph))).
-                     distance_map(boost::make_iterator_property_map(d.begin(), boost::get(boost::vertex_index, *m_graph))).
-                     visitor(astar_goal_visitor(goal)));
-        }
-        catch (found_goal fg)
+        std::vector<uint32_t> pathIndices;
+        if (m_roadGraphRouter.bFindShortestPath(static_cast<uint32_t> (itStartNodeIndex->second),
+                                                static_cast<uint32_t> (itEndNodeIndex->second), pathLength, pathIndices))
         {
-            isSuccess = true; //for now :)
+            isSuccess = true;
             // found a path to the goal
-            pathLength = d[goal];
-            for (VertexDescriptor_t v = goal;; v = p[v])
+            for (auto itIndex = pathIndices.begin(); itIndex != pathIndices.end(); itIndex++)
             {
-                auto itId = m_planningIndexVsNodeId->find(static_cast<int32_t> (v));
+                auto itId = m_planningIndexVsNodeId->find(static_cast<int32_t> (*itIndex));
                 if (itId != m_planningIndexVsNodeId->end())
                 {
-                    pathNodes.push_front(itId->second);
-
-                    if (p[v] == v)
-                    {
-                        break;
-                    }
+                    pathNodes.push_back(itId->second);
                 }
                 else
                 {
-                    UXAS_LOG_ERROR("OSM FILE:: while constructing shortest route from index[ ", static_cast<int64_t> (v), "], could not find corresponding node Id.");
+                    UXAS_LOG_ERROR("OSM FILE:: while constructing shortest route from index[ ", static_cast<int64_t> (*itIndex), "], could not find corresponding node Id.");
                     isSuccess = false;
                     break;
                 }
@@ -1572,7 +1597,7 @@ bool OsmPlannerService::isFindShortestRoute(const int64_t& startNodeId, const in
             auto endTime = std::chrono::system_clock::now();
             std::chrono::duration<double> elapsed_seconds = endTime - startTime;
             m_searchTime_s = elapsed_seconds.count();
-            UXAS_LOG_INFORM(" **** Finished running ASTAR search from startNodeId[", startNodeId, "] to endNodeId[", endNodeId, "] Elapsed Seconds[", elapsed_seconds.count(), "] ****");
+            UXAS_LOG_INFORM(" **** Finished running ALT search from startNodeId[", startNodeId, "] to endNodeId[", endNodeId, "] Elapsed Seconds[", elapsed_seconds.count(), "] ****");
 
 //#define PRINT_SHORTEST_PATH
 #ifdef PRINT_SHORTEST_PATH
@@ -1581,7 +1606,7 @@ bool OsmPlannerService::isFindShortestRoute(const int64_t& startNodeId, const in
             {
                 std::cout << " -> " << *itNode;
             }
-            std::cout << std::endl << "Total travel cost: [" << d[goal] << "], Number of Nodes[" << pathNodes.size() << "]" << std::endl;
+            std::cout << std::endl << "Total travel cost: [" << pathLength << "], Number of Nodes[" << pathNodes.size() << "]" << std::endl;
 #endif  //PRINT_SHORTEST_PATH
         }
 
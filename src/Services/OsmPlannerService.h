@@ -22,7 +22,9 @@
 
 
 #include "VisibilityGraph.h"
+#include "RoadGraphRouter.h"
 #include "FlatEarth.h"
+#include "RoutePlanCache.h"
 
 #include "ServiceBase.h"
 #include "Constants/Constants_Control.h"
@@ -34,10 +36,6 @@
 #include "uxas/messages/route/RoadPointsRequest.h"
 #include "uxas/messages/route/RoadPointsResponse.h"
 
-#include "boost/graph/astar_search.hpp"
-#include "boost/graph/graph_traits.hpp"
-#include "boost/graph/adjacency_list.hpp"
-
 #include <unordered_map>
 
 namespace uxas
@@ -56,13 +54,25 @@ namespace service
  *    paths for each plan request.?????
  * 
  * Configuration String: 
- *  <Service Type="OsmPlannerService" OsmFile="" MapEdgesFile=""  ShortestPathFile=""  MetricsFile="" />
+ *  <Service Type="OsmPlannerService" OsmFile="" MapEdgesFile=""  ShortestPathFile=""  MetricsFile=""
+ *           RouteCacheCapacity="10000" RouteCacheTolerance_m="0.01" NumberLandmarks="8" />
  * 
  * Options:
  *  - OsmFile
  *  - MapEdgesFile
  *  - ShortestPathFile
  *  - MetricsFile
+ *  - RouteCacheCapacity: maximum number of cached route plans, 0 disables the
+ *    cache (shortest path and metrics files are only written for routes that
+ *    are not found in the cache)
+ *  - RouteCacheTolerance_m: start/end locations within the same cell of this
+ *    size share cached route plans
+ *  - NumberLandmarks: number of landmark nodes selected when the road graph is
+ *    built. Shortest routes are found using A* with lower bounds on the
+ *    remaining cost derived from the (precomputed) landmark to node costs.
+ *    More landmarks tighten the bounds, at the cost of memory (one cost per
+ *    node per landmark) and graph building time. 0 reduces the search to
+ *    Dijkstra's algorithm.
  * 
  * Subscribed Messages:
  *  - GroundPathPlanner
@@ -73,6 +83,7 @@ namespace service
  * Sent Messages:
  *  - uxas::messages::route::RoutePlanResponse
  *  - uxas::messages::route::EgressRouteResponse
+ *  - afrl::cmasi::ServiceStatus (route cache hit/miss counters)
  * 
  */
 
@@ -133,30 +144,13 @@ private:
     //bool
     //start() override;
 
-    //bool
-    //terminate() override;
+    bool
+    terminate() override;
 
     bool
     processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage) override;
 
 
-public:
-    //TODO:: is boost::vecS faster than boost::listS ???
-    //using Graph_t = boost::adjacency_list < boost::vecS, boost::vecS, boost::undirectedS, boost::no_property, boost::property < boost::edge_weight_t, int32_t > >;
-    using Graph_t = boost::adjacency_list < boost::listS, boost::vecS, boost::undirectedS, boost::no_property, boost::property < boost::edge_weight_t, int32_t > >;
-    using VertexDescriptor_t = boost::graph_traits <Graph_t>::vertex_descriptor;
-    using EdgeDescriptor_t = boost::graph_traits<Graph_t>::edge_descriptor;
-
-public:
-
-
-
-public: //virtual
-
-
-
-
-
 public:
 
     struct PairIdHash
@@ -266,7 +260,10 @@ protected:
     std::string m_strSavePath;
 
     std::vector<n_FrameworkLib::CEdge> m_edges; //uses node index
-    std::shared_ptr<Graph_t> m_graph;
+    /*! \brief  road graph (planning node indices) with landmark distances, used for shortest route searches */
+    n_FrameworkLib::CRoadGraphRouter m_roadGraphRouter;
+    /*! \brief  number of landmarks selected when the road graph is built */
+    uint32_t m_numberLandmarks = 8;
 
     int32_t m_numberHighways = 0;
     int32_t m_numberNodes = 0;
@@ -276,6 +273,9 @@ protected:
     double m_searchTime_s = 0.0;
     double m_processPlanTime_s = 0.0;
 
+    /*! \brief  cached route plans*/
+    uxas::common::utilities::RoutePlanCache<std::shared_ptr<uxas::messages::route::RoutePlan>> m_routePlanCache;
+
 private:
     bool isBuildFullPlot(const std::vector<int64_t>& highWayIds);
     uxas::common::utilities::FlatEarth m_flatEarth;
@@ -283,100 +283,6 @@ private:
 
 };
 
-// manhattan distance heuristic
-
-class manhattan_distance_heuristic : public boost::astar_heuristic<OsmPlannerService::Graph_t, int64_t>
-{
-public:
-
-    manhattan_distance_heuristic(std::shared_ptr<std::unordered_map<int64_t, std::unique_ptr<n_FrameworkLib::CPosition> > >& idVsNode,
-            std::shared_ptr<std::unordered_map<int32_t, int64_t> >& planningIndexVsNodeId,
-            n_FrameworkLib::CPosition& goalPosition)
-    : m_idVsNode(idVsNode), m_planningIndexVsNodeId(planningIndexVsNodeId), m_goalPosition(goalPosition) { }
-
-    int64_t operator()(OsmPlannerService::VertexDescriptor_t v)
-    {
-        int64_t returnDistance((std::numeric_limits<int64_t>::max)());
-
-        auto itNodeId = m_planningIndexVsNodeId->find(v);
-        if (itNodeId != m_planningIndexVsNodeId->end())
-        {
-            auto itPosition = m_idVsNode->find(itNodeId->second);
-            if (itPosition != m_idVsNode->end())
-            {
-                returnDistance = (m_goalPosition.m_north_m - itPosition->second->m_north_m) +
-                        (m_goalPosition.m_east_m - itPosition->second->m_east_m);
-            }
-        }
-        return (returnDistance);
-    }
-
-private:
-    std::shared_ptr<std::unordered_map<int64_t, std::unique_ptr<n_FrameworkLib::CPosition> > > m_idVsNode;
-    std::shared_ptr<std::unordered_map<int32_t, int64_t> > m_planningIndexVsNodeId;
-    n_FrameworkLib::CPosition m_goalPosition;
-};
-
-// euclidean distance heuristic
-
-class euclidean_distance_heuristic : public boost::astar_heuristic<OsmPlannerService::Graph_t, int64_t>
-{
-public:
-
-    euclidean_distance_heuristic(std::shared_ptr<std::unordered_map<int64_t, std::unique_ptr<n_FrameworkLib::CPosition> > >& idVsNode,
-            std::shared_ptr<std::unordered_map<int32_t, int64_t> >& planningIndexVsNodeId,
-            n_FrameworkLib::CPosition& goalPosition)
-    : m_idVsNode(idVsNode), m_planningIndexVsNodeId(planningIndexVsNodeId), m_goalPosition(goalPosition) { }
-
-    int64_t operator()(OsmPlannerService::VertexDescriptor_t v)
-    {
-        int64_t returnDistance((std::numeric_limits<int64_t>::max)());
-
-        auto itNodeId = m_planningIndexVsNodeId->find(v);
-        if (itNodeId != m_planningIndexVsNodeId->end())
-        {
-            auto itPosition = m_idVsNode->find(itNodeId->second);
-            if (itPosition != m_idVsNode->end())
-            {
-                returnDistance = static_cast<int64_t> (sqrt(pow(static_cast<double> (m_goalPosition.m_north_m - itPosition->second->m_north_m), 2.0) +
-                        pow(static_cast<double> (m_goalPosition.m_east_m - itPosition->second->m_east_m), 2.0)));
-            }
-        }
-        return (returnDistance);
-    }
-
-private:
-    std::shared_ptr<std::unordered_map<int64_t, std::unique_ptr<n_FrameworkLib::CPosition> > > m_idVsNode;
-    std::shared_ptr<std::unordered_map<int32_t, int64_t> > m_planningIndexVsNodeId;
-    n_FrameworkLib::CPosition m_goalPosition;
-};
-
-struct found_goal
-{
-}; // exception for termination
-
-// visitor that terminates when we find the goal
-
-class astar_goal_visitor : public boost::default_astar_visitor
-{
-public:
-
-    astar_goal_visitor(OsmPlannerService::VertexDescriptor_t goal) : m_goal(goal) { }
-
-    void examine_vertex(OsmPlannerService::VertexDescriptor_t u, const OsmPlannerService::Graph_t& g)
-    {
-        if (u == m_goal)
-            throw found_goal();
-    }
-private:
-private:
-    OsmPlannerService::VertexDescriptor_t m_goal;
-
-};
-
-
-
-
 }; //namespace service
 }; //namespace uxas
 
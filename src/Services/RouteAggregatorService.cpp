@@ -108,12 +108,7 @@ RouteAggregatorService::processReceivedLmcpMessage(std::unique_ptr<uxas::communi
     // successful de-serialization of message
     if (uxas::messages::route::isRoutePlanResponse(receivedLmcpMessage->m_object.get()))
     {
-        auto rplan = std::static_pointer_cast<uxas::messages::route::RoutePlanResponse>(receivedLmcpMessage->m_object);
-        m_routePlanResponses[rplan->getResponseID()] = rplan;
-        for (auto p : rplan->getRouteResponses())
-        {
-            m_routePlans[p->getRouteID()] = std::make_pair(rplan->getResponseID(), std::shared_ptr<uxas::messages::route::RoutePlan>(p->clone()));
-        }
+        StoreRoutePlanResponse(std::static_pointer_cast<uxas::messages::route::RoutePlanResponse>(receivedLmcpMessage->m_object));
         CheckAllRoutePlans();
     }
     else if (uxas::messages::route::isRouteRequest(receivedLmcpMessage->m_object.get()))
@@ -183,6 +178,46 @@ RouteAggregatorService::processReceivedLmcpMessage(std::unique_ptr<uxas::communi
     return (false); // always false implies never terminating service from here
 }
 
+bool
+RouteAggregatorService::processReceivedLmcpMessageBatch(std::vector< std::unique_ptr<uxas::communications::data::LmcpMessage> >& receivedLmcpMessages)
+{
+    // a burst of route plan responses (e.g., after a UniqueAutomationRequest) 
+    // only needs a single check of the pending requests; the check is 
+    // performed before any other message so that processing order is retained
+    bool isRoutePlanCheckPending{false};
+    for (auto& receivedLmcpMessage : receivedLmcpMessages)
+    {
+        if (uxas::messages::route::isRoutePlanResponse(receivedLmcpMessage->m_object.get()))
+        {
+            StoreRoutePlanResponse(std::static_pointer_cast<uxas::messages::route::RoutePlanResponse>(receivedLmcpMessage->m_object));
+            isRoutePlanCheckPending = true;
+        }
+        else
+        {
+            if (isRoutePlanCheckPending)
+            {
+                CheckAllRoutePlans();
+                isRoutePlanCheckPending = false;
+            }
+            processReceivedLmcpMessage(std::move(receivedLmcpMessage));
+        }
+    }
+    if (isRoutePlanCheckPending)
+    {
+        CheckAllRoutePlans();
+    }
+    return (false); // always false implies never terminating service from here
+}
+
+void RouteAggregatorService::StoreRoutePlanResponse(const std::shared_ptr<uxas::messages::route::RoutePlanResponse>& rplan)
+{
+    m_routePlanResponses[rplan->getResponseID()] = rplan;
+    for (auto p : rplan->getRouteResponses())
+    {
+        m_routePlans[p->getRouteID()] = std::make_pair(rplan->getResponseID(), std::shared_ptr<uxas::messages::route::RoutePlan>(p->clone()));
+    }
+}
+
 void RouteAggregatorService::CheckAllTaskOptionsReceived()
 {
     // loop through all automation requests; delete when fulfilled
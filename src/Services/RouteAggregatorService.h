@@ -160,6 +160,9 @@ private:
     bool
     processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage) override;
 
+    bool
+    processReceivedLmcpMessageBatch(std::vector< std::unique_ptr<uxas::communications::data::LmcpMessage> >& receivedLmcpMessages) override;
+
 
 public:
 
@@ -182,6 +185,7 @@ private:
     void EuclideanPlan(std::shared_ptr<uxas::messages::route::RoutePlanRequest>);
     void CheckAllTaskOptionsReceived();
     void CheckAllRoutePlans();
+    void StoreRoutePlanResponse(const std::shared_ptr<uxas::messages::route::RoutePlanResponse>&);
     void BuildMatrixRequests(int64_t, const std::shared_ptr<uxas::messages::task::UniqueAutomationRequest>&);
     void SendRouteResponse(int64_t);
     void SendMatrix(int64_t);
@@ -18,6 +18,7 @@
 
 #include "UxAS_Log.h"
 #include "UnitConversions.h"
+#include "UxAS_WorkerPoolExecutor.h"
 #include "Constants/Convert.h"
 #include "Constants/UxAS_String.h"
 
@@ -54,6 +55,15 @@ RoutePlannerService::~RoutePlannerService()
 bool
 RoutePlannerService::configure(const pugi::xml_node& serviceXmlNode)
 {
+    if (!serviceXmlNode.attribute(STRING_XML_ROUTE_CACHE_CAPACITY).empty())
+    {
+        m_routePlanCache.setCapacity(serviceXmlNode.attribute(STRING_XML_ROUTE_CACHE_CAPACITY).as_uint());
+    }
+    if (!serviceXmlNode.attribute(STRING_XML_ROUTE_CACHE_TOLERANCE_M).empty())
+    {
+        m_routePlanCache.setTolerance(serviceXmlNode.attribute(STRING_XML_ROUTE_CACHE_TOLERANCE_M).as_double());
+    }
+
     // Need to track:
     //  (1) environment construction (keep-in/keep-out zones and operating region)
     //  (2) current states of entities for non-specified start locations
@@ -84,6 +94,17 @@ RoutePlannerService::configure(const pugi::xml_node& serviceXmlNode)
     return true;
 }
 
+bool
+RoutePlannerService::terminate()
+{
+    // route cache counters since the last (throttled) status
+    if (m_routePlanCache.isStatusDue(0))
+    {
+        sendSharedLmcpObjectBroadcastMessage(m_routePlanCache.getServiceStatus());
+    }
+    return (true);
+}
+
 bool
 RoutePlannerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
 //example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->m_object.get()))
@@ -104,6 +125,11 @@ RoutePlannerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communicat
                         receivedLmcpMessage->m_attributes->getSourceServiceId()
                     ),
                     pResponse);
+
+            if (m_routePlanCache.isStatusDue())
+            {
+                sendSharedLmcpObjectBroadcastMessage(m_routePlanCache.getServiceStatus());
+            }
         }
     }
     else if (afrl::cmasi::isEntityState(receivedLmcpMessage->m_object.get()))
@@ -250,17 +276,41 @@ RoutePlannerService::processReceivedLmcpMessage(std::unique_ptr<uxas::communicat
 
 void RoutePlannerService::BuildVisibilityRegion(std::shared_ptr<afrl::cmasi::OperatingRegion> region)
 {
-    // completely new/updated region, so clear everything out for all vehicles
+    // completely new/updated region, so rebuild everything for all vehicles
+    // (each vehicle replaces its own environment and graph, see BuildVehicleSpecificRegion)
+
+    // vehicles that are not rebuilt (e.g., a state received without a configuration)
+    // must not keep the environment and graph of the previous region
     auto env = m_environments.find(region->getID());
     if (env != m_environments.end())
     {
-        env->second.clear();
+        for (auto vehicleEnv = env->second.begin(); vehicleEnv != env->second.end();)
+        {
+            if (m_airVehicles.find(vehicleEnv->first) == m_airVehicles.end() && m_surfaceVehicles.find(vehicleEnv->first) == m_surfaceVehicles.end())
+            {
+                m_environmentGenerations[region->getID()].erase(vehicleEnv->first);
+                vehicleEnv = env->second.erase(vehicleEnv);
+            }
+            else
+            {
+                vehicleEnv++;
+            }
+        }
     }
-
     auto graph = m_visgraphs.find(region->getID());
     if (graph != m_visgraphs.end())
     {
-        graph->second.clear();
+        for (auto vehicleGraph = graph->second.begin(); vehicleGraph != graph->second.end();)
+        {
+            if (m_airVehicles.find(vehicleGraph->first) == m_airVehicles.end() && m_surfaceVehicles.find(vehicleGraph->first) == m_surfaceVehicles.end())
+            {
+                vehicleGraph = graph->second.erase(vehicleGraph);
+            }
+            else
+            {
+                vehicleGraph++;
+            }
+        }
     }
 
     // for each eligible vehicle (surface/air) build a visibility environment and graph
@@ -378,6 +428,24 @@ void RoutePlannerService::BuildVehicleSpecificRegion(std::shared_ptr<afrl::cmasi
 {
     double epsilon = 1e-4; // millimeter accuracy + tolerance
 
+    // cached paths are keyed on the environment generations of the region, the paths of
+    // the previous generations cannot be found anymore
+    m_routePlanCache.invalidate(region->getID());
+
+    // remove the current environment/graph of the vehicle, it is the starting point for the new graph
+    std::shared_ptr<VisiLibity::Environment> previousEnvironment;
+    std::shared_ptr<VisiLibity::Visibility_Graph> previousVisgraph;
+    auto previousEnv = m_environments[region->getID()].find(vehicleId);
+    auto previousGraph = m_visgraphs[region->getID()].find(vehicleId);
+    if (previousEnv != m_environments[region->getID()].end() && previousGraph != m_visgraphs[region->getID()].end())
+    {
+        previousEnvironment = previousEnv->second;
+        previousVisgraph = previousGraph->second;
+    }
+    m_environments[region->getID()].erase(vehicleId);
+    m_visgraphs[region->getID()].erase(vehicleId);
+    m_environmentGenerations[region->getID()].erase(vehicleId);
+
     std::vector< VisiLibity::Polygon > polygonPlanningList;
     std::vector< VisiLibity::Polygon > polygonsToExpand;
     std::vector< double > expandValues;
@@ -628,10 +696,50 @@ void RoutePlannerService::BuildVehicleSpecificRegion(std::shared_ptr<afrl::cmasi
             // check for epsilon valid
             if (environment->is_valid(epsilon))
             {
-                // save environment
-                m_environments[region->getID()][vehicleId].reset(environment);
-                // create visibility graph
-                m_visgraphs[region->getID()][vehicleId].reset(new VisiLibity::Visibility_Graph(*environment, epsilon));
+                // vehicles with the same zones (and padding) share one environment and graph
+                for (auto other = m_environments[region->getID()].begin(); other != m_environments[region->getID()].end(); other++)
+                {
+                    if (IsSameEnvironment(*environment, *(other->second)))
+                    {
+                        delete environment;
+                        environment = nullptr;
+                        m_environments[region->getID()][vehicleId] = other->second;
+                        m_visgraphs[region->getID()][vehicleId] = m_visgraphs[region->getID()][other->first];
+                        m_environmentGenerations[region->getID()][vehicleId] = m_environmentGenerations[region->getID()][other->first];
+                        break;
+                    }
+                }
+
+                if (environment)
+                {
+                    // save environment
+                    m_environments[region->getID()][vehicleId].reset(environment);
+                    m_environmentGenerations[region->getID()][vehicleId] = ++m_regionGenerations[region->getID()];
+
+                    // create visibility graph, updating only the vertex pairs affected by the changed zones of the
+                    // previous graph of this vehicle (or of another vehicle in the region)
+                    if (!previousEnvironment && !m_environments[region->getID()].empty())
+                    {
+                        auto other = m_environments[region->getID()].begin();
+                        if (other->first == vehicleId)
+                        {
+                            other++;
+                        }
+                        if (other != m_environments[region->getID()].end())
+                        {
+                            previousEnvironment = other->second;
+                            previousVisgraph = m_visgraphs[region->getID()][other->first];
+                        }
+                    }
+                    if (previousEnvironment && previousVisgraph)
+                    {
+                        m_visgraphs[region->getID()][vehicleId].reset(new VisiLibity::Visibility_Graph(*previousVisgraph, *previousEnvironment, *environment, epsilon));
+                    }
+                    else
+                    {
+                        m_visgraphs[region->getID()][vehicleId].reset(new VisiLibity::Visibility_Graph(*environment, epsilon));
+                    }
+                }
             }
             else
             {
@@ -641,6 +749,22 @@ void RoutePlannerService::BuildVehicleSpecificRegion(std::shared_ptr<afrl::cmasi
     }
 }
 
+bool RoutePlannerService::IsSameEnvironment(const VisiLibity::Environment& environment1, const VisiLibity::Environment& environment2)
+{
+    if (environment1.h() != environment2.h() || environment1.n() != environment2.n())
+    {
+        return false;
+    }
+    for (unsigned k = 0; k < environment1.n(); k++)
+    {
+        if (environment1(k).x() != environment2(k).x() || environment1(k).y() != environment2(k).y())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool RoutePlannerService::LinearizeBoundary(afrl::cmasi::AbstractGeometry* boundary, VisiLibity::Polygon& poly)
 {
     uxas::common::utilities::CUnitConversions flatEarth;
@@ -748,105 +872,135 @@ RoutePlannerService::HandleRoutePlanRequestMsg(std::shared_ptr<uxas::messages::r
     response->setAssociatedTaskID(taskId);
     response->setVehicleID(vehicleId);
     response->setOperatingRegion(regionId);
-    for (size_t k = 0; k < request->getRouteRequests().size(); k++)
+
+    // environment and visibility graph of the vehicle, shared read-only by the route solutions
+    VisiLibity::Environment* env = nullptr;
+    VisiLibity::Visibility_Graph* graph = nullptr;
+    uint64_t environmentGeneration{0};
+    auto r = m_environments.find(regionId);
+    auto s = m_visgraphs.find(regionId);
+    if (r != m_environments.end() && s != m_visgraphs.end())
+    {
+        auto v = r->second.find(vehicleId);
+        auto vv = s->second.find(vehicleId);
+        if (v != r->second.end() && vv != s->second.end())
+        {
+            env = v->second.get();
+            graph = vv->second.get();
+            environmentGeneration = m_environmentGenerations[regionId][vehicleId];
+        }
+    }
+
+    // route end points
+    size_t routeCount = request->getRouteRequests().size();
+    std::vector<VisiLibity::Point> startPts(routeCount);
+    std::vector<VisiLibity::Point> endPts(routeCount);
+    std::vector<bool> hasValidLocations(routeCount, false);
+    for (size_t k = 0; k < routeCount; k++)
     {
-        bool hasValidLocations = (speed < 1e-4) ? false : true;
+        hasValidLocations[k] = (speed < 1e-4) ? false : true;
         uxas::messages::route::RouteConstraints* routeRequest = request->getRouteRequests().at(k);
-        int64_t routeId = routeRequest->getRouteID();
-        VisiLibity::Point startPt, endPt;
         double north, east;
 
-        uxas::messages::route::RoutePlan* plan = new uxas::messages::route::RoutePlan;
-        plan->setRouteID(routeId);
-
         if (routeRequest->getStartLocation() == nullptr && hasState)
         {
-            startPt = vehiclePt;
+            startPts[k] = vehiclePt;
         }
         else if (routeRequest->getStartLocation() != nullptr)
         {
             flatEarth.ConvertLatLong_degToNorthEast_m(routeRequest->getStartLocation()->getLatitude(), routeRequest->getStartLocation()->getLongitude(), north, east);
-            startPt.set_x(east);
-            startPt.set_y(north);
+            startPts[k].set_x(east);
+            startPts[k].set_y(north);
         }
         else
         {
-            hasValidLocations = false;
+            hasValidLocations[k] = false;
         }
 
         if (routeRequest->getEndLocation() == nullptr && hasState)
         {
-            endPt = vehiclePt;
+            endPts[k] = vehiclePt;
         }
         else if (routeRequest->getEndLocation() != nullptr)
         {
             flatEarth.ConvertLatLong_degToNorthEast_m(routeRequest->getEndLocation()->getLatitude(), routeRequest->getEndLocation()->getLongitude(), north, east);
-            endPt.set_x(east);
-            endPt.set_y(north);
+            endPts[k].set_x(east);
+            endPts[k].set_y(north);
         }
         else
         {
-            hasValidLocations = false;
+            hasValidLocations[k] = false;
         }
+    }
 
-        if (hasValidLocations)
-        {
-            bool hasEnvironment = false;
-            auto r = m_environments.find(regionId);
-            if (r != m_environments.end())
+    // shortest paths are independent, solve them on the worker pool
+    std::vector<VisiLibity::Polyline> paths(routeCount);
+    std::vector<uint8_t> hasPath(routeCount, 0); // not vector<bool>, elements are written concurrently
+    if (env && graph)
+    {
+        // vehicles with identical environments share one (and its generation), so the generation identifies the path
+        std::string environmentKey = std::to_string(environmentGeneration);
+        uxas::common::WorkerPoolExecutor::getInstance().parallelFor(static_cast<uint32_t>(routeCount),
+            [&](uint32_t k)
             {
-                auto v = r->second.find(vehicleId);
-                if (v != r->second.end())
+                // make sure locations can be reached
+                if (hasValidLocations[k] && startPts[k].in(*env, 1e-4) && endPts[k].in(*env, 1e-4))
                 {
-                    VisiLibity::Environment* env = v->second.get();
+                    if (!m_routePlanCache.find(regionId, environmentKey, startPts[k].y(), startPts[k].x(), endPts[k].y(), endPts[k].x(), paths[k]))
+                    {
+                        paths[k] = env->shortest_path(startPts[k], endPts[k], *graph, 1e-4);
+                        m_routePlanCache.insert(regionId, environmentKey, startPts[k].y(), startPts[k].x(), endPts[k].y(), endPts[k].x(), paths[k]);
+                    }
+                    hasPath[k] = 1;
+                }
+            });
+    }
+
+    // assemble the plans in request order
+    for (size_t k = 0; k < routeCount; k++)
+    {
+        uxas::messages::route::RouteConstraints* routeRequest = request->getRouteRequests().at(k);
+        VisiLibity::Point& startPt = startPts[k];
+        VisiLibity::Point& endPt = endPts[k];
 
-                    auto s = m_visgraphs.find(regionId);
-                    if (s != m_visgraphs.end())
+        uxas::messages::route::RoutePlan* plan = new uxas::messages::route::RoutePlan;
+        plan->setRouteID(routeRequest->getRouteID());
+
+        if (hasValidLocations[k])
+        {
+            if (hasPath[k])
+            {
+                VisiLibity::Polyline& path = paths[k];
+                // speed is guaranteed to be bounded postive away from zero by default setting on 'validLocations'
+                // alt and altType are valid by same logic
+                plan->setRouteCost((path.length() / speed * 1000)); // WARNING: in seconds -> change to miliseconds?? DONE RAS
+
+                if (!request->getIsCostOnlyRequest())
+                {
+                    afrl::cmasi::Waypoint* wp;
+                    for (size_t n = 0; n < path.size(); n++)
                     {
-                        auto vv = s->second.find(vehicleId);
-                        if (vv != s->second.end())
+                        wp = new afrl::cmasi::Waypoint();
+                        double lat, lon;
+                        flatEarth.ConvertNorthEast_mToLatLong_deg(path[n].y(), path[n].x(), lat, lon);
+                        wp->setLatitude(lat);
+                        wp->setLongitude(lon);
+                        wp->setAltitude(alt);
+                        wp->setAltitudeType(altType);
+                        wp->setNumber(n + 1);
+                        wp->setNextWaypoint(n + 2);
+                        if ((n + 1) >= path.size())
                         {
-                            VisiLibity::Visibility_Graph* graph = vv->second.get();
-                            hasEnvironment = true;
-
-                            // make sure locations can be reached
-                            if (startPt.in(*env, 1e-4) && endPt.in(*env, 1e-4))
-                            {
-                                VisiLibity::Polyline path = env->shortest_path(startPt, endPt, *graph, 1e-4);
-                                // speed is guaranteed to be bounded postive away from zero by default setting on 'validLocations'
-                                // alt and altType are valid by same logic
-                                plan->setRouteCost((path.length() / speed * 1000)); // WARNING: in seconds -> change to miliseconds?? DONE RAS
-
-                                if (!request->getIsCostOnlyRequest())
-                                {
-                                    afrl::cmasi::Waypoint* wp;
-                                    for (size_t n = 0; n < path.size(); n++)
-                                    {
-                                        wp = new afrl::cmasi::Waypoint();
-                                        double lat, lon;
-                                        flatEarth.ConvertNorthEast_mToLatLong_deg(path[n].y(), path[n].x(), lat, lon);
-                                        wp->setLatitude(lat);
-                                        wp->setLongitude(lon);
-                                        wp->setAltitude(alt);
-                                        wp->setAltitudeType(altType);
-                                        wp->setNumber(n + 1);
-                                        wp->setNextWaypoint(n + 2);
-                                        if ((n + 1) >= path.size())
-                                        {
-                                            wp->setNextWaypoint(n + 1);
-                                        }
-                                        wp->setSpeed(speed);
-                                        wp->setTurnType(afrl::cmasi::TurnType::TurnShort);
-                                        plan->getWaypoints().push_back(wp);
-                                    }
-                                }
-                            }
+                            wp->setNextWaypoint(n + 1);
                         }
+                        wp->setSpeed(speed);
+                        wp->setTurnType(afrl::cmasi::TurnType::TurnShort);
+                        plan->getWaypoints().push_back(wp);
                     }
                 }
             }
 
-            if (!hasEnvironment)
+            if (!env || !graph)
             {
                 // no valid region, so straight line plan
                 double linedist = VisiLibity::distance(startPt, endPt);
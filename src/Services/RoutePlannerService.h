@@ -25,6 +25,7 @@
 #include "afrl/impact/IMPACT.h"
 #include "afrl/vehicles/VEHICLES.h"
 #include "visilibity.h"
+#include "RoutePlanCache.h"
 
 #include <unordered_map>
 #include <unordered_set>
@@ -39,18 +40,22 @@ namespace service
     \brief A component that responds to route plan requests. Uses
  *  the library 'DubLib' for air and surface entities. Does not respond
  *  to requests involving ground entities (assumes a ground planner
- *  will plan for ground entities).
+ *  will plan for ground entities). The shortest paths of the route
+ *  constraints of a request are solved in parallel on the worker pool.
  * 
  * Configuration String: 
+ *  <Service Type="RoutePlannerService" RouteCacheCapacity="10000" RouteCacheTolerance_m="0.01"/>
  * 
  * Options:
- *  - 
+ *  - RouteCacheCapacity: maximum number of cached paths, 0 disables the cache
+ *  - RouteCacheTolerance_m: start/end locations within the same cell of this
+ *    size share cached paths
  * 
  * Subscribed Messages:
  *  - 
  * 
  * Sent Messages:
- *  - 
+ *  - afrl::cmasi::ServiceStatus (route cache hit/miss counters)
  * 
  */
 
@@ -108,8 +113,8 @@ private:
     //bool
     //start() override;
 
-    //bool
-    //terminate() override;
+    bool
+    terminate() override;
 
     bool
     processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage) override;
@@ -137,6 +142,7 @@ private:
     void UpdateRegions(std::shared_ptr<avtas::lmcp::Object>);
     void BuildVehicleSpecificRegion(std::shared_ptr<afrl::cmasi::OperatingRegion>, int64_t, afrl::cmasi::AbstractGeometry*);
     bool LinearizeBoundary(afrl::cmasi::AbstractGeometry*, VisiLibity::Polygon&);
+    bool IsSameEnvironment(const VisiLibity::Environment&, const VisiLibity::Environment&);
 
     // storage
     std::unordered_map<int64_t, std::shared_ptr<afrl::cmasi::EntityState> > m_entityStates;
@@ -151,9 +157,19 @@ private:
 
     // environments for all vehicles that will have plans
     // [operating region id], [vehicle id], <environment/graph>
+    // (vehicles with identical environments share the environment and graph)
     std::unordered_map<int64_t, std::unordered_map<int64_t, std::shared_ptr<VisiLibity::Environment> > > m_environments;
     std::unordered_map<int64_t, std::unordered_map<int64_t, std::shared_ptr<VisiLibity::Visibility_Graph> > > m_visgraphs;
 
+    // generation of the environment of each vehicle, [operating region id], [vehicle id] (shared environments
+    // share the generation). The generation of a region increments whenever one of its environments is rebuilt.
+    std::unordered_map<int64_t, std::unordered_map<int64_t, uint64_t> > m_environmentGenerations;
+    std::unordered_map<int64_t, uint64_t> m_regionGenerations;
+
+    // shortest paths, keyed on operating region and environment generation, invalidated
+    // for a region whenever one of its environments is rebuilt
+    uxas::common::utilities::RoutePlanCache<VisiLibity::Polyline> m_routePlanCache;
+
 };
 
 }; //namespace service
@@ -136,6 +136,14 @@ RoutePlannerVisibilityService::configure(const pugi::xml_node& ndComponent)
     {
         m_minimumWaypointSeparation_m = ndComponent.attribute(STRING_XML_MINIMUM_WAYPOINT_SEPARATION_M).as_double();
     }
+    if (!ndComponent.attribute(STRING_XML_ROUTE_CACHE_CAPACITY).empty())
+    {
+        m_routePlanCache.setCapacity(ndComponent.attribute(STRING_XML_ROUTE_CACHE_CAPACITY).as_uint());
+    }
+    if (!ndComponent.attribute(STRING_XML_ROUTE_CACHE_TOLERANCE_M).empty())
+    {
+        m_routePlanCache.setTolerance(ndComponent.attribute(STRING_XML_ROUTE_CACHE_TOLERANCE_M).as_double());
+    }
 
     addSubscriptionAddress(afrl::cmasi::KeepOutZone::Subscription);
     addSubscriptionAddress(afrl::cmasi::KeepInZone::Subscription);
@@ -182,6 +190,17 @@ RoutePlannerVisibilityService::initialize()
     return (isSuccess);
 };
 
+bool
+RoutePlannerVisibilityService::terminate()
+{
+    // route cache counters since the last (throttled) status
+    if (m_routePlanCache.isStatusDue(0))
+    {
+        sendSharedLmcpObjectBroadcastMessage(m_routePlanCache.getServiceStatus());
+    }
+    return (true);
+}
+
 bool
 RoutePlannerVisibilityService::processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage)
 //example: if (afrl::cmasi::isServiceStatus(receivedLmcpMessage->m_object.get()))
@@ -239,6 +258,10 @@ RoutePlannerVisibilityService::processReceivedLmcpMessage(std::unique_ptr<uxas::
             {
                CERR_FILE_LINE_MSG("Error processing route plan request")
             }
+            if (m_routePlanCache.isStatusDue())
+            {
+                sendSharedLmcpObjectBroadcastMessage(m_routePlanCache.getServiceStatus());
+            }
         }
         else
         {
@@ -259,6 +282,9 @@ bool RoutePlannerVisibilityService::bProcessZone(const std::shared_ptr<afrl::cma
 {
     bool isSuccess(true);
 
+    // zones change the operating region visibility graphs
+    m_routePlanCache.invalidate();
+
     //ASSUMES:: unique Id's for all zones
     stringstream sstreamErrors;
     n_FrameworkLib::V_POSITION_t vposBoundaryPoints; //used to store the boundary points       
@@ -277,6 +303,8 @@ bool RoutePlannerVisibilityService::bProcessOperatingRegion(const std::shared_pt
 {
     bool isSuccess(true);
 
+    m_routePlanCache.invalidate(operatingRegion->getID());
+
     //ASSUMES:: unique Id's for all zones
     //ASSUMES:: all zones used in the operating region have already been received
 
@@ -437,7 +465,22 @@ bool RoutePlannerVisibilityService::bProcessRoutePlanRequest(const std::shared_p
                     (*itRequest)->getEndLocation()->getLongitude(), dNorth_m, dEast_m);
             pathInformation->posGetEnd() = n_FrameworkLib::CPosition(dNorth_m, dEast_m);
 
-            if (itOperatingVisibilityGraph->second->isFindPath(pathInformation))
+            // plans depend on the vehicle's planner parameters and the requested headings
+            std::stringstream sstrPlannerParameters;
+            sstrPlannerParameters << itPlannerParameters->second->nominalSpeed_mps << "," << itPlannerParameters->second->turnRadius_m
+                    << "," << routePlanRequest->getIsCostOnlyRequest()
+                    << "," << (*itRequest)->getUseStartHeading() << "," << (*itRequest)->getStartHeading()
+                    << "," << (*itRequest)->getUseEndHeading() << "," << (*itRequest)->getEndHeading();
+            std::shared_ptr<uxas::messages::route::RoutePlan> cachedRoutePlan;
+            if (m_routePlanCache.find(routePlanRequest->getOperatingRegion(), sstrPlannerParameters.str(),
+                                      pathInformation->posGetStart().m_north_m, pathInformation->posGetStart().m_east_m,
+                                      pathInformation->posGetEnd().m_north_m, pathInformation->posGetEnd().m_east_m, cachedRoutePlan))
+            {
+                auto routePlan = cachedRoutePlan->clone();
+                routePlan->setRouteID((*itRequest)->getRouteID());
+                routePlanResponse->getRouteResponses().push_back(routePlan);
+            }
+            else if (itOperatingVisibilityGraph->second->isFindPath(pathInformation))
             {
                 auto routePlan = std::make_shared<uxas::messages::route::RoutePlan>();
                 routePlan->setRouteID((*itRequest)->getRouteID());
@@ -457,6 +500,9 @@ bool RoutePlannerVisibilityService::bProcessRoutePlanRequest(const std::shared_p
                             routePlan->getWaypoints(),enpathType);
                 }
                 routePlanResponse->getRouteResponses().push_back(routePlan->clone());
+                m_routePlanCache.insert(routePlanRequest->getOperatingRegion(), sstrPlannerParameters.str(),
+                                        pathInformation->posGetStart().m_north_m, pathInformation->posGetStart().m_east_m,
+                                        pathInformation->posGetEnd().m_north_m, pathInformation->posGetEnd().m_east_m, routePlan);
             }
             else
             {
@@ -20,6 +20,7 @@
 
 
 #include "VisibilityGraph.h"
+#include "RoutePlanCache.h"
 
 #include "uxas/messages/route/RouteRequest.h"
 #include "uxas/messages/route/RoutePlanRequest.h"
@@ -50,12 +51,16 @@ namespace service
  * 
  * Configuration String: 
  *  <Service Type="RoutePlannerVisibilityService" TurnRadiusOffset_m="0.0" 
-  *                OsmFileName="" MinimumWaypointSeparation_m="50.0"/> 
+  *                OsmFileName="" MinimumWaypointSeparation_m="50.0"
+  *                RouteCacheCapacity="10000" RouteCacheTolerance_m="0.01"/> 
  * 
  * Options:
  *  - TurnRadiusOffset_m
  *  - OsmFileName
  *  - MinimumWaypointSeparation_m
+ *  - RouteCacheCapacity: maximum number of cached route plans, 0 disables the cache
+ *  - RouteCacheTolerance_m: start/end locations within the same cell of this
+ *    size share cached route plans
  *  - 
  *  - 
  * 
@@ -75,6 +80,7 @@ namespace service
  * 
  * Sent Messages:
  *  - uxas::messages::route::RoutePlanResponse
+ *  - afrl::cmasi::ServiceStatus (route cache hit/miss counters)
  * 
  */
 
@@ -134,8 +140,8 @@ private:
     //bool
     //start() override;
 
-    //bool
-    //terminate() override;
+    bool
+    terminate() override;
 
     bool
     processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage) override;
@@ -202,6 +208,9 @@ protected:
 
     double m_minimumWaypointSeparation_m = 50; //TODO:: this need to be configurable
 
+    /*! \brief  cached route plans, invalidated when zones or operating regions change*/
+    uxas::common::utilities::RoutePlanCache<std::shared_ptr<uxas::messages::route::RoutePlan>> m_routePlanCache;
+
 private:
 
 
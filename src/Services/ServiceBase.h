@@ -25,6 +25,12 @@ namespace service
  * Service class constructors are registered in the <B><i>ServiceBase</i></B> 
  * creation registry.
  * 
+ * \par Services receive <b>LMCP</b> objects one at a time through 
+ * <B><i>processReceivedLmcpMessage</i></B>. Services that can coalesce work 
+ * over a burst of messages can instead override 
+ * <B><i>processReceivedLmcpMessageBatch</i></B>, which is invoked with all 
+ * objects that were ready when the service woke up.
+ * 
  * @n
  */
 class ServiceBase : public uxas::communications::LmcpObjectNetworkClientBase
@@ -157,7 +157,7 @@ ServiceManager::runUntil(uint32_t duration_s)
     UXAS_LOG_INFORM_ASSIGNMENT(s_typeName(),"****** All Services have been Terminated !!! ******");
 
     // terminate my client thread
-    m_isTerminateNetworkClient = true;
+    stopNetworkClient();
     uint32_t checkBaseTerminateCount{0};
     while (!m_isBaseClassTerminationFinished && checkBaseTerminateCount++ < 20)
     {
@@ -667,6 +667,171 @@ v_action_t CAlgebra::searchPred(const v_action_t &executedAtomicObjectives, int
     return v_action;
 }
 
+bool CCompiledAlgebra::compile(const CAlgebraBase& algebra, const v_action_t& actionIDs)
+{
+    m_nodes.clear();
+    m_children.clear();
+    m_actionIDs = actionIDs;
+    std::unordered_map<action_t, uint32_t> actionIDVsIndex;
+    for (uint32_t actionIndex = 0; actionIndex < m_actionIDs.size(); actionIndex++)
+    {
+        actionIDVsIndex.insert(std::make_pair(m_actionIDs[actionIndex], actionIndex));
+    }
+    if (algebra.parseTreeRoot == NULL)
+    {
+        return false;
+    }
+    compileNode(algebra.parseTreeRoot, actionIDVsIndex);
+    return true;
+}
+
+uint32_t CCompiledAlgebra::compileNode(parseTreeNode* treeNode, std::unordered_map<action_t, uint32_t>& actionIDVsIndex)
+{
+    s_Node node;
+    node.m_nodeType = treeNode->getNodeType();
+    node.m_operatorType = OP_UNDEFINED;
+    node.m_firstChild = 0;
+    node.m_numberChildren = 0;
+    node.m_actionIndex = 0;
+    if (node.m_nodeType == ND_ACTION)
+    {
+        action_t actionID = ((actionNode *) treeNode)->getActionID();
+        auto itActionIndex = actionIDVsIndex.find(actionID);
+        if (itActionIndex == actionIDVsIndex.end())
+        {
+            itActionIndex = actionIDVsIndex.insert(std::make_pair(actionID, static_cast<uint32_t> (m_actionIDs.size()))).first;
+            m_actionIDs.push_back(actionID);
+        }
+        node.m_actionIndex = itActionIndex->second;
+    }
+    else if (node.m_nodeType == ND_OPERATOR)
+    {
+        operatorNode *operatorNodeTmp = (operatorNode *) treeNode;
+        node.m_operatorType = operatorNodeTmp->getOperatorType();
+        // the children are compiled first, their indices are stored together
+        std::vector<uint32_t> childNodes;
+        for (int i = 0; i < operatorNodeTmp->getNumNodes(); i++)
+        {
+            parseTreeNode *childNode = operatorNodeTmp->getNodePointer(i);
+            if (childNode != NULL)
+            {
+                childNodes.push_back(compileNode(childNode, actionIDVsIndex));
+            }
+        }
+        node.m_firstChild = static_cast<uint32_t> (m_children.size());
+        node.m_numberChildren = static_cast<uint32_t> (childNodes.size());
+        m_children.insert(m_children.end(), childNodes.begin(), childNodes.end());
+    }
+    m_nodes.push_back(node);
+    return (static_cast<uint32_t> (m_nodes.size() - 1));
+}
+
+void CCompiledAlgebra::searchNext(const std::vector<uint64_t>& executedActions, std::vector<uint32_t>& nextActions, s_SearchBuffers& buffers) const
+{
+    nextActions.clear();
+    if (m_nodes.empty())
+    {
+        return;
+    }
+    buffers.m_isNext.resize(m_nodes.size());
+    buffers.m_isEncounterExecuted.resize(m_nodes.size());
+    buffers.m_nextChild.resize(m_nodes.size());
+
+    // children before parents, same rules as the nextActions functions of the parse tree nodes
+    for (uint32_t nodeIndex = 0; nodeIndex < m_nodes.size(); nodeIndex++)
+    {
+        const s_Node& node = m_nodes[nodeIndex];
+        const uint32_t* children = m_children.data() + node.m_firstChild;
+        bool isNext = false;
+        bool isEncounterExecuted = false;
+        int32_t nextChild = -1;
+        if (node.m_nodeType == ND_ACTION)
+        {
+            isEncounterExecuted = isBitSet(executedActions, node.m_actionIndex);
+            isNext = !isEncounterExecuted;
+        }
+        else if (node.m_nodeType == ND_OPERATOR)
+        {
+            switch (node.m_operatorType)
+            {
+                case OP_SEQUENTIAL:
+                    // the first child with next actions, see operatorNode::nextActions
+                    isEncounterExecuted = true;
+                    for (uint32_t i = 0; i < node.m_numberChildren; i++)
+                    {
+                        if (buffers.m_isNext[children[i]])
+                        {
+                            isNext = true;
+                            nextChild = static_cast<int32_t> (children[i]);
+                            if (i == 0)
+                                isEncounterExecuted = (buffers.m_isEncounterExecuted[children[i]] != 0);
+                            break;
+                        }
+                    }
+                    break;
+
+                case OP_ALTERNATIVE:
+                    // the first child that encountered an executed action, otherwise all of them
+                    for (uint32_t i = 0; i < node.m_numberChildren; i++)
+                    {
+                        if (buffers.m_isEncounterExecuted[children[i]])
+                        {
+                            isEncounterExecuted = true;
+                            isNext = (buffers.m_isNext[children[i]] != 0);
+                            nextChild = static_cast<int32_t> (children[i]);
+                            break;
+                        }
+                        isNext = isNext || (buffers.m_isNext[children[i]] != 0);
+                    }
+                    break;
+
+                case OP_PARALLEL:
+                    for (uint32_t i = 0; i < node.m_numberChildren; i++)
+                    {
+                        isNext = isNext || (buffers.m_isNext[children[i]] != 0);
+                        isEncounterExecuted = isEncounterExecuted || (buffers.m_isEncounterExecuted[children[i]] != 0);
+                    }
+                    break;
+
+                case OP_UNDEFINED:
+                default:
+                    break;
+            }
+        }
+        buffers.m_isNext[nodeIndex] = isNext;
+        buffers.m_isEncounterExecuted[nodeIndex] = isEncounterExecuted;
+        buffers.m_nextChild[nodeIndex] = nextChild;
+    }
+
+    // collect the next actions, depth first from the root (the last node)
+    buffers.m_nodeStack.assign(1, static_cast<uint32_t> (m_nodes.size() - 1));
+    while (!buffers.m_nodeStack.empty())
+    {
+        uint32_t nodeIndex = buffers.m_nodeStack.back();
+        buffers.m_nodeStack.pop_back();
+        if (!buffers.m_isNext[nodeIndex])
+        {
+            continue;
+        }
+        const s_Node& node = m_nodes[nodeIndex];
+        if (node.m_nodeType == ND_ACTION)
+        {
+            nextActions.push_back(node.m_actionIndex);
+        }
+        else if (buffers.m_nextChild[nodeIndex] >= 0)
+        {
+            buffers.m_nodeStack.push_back(static_cast<uint32_t> (buffers.m_nextChild[nodeIndex]));
+        }
+        else
+        {
+            for (uint32_t i = node.m_numberChildren; i > 0; i--)
+            {
+                buffers.m_nodeStack.push_back(m_children[node.m_firstChild + i - 1]);
+            }
+        }
+    }
+}
+
 }; //namespace log
 }; //namespace common
 }; //namespace uxas
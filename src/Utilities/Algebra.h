@@ -9,6 +9,8 @@
 
 #include "AlgebraBase.h"
 
+#include <unordered_map>
+
 #ifndef ALGEBRA_H
 #define ALGEBRA_H
 
@@ -35,6 +37,86 @@ public:
     v_action_t searchPred(const v_action_t &executedAtomicObjectives, int atomicObjectiveIn);
 };
 
+/*! \brief  the parse tree of a CAlgebra compiled into flat arrays, used to evaluate the next
+ * actions without walking the tree or building intermediate vectors. The actions are
+ * numbered by their position in the action list given to compile (actions of the tree that
+ * are not in the list follow), the executed actions are a bitset over these numbers. The
+ * next actions and their order are the same as CAlgebra::searchNext's. */
+class CCompiledAlgebra
+{
+public:
+    /*! \brief  evaluation storage, one for each thread calling searchNext*/
+    struct s_SearchBuffers
+    {
+        /*! \brief  node index -> true if the node has next actions*/
+        std::vector<uint8_t> m_isNext;
+        /*! \brief  node index -> true if an executed action was encountered below the node*/
+        std::vector<uint8_t> m_isEncounterExecuted;
+        /*! \brief  node index -> child that provides the next actions, -1 -> all children*/
+        std::vector<int32_t> m_nextChild;
+        std::vector<uint32_t> m_nodeStack;
+    };
+
+public:
+    /*! \brief  compiles the parse tree of "algebra", the action with index k is "actionIDs[k]".
+     * Returns false if there is no parse tree */
+    bool compile(const CAlgebraBase& algebra, const v_action_t& actionIDs);
+    /*! \brief  returns the indices of the actions that can be executed next in "nextActions",
+     * "executedActions" is a bitset of the executed action indices (see getNumberWords) */
+    void searchNext(const std::vector<uint64_t>& executedActions, std::vector<uint32_t>& nextActions, s_SearchBuffers& buffers) const;
+
+    /*! \brief  number of actions, including the actions of the tree that are not in the compiled action list*/
+    size_t getNumberActions() const
+    {
+        return (m_actionIDs.size());
+    };
+    /*! \brief  number of 64 bit words of an action bitset*/
+    size_t getNumberWords() const
+    {
+        return ((m_actionIDs.size() + 63) / 64);
+    };
+    action_t getActionID(const uint32_t& actionIndex) const
+    {
+        return (m_actionIDs[actionIndex]);
+    };
+
+    static void setBit(std::vector<uint64_t>& bitset, const uint32_t& index)
+    {
+        bitset[index >> 6] |= (static_cast<uint64_t> (1) << (index & 63));
+    };
+    static void clearBit(std::vector<uint64_t>& bitset, const uint32_t& index)
+    {
+        bitset[index >> 6] &= ~(static_cast<uint64_t> (1) << (index & 63));
+    };
+    static bool isBitSet(const std::vector<uint64_t>& bitset, const uint32_t& index)
+    {
+        return ((bitset[index >> 6] & (static_cast<uint64_t> (1) << (index & 63))) != 0);
+    };
+
+protected:
+    /*! \brief  a node of the parse tree, the children of a node come before it*/
+    struct s_Node
+    {
+        nodeType_t m_nodeType;
+        operatorType_t m_operatorType;
+        /*! \brief  the node's children are m_children[m_firstChild, m_firstChild + m_numberChildren)*/
+        uint32_t m_firstChild;
+        uint32_t m_numberChildren;
+        /*! \brief  action index of an action node*/
+        uint32_t m_actionIndex;
+    };
+
+    /*! \brief  adds "treeNode" and the nodes below it, returns the node's index. Actions
+     * that are not in "actionIDVsIndex" are added to it*/
+    uint32_t compileNode(parseTreeNode* treeNode, std::unordered_map<action_t, uint32_t>& actionIDVsIndex);
+
+protected:
+    std::vector<s_Node> m_nodes;
+    std::vector<uint32_t> m_children;
+    /*! \brief  action index -> action ID*/
+    v_action_t m_actionIDs;
+};
+
 }; //namespace log
 }; //namespace common
 }; //namespace uxas
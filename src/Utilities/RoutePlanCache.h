@@ -0,0 +1,295 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#ifndef UXAS_COMMON_UTILITIES_ROUTE_PLAN_CACHE_H
+#define UXAS_COMMON_UTILITIES_ROUTE_PLAN_CACHE_H
+
+#include "afrl/cmasi/KeyValuePair.h"
+#include "afrl/cmasi/ServiceStatus.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/** route planner service XML attributes configuring the cache */
+#define STRING_XML_ROUTE_CACHE_CAPACITY "RouteCacheCapacity"
+#define STRING_XML_ROUTE_CACHE_TOLERANCE_M "RouteCacheTolerance_m"
+
+namespace uxas
+{
+namespace common
+{
+namespace utilities
+{
+
+/** \class RoutePlanCache
+ *
+ * \par Description:
+ * Least-recently-used cache of route planning results for route planner
+ * services. Entries are keyed on operating region, a planner parameter
+ * string supplied by the planner (vehicle speed, turn radius, ...) and the
+ * start and end locations (north/east, meters) quantized to the cache
+ * tolerance, i.e. requests with endpoints in the same tolerance cells share
+ * a result. The planner is responsible for invalidating the cache when the
+ * environment it plans in changes (operating regions, zones), or for making
+ * the change part of the planner parameters (e.g., an environment generation).
+ *
+ * \par Threading:
+ * All methods may be called concurrently.
+ *
+ * \n
+ */
+template <typename T>
+class RoutePlanCache final
+{
+public:
+
+    RoutePlanCache(size_t capacity = 10000, double tolerance_m = 0.01)
+    : m_capacity(capacity), m_tolerance_m(tolerance_m) { };
+
+    /** \brief maximum number of entries, zero disables the cache */
+    void
+    setCapacity(size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_capacity = capacity;
+        while (m_entries.size() > m_capacity)
+        {
+            m_keyVsEntry.erase(m_entries.back().m_key);
+            m_entries.pop_back();
+        }
+    };
+
+    /** \brief size of the cells start/end locations are quantized to (meters) */
+    void
+    setTolerance(double tolerance_m)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (tolerance_m > 0.0 && tolerance_m != m_tolerance_m)
+        {
+            m_tolerance_m = tolerance_m;
+            m_entries.clear();
+            m_keyVsEntry.clear();
+        }
+    };
+
+    bool
+    isEnabled() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return (m_capacity > 0);
+    };
+
+    /** \brief looks up a result, on a hit copies it to "value" and returns true */
+    bool
+    find(int64_t operatingRegionId, const std::string& plannerParameters,
+         double startNorth_m, double startEast_m, double endNorth_m, double endEast_m, T& value)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_capacity == 0)
+        {
+            return (false);
+        }
+        auto itEntry = m_keyVsEntry.find(makeKey(operatingRegionId, plannerParameters, startNorth_m, startEast_m, endNorth_m, endEast_m));
+        if (itEntry == m_keyVsEntry.end())
+        {
+            m_missCount++;
+            return (false);
+        }
+        // move to the front, i.e. most recently used
+        m_entries.splice(m_entries.begin(), m_entries, itEntry->second);
+        value = itEntry->second->m_value;
+        m_hitCount++;
+        return (true);
+    };
+
+    /** \brief stores a result, replaces the least recently used entry when full */
+    void
+    insert(int64_t operatingRegionId, const std::string& plannerParameters,
+           double startNorth_m, double startEast_m, double endNorth_m, double endEast_m, const T& value)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_capacity == 0)
+        {
+            return;
+        }
+        Key entryKey = makeKey(operatingRegionId, plannerParameters, startNorth_m, startEast_m, endNorth_m, endEast_m);
+        auto itEntry = m_keyVsEntry.find(entryKey);
+        if (itEntry != m_keyVsEntry.end())
+        {
+            itEntry->second->m_value = value;
+            m_entries.splice(m_entries.begin(), m_entries, itEntry->second);
+            return;
+        }
+        if (m_entries.size() >= m_capacity)
+        {
+            m_keyVsEntry.erase(m_entries.back().m_key);
+            m_entries.pop_back();
+        }
+        m_entries.push_front(Entry{entryKey, value});
+        m_keyVsEntry[entryKey] = m_entries.begin();
+    };
+
+    /** \brief removes all entries */
+    void
+    invalidate()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.clear();
+        m_keyVsEntry.clear();
+    };
+
+    /** \brief removes the entries of one operating region */
+    void
+    invalidate(int64_t operatingRegionId)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto itEntry = m_entries.begin(); itEntry != m_entries.end();)
+        {
+            if (itEntry->m_key.m_operatingRegionId == operatingRegionId)
+            {
+                m_keyVsEntry.erase(itEntry->m_key);
+                itEntry = m_entries.erase(itEntry);
+            }
+            else
+            {
+                itEntry++;
+            }
+        }
+    };
+
+    uint64_t
+    getHitCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return (m_hitCount);
+    };
+
+    uint64_t
+    getMissCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return (m_missCount);
+    };
+
+    /** \brief true at most once per status period (milliseconds) and only after new lookups, used to throttle
+     * status messages. A zero period reports any lookups since the last status (e.g., when terminating). */
+    bool
+    isStatusDue(int64_t statusPeriod_ms = 1000)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto now = std::chrono::steady_clock::now();
+        if (m_capacity == 0 || (m_hitCount + m_missCount) == m_statusLookupCount
+            || std::chrono::duration_cast<std::chrono::milliseconds>(now - m_statusTime).count() < statusPeriod_ms)
+        {
+            return (false);
+        }
+        m_statusTime = now;
+        m_statusLookupCount = m_hitCount + m_missCount;
+        return (true);
+    };
+
+    /** \brief information status with the "RouteCacheHits", "RouteCacheMisses" and "RouteCacheSize" counters */
+    std::shared_ptr<afrl::cmasi::ServiceStatus>
+    getServiceStatus()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto serviceStatus = std::make_shared<afrl::cmasi::ServiceStatus>();
+        serviceStatus->setStatusType(afrl::cmasi::ServiceStatusType::Information);
+        auto keyValuePair = new afrl::cmasi::KeyValuePair;
+        keyValuePair->setKey("RouteCacheHits");
+        keyValuePair->setValue(std::to_string(m_hitCount));
+        serviceStatus->getInfo().push_back(keyValuePair);
+        keyValuePair = new afrl::cmasi::KeyValuePair;
+        keyValuePair->setKey("RouteCacheMisses");
+        keyValuePair->setValue(std::to_string(m_missCount));
+        serviceStatus->getInfo().push_back(keyValuePair);
+        keyValuePair = new afrl::cmasi::KeyValuePair;
+        keyValuePair->setKey("RouteCacheSize");
+        keyValuePair->setValue(std::to_string(m_entries.size()));
+        serviceStatus->getInfo().push_back(keyValuePair);
+        keyValuePair = nullptr;
+        return (serviceStatus);
+    };
+
+private:
+
+    struct Key
+    {
+        int64_t m_operatingRegionId;
+        std::string m_plannerParameters;
+        /** start and end locations in tolerance cells */
+        int64_t m_startNorth;
+        int64_t m_startEast;
+        int64_t m_endNorth;
+        int64_t m_endEast;
+
+        bool
+        operator==(const Key& other) const
+        {
+            return (m_operatingRegionId == other.m_operatingRegionId && m_startNorth == other.m_startNorth
+                    && m_startEast == other.m_startEast && m_endNorth == other.m_endNorth && m_endEast == other.m_endEast
+                    && m_plannerParameters == other.m_plannerParameters);
+        };
+    };
+
+    struct KeyHash
+    {
+        size_t
+        operator()(const Key& key) const
+        {
+            size_t hash = std::hash<std::string>()(key.m_plannerParameters);
+            for (int64_t component : {key.m_operatingRegionId, key.m_startNorth, key.m_startEast, key.m_endNorth, key.m_endEast})
+            {
+                // boost::hash_combine
+                hash ^= std::hash<int64_t>()(component) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            }
+            return (hash);
+        };
+    };
+
+    struct Entry
+    {
+        Key m_key;
+        T m_value;
+    };
+
+    Key
+    makeKey(int64_t operatingRegionId, const std::string& plannerParameters,
+            double startNorth_m, double startEast_m, double endNorth_m, double endEast_m) const
+    {
+        return (Key{operatingRegionId, plannerParameters,
+                    std::llround(startNorth_m / m_tolerance_m), std::llround(startEast_m / m_tolerance_m),
+                    std::llround(endNorth_m / m_tolerance_m), std::llround(endEast_m / m_tolerance_m)});
+    };
+
+    mutable std::mutex m_mutex;
+    size_t m_capacity;
+    double m_tolerance_m;
+    /** most recently used first */
+    std::list<Entry> m_entries;
+    std::unordered_map<Key, typename std::list<Entry>::iterator, KeyHash> m_keyVsEntry;
+
+    uint64_t m_hitCount{0};
+    uint64_t m_missCount{0};
+    uint64_t m_statusLookupCount{0};
+    std::chrono::steady_clock::time_point m_statusTime;
+};
+
+}; //namespace utilities
+}; //namespace common
+}; //namespace uxas
+
+#endif /* UXAS_COMMON_UTILITIES_ROUTE_PLAN_CACHE_H */
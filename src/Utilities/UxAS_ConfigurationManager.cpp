@@ -43,6 +43,10 @@ namespace common
 {
 
 bool ConfigurationManager::s_isZeroMqMultipartMessage{false};
+bool ConfigurationManager::s_isInProcessLmcpDelivery{false};
+bool ConfigurationManager::s_isWorkerPoolExecution{false};
+uint32_t ConfigurationManager::s_workerPoolThreadCount = 0;
+bool ConfigurationManager::s_isEventDrivenReceive{false};
 uint32_t ConfigurationManager::s_serialPortWaitTime_ms = 50;
 int32_t ConfigurationManager::s_zeroMqReceiveSocketPollWaitTime_ms = 100;
 
@@ -50,6 +54,9 @@ int64_t ConfigurationManager::s_entityStartTimeSinceEpoch_ms = 0;
 uint32_t ConfigurationManager::s_startDelay_ms = 0;
 uint32_t ConfigurationManager::s_runDuration_s = UINT32_MAX;
 bool ConfigurationManager::s_isLoggingThreadId{false};
+bool ConfigurationManager::s_isAsyncLogging{false};
+bool ConfigurationManager::s_isAsyncLogOverflowDrop{true};
+uint32_t ConfigurationManager::s_asyncLogRecordCapacity = 8192;
 bool ConfigurationManager::s_isDataTimestamp{true};
 
 uint32_t ConfigurationManager::s_entityId = 0;
@@ -408,7 +415,111 @@ ConfigurationManager::setEntityValuesFromXmlNode(const pugi::xml_node& xmlNode)
         {
           UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default isDataTimeStamp ", s_isDataTimestamp);
         }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::InProcessLmcpDelivery().c_str()).empty())
+        {
+            s_isInProcessLmcpDelivery = entityInfoXmlNode.attribute(StringConstant::InProcessLmcpDelivery().c_str()).as_bool();
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode setting InProcessLmcpDelivery ", s_isInProcessLmcpDelivery);
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default InProcessLmcpDelivery ", s_isInProcessLmcpDelivery);
+        }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::NetworkClientExecution().c_str()).empty())
+        {
+            std::string networkClientExecution = entityInfoXmlNode.attribute(StringConstant::NetworkClientExecution().c_str()).value();
+            if (NetworkClientExecution::WorkerPool().compare(networkClientExecution) == 0)
+            {
+                s_isWorkerPoolExecution = true;
+                // worker pool dispatch is driven by the in-process bus
+                s_isInProcessLmcpDelivery = true;
+                UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode setting ", StringConstant::NetworkClientExecution(), " [", networkClientExecution, "] (enables InProcessLmcpDelivery)");
+            }
+            else if (NetworkClientExecution::DedicatedThread().compare(networkClientExecution) == 0)
+            {
+                s_isWorkerPoolExecution = false;
+                UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode setting ", StringConstant::NetworkClientExecution(), " [", networkClientExecution, "]");
+            }
+            else
+            {
+                UXAS_LOG_WARN(s_typeName(), "::setEntityFromXmlNode ignoring invalid ", StringConstant::NetworkClientExecution(), " [", networkClientExecution, "] from XML");
+            }
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default ", StringConstant::NetworkClientExecution(), " worker pool ", s_isWorkerPoolExecution);
+        }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::WorkerPoolThreadCount().c_str()).empty())
+        {
+            s_workerPoolThreadCount = entityInfoXmlNode.attribute(StringConstant::WorkerPoolThreadCount().c_str()).as_uint();
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode setting WorkerPoolThreadCount ", s_workerPoolThreadCount);
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default WorkerPoolThreadCount ", s_workerPoolThreadCount);
+        }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::isEventDrivenReceive().c_str()).empty())
+        {
+            s_isEventDrivenReceive = entityInfoXmlNode.attribute(StringConstant::isEventDrivenReceive().c_str()).as_bool();
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode setting isEventDrivenReceive ", s_isEventDrivenReceive);
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default isEventDrivenReceive ", s_isEventDrivenReceive);
+        }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::isAsyncLogging().c_str()).empty())
+        {
+            s_isAsyncLogging = entityInfoXmlNode.attribute(StringConstant::isAsyncLogging().c_str()).as_bool();
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode setting isAsyncLogging ", s_isAsyncLogging);
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default isAsyncLogging ", s_isAsyncLogging);
+        }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::AsyncLogOverflowPolicy().c_str()).empty())
+        {
+            std::string asyncLogOverflowPolicy = entityInfoXmlNode.attribute(StringConstant::AsyncLogOverflowPolicy().c_str()).value();
+            if (AsyncLogOverflowPolicy::Drop().compare(asyncLogOverflowPolicy) == 0)
+            {
+                s_isAsyncLogOverflowDrop = true;
+                UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode setting ", StringConstant::AsyncLogOverflowPolicy(), " [", asyncLogOverflowPolicy, "]");
+            }
+            else if (AsyncLogOverflowPolicy::Block().compare(asyncLogOverflowPolicy) == 0)
+            {
+                s_isAsyncLogOverflowDrop = false;
+                UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode setting ", StringConstant::AsyncLogOverflowPolicy(), " [", asyncLogOverflowPolicy, "]");
+            }
+            else
+            {
+                UXAS_LOG_WARN(s_typeName(), "::setEntityFromXmlNode ignoring invalid ", StringConstant::AsyncLogOverflowPolicy(), " [", asyncLogOverflowPolicy, "] from XML");
+            }
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default ", StringConstant::AsyncLogOverflowPolicy(), " drop ", s_isAsyncLogOverflowDrop);
+        }
+
+        if (isSuccess && !entityInfoXmlNode.attribute(StringConstant::AsyncLogRecordCapacity().c_str()).empty())
+        {
+            s_asyncLogRecordCapacity = entityInfoXmlNode.attribute(StringConstant::AsyncLogRecordCapacity().c_str()).as_uint();
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode setting AsyncLogRecordCapacity ", s_asyncLogRecordCapacity);
+        }
+        else
+        {
+            UXAS_LOG_INFORM(s_typeName(), "::setEntityFromXmlNode retained default AsyncLogRecordCapacity ", s_asyncLogRecordCapacity);
+        }
+
         uxas::common::log::LogManager::getInstance().m_isLoggingThreadId = s_isLoggingThreadId;
+        if (s_isAsyncLogging)
+        {
+            uxas::common::log::LogManager::getInstance().startAsyncLogging(s_isAsyncLogOverflowDrop ? uxas::common::log::LogOverflowPolicy::DROP : uxas::common::log::LogOverflowPolicy::BLOCK,
+                                                                          s_asyncLogRecordCapacity);
+        }
     }
 
     return (isSuccess);
@@ -134,6 +134,29 @@ public:
     static const bool
     getIsLoggingThreadId() { return (s_isLoggingThreadId); };
     
+    /** \brief LogManager asynchronous logging boolean.
+     * 
+     * @return true implies log statements are output by the LogManager drain 
+     * thread rather than the logging thread
+     */
+    static const bool
+    getIsAsyncLogging() { return (s_isAsyncLogging); };
+
+    /** \brief LogManager asynchronous logging overflow policy.
+     * 
+     * @return true implies log records are dropped when a thread's ring buffer 
+     * is full; false implies the logging thread waits
+     */
+    static const bool
+    getIsAsyncLogOverflowDrop() { return (s_isAsyncLogOverflowDrop); };
+
+    /** \brief LogManager asynchronous logging ring buffer capacity (per thread).
+     * 
+     * @return Number of log records.
+     */
+    static const uint32_t
+    getAsyncLogRecordCapacity() { return (s_asyncLogRecordCapacity); };
+
     /** \brief LogManager configuration to timestamp logs.
      *
      * @return true implies include a timestamp in log file names 
@@ -149,6 +172,40 @@ public:
     static const bool
     getIsZeroMqMultipartMessage() { return (s_isZeroMqMultipartMessage); };
   
+    /** \brief In-process <b>LMCP</b> object delivery boolean.
+     * 
+     * @return true if co-located network clients exchange <b>LMCP</b> objects 
+     * through the in-process bus without serialization; false if all messages 
+     * are serialized and routed through the Zero MQ message hub
+     */
+    static const bool
+    getIsInProcessLmcpDelivery() { return (s_isInProcessLmcpDelivery); };
+  
+    /** \brief Worker pool network client execution boolean.
+     * 
+     * @return true if network clients (by default) dispatch received <b>LMCP</b> 
+     * objects on the shared worker pool; false if each network client runs 
+     * a dedicated thread
+     */
+    static const bool
+    getIsWorkerPoolExecution() { return (s_isWorkerPoolExecution); };
+
+    /** \brief Number of worker pool threads (zero selects the hardware concurrency).
+     * 
+     * @return Worker pool thread count.
+     */
+    static const uint32_t
+    getWorkerPoolThreadCount() { return (s_workerPoolThreadCount); };
+
+    /** \brief Event-driven Zero MQ receive boolean.
+     * 
+     * @return true if network client receive sockets are multiplexed by the 
+     * process-wide <B><i>ZeroMqReceivePoller</i></B> (no polling timeout); 
+     * false if each receiver polls its socket with the receive socket poll wait time
+     */
+    static const bool
+    getIsEventDrivenReceive() { return (s_isEventDrivenReceive); };
+  
     /** \brief UxAS application run duration (units: seconds).
      * 
      * @return Run duration in seconds.
@@ -363,8 +420,15 @@ private:
     static uint32_t s_entityId;
     static std::string s_entityType;
     static bool s_isLoggingThreadId;
+    static bool s_isAsyncLogging;
+    static bool s_isAsyncLogOverflowDrop;
+    static uint32_t s_asyncLogRecordCapacity;
     static bool s_isDataTimestamp;
     static bool s_isZeroMqMultipartMessage;
+    static bool s_isInProcessLmcpDelivery;
+    static bool s_isWorkerPoolExecution;
+    static uint32_t s_workerPoolThreadCount;
+    static bool s_isEventDrivenReceive;
     static uint32_t s_runDuration_s;
     static uint32_t s_serialPortWaitTime_ms;
     static uint32_t s_startDelay_ms;
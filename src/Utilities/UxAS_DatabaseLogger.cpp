@@ -52,12 +52,24 @@ DatabaseLogger::closeStream()
     return (m_databaseLoggerHelper->closeStream());
 };
 
+void
+DatabaseLogger::configureBatching(uint32_t batchRowCount, uint32_t batchPeriod_ms)
+{
+    m_databaseLoggerHelper->configureBatching(batchRowCount, batchPeriod_ms);
+};
+
 bool
 DatabaseLogger::outputTextToStream(const std::string& text)
 {
     return (m_databaseLoggerHelper->insertValuesIntoTable(text));
 };
 
+bool
+DatabaseLogger::outputRowToStream(std::vector<std::string> rowValues)
+{
+    return (m_databaseLoggerHelper->insertRowIntoTable(std::move(rowValues)));
+};
+
 }; //namespace log
 }; //namespace common
 }; //namespace uxas
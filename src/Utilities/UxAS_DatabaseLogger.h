@@ -15,6 +15,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace uxas
 {
@@ -62,9 +63,18 @@ public:
     bool
     closeStream() override;
 
+    /** \brief Configure group commit of rows (see <B><i>DatabaseLoggerHelper::configureBatching</i></B>). */
+    void
+    configureBatching(uint32_t batchRowCount, uint32_t batchPeriod_ms);
+
+    /** \brief Output text as an SQL values list (e.g., "'1','text'"). */
     bool
     outputTextToStream(const std::string& text) override;
 
+    /** \brief Output a row of column values (bound parameters; no SQL quoting required). */
+    bool
+    outputRowToStream(std::vector<std::string> rowValues);
+
 private:
     
     std::unique_ptr<DatabaseLoggerHelper> m_databaseLoggerHelper;
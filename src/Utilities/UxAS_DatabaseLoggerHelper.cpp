@@ -14,6 +14,9 @@
 
 #include "stdUniquePtr.h"
 
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
 
 namespace uxas
@@ -51,8 +54,61 @@ DatabaseLoggerHelper::configureDatabaseHelper(const std::string& location, bool
     return (true);
 };
 
+void
+DatabaseLoggerHelper::configureBatching(uint32_t batchRowCount, uint32_t batchPeriod_ms)
+{
+    m_batchRowCount = (batchRowCount > 0) ? batchRowCount : 1;
+    m_batchPeriod_ms = batchPeriod_ms;
+};
+
 bool
 DatabaseLoggerHelper::openStream(std::string& logFilePath)
+{
+    std::lock_guard<std::mutex> streamLock(m_streamMutex);
+    return (openStreamLocked(logFilePath));
+};
+
+bool
+DatabaseLoggerHelper::openStreamLocked(std::string& logFilePath)
+{
+    if (!openDatabase(logFilePath))
+    {
+        return (false);
+    }
+
+    if (!m_writerThread)
+    {
+        m_isWriterTerminate = false;
+        m_writerThread = uxas::stduxas::make_unique<std::thread>(&DatabaseLoggerHelper::executeWriter, this);
+    }
+    m_isStreamOpen.store(true, std::memory_order_release);
+    return (true);
+};
+
+bool
+DatabaseLoggerHelper::closeStream()
+{
+    std::lock_guard<std::mutex> streamLock(m_streamMutex);
+    m_isStreamOpen.store(false, std::memory_order_release);
+    // write queued rows and stop the writer thread
+    if (m_writerThread)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            m_isWriterTerminate = true;
+        }
+        m_queueCondition.notify_one();
+        if (m_writerThread->joinable())
+        {
+            m_writerThread->join();
+        }
+        m_writerThread.reset();
+    }
+    return (closeDatabase());
+};
+
+bool
+DatabaseLoggerHelper::openDatabase(std::string& logFilePath)
 {
     if (!m_isTableConfigurationDefined)
     {
@@ -73,28 +129,44 @@ DatabaseLoggerHelper::openStream(std::string& logFilePath)
             dbFile.close();
             remove(m_dbFilePath.c_str());
         }
-            m_db = uxas::stduxas::make_unique<SQLite::Database>(m_dbFilePath, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
+        m_db = uxas::stduxas::make_unique<SQLite::Database>(m_dbFilePath, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
 
-            // begin transaction
-            SQLite::Transaction createTableTrans(*(m_db.get()));
-            m_db->exec(m_dbTableCreate);
+        // write-ahead log: commits append to the log instead of rewriting pages
+        m_db->exec("PRAGMA journal_mode=WAL");
+        m_db->exec("PRAGMA synchronous=NORMAL");
 
-            // commit transaction
-            createTableTrans.commit();
+        // begin transaction
+        SQLite::Transaction createTableTrans(*(m_db.get()));
+        m_db->exec(m_dbTableCreate);
+
+        // commit transaction
+        createTableTrans.commit();
+
+        // one bound parameter per column
+        std::string insertSqlStmt = "INSERT INTO " + m_dbTableName + " (" + m_dbTableColumnNames + ") VALUES (?";
+        for (size_t columnIndex = 0; columnIndex < m_dbTableColumnNames.size(); columnIndex++)
+        {
+            if (m_dbTableColumnNames[columnIndex] == ',')
+            {
+                insertSqlStmt.append(",?");
+            }
+        }
+        insertSqlStmt.append(")");
+        m_insertStatement = uxas::stduxas::make_unique<SQLite::Statement>(*(m_db.get()), insertSqlStmt);
         
         m_isDbOpened = true;
         isSuccess = true;
     }
     catch (std::exception& ex)
     {
-        std::cout << "ERROR: DatabaseLoggerHelper::openStream failed to open database file and create SQLite tables [" << m_dbFilePath << "] - ERROR: [" << ex.what() << "]" << std::endl;
+        std::cout << "ERROR: DatabaseLoggerHelper::openDatabase failed to open database file and create SQLite tables [" << m_dbFilePath << "] - ERROR: [" << ex.what() << "]" << std::endl;
     }
 
     return (isSuccess);
 };
 
 bool
-DatabaseLoggerHelper::closeStream()
+DatabaseLoggerHelper::closeDatabase()
 {
     bool isSuccess{false};
     if (m_db)
@@ -102,52 +174,272 @@ DatabaseLoggerHelper::closeStream()
         std::string dbFilePath = m_db->getFilename();
         try
         {
+            m_insertStatement.reset();
             m_db.reset();
             isSuccess = true;
         }
         catch (std::exception& ex)
         {
-            std::cout << "ERROR: DatabaseLoggerHelper::closeStream failed to close database file [" << dbFilePath << "] - ERROR: [" << ex.what() << "]" << std::endl;
+            std::cout << "ERROR: DatabaseLoggerHelper::closeDatabase failed to close database file [" << dbFilePath << "] - ERROR: [" << ex.what() << "]" << std::endl;
             if (!m_dbFilePathOld.empty())
             {
                 m_dbFilePathCloseFailed = m_dbFilePathOld;
                 m_dbFileCloseFailureCount++;
-                std::cout << "ERROR: DatabaseLoggerHelper::closeStream close database file failure count [" << dbFilePath << std::endl;
+                std::cout << "ERROR: DatabaseLoggerHelper::closeDatabase close database file failure count [" << dbFilePath << std::endl;
             }
         }
     }
+    m_isDbOpened = false;
 
     return (isSuccess);
 };
 
+bool
+DatabaseLoggerHelper::insertRowIntoTable(std::vector<std::string> rowValues)
+{
+    QueuedRow row;
+    row.m_values = std::move(rowValues);
+    return (queueRow(std::move(row)));
+};
+
 bool
 DatabaseLoggerHelper::insertValuesIntoTable(const std::string& commaDelimitedValues)
 {
-    bool isSuccess{true};
-    if (!m_isDbOpened)
+    QueuedRow row;
+    if (!parseSqlValues(commaDelimitedValues, row))
+    {
+        std::cout << "ERROR: DatabaseLoggerHelper::insertValuesIntoTable rejected values [" << commaDelimitedValues << "]; only string, numeric and NULL literals are supported" << std::endl;
+        return (false);
+    }
+    return (queueRow(std::move(row)));
+};
+
+bool
+DatabaseLoggerHelper::parseSqlValues(const std::string& commaDelimitedValues, QueuedRow& row)
+{
+    size_t index{0};
+    while (true)
     {
+        while (index < commaDelimitedValues.size() && std::isspace(static_cast<unsigned char>(commaDelimitedValues[index])))
+        {
+            index++;
+        }
+        std::string value;
+        ValueType valueType{ValueType::TEXT};
+        if (index < commaDelimitedValues.size() && commaDelimitedValues[index] == '\'')
+        {
+            // quoted string, '' is an escaped quote
+            index++;
+            while (true)
+            {
+                size_t quoteIndex = commaDelimitedValues.find('\'', index);
+                if (quoteIndex == std::string::npos)
+                {
+                    return (false);
+                }
+                value.append(commaDelimitedValues, index, quoteIndex - index);
+                index = quoteIndex + 1;
+                if (index < commaDelimitedValues.size() && commaDelimitedValues[index] == '\'')
+                {
+                    value.push_back('\'');
+                    index++;
+                    continue;
+                }
+                break;
+            }
+        }
+        else
+        {
+            size_t valueEnd = commaDelimitedValues.find(',', index);
+            value = commaDelimitedValues.substr(index, (valueEnd == std::string::npos) ? std::string::npos : (valueEnd - index));
+            while (!value.empty() && std::isspace(static_cast<unsigned char>(value.back())))
+            {
+                value.pop_back();
+            }
+            index += value.size();
+            char* numberEnd{nullptr};
+            if (value == "NULL" || value == "null")
+            {
+                valueType = ValueType::NULL_VALUE;
+            }
+            else if (!value.empty() && (std::strtoll(value.c_str(), &numberEnd, 10), *numberEnd == '\0'))
+            {
+                valueType = ValueType::INTEGER;
+            }
+            else if (!value.empty() && (std::strtod(value.c_str(), &numberEnd), *numberEnd == '\0'))
+            {
+                valueType = ValueType::REAL;
+            }
+            else
+            {
+                return (false);
+            }
+        }
+        row.m_values.push_back(std::move(value));
+        row.m_valueTypes.push_back(valueType);
+
+        while (index < commaDelimitedValues.size() && std::isspace(static_cast<unsigned char>(commaDelimitedValues[index])))
+        {
+            index++;
+        }
+        if (index == commaDelimitedValues.size())
+        {
+            return (true);
+        }
+        if (commaDelimitedValues[index] != ',')
+        {
+            return (false);
+        }
+        index++;
+    }
+};
+
+bool
+DatabaseLoggerHelper::queueRow(QueuedRow&& row)
+{
+    // (the writer thread runs while the stream is open)
+    if (!m_isStreamOpen.load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> streamLock(m_streamMutex);
+        // another thread may have opened the stream while this one waited
         std::string logFilePath;
-        isSuccess = openStream(logFilePath);
+        if (!m_writerThread && !openStreamLocked(logFilePath))
+        {
+            return (false);
+        }
     }
-    if (isSuccess)
+
+    bool isBatchReady{false};
     {
-        std::string insertSqlStmt = "INSERT INTO " + m_dbTableName + " (" + m_dbTableColumnNames + ") VALUES (" + commaDelimitedValues + ")";
+        std::unique_lock<std::mutex> lock(m_queueMutex);
+        // back-pressure when the writer falls behind
+        m_writtenCondition.wait(lock, [this]
+        {
+            return (m_queuedRows.size() < static_cast<size_t>(m_batchRowCount) * s_queuedBatchCountLimit || m_isWriterTerminate);
+        });
+        m_queuedRows.push_back(std::move(row));
+        isBatchReady = (m_queuedRows.size() >= m_batchRowCount);
+    }
+    if (isBatchReady)
+    {
+        m_queueCondition.notify_one();
+    }
+    return (true);
+};
+
+void
+DatabaseLoggerHelper::flush()
+{
+    std::unique_lock<std::mutex> lock(m_queueMutex);
+    if (!m_writerThread)
+    {
+        return;
+    }
+    // the writer does not wait for a full batch while a flush is requested
+    m_isFlushRequested = true;
+    m_queueCondition.notify_one();
+    m_writtenCondition.wait(lock, [this] { return ((m_queuedRows.empty() && !m_isWriting) || m_isWriterTerminate); });
+    m_isFlushRequested = false;
+};
+
+void
+DatabaseLoggerHelper::executeWriter()
+{
+    std::unique_lock<std::mutex> lock(m_queueMutex);
+    while (true)
+    {
+        if (m_queuedRows.empty())
+        {
+            if (m_isWriterTerminate)
+            {
+                break;
+            }
+            m_queueCondition.wait(lock);
+            continue;
+        }
+
+        // wait (at most the batch period) for a full batch
+        if (m_queuedRows.size() < m_batchRowCount && !m_isWriterTerminate && !m_isFlushRequested)
+        {
+            m_queueCondition.wait_for(lock, std::chrono::milliseconds(m_batchPeriod_ms), [this]
+            {
+                return (m_queuedRows.size() >= m_batchRowCount || m_isWriterTerminate || m_isFlushRequested);
+            });
+        }
+
+        m_writingRows.swap(m_queuedRows);
+        m_isWriting = true;
+        lock.unlock();
+        m_writtenCondition.notify_all();
+
+        writeRows(m_writingRows);
+        m_writingRows.clear();
+
+        lock.lock();
+        m_isWriting = false;
+        m_writtenCondition.notify_all();
+    }
+};
+
+void
+DatabaseLoggerHelper::writeRows(std::vector<QueuedRow>& rows)
+{
+    size_t rowIndex{0};
+    while (rowIndex < rows.size())
+    {
+        if (!m_db)
+        {
+            std::cout << "ERROR: DatabaseLoggerHelper::writeRows discarding " << (rows.size() - rowIndex) << " rows; database file is not open" << std::endl;
+            return;
+        }
         try
         {
-            // begin transaction
+            // begin transaction (one per batch, or per database file when a batch spans files)
             SQLite::Transaction transaction(*(m_db.get()));
-            m_db->exec(insertSqlStmt);
+            size_t transactionFirstRowIndex = rowIndex;
+            for (; rowIndex < rows.size() && (rowIndex == transactionFirstRowIndex || m_dbStatementCount <= m_dbStatementCountLimit); rowIndex++)
+            {
+                QueuedRow& row = rows[rowIndex];
+                try
+                {
+                    m_insertStatement->reset();
+                    m_insertStatement->clearBindings();
+                    for (size_t valueIndex = 0; valueIndex < row.m_values.size(); valueIndex++)
+                    {
+                        int parameterIndex = static_cast<int>(valueIndex + 1);
+                        switch (row.m_valueTypes.empty() ? ValueType::TEXT : row.m_valueTypes[valueIndex])
+                        {
+                            case ValueType::TEXT:
+                                m_insertStatement->bind(parameterIndex, row.m_values[valueIndex]);
+                                break;
+                            case ValueType::INTEGER:
+                                m_insertStatement->bind(parameterIndex, static_cast<sqlite3_int64>(std::strtoll(row.m_values[valueIndex].c_str(), nullptr, 10)));
+                                break;
+                            case ValueType::REAL:
+                                m_insertStatement->bind(parameterIndex, std::strtod(row.m_values[valueIndex].c_str(), nullptr));
+                                break;
+                            case ValueType::NULL_VALUE:
+                                m_insertStatement->bind(parameterIndex);
+                                break;
+                        }
+                    }
+                    m_insertStatement->exec();
+                    m_dbStatementCount++;
+                }
+                catch (std::exception& ex)
+                {
+                    std::cout << "ERROR: DatabaseLoggerHelper::writeRows insert into table [" << m_dbTableName << "] failed - ERROR: [" << ex.what() << "]" << std::endl;
+                }
+            }
             // commit transaction
             transaction.commit();
-            m_dbStatementCount++;
-            isSuccess = closeAndOpenStream();
         }
         catch (std::exception& ex)
         {
-            std::cout << "ERROR: DatabaseLoggerHelper::insertMessageIntoTable insert failed while executing SQL statement [" << insertSqlStmt << "] - ERROR: [" << ex.what() << "]" << std::endl;
+            std::cout << "ERROR: DatabaseLoggerHelper::writeRows failed to commit rows into table [" << m_dbTableName << "] - ERROR: [" << ex.what() << "]" << std::endl;
         }
+        closeAndOpenStream();
     }
-    return (isSuccess);
 };
 
 bool
@@ -156,13 +448,13 @@ DatabaseLoggerHelper::closeAndOpenStream()
     bool isSuccess{true};
     if (m_dbStatementCount > m_dbStatementCountLimit)
     {
-        if (!closeStream())
+        if (!closeDatabase())
         {
             isSuccess = false;
             std::cout << "WARN: DatabaseLoggerHelper::closeAndOpenStream failed to close database file [" << m_dbFilePathOld << "]" << std::endl;
         }
-        std::string logFilePath;        //not used ??
-        if (!openStream(logFilePath))
+        std::string logFilePath;
+        if (!openDatabase(logFilePath))
         {
             isSuccess = false;
             std::cout << "WARN: DatabaseLoggerHelper::closeAndOpenStream failed to open database file" << std::endl;
@@ -13,9 +13,14 @@
 #include <SQLiteCpp/Database.h>
 #include <SQLiteCpp/SQLiteCpp.h>
 
+#include <atomic>
+#include <condition_variable>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace uxas
 {
@@ -24,6 +29,20 @@ namespace common
 namespace log
 {
 
+/** \class DatabaseLoggerHelper
+ * 
+ * \par Description:
+ * Writes rows into a SQLite database table (WAL journal mode). Rows are 
+ * queued by the calling thread and written by a writer thread, which 
+ * inserts the queued rows with a cached prepared statement (bound 
+ * parameters) and commits them in one transaction per batch. A batch is 
+ * written once <B><i>batchRowCount</i></B> rows are queued or 
+ * <B><i>batchPeriod_ms</i></B> has elapsed (see <B><i>configureBatching</i></B>). 
+ * The calling thread waits if the writer falls behind by more than 
+ * <B><i>s_queuedBatchCountLimit</i></B> batches.
+ * 
+ * \n
+ */
 class DatabaseLoggerHelper
 {
 public:
@@ -51,11 +70,80 @@ public:
     bool
     closeStream();
 
+    /** \brief Configure group commit of queued rows (takes effect when the 
+     * stream is opened).
+     * 
+     * @param batchRowCount number of queued rows that triggers a write.
+     * @param batchPeriod_ms maximum time a queued row waits to be written.
+     */
+    void
+    configureBatching(uint32_t batchRowCount, uint32_t batchPeriod_ms);
+
+    /** \brief Queue a row of column values (in the order of the configured 
+     * table column names), bound as text parameters of the insert statement.
+     */
+    bool
+    insertRowIntoTable(std::vector<std::string> rowValues);
+
+    /** \brief Queue a row given as an SQL values list of literals (e.g., 
+     * "'1','it''s',2,NULL"). The literals are bound as parameters of the 
+     * insert statement; lists with other expressions are rejected. Prefer 
+     * <B><i>insertRowIntoTable</i></B>, which needs no SQL quoting.
+     */
     bool
     insertValuesIntoTable(const std::string& commaDelimitedValues);
 
+    /** \brief Wait until all queued rows are committed. */
+    void
+    flush();
+
 private:
 
+    /** \brief Type of a bound column value */
+    enum class ValueType : uint8_t
+    {
+        TEXT,
+        INTEGER,
+        REAL,
+        NULL_VALUE
+    };
+
+    /** \brief Queued row of bound column values */
+    struct QueuedRow
+    {
+        std::vector<std::string> m_values;
+        /** \brief types of <B><i>m_values</i></B> (all text if empty) */
+        std::vector<ValueType> m_valueTypes;
+    };
+
+    /** \brief Split an SQL values list of literals into typed column values.
+     * 
+     * @return false if the list holds anything but string, numeric and NULL literals.
+     */
+    static bool
+    parseSqlValues(const std::string& commaDelimitedValues, QueuedRow& row);
+
+    bool
+    queueRow(QueuedRow&& row);
+
+    /** \brief Open the database and start the writer thread (requires 
+     * <B><i>m_streamMutex</i></B>). */
+    bool
+    openStreamLocked(std::string& logFilePath);
+
+    bool
+    openDatabase(std::string& logFilePath);
+
+    bool
+    closeDatabase();
+
+    void
+    executeWriter();
+
+    /** \brief Insert and commit a batch (writer thread). */
+    void
+    writeRows(std::vector<QueuedRow>& rows);
+
     bool
     closeAndOpenStream();
     
@@ -71,11 +159,34 @@ private:
     uint32_t m_dbFileCloseFailureCount{0};
     
     std::unique_ptr<SQLite::Database> m_db;
+    /** \brief cached insert statement of <B><i>m_db</i></B> (re-prepared when the database file is rolled over) */
+    std::unique_ptr<SQLite::Statement> m_insertStatement;
     bool m_isTableConfigurationDefined{false};
     bool m_isDbOpened{false};
     std::string m_dbTableCreate;
     std::string m_dbTableName;
     std::string m_dbTableColumnNames;
+
+    uint32_t m_batchRowCount{500};
+    uint32_t m_batchPeriod_ms{100};
+    static const uint32_t s_queuedBatchCountLimit{64};
+
+    /** \brief guards opening and closing the stream (and starting the writer thread) */
+    std::mutex m_streamMutex;
+    /** \brief set while the writer thread runs */
+    std::atomic<bool> m_isStreamOpen{false};
+
+    /** \brief rows queued for the writer thread (guarded by <B><i>m_queueMutex</i></B>) */
+    std::vector<QueuedRow> m_queuedRows;
+    /** \brief rows being written by the writer thread */
+    std::vector<QueuedRow> m_writingRows;
+    bool m_isWriting{false};
+    bool m_isFlushRequested{false};
+    bool m_isWriterTerminate{false};
+    std::mutex m_queueMutex;
+    std::condition_variable m_queueCondition;
+    std::condition_variable m_writtenCondition;
+    std::unique_ptr<std::thread> m_writerThread;
     
 };
 
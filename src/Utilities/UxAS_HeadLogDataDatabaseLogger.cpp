@@ -12,7 +12,6 @@
 #include "UxAS_Time.h"
 
 #include "stdUniquePtr.h"
-#include "UxAS_XmlUtil.h"
 
 namespace uxas
 {
@@ -84,12 +83,16 @@ HeadLogDataDatabaseLogger::closeStream()
 bool
 HeadLogDataDatabaseLogger::outputToStream(HeadLogData& headerAndData)
 {
-    std::string msg = headerAndData.m_message.str().substr();
-    uxas::common::XmlUtil::escapeXmlQuoteApostropheChars(msg);
-    m_HeadLogDataDatabaseLoggerHelper->insertValuesIntoTable("'" + std::to_string(headerAndData.m_time_ms) + "','" +
-                                                             (m_isLogThreadId ? (headerAndData.m_threadID.str() + "','") : "") +
-                                                             headerAndData.m_severityLevelString + "','" +
-                                                             msg + "'");
+    std::vector<std::string> rowValues;
+    rowValues.reserve(4);
+    rowValues.push_back(std::to_string(headerAndData.m_time_ms));
+    if (m_isLogThreadId)
+    {
+        rowValues.push_back(headerAndData.m_threadID.str());
+    }
+    rowValues.push_back(headerAndData.m_severityLevelString);
+    rowValues.push_back(headerAndData.m_message.str());
+    m_HeadLogDataDatabaseLoggerHelper->insertRowIntoTable(std::move(rowValues));
     return true;
 };
 
@@ -15,6 +15,8 @@
 
 #include "stdUniquePtr.h"
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 
 #define LOG_MANAGER_LOCAL_LOG_MESSAGE(message) std::cout << message << std::endl; std::cout.flush();
@@ -26,6 +28,42 @@ namespace common
 namespace log
 {
 
+namespace
+{
+
+/** \brief Per-thread asynchronous logging state */
+struct ThreadLogContext
+{
+    ~ThreadLogContext()
+    {
+        if (m_ringBuffer)
+        {
+            m_ringBuffer->m_isProducerExited = true;
+        }
+    };
+
+    std::shared_ptr<LogRecordRingBuffer> m_ringBuffer;
+    LogRecord m_record;
+    std::ostringstream m_messageStream;
+    uint64_t m_nextSequenceNumber{0};
+};
+
+thread_local ThreadLogContext t_threadLogContext;
+
+int64_t
+getSystemTimeSinceEpoch_ms()
+{
+    return (std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+};
+
+int64_t
+getSteadyTime_ns()
+{
+    return (std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+};
+
+}
+
 std::unique_ptr<LogManager> LogManager::s_instance = nullptr;
 
 LogManager&
@@ -60,6 +98,7 @@ LogManager::getInstance()
 
 LogManager::~LogManager()
 {
+    stopAsyncLogging();
     for (auto& loggerIt : m_loggers)
     {
         if (loggerIt)
@@ -246,6 +285,263 @@ LogManager::setLoggerSeverityLevelByTypeAndNameImpl(const std::string& loggerTyp
     m_mutex.unlock();
 };
 
+bool
+LogManager::startAsyncLogging(LogOverflowPolicy overflowPolicy, uint32_t recordCapacity)
+{
+    if (m_isAsyncLogging.load(std::memory_order_acquire))
+    {
+        LOG_MANAGER_LOCAL_LOG_MESSAGE("WARNING LogManager asynchronous logging already started")
+        return (true);
+    }
+    m_overflowPolicy = overflowPolicy;
+    m_asyncRecordCapacity = recordCapacity;
+    m_isDrainTerminate = false;
+    try
+    {
+        m_drainThread = uxas::stduxas::make_unique<std::thread>(&LogManager::executeDrain, this);
+    }
+    catch (std::exception& ex)
+    {
+        LOG_MANAGER_LOCAL_LOG_MESSAGE("ERROR LogManager failed to start asynchronous logging drain thread EXCEPTION: " << ex.what())
+        return (false);
+    }
+    m_isAsyncLogging.store(true, std::memory_order_release);
+    return (true);
+};
+
+void
+LogManager::stopAsyncLogging()
+{
+    if (!m_isAsyncLogging.exchange(false))
+    {
+        return;
+    }
+    // new log statements are output synchronously, wait for the threads 
+    // that are still pushing records into their ring buffers (a ring buffer 
+    // registered after this point belongs to a thread that sees the stop)
+    std::vector<std::shared_ptr<LogRecordRingBuffer>> ringBuffers;
+    {
+        std::lock_guard<std::mutex> lock(m_ringBuffersMutex);
+        ringBuffers = m_ringBuffers;
+    }
+    for (auto& ringBuffer : ringBuffers)
+    {
+        while (ringBuffer->m_isProducing.load())
+        {
+            m_drainCondition.notify_one();
+            std::this_thread::yield();
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_drainMutex);
+        m_isDrainTerminate = true;
+    }
+    m_drainCondition.notify_one();
+    if (m_drainThread && m_drainThread->joinable())
+    {
+        m_drainThread->join();
+    }
+    m_drainThread.reset();
+    // records pushed while the drain thread was stopping
+    while (drainRingBuffers() != 0)
+    {
+    }
+};
+
+LogRecordRingBuffer&
+LogManager::getThreadRingBuffer()
+{
+    ThreadLogContext& threadLogContext = t_threadLogContext;
+    if (!threadLogContext.m_ringBuffer)
+    {
+        threadLogContext.m_ringBuffer = std::make_shared<LogRecordRingBuffer>(m_asyncRecordCapacity);
+        std::lock_guard<std::mutex> lock(m_ringBuffersMutex);
+        m_ringBuffers.push_back(threadLogContext.m_ringBuffer);
+        m_isRingBuffersChanged.store(true, std::memory_order_release);
+    }
+    return (*threadLogContext.m_ringBuffer);
+};
+
+std::ostringstream&
+LogManager::beginAsyncRecord()
+{
+    std::ostringstream& messageStream = t_threadLogContext.m_messageStream;
+    messageStream.str(std::string());
+    messageStream.clear();
+    return (messageStream);
+};
+
+void
+LogManager::endAsyncRecord(LogSeverityLevel severityLevel)
+{
+    // the ring buffer was created by getThreadRingBuffer
+    ThreadLogContext& threadLogContext = t_threadLogContext;
+    LogRecord& record = threadLogContext.m_record;
+    record.m_time_ms = getSystemTimeSinceEpoch_ms();
+    record.m_threadId = std::this_thread::get_id();
+    record.m_severityLevel = severityLevel;
+    record.m_steadyTime_ns = getSteadyTime_ns();
+    record.m_sequenceNumber = threadLogContext.m_nextSequenceNumber++;
+    record.m_message = threadLogContext.m_messageStream.str();
+
+    while (!threadLogContext.m_ringBuffer->tryPush(record))
+    {
+        if (m_overflowPolicy == LogOverflowPolicy::DROP)
+        {
+            m_droppedRecordCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        if (!m_isAsyncLogging.load(std::memory_order_acquire))
+        {
+            // drain thread stopped - output on the calling thread
+            std::lock_guard<std::mutex> lock(m_mutex);
+            outputRecordToLoggers(record, uxas::common::Time::getInstance().getUtcTimeSinceEpoch_ms() - getSystemTimeSinceEpoch_ms());
+            return;
+        }
+        m_drainCondition.notify_one();
+        std::this_thread::yield();
+    }
+};
+
+void
+LogManager::executeDrain()
+{
+    while (true)
+    {
+        if (drainRingBuffers() == 0)
+        {
+            std::unique_lock<std::mutex> lock(m_drainMutex);
+            if (m_isDrainTerminate)
+            {
+                break;
+            }
+            m_drainCondition.wait_for(lock, std::chrono::milliseconds(10));
+        }
+    }
+};
+
+size_t
+LogManager::drainRingBuffers()
+{
+    if (m_isRingBuffersChanged.exchange(false, std::memory_order_acq_rel))
+    {
+        std::lock_guard<std::mutex> lock(m_ringBuffersMutex);
+        m_drainRingBuffers = m_ringBuffers;
+    }
+
+    // take (at most s_drainRecordCountPerRingBuffer) records from each ring buffer
+    size_t recordCount{0};
+    bool isExitedRingBuffer{false};
+    for (auto& ringBuffer : m_drainRingBuffers)
+    {
+        for (size_t ringRecordCount = 0; ringRecordCount < s_drainRecordCountPerRingBuffer; ringRecordCount++)
+        {
+            if (recordCount == m_drainRecords.size())
+            {
+                m_drainRecords.emplace_back();
+            }
+            if (!ringBuffer->tryPop(m_drainRecords[recordCount]))
+            {
+                break;
+            }
+            recordCount++;
+        }
+        if (ringBuffer->m_isProducerExited.load(std::memory_order_acquire) && ringBuffer->isEmpty())
+        {
+            isExitedRingBuffer = true;
+        }
+    }
+
+    // release ring buffers of exited threads
+    if (isExitedRingBuffer)
+    {
+        std::lock_guard<std::mutex> lock(m_ringBuffersMutex);
+        m_ringBuffers.erase(std::remove_if(m_ringBuffers.begin(), m_ringBuffers.end(),
+                                           [](const std::shared_ptr<LogRecordRingBuffer>& ringBuffer)
+                                           {
+                                               return (ringBuffer->m_isProducerExited.load(std::memory_order_acquire) && ringBuffer->isEmpty());
+                                           }), m_ringBuffers.end());
+        m_isRingBuffersChanged.store(true, std::memory_order_release);
+    }
+
+    uint64_t droppedRecordCount = m_droppedRecordCount.load(std::memory_order_relaxed);
+    if (recordCount == 0 && droppedRecordCount == m_reportedDroppedRecordCount)
+    {
+        return (0);
+    }
+
+    // order records of all threads by log statement time (stable, so that 
+    // the records of a thread remain in log statement order)
+    m_drainSortedRecords.clear();
+    for (size_t recordIndex = 0; recordIndex < recordCount; recordIndex++)
+    {
+        m_drainSortedRecords.push_back(&m_drainRecords[recordIndex]);
+    }
+    std::stable_sort(m_drainSortedRecords.begin(), m_drainSortedRecords.end(),
+                     [](const LogRecord* lhs, const LogRecord* rhs) { return (lhs->m_steadyTime_ns < rhs->m_steadyTime_ns); });
+
+    // records hold uncalibrated system time; apply the current calibration
+    int64_t timeCalibrationDelta_ms = uxas::common::Time::getInstance().getUtcTimeSinceEpoch_ms() - getSystemTimeSinceEpoch_ms();
+    size_t outputRecordCount{recordCount};
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const LogRecord* record : m_drainSortedRecords)
+    {
+        outputRecordToLoggers(*record, timeCalibrationDelta_ms);
+    }
+    if (droppedRecordCount != m_reportedDroppedRecordCount)
+    {
+        LogRecord dropRecord;
+        dropRecord.m_time_ms = getSystemTimeSinceEpoch_ms();
+        dropRecord.m_threadId = std::this_thread::get_id();
+        dropRecord.m_severityLevel = LogSeverityLevel::UXASWARNING;
+        dropRecord.m_message = "LogManager::drainRingBuffers dropped " + std::to_string(droppedRecordCount - m_reportedDroppedRecordCount)
+                + " log records (total " + std::to_string(droppedRecordCount) + ")";
+        outputRecordToLoggers(dropRecord, timeCalibrationDelta_ms);
+        m_reportedDroppedRecordCount = droppedRecordCount;
+        outputRecordCount++;
+    }
+    return (outputRecordCount);
+};
+
+void
+LogManager::outputRecordToLoggers(const LogRecord& record, int64_t timeCalibrationDelta_ms)
+{
+    HeadLogData& headerAndData = m_drainHeaderAndData;
+    headerAndData.m_time_ms = record.m_time_ms + timeCalibrationDelta_ms;
+    headerAndData.m_severityLevel = record.m_severityLevel;
+    switch (record.m_severityLevel)
+    {
+        case LogSeverityLevel::UXASDEBUG:
+            headerAndData.m_severityLevelString = debugString();
+            break;
+        case LogSeverityLevel::UXASINFO:
+            headerAndData.m_severityLevelString = infoString();
+            break;
+        case LogSeverityLevel::UXASWARNING:
+            headerAndData.m_severityLevelString = warningString();
+            break;
+        case LogSeverityLevel::UXASERROR:
+            headerAndData.m_severityLevelString = errorString();
+            break;
+    };
+    headerAndData.m_threadID.str(std::string());
+    headerAndData.m_threadID.clear();
+    if (m_isLoggingThreadId)
+    {
+        headerAndData.m_threadID << record.m_threadId;
+    }
+    headerAndData.m_message.str(record.m_message);
+    headerAndData.m_message.clear();
+    headerAndData.m_message.seekp(0, std::ios_base::end);
+    for (auto& loggerIt : m_loggers)
+    {
+        if (loggerIt && loggerIt->m_severityLevelThreshold <= headerAndData.m_severityLevel)
+        {
+            loggerIt->outputToStream(headerAndData);
+        }
+    }
+};
+
 std::string
 LogManager::getDate()
 {
@@ -12,12 +12,15 @@
 
 #include "UxAS_ConfigurationManager.h"
 #include "UxAS_LoggerBase.h"
+#include "UxAS_LogRecordRingBuffer.h"
 #include "UxAS_LogSeverityLevel.h"
 #include "UxAS_Time.h"
 
 #include "stdUniquePtr.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <string>
 #include <sstream>
@@ -39,6 +42,18 @@ namespace log
  * \par Description:
  * Singleton pattern
  * 
+ * By default, <B><i>log</i></B> formats and outputs each log statement to the 
+ * loggers on the calling thread (synchronous logging). After 
+ * <B><i>startAsyncLogging</i></B>, <B><i>log</i></B> only formats the message 
+ * and pushes a log record into a lock-free ring buffer owned by the calling 
+ * thread; a single drain thread formats the header fields (time, thread ID, 
+ * severity) and outputs the records (ordered by log statement steady clock 
+ * time within each drain pass) to the loggers. Log statements share no 
+ * counters: each thread numbers its own records and announces itself as a 
+ * producer on its own ring buffer. When a ring buffer is full, the record is 
+ * dropped (counted) or the calling thread waits, depending on the 
+ * <B><i>LogOverflowPolicy</i></B>.
+ * 
  * \n
  */
 class LogManager
@@ -101,12 +116,49 @@ public:
     void
     setLoggersSeverityLevelByLoggerTypeAndName(const std::string& loggerType, const std::string& name, LogSeverityLevel severityLevelThreshold);
         
+    /** \brief Start asynchronous logging (see class description).
+     * 
+     * @param overflowPolicy action taken when a thread's ring buffer is full.
+     * @param recordCapacity number of records of each thread's ring buffer.
+     * @return true if asynchronous logging is running.
+     */
+    bool
+    startAsyncLogging(LogOverflowPolicy overflowPolicy, uint32_t recordCapacity);
+
+    /** \brief Output all buffered log records, stop the drain thread and 
+     * return to synchronous logging.
+     */
+    void
+    stopAsyncLogging();
+
+    bool
+    getIsAsyncLogging() const { return (m_isAsyncLogging.load(std::memory_order_acquire)); };
+
+    /** \brief Number of log records dropped by asynchronous logging (all threads). */
+    uint64_t
+    getDroppedRecordCount() const { return (m_droppedRecordCount.load(std::memory_order_relaxed)); };
+
     template<LogSeverityLevel logSeverity, typename...Args>
     void
     log(Args...args)
     {
         if (logSeverity >= m_severityLevelThreshold)
         {
+            if (m_isAsyncLogging.load(std::memory_order_acquire))
+            {
+                // announce the producer before re-checking (see stopAsyncLogging)
+                LogRecordRingBuffer& ringBuffer = getThreadRingBuffer();
+                ringBuffer.m_isProducing.store(true);
+                if (m_isAsyncLogging.load())
+                {
+                    std::ostringstream& messageStream = beginAsyncRecord();
+                    appendToStream(messageStream, args...);
+                    endAsyncRecord(logSeverity);
+                    ringBuffer.m_isProducing.store(false, std::memory_order_release);
+                    return;
+                }
+                ringBuffer.m_isProducing.store(false, std::memory_order_release);
+            }
             m_mutex.lock();
             switch (logSeverity)
             {
@@ -140,6 +192,48 @@ private:
     void
     setLoggerSeverityLevelByTypeAndNameImpl(const std::string& loggerType, const std::string& name, LogSeverityLevel severityLevelThreshold, bool isCheckLoggerType, bool isCheckName);
     
+    template<typename First, typename...Rest>
+    static void
+    appendToStream(std::ostringstream& messageStream, First parm1, Rest...parm)
+    {
+        messageStream << parm1;
+
+        // recursive processing of tokens
+        appendToStream(messageStream, parm...);
+    };
+
+    static void
+    appendToStream(std::ostringstream& messageStream) { };
+
+    /** \brief Return the ring buffer of the calling thread (created and 
+     * registered with the drain thread on first use). */
+    LogRecordRingBuffer&
+    getThreadRingBuffer();
+
+    /** \brief Return the (cleared) message stream of the calling thread. */
+    std::ostringstream&
+    beginAsyncRecord();
+
+    /** \brief Push the message of the calling thread's message stream into 
+     * the calling thread's ring buffer (applying the overflow policy). */
+    void
+    endAsyncRecord(LogSeverityLevel severityLevel);
+
+    void
+    executeDrain();
+
+    /** \brief Move records from all ring buffers to the loggers (drain thread, 
+     * or after the drain thread stopped).
+     * 
+     * @return number of records output.
+     */
+    size_t
+    drainRingBuffers();
+
+    /** \brief Output a record to the loggers (requires <B><i>m_mutex</i></B>). */
+    void
+    outputRecordToLoggers(const LogRecord& record, int64_t timeCalibrationDelta_ms);
+
     template<typename First, typename...Rest>
     void
     outputToLog(First parm1, Rest...parm)
@@ -195,6 +289,33 @@ private:
 
     LogSeverityLevel m_severityLevelThreshold = LogSeverityLevel::UXASDEBUG;
     std::unique_ptr<uxas::common::log::HeadLogData> m_currentHeaderAndData;
+
+    std::atomic<bool> m_isAsyncLogging{false};
+    LogOverflowPolicy m_overflowPolicy{LogOverflowPolicy::DROP};
+    uint32_t m_asyncRecordCapacity{8192};
+    std::atomic<uint64_t> m_droppedRecordCount{0};
+    uint64_t m_reportedDroppedRecordCount{0};
+
+    /** \brief ring buffers of all logging threads (guarded by <B><i>m_ringBuffersMutex</i></B>) */
+    std::vector<std::shared_ptr<LogRecordRingBuffer>> m_ringBuffers;
+    std::mutex m_ringBuffersMutex;
+    std::atomic<bool> m_isRingBuffersChanged{false};
+
+    /** \brief drain thread copy of <B><i>m_ringBuffers</i></B> */
+    std::vector<std::shared_ptr<LogRecordRingBuffer>> m_drainRingBuffers;
+    /** \brief drain thread records (re-used) */
+    std::vector<LogRecord> m_drainRecords;
+    std::vector<LogRecord*> m_drainSortedRecords;
+    /** \brief drain thread header and data (re-used) */
+    uxas::common::log::HeadLogData m_drainHeaderAndData;
+
+    std::unique_ptr<std::thread> m_drainThread;
+    std::mutex m_drainMutex;
+    std::condition_variable m_drainCondition;
+    bool m_isDrainTerminate{false};
+
+    /** \brief maximum number of records taken from one ring buffer in a drain pass */
+    static const size_t s_drainRecordCountPerRingBuffer{256};
 };
 
 }; //namespace log
@@ -0,0 +1,180 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#ifndef UXAS_COMMON_LOG_LOG_RECORD_RING_BUFFER_H
+#define UXAS_COMMON_LOG_LOG_RECORD_RING_BUFFER_H
+
+#include "UxAS_LogSeverityLevel.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace uxas
+{
+namespace common
+{
+namespace log
+{
+
+/** \class LogOverflowPolicy
+ * (enum LogOverflowPolicy)
+ *
+ * \par Description:
+ * Action taken by a logging thread when its asynchronous log record ring
+ * buffer is full.
+ *
+ * \n
+ */
+enum class LogOverflowPolicy
+{
+    /** \brief discard the log record (counted) */
+    DROP,
+    /** \brief wait for the drain thread to free a slot */
+    BLOCK
+};
+
+/** \class LogRecord
+    \brief Log record captured by a logging thread. The message is formatted
+ * by the logging thread; header fields (time, thread ID, severity) are
+ * formatted by the drain thread.
+ */
+struct LogRecord
+{
+    int64_t m_time_ms{0};
+    std::thread::id m_threadId;
+    LogSeverityLevel m_severityLevel{LogSeverityLevel::UXASDEBUG};
+    /** \brief steady clock time (orders the records of all threads) */
+    int64_t m_steadyTime_ns{0};
+    /** \brief log statement number of the logging thread (including dropped records) */
+    uint64_t m_sequenceNumber{0};
+    std::string m_message;
+};
+
+/** \class LogRecordRingBuffer
+ *
+ * \par Description:
+ * Bounded, lock-free, single-producer/single-consumer ring buffer of log
+ * records. Each logging thread owns one ring buffer (producer) and the
+ * <B><i>LogManager</i></B> drain thread empties all of them (consumer).
+ * Record message strings are swapped (not copied) in and out of the slots,
+ * so slot string capacity is re-used.
+ *
+ * \n
+ */
+class LogRecordRingBuffer final
+{
+public:
+
+    /** \brief Construct a ring buffer holding <B><i>capacity</i></B> records
+     * (rounded up to a power of two).
+     */
+    explicit
+    LogRecordRingBuffer(uint32_t capacity)
+    {
+        size_t roundedCapacity{2};
+        while (roundedCapacity < capacity)
+        {
+            roundedCapacity <<= 1;
+        }
+        m_records.resize(roundedCapacity);
+        m_indexMask = roundedCapacity - 1;
+    };
+
+private:
+
+    /** \brief Copy construction not permitted */
+    LogRecordRingBuffer(LogRecordRingBuffer const&) = delete;
+
+    /** \brief Copy assignment operation not permitted */
+    void operator=(LogRecordRingBuffer const&) = delete;
+
+public:
+
+    /** \brief Producer: move <B><i>record</i></B> into the ring buffer. On
+     * success, <B><i>record</i></B> holds a cleared (re-usable) message string.
+     *
+     * @return false if the ring buffer is full.
+     */
+    bool
+    tryPush(LogRecord& record)
+    {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head.load(std::memory_order_acquire) > m_indexMask)
+        {
+            return (false);
+        }
+        LogRecord& slot = m_records[tail & m_indexMask];
+        slot.m_time_ms = record.m_time_ms;
+        slot.m_threadId = record.m_threadId;
+        slot.m_severityLevel = record.m_severityLevel;
+        slot.m_steadyTime_ns = record.m_steadyTime_ns;
+        slot.m_sequenceNumber = record.m_sequenceNumber;
+        slot.m_message.swap(record.m_message);
+        record.m_message.clear();
+        m_tail.store(tail + 1, std::memory_order_release);
+        return (true);
+    };
+
+    /** \brief Consumer: move the oldest record into <B><i>record</i></B>.
+     *
+     * @return false if the ring buffer is empty.
+     */
+    bool
+    tryPop(LogRecord& record)
+    {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire))
+        {
+            return (false);
+        }
+        LogRecord& slot = m_records[head & m_indexMask];
+        record.m_time_ms = slot.m_time_ms;
+        record.m_threadId = slot.m_threadId;
+        record.m_severityLevel = slot.m_severityLevel;
+        record.m_steadyTime_ns = slot.m_steadyTime_ns;
+        record.m_sequenceNumber = slot.m_sequenceNumber;
+        record.m_message.swap(slot.m_message);
+        m_head.store(head + 1, std::memory_order_release);
+        return (true);
+    };
+
+    bool
+    isEmpty() const
+    {
+        return (m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire));
+    };
+
+    /** \brief set when the producing thread exits; the drain thread releases
+     * the ring buffer once it is empty */
+    std::atomic<bool> m_isProducerExited{false};
+
+    /** \brief set by the producing thread while it pushes a record (see
+     * <B><i>LogManager::stopAsyncLogging</i></B>) */
+    std::atomic<bool> m_isProducing{false};
+
+private:
+
+    std::vector<LogRecord> m_records;
+    size_t m_indexMask{0};
+
+    /** \brief producer (write) and consumer (read) positions, padded onto separate cache lines */
+    char m_tailPadding[64];
+    std::atomic<size_t> m_tail{0};
+    char m_headPadding[64];
+    std::atomic<size_t> m_head{0};
+};
+
+}; //namespace log
+}; //namespace common
+}; //namespace uxas
+
+#endif /* UXAS_COMMON_LOG_LOG_RECORD_RING_BUFFER_H */
@@ -0,0 +1,127 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#ifndef UXAS_COMMON_MPSC_QUEUE_H
+#define UXAS_COMMON_MPSC_QUEUE_H
+
+#include <atomic>
+#include <utility>
+
+namespace uxas
+{
+namespace common
+{
+
+/** \class MpscQueue
+ *
+ * \par Description:
+ * Unbounded, lock-free, multiple-producer single-consumer FIFO queue.
+ * Producers link a new node onto the head with a single atomic exchange;
+ * the consumer unlinks nodes from the tail without synchronization with
+ * other consumers (there must be exactly one consumer thread at a time).
+ *
+ * \par Threading:
+ * <B><i>push</i></B> may be called concurrently from any number of threads.
+ * <B><i>tryPop</i></B> and <B><i>isEmpty</i></B> must only be called by the
+ * single consumer.
+ *
+ * \n
+ */
+template <typename T>
+class MpscQueue final
+{
+private:
+
+    struct Node
+    {
+        Node() { };
+
+        explicit
+        Node(T&& value)
+        : m_value(std::move(value)) { };
+
+        std::atomic<Node*> m_next{nullptr};
+        T m_value;
+    };
+
+public:
+
+    MpscQueue()
+    {
+        Node* stub = new Node();
+        m_head.store(stub);
+        m_tail = stub;
+    };
+
+    ~MpscQueue()
+    {
+        T value;
+        while (tryPop(value))
+        {
+        }
+        delete m_tail;
+    };
+
+private:
+
+    /** \brief Copy construction not permitted */
+    MpscQueue(MpscQueue const&) = delete;
+
+    /** \brief Copy assignment operation not permitted */
+    void operator=(MpscQueue const&) = delete;
+
+public:
+
+    /** \brief Append value to the queue (any thread). */
+    void
+    push(T value)
+    {
+        Node* node = new Node(std::move(value));
+        Node* previous = m_head.exchange(node, std::memory_order_acq_rel);
+        previous->m_next.store(node, std::memory_order_release);
+    };
+
+    /** \brief Remove the oldest value from the queue (consumer thread only).
+     *
+     * @param value receives the removed value.
+     * @return true if a value was removed; false if the queue is empty.
+     */
+    bool
+    tryPop(T& value)
+    {
+        Node* tail = m_tail;
+        Node* next = tail->m_next.load(std::memory_order_acquire);
+        if (next == nullptr)
+        {
+            return (false);
+        }
+        value = std::move(next->m_value);
+        m_tail = next;
+        delete tail;
+        return (true);
+    };
+
+    /** \brief Queue emptiness check (consumer thread only). */
+    bool
+    isEmpty() const
+    {
+        return (m_tail->m_next.load(std::memory_order_acquire) == nullptr);
+    };
+
+private:
+
+    std::atomic<Node*> m_head;
+    Node* m_tail;
+
+};
+
+}; //namespace common
+}; //namespace uxas
+
+#endif /* UXAS_COMMON_MPSC_QUEUE_H */
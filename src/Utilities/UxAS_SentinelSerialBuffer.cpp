@@ -14,6 +14,7 @@
 #include "stdUniquePtr.h"
 #include "UxAS_StringUtil.h"
 
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <queue>
@@ -44,9 +45,14 @@ SentinelSerialBuffer::createSentinelizedString(const std::string& data)
     {
         UXAS_LOG_INFORM(s_typeName(), "::createSentinelizedString creating payload string containing sentinel substrings.  ", detectedSentinelBaseStrings->c_str());
     }
-    return (getSerialSentinelBeforePayloadSize() + std::to_string(data.size())
-             + getSerialSentinelAfterPayloadSize() + data + getSerialSentinelBeforeChecksum()
-             + std::to_string(calculateChecksum(data)) + getSerialSentinelAfterChecksum());
+    std::string payloadSize = std::to_string(data.size());
+    std::string checksum = std::to_string(calculateChecksum(data));
+    std::string sentinelizedString;
+    sentinelizedString.reserve(getSerialSentinelBeforePayloadSizeSize() + payloadSize.size() + getSerialSentinelAfterPayloadSizeSize() + data.size()
+            + getSerialSentinelBeforeChecksumSize() + checksum.size() + getSerialSentinelAfterChecksumSize());
+    sentinelizedString.append(getSerialSentinelBeforePayloadSize()).append(payloadSize).append(getSerialSentinelAfterPayloadSize()).append(data)
+            .append(getSerialSentinelBeforeChecksum()).append(checksum).append(getSerialSentinelAfterChecksum());
+    return (sentinelizedString);
 };
 
 std::unique_ptr<std::string>
@@ -102,143 +108,312 @@ SentinelSerialBuffer::getDetectSentinelBaseStringsMessage(const std::string& dat
     return (detectMsg);
 };
 
-std::string
-SentinelSerialBuffer::getNextPayloadString(const std::string& newDataChunk)
+SentinelSerialBuffer::SentinelMatcher::SentinelMatcher(const std::string& sentinel)
+: m_sentinel(sentinel), m_fallbackCounts(sentinel.size(), 0)
 {
-    UXAS_LOG_DEBUGGING(s_typeName(), "::getNextPayloadString BEFORE appending [newDataChunk]", newDataChunk);
-    UXAS_LOG_DEBUGGING(s_typeName(), "::getNextPayloadString BEFORE append [m_data]", m_data);
-    m_data.append(newDataChunk);
-    UXAS_LOG_DEBUGGING(s_typeName(), "::getNextPayloadString AFTER  append [m_data]", m_data);
-    auto aftChecksum = m_data.find(getSerialSentinelAfterChecksum());
-    if (aftChecksum == std::string::npos)
+    // longest proper prefix that is also a suffix of each sentinel prefix
+    size_t prefixCount{0};
+    for (size_t index = 1; index < m_sentinel.size(); index++)
     {
-        UXAS_LOG_INFORM(s_typeName(), "::getNextPayloadString does not contain complete data segment");
-        return std::string("");
+        while (prefixCount > 0 && m_sentinel[index] != m_sentinel[prefixCount])
+        {
+            prefixCount = m_fallbackCounts[prefixCount - 1];
+        }
+        if (m_sentinel[index] == m_sentinel[prefixCount])
+        {
+            prefixCount++;
+        }
+        m_fallbackCounts[index] = prefixCount;
     }
-    auto inspectLength = aftChecksum + getSerialSentinelAfterChecksumSize();
-    bool isValid{true};
-    auto befChecksum = m_data.rfind(getSerialSentinelBeforeChecksum(), aftChecksum);
-    if (befChecksum == std::string::npos)
+    for (size_t index = 0; index + 1 < m_sentinel.size(); index++)
     {
-        isValid = false;
-        UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString before-checksum marker is missing");
+        m_leadingByteSum += static_cast<uint8_t>(m_sentinel[index]);
     }
-    auto aftPayloadSz = m_data.rfind(getSerialSentinelAfterPayloadSize(), befChecksum);
-    if (aftPayloadSz == std::string::npos)
+};
+
+void
+SentinelSerialBuffer::appendData(const uint8_t* data, size_t size)
+{
+    while (size > 0)
     {
-        isValid = false;
-        UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString after-payload marker is missing");
+        uint8_t* writeBuffer = getWriteBuffer(1);
+        size_t writeIndex = writeBuffer - m_ringBuffer.data();
+        size_t writableCount = (writeIndex < m_ringReadIndex) ? (m_ringReadIndex - writeIndex) : (m_ringBuffer.size() - writeIndex);
+        size_t copyCount = (size < writableCount ? size : writableCount);
+        std::memcpy(writeBuffer, data, copyCount);
+        commitData(copyCount);
+        data += copyCount;
+        size -= copyCount;
     }
-    auto befPayloadSz = m_data.rfind(getSerialSentinelBeforePayloadSize(), aftPayloadSz);
-    if (befPayloadSz == std::string::npos)
+};
+
+uint8_t*
+SentinelSerialBuffer::getWriteBuffer(size_t minimumSize)
+{
+    if (m_ringBuffer.empty())
     {
-        isValid = false;
-        UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString before-payload marker is missing");
+        m_ringBuffer.resize(s_initialRingBufferCapacity);
     }
-    if (!isValid)
+    if (m_ringDataSize == 0)
     {
-        UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString erasing invalid data segment: ", m_data.substr(0, inspectLength));
-        m_data.erase(0, inspectLength);
-        UXAS_LOG_DEBUGGING(s_typeName(), "::getNextPayloadString buffer contents (after erasure): ", m_data);
-        return std::string("");
+        m_ringReadIndex = 0;
     }
 
-    auto totalLen = aftChecksum + getSerialSentinelAfterChecksumSize() - befPayloadSz;
-    std::string wholeStr = m_data.substr(befPayloadSz, totalLen);
-    m_data.erase(befPayloadSz, totalLen);
-    if (befPayloadSz > 0)
+    size_t capacity = m_ringBuffer.size();
+    size_t writeIndex = (m_ringReadIndex + m_ringDataSize) & (capacity - 1);
+    size_t contiguousCount = (writeIndex >= m_ringReadIndex && m_ringDataSize < capacity) ? (capacity - writeIndex) : (m_ringReadIndex - writeIndex);
+    if (contiguousCount < minimumSize)
     {
-        // disregard data and log
-        m_disregardedDataCount++;
-        std::string invalidData = m_data.substr(0, befPayloadSz);
-        m_data.erase(0, befPayloadSz);
-        std::unique_ptr<std::string> detectedSentinelBaseStrings = getDetectSentinelBaseStringsMessage(invalidData);
-        if (detectedSentinelBaseStrings)
+        // re-allocate with the buffered data moved to the front
+        size_t newCapacity = capacity;
+        while (newCapacity < m_ringDataSize + minimumSize)
         {
-            UXAS_LOG_INFORM(s_typeName(), "::getNextPayloadString detected partial sentinel markers in disregarded data: ", detectedSentinelBaseStrings->c_str());
+            newCapacity *= 2;
         }
-        UXAS_LOG_INFORM(s_typeName(), "::getNextPayloadString erased disregarded data from front of data queue: ", invalidData);
-
-        // update indices for use with valid data
-        aftPayloadSz = aftPayloadSz - befPayloadSz;
-        befChecksum = befChecksum - befPayloadSz;
-        aftChecksum = aftChecksum - befPayloadSz;
-        befPayloadSz = 0;
+        std::vector<uint8_t> ringBuffer(newCapacity);
+        size_t firstCount = (m_ringDataSize < capacity - m_ringReadIndex) ? m_ringDataSize : (capacity - m_ringReadIndex);
+        std::memcpy(ringBuffer.data(), m_ringBuffer.data() + m_ringReadIndex, firstCount);
+        std::memcpy(ringBuffer.data() + firstCount, m_ringBuffer.data(), m_ringDataSize - firstCount);
+        m_ringBuffer.swap(ringBuffer);
+        m_ringReadIndex = 0;
+        writeIndex = m_ringDataSize;
     }
+    return (m_ringBuffer.data() + writeIndex);
+};
 
-    std::string payloadSzStr = wholeStr.substr(getSerialSentinelBeforePayloadSizeSize(), aftPayloadSz - getSerialSentinelBeforePayloadSizeSize());
-    UXAS_LOG_DEBUG_VERBOSE(s_typeName(), "::getNextPayloadString payloadSzStr=", payloadSzStr);
-    std::string chksumStr = wholeStr.substr(befChecksum + getSerialSentinelBeforeChecksumSize(), aftChecksum - befChecksum - getSerialSentinelBeforeChecksumSize());
-    UXAS_LOG_DEBUG_VERBOSE(s_typeName(), "::getNextPayloadString chksumStr=", chksumStr);
-    
-    bool isValidPayloadSzStr = true;
-    if (payloadSzStr.find_first_not_of(getValidIntegerDigits()) != std::string::npos)
-    {
-        isValidPayloadSzStr = false;
-        UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString detected invalid payload size string: ", payloadSzStr);
-    }
-    bool isValidChecksumStr = true;
-    if (chksumStr.find_first_not_of(getValidIntegerDigits()) != std::string::npos)
+void
+SentinelSerialBuffer::commitData(size_t size)
+{
+    m_ringDataSize += size;
+};
+
+bool
+SentinelSerialBuffer::getNextPayload(std::string& payload)
+{
+    while (m_ringDataSize > 0)
     {
-        isValidChecksumStr = false;
-        UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString detected invalid checksum string: ", chksumStr);
+        size_t contiguousCount = m_ringBuffer.size() - m_ringReadIndex;
+        if (contiguousCount > m_ringDataSize)
+        {
+            contiguousCount = m_ringDataSize;
+        }
+        size_t scannedCount{0};
+        bool isPayloadCompleted = scanData(m_ringBuffer.data() + m_ringReadIndex, contiguousCount, scannedCount);
+        m_ringReadIndex = (m_ringReadIndex + scannedCount) & (m_ringBuffer.size() - 1);
+        m_ringDataSize -= scannedCount;
+        if (isPayloadCompleted)
+        {
+            payload = std::move(m_payload);
+            m_payload = std::string();
+            return (true);
+        }
     }
+    return (false);
+};
 
-    if (isValidPayloadSzStr && isValidChecksumStr)
+std::string
+SentinelSerialBuffer::getNextPayloadString(const std::string& newDataChunk)
+{
+    appendData(reinterpret_cast<const uint8_t*>(newDataChunk.data()), newDataChunk.size());
+    std::string payload;
+    getNextPayload(payload);
+    return (payload);
+};
+
+bool
+SentinelSerialBuffer::scanData(const uint8_t* data, size_t size, size_t& scannedCount)
+{
+    // start of the bytes of the current chunk that are part of the payload
+    size_t payloadStartIndex{0};
+    for (size_t index = 0; index < size; index++)
     {
-        std::string payload = wholeStr.substr(aftPayloadSz + getSerialSentinelAfterPayloadSizeSize(), befChecksum - aftPayloadSz - getSerialSentinelAfterPayloadSizeSize());
-        UXAS_LOG_DEBUG_VERBOSE(s_typeName(), "::getNextPayloadString payload=", payload);
+        uint8_t byte = data[index];
 
-        if (static_cast<int>(payload.size()) == std::stoi(payloadSzStr))
+        // a before-payload-size sentinel always starts a new frame
+        if (m_beforePayloadSizeMatcher.isMatchCompleted(byte))
         {
-            uint32_t calcChksum = calculateChecksum(payload);
-            if (static_cast<int>(calcChksum) == std::stoi(chksumStr))
+            if (m_frameState != FrameState::SEEK_FRAME || m_seekByteCount + 1 > getSerialSentinelBeforePayloadSizeSize())
             {
-                m_validDeserializeCount++;
-                UXAS_LOG_DEBUGGING(s_typeName(), "::getNextPayloadString m_validDeserializeCount=", m_validDeserializeCount);
-                UXAS_LOG_DEBUGGING(s_typeName(), "::getNextPayloadString m_invalidDeserializeCount=", m_invalidDeserializeCount);
-                return payload;
+                m_disregardedDataCount++;
+                UXAS_LOG_INFORM(s_typeName(), "::getNextPayloadString disregarded data preceding before-payload-size marker (m_disregardedDataCount=", m_disregardedDataCount, ")");
             }
-            else
+            startFrame();
+            continue;
+        }
+
+        // an after-checksum sentinel always ends a frame
+        bool isAfterChecksum = m_afterChecksumMatcher.isMatchCompleted(byte);
+        if (isAfterChecksum && m_frameState != FrameState::CHECKSUM)
+        {
+            if (m_frameState != FrameState::SEEK_FRAME)
             {
                 m_invalidDeserializeCount++;
-                UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString ignoring invalid data segment since calculated checksum=", calcChksum, " does not equal chksumStr=", chksumStr, " for payload=", payload);
+                UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString erasing invalid data segment since markers are missing (m_invalidDeserializeCount=", m_invalidDeserializeCount, ")");
             }
+            discardFrame();
+            continue;
         }
-        else
+
+        switch (m_frameState)
         {
-            m_invalidDeserializeCount++;
-            UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString ignoring invalid data segment since calculated payload size=", payload.size(), " does not equal payloadSzStr=", payloadSzStr, " for payload=", payload);
+            case FrameState::SEEK_FRAME:
+                m_seekByteCount++;
+                break;
+
+            case FrameState::PAYLOAD_SIZE:
+                if (m_afterPayloadSizeMatcher.isMatchCompleted(byte))
+                {
+                    m_payloadSizeString.resize(m_payloadSizeString.size() - (getSerialSentinelAfterPayloadSizeSize() - 1));
+                    if (!parseUnsignedInteger(m_payloadSizeString, m_payloadSize))
+                    {
+                        m_invalidDeserializeCount++;
+                        UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString detected invalid payload size string: ", m_payloadSizeString);
+                        discardFrame();
+                        break;
+                    }
+                    m_payload.clear();
+                    if (m_payloadSize <= s_maximumPayloadReserveSize)
+                    {
+                        m_payload.reserve(m_payloadSize + getSerialSentinelBeforeChecksumSize());
+                    }
+                    m_checksum = 0;
+                    m_beforeChecksumMatcher.reset();
+                    m_frameState = FrameState::PAYLOAD;
+                    payloadStartIndex = index + 1;
+                }
+                else if (m_payloadSizeString.size() < s_maximumDigitCount + getSerialSentinelAfterPayloadSizeSize())
+                {
+                    m_payloadSizeString.push_back(static_cast<char>(byte));
+                }
+                else
+                {
+                    m_invalidDeserializeCount++;
+                    UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString erasing invalid data segment since after-payload marker is missing");
+                    discardFrame();
+                }
+                break;
+
+            case FrameState::PAYLOAD:
+                if (m_beforeChecksumMatcher.isMatchCompleted(byte))
+                {
+                    m_payload.append(reinterpret_cast<const char*>(data + payloadStartIndex), index - payloadStartIndex);
+                    // remove the leading sentinel bytes already added to the payload
+                    m_payload.resize(m_payload.size() - (getSerialSentinelBeforeChecksumSize() - 1));
+                    m_checksum -= m_beforeChecksumMatcher.m_leadingByteSum;
+                    m_checksumString.clear();
+                    m_afterChecksumMatcher.reset();
+                    m_frameState = FrameState::CHECKSUM;
+                }
+                else
+                {
+                    m_checksum += byte;
+                    if (m_payload.size() + (index + 1 - payloadStartIndex) > m_payloadSize + getSerialSentinelBeforeChecksumSize())
+                    {
+                        m_invalidDeserializeCount++;
+                        UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString erasing invalid data segment since payload exceeds payload size=", m_payloadSize);
+                        discardFrame();
+                    }
+                }
+                break;
+
+            case FrameState::CHECKSUM:
+                if (isAfterChecksum)
+                {
+                    m_checksumString.resize(m_checksumString.size() - (getSerialSentinelAfterChecksumSize() - 1));
+                    scannedCount = index + 1;
+                    return (completeFrame());
+                }
+                else if (m_checksumString.size() < s_maximumDigitCount + getSerialSentinelAfterChecksumSize())
+                {
+                    m_checksumString.push_back(static_cast<char>(byte));
+                }
+                else
+                {
+                    m_invalidDeserializeCount++;
+                    UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString erasing invalid data segment since after-checksum marker is missing");
+                    discardFrame();
+                }
+                break;
         }
     }
-    else
+
+    if (m_frameState == FrameState::PAYLOAD)
     {
-        m_invalidDeserializeCount++;
-        UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString ignoring invalid data segment having invalid ", 
-                 (!isValidPayloadSzStr && !isValidChecksumStr ? "payload size and checksum strings" 
-                : (isValidPayloadSzStr ? "payload size string" : "checksum string")));
+        m_payload.append(reinterpret_cast<const char*>(data + payloadStartIndex), size - payloadStartIndex);
     }
+    scannedCount = size;
+    return (false);
+};
 
-    UXAS_LOG_DEBUGGING(s_typeName(), "::getNextPayloadString m_validDeserializeCount=", m_validDeserializeCount);
-    if (m_invalidDeserializeCount < 1)
+void
+SentinelSerialBuffer::startFrame()
+{
+    m_frameState = FrameState::PAYLOAD_SIZE;
+    m_seekByteCount = 0;
+    m_payloadSizeString.clear();
+    m_payload.clear();
+    m_afterPayloadSizeMatcher.reset();
+    m_afterChecksumMatcher.reset();
+};
+
+void
+SentinelSerialBuffer::discardFrame()
+{
+    m_frameState = FrameState::SEEK_FRAME;
+    m_seekByteCount = 0;
+    m_payload.clear();
+    m_beforePayloadSizeMatcher.reset();
+    m_afterChecksumMatcher.reset();
+};
+
+bool
+SentinelSerialBuffer::completeFrame()
+{
+    m_frameState = FrameState::SEEK_FRAME;
+    m_seekByteCount = 0;
+    m_beforePayloadSizeMatcher.reset();
+
+    uint64_t checksum{0};
+    if (!parseUnsignedInteger(m_checksumString, checksum))
     {
-        UXAS_LOG_DEBUGGING(s_typeName(), "::getNextPayloadString m_invalidDeserializeCount=", m_invalidDeserializeCount);
+        m_invalidDeserializeCount++;
+        UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString detected invalid checksum string: ", m_checksumString);
     }
-    else
+    else if (m_payload.size() != m_payloadSize)
     {
-        UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString m_invalidDeserializeCount=", m_invalidDeserializeCount);
+        m_invalidDeserializeCount++;
+        UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString ignoring invalid data segment since calculated payload size=", m_payload.size(), " does not equal payloadSzStr=", m_payloadSizeString);
     }
-    
-    if (m_disregardedDataCount < 1)
+    else if (m_checksum != checksum)
     {
-        UXAS_LOG_DEBUGGING(s_typeName(), "::getNextPayloadString m_disregardedDataCount=", m_disregardedDataCount);
+        m_invalidDeserializeCount++;
+        UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString ignoring invalid data segment since calculated checksum=", m_checksum, " does not equal chksumStr=", m_checksumString);
     }
     else
     {
-        UXAS_LOG_INFORM(s_typeName(), "::getNextPayloadString m_disregardedDataCount=", m_disregardedDataCount);
+        m_validDeserializeCount++;
+        UXAS_LOG_DEBUGGING(s_typeName(), "::getNextPayloadString m_validDeserializeCount=", m_validDeserializeCount);
+        return (true);
     }
 
-    return std::string("");
+    m_payload.clear();
+    UXAS_LOG_WARN(s_typeName(), "::getNextPayloadString m_invalidDeserializeCount=", m_invalidDeserializeCount);
+    return (false);
+};
+
+bool
+SentinelSerialBuffer::parseUnsignedInteger(const std::string& digits, uint64_t& value)
+{
+    if (digits.empty() || digits.size() > s_maximumDigitCount || digits.find_first_not_of(getValidIntegerDigits()) != std::string::npos)
+    {
+        return (false);
+    }
+    value = 0;
+    for (char digit : digits)
+    {
+        value = value * 10 + static_cast<uint64_t>(digit - '0');
+    }
+    return (true);
 };
 
 }; //namespace common
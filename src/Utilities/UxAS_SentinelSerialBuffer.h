@@ -10,14 +10,29 @@
 #ifndef UXAS_COMMON_SENTINEL_SERIAL_BUFFER_H
 #define UXAS_COMMON_SENTINEL_SERIAL_BUFFER_H
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace uxas
 {
 namespace common
 {
 
+/** \class SentinelSerialBuffer
+ * 
+ * \par Description:
+ * Extracts sentinelized payloads (see <B><i>createSentinelizedString</i></B>) 
+ * from a byte stream (e.g., TCP or serial data) received in arbitrary chunks.
+ * 
+ * Received data is held in a ring buffer. Framing is incremental: each byte 
+ * is scanned once, the sentinel match state, payload size and running checksum 
+ * of the frame being received are retained between calls and the payload is 
+ * assembled directly into the returned string. 
+ * 
+ * \n
+ */
 class SentinelSerialBuffer
 {
 public:
@@ -118,7 +133,45 @@ public:
     static std::unique_ptr<std::string>
     getDetectSentinelBaseStringsMessage(const std::string& data);
 
+    /** \brief Copy received data into the ring buffer.
+     * 
+     * @param data received data
+     * @param size number of received bytes
+     */
+    void
+    appendData(const uint8_t* data, size_t size);
+
+    /** \brief Contiguous writable region of the ring buffer for reading 
+     * directly from a device (e.g., serial port). The ring buffer grows if 
+     * necessary. Must be followed by <B><i>commitData</i></B>.
+     * 
+     * @param minimumSize minimum number of writable bytes
+     * @return start of the writable region
+     */
+    uint8_t*
+    getWriteBuffer(size_t minimumSize);
+
+    /** \brief Add bytes written to the region returned by 
+     * <B><i>getWriteBuffer</i></B> to the ring buffer.
+     * 
+     * @param size number of bytes written
+     */
+    void
+    commitData(size_t size);
+
+    /** \brief Scan buffered data (continuing from the previous call) until 
+     * the next valid payload is complete. Invalid data segments are discarded.
+     * 
+     * multi-thread safety not implemented
+     * @param payload set to the next valid payload
+     * @return true if a payload was extracted
+     */
+    bool
+    getNextPayload(std::string& payload);
+
     /**
+     * Appends the new data chunk (see <B><i>appendData</i></B>) and returns 
+     * the next valid payload (empty string if none is complete).
      * multi-thread safety not implemented
      * @param data
      * @return 
@@ -126,10 +179,104 @@ public:
     std::string
     getNextPayloadString(const std::string& newDataChunk);
     
-    std::string m_data;
     uint32_t m_validDeserializeCount{0};
     uint32_t m_invalidDeserializeCount{0};
     uint32_t m_disregardedDataCount{0};
+
+private:
+
+    enum class FrameState
+    {
+        /** \brief disregarding data until the before-payload-size sentinel */
+        SEEK_FRAME,
+        PAYLOAD_SIZE,
+        PAYLOAD,
+        CHECKSUM
+    };
+
+    /** \brief Incremental (Knuth-Morris-Pratt) sentinel match state */
+    class SentinelMatcher
+    {
+    public:
+
+        explicit SentinelMatcher(const std::string& sentinel);
+
+        /** \brief Advance the match state by one byte.
+         * @return true if the byte completes the sentinel
+         */
+        bool
+        isMatchCompleted(uint8_t byte)
+        {
+            while (m_matchedCount > 0 && byte != m_sentinel[m_matchedCount])
+            {
+                m_matchedCount = m_fallbackCounts[m_matchedCount - 1];
+            }
+            if (byte == m_sentinel[m_matchedCount])
+            {
+                m_matchedCount++;
+            }
+            if (m_matchedCount == m_sentinel.size())
+            {
+                m_matchedCount = m_fallbackCounts[m_matchedCount - 1];
+                return (true);
+            }
+            return (false);
+        };
+
+        void
+        reset() { m_matchedCount = 0; };
+
+        /** \brief sum of the byte values of all but the last sentinel byte */
+        uint32_t m_leadingByteSum{0};
+
+    private:
+
+        std::string m_sentinel;
+        std::vector<size_t> m_fallbackCounts;
+        size_t m_matchedCount{0};
+    };
+
+    bool
+    scanData(const uint8_t* data, size_t size, size_t& scannedCount);
+
+    void
+    startFrame();
+
+    void
+    discardFrame();
+
+    bool
+    completeFrame();
+
+    static bool
+    parseUnsignedInteger(const std::string& digits, uint64_t& value);
+
+    /** \brief initial ring buffer capacity (power of 2) */
+    static const size_t s_initialRingBufferCapacity{65536};
+
+    /** \brief maximum number of digits of payload size and checksum strings */
+    static const size_t s_maximumDigitCount{20};
+
+    /** \brief maximum payload size for which payload storage is reserved up front */
+    static const size_t s_maximumPayloadReserveSize{64 * 1024 * 1024};
+
+    /** \brief ring buffer of received, not yet scanned data (capacity is a power of 2) */
+    std::vector<uint8_t> m_ringBuffer;
+    size_t m_ringReadIndex{0};
+    size_t m_ringDataSize{0};
+
+    FrameState m_frameState{FrameState::SEEK_FRAME};
+    size_t m_seekByteCount{0};
+    std::string m_payloadSizeString;
+    uint64_t m_payloadSize{0};
+    std::string m_payload;
+    uint32_t m_checksum{0};
+    std::string m_checksumString;
+
+    SentinelMatcher m_beforePayloadSizeMatcher{getSerialSentinelBeforePayloadSize()};
+    SentinelMatcher m_afterPayloadSizeMatcher{getSerialSentinelAfterPayloadSize()};
+    SentinelMatcher m_beforeChecksumMatcher{getSerialSentinelBeforeChecksum()};
+    SentinelMatcher m_afterChecksumMatcher{getSerialSentinelAfterChecksum()};
     
 };
 
@@ -0,0 +1,257 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#include "UxAS_WorkerPoolExecutor.h"
+
+#include "UxAS_ConfigurationManager.h"
+#include "UxAS_Log.h"
+
+#include "stdUniquePtr.h"
+
+#include <algorithm>
+#include <exception>
+
+namespace uxas
+{
+namespace common
+{
+
+void
+WorkerPoolExecutor::Strand::post(std::function<void()> task)
+{
+    m_tasks.push(std::move(task));
+    if (m_pendingTaskCount.fetch_add(1, std::memory_order_acq_rel) == 0)
+    {
+        auto self = shared_from_this();
+        m_executor.submit([self]() { self->run(); });
+    }
+};
+
+void
+WorkerPoolExecutor::Strand::run()
+{
+    for (uint32_t taskCount = 0; taskCount < s_maxTasksPerRun; taskCount++)
+    {
+        std::function<void()> task;
+        while (!m_tasks.tryPop(task))
+        {
+            // counted task is still being linked by its producer
+            std::this_thread::yield();
+        }
+
+        try
+        {
+            task();
+        }
+        catch (std::exception& ex)
+        {
+            UXAS_LOG_ERROR("WorkerPoolExecutor::Strand::run continuing after task EXCEPTION: ", ex.what());
+        }
+
+        if (m_pendingTaskCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            return;
+        }
+    }
+
+    // tasks remain - re-submit (retaining strand ownership) so other strands get a turn
+    auto self = shared_from_this();
+    m_executor.submit([self]() { self->run(); });
+};
+
+std::unique_ptr<WorkerPoolExecutor> WorkerPoolExecutor::s_instance = nullptr;
+
+thread_local int32_t WorkerPoolExecutor::s_workerIndex{-1};
+
+WorkerPoolExecutor&
+WorkerPoolExecutor::getInstance()
+{
+    // first time/one time creation (services may call this from their own threads)
+    static std::once_flag s_createOnceFlag;
+    std::call_once(s_createOnceFlag, []()
+    {
+        uint32_t workerCount = ConfigurationManager::getWorkerPoolThreadCount();
+        if (workerCount == 0)
+        {
+            workerCount = std::thread::hardware_concurrency();
+        }
+        s_instance.reset(new WorkerPoolExecutor(workerCount > 0 ? workerCount : 1));
+    });
+    return *s_instance;
+};
+
+WorkerPoolExecutor::WorkerPoolExecutor(uint32_t workerCount)
+{
+    for (uint32_t workerIndex = 0; workerIndex < workerCount; workerIndex++)
+    {
+        m_workerQueues.push_back(uxas::stduxas::make_unique<WorkerQueue>());
+    }
+    for (uint32_t workerIndex = 0; workerIndex < workerCount; workerIndex++)
+    {
+        m_workers.emplace_back(&WorkerPoolExecutor::executeWorker, this, workerIndex);
+    }
+    UXAS_LOG_INFORM("WorkerPoolExecutor started [", workerCount, "] worker threads");
+};
+
+WorkerPoolExecutor::~WorkerPoolExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_idleMutex);
+        m_isTerminate = true;
+    }
+    m_idleCondition.notify_all();
+    for (auto& worker : m_workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+};
+
+void
+WorkerPoolExecutor::parallelFor(uint32_t count, const std::function<void(uint32_t)>& work)
+{
+    struct ParallelForState
+    {
+        const std::function<void(uint32_t)>* m_work{nullptr};
+        uint32_t m_count{0};
+        std::atomic<uint32_t> m_nextIndex{0};
+        std::atomic<uint32_t> m_completedCount{0};
+        std::mutex m_mutex;
+        std::condition_variable m_completedCondition;
+    };
+
+    if (count == 0)
+    {
+        return;
+    }
+    // helpers that start after all indices are taken return without touching "work",
+    // the state outlives this call for them
+    auto state = std::make_shared<ParallelForState>();
+    state->m_work = &work;
+    state->m_count = count;
+    auto executeIndices = [state]()
+    {
+        uint32_t index;
+        while ((index = state->m_nextIndex.fetch_add(1)) < state->m_count)
+        {
+            try
+            {
+                (*state->m_work)(index);
+            }
+            catch (std::exception& ex)
+            {
+                UXAS_LOG_ERROR("WorkerPoolExecutor::parallelFor continuing after task EXCEPTION: ", ex.what());
+            }
+            if (state->m_completedCount.fetch_add(1) + 1 == state->m_count)
+            {
+                std::lock_guard<std::mutex> lock(state->m_mutex);
+                state->m_completedCondition.notify_all();
+            }
+        }
+    };
+
+    uint32_t helperCount = std::min(count, getWorkerCount()) - 1;
+    for (uint32_t helper = 0; helper < helperCount; helper++)
+    {
+        submit(executeIndices);
+    }
+    executeIndices();
+
+    std::unique_lock<std::mutex> lock(state->m_mutex);
+    state->m_completedCondition.wait(lock, [&state]() { return (state->m_completedCount.load() == state->m_count); });
+};
+
+std::shared_ptr<WorkerPoolExecutor::Strand>
+WorkerPoolExecutor::createStrand()
+{
+    return (std::make_shared<Strand>(*this));
+};
+
+void
+WorkerPoolExecutor::submit(std::function<void()> task)
+{
+    uint32_t queueIndex = (s_workerIndex >= 0)
+            ? static_cast<uint32_t>(s_workerIndex)
+            : (m_nextQueueIndex.fetch_add(1, std::memory_order_relaxed) % m_workerQueues.size());
+    {
+        std::lock_guard<std::mutex> lock(m_workerQueues[queueIndex]->m_mutex);
+        m_workerQueues[queueIndex]->m_tasks.push_back(std::move(task));
+    }
+
+    // sequentially consistent count/idle updates pair with those in executeWorker
+    // so that a submitted task is never left unseen by a sleeping worker
+    m_queuedTaskCount.fetch_add(1);
+    if (m_idleWorkerCount.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_idleMutex);
+        m_idleCondition.notify_one();
+    }
+};
+
+bool
+WorkerPoolExecutor::tryTakeTask(uint32_t workerIndex, std::function<void()>& task)
+{
+    // own deque first (oldest task keeps strand re-submissions fair) ...
+    {
+        std::lock_guard<std::mutex> lock(m_workerQueues[workerIndex]->m_mutex);
+        if (!m_workerQueues[workerIndex]->m_tasks.empty())
+        {
+            task = std::move(m_workerQueues[workerIndex]->m_tasks.front());
+            m_workerQueues[workerIndex]->m_tasks.pop_front();
+            return (true);
+        }
+    }
+
+    // ... then steal from the back of the other deques
+    for (size_t offset = 1; offset < m_workerQueues.size(); offset++)
+    {
+        auto& victim = m_workerQueues[(workerIndex + offset) % m_workerQueues.size()];
+        std::lock_guard<std::mutex> lock(victim->m_mutex);
+        if (!victim->m_tasks.empty())
+        {
+            task = std::move(victim->m_tasks.back());
+            victim->m_tasks.pop_back();
+            return (true);
+        }
+    }
+    return (false);
+};
+
+void
+WorkerPoolExecutor::executeWorker(uint32_t workerIndex)
+{
+    s_workerIndex = static_cast<int32_t>(workerIndex);
+    while (!m_isTerminate)
+    {
+        std::function<void()> task;
+        if (tryTakeTask(workerIndex, task))
+        {
+            m_queuedTaskCount.fetch_sub(1);
+            try
+            {
+                task();
+            }
+            catch (std::exception& ex)
+            {
+                UXAS_LOG_ERROR("WorkerPoolExecutor::executeWorker continuing after task EXCEPTION: ", ex.what());
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_idleMutex);
+        m_idleWorkerCount.fetch_add(1);
+        m_idleCondition.wait(lock, [this]() { return (m_isTerminate || m_queuedTaskCount.load() > 0); });
+        m_idleWorkerCount.fetch_sub(1);
+    }
+};
+
+}; //namespace common
+}; //namespace uxas
@@ -0,0 +1,172 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+#ifndef UXAS_COMMON_WORKER_POOL_EXECUTOR_H
+#define UXAS_COMMON_WORKER_POOL_EXECUTOR_H
+
+#include "UxAS_MpscQueue.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace uxas
+{
+namespace common
+{
+
+/** \class WorkerPoolExecutor
+ *
+ * \par Description:
+ * Fixed-size, work-stealing thread pool shared by all network clients that
+ * are configured for worker pool execution. Each worker owns a task deque;
+ * tasks submitted by a worker go to its own deque, tasks submitted by other
+ * threads are distributed round-robin. Idle workers steal from the other
+ * deques before sleeping.
+ *
+ * \par Strands:
+ * A <B><i>Strand</i></B> serializes the tasks posted to it - at most one of
+ * its tasks executes at a time and tasks execute in posting order - while
+ * different strands execute concurrently on the pool.
+ *
+ * \par Singleton pattern
+ *
+ * \n
+ */
+class WorkerPoolExecutor final
+{
+public:
+
+    /** \class Strand
+     *
+     * \par Description:
+     * Ordered, non-concurrent task sequence executed on the worker pool.
+     *
+     * \n
+     */
+    class Strand final : public std::enable_shared_from_this<Strand>
+    {
+    public:
+
+        explicit
+        Strand(WorkerPoolExecutor& executor)
+        : m_executor(executor) { };
+
+    private:
+
+        /** \brief Copy construction not permitted */
+        Strand(Strand const&) = delete;
+
+        /** \brief Copy assignment operation not permitted */
+        void operator=(Strand const&) = delete;
+
+    public:
+
+        /** \brief Append a task to the strand (any thread). */
+        void
+        post(std::function<void()> task);
+
+        /** \brief Strand idle check.
+         *
+         * @return true if no task is queued or executing; false otherwise.
+         */
+        bool
+        isIdle() const { return (m_pendingTaskCount.load(std::memory_order_acquire) == 0); };
+
+    private:
+
+        void
+        run();
+
+        /** \brief maximum tasks executed before the worker is yielded to other strands */
+        static const uint32_t s_maxTasksPerRun{64};
+
+        WorkerPoolExecutor& m_executor;
+        MpscQueue< std::function<void()> > m_tasks;
+        std::atomic<uint32_t> m_pendingTaskCount{0};
+    };
+
+    static WorkerPoolExecutor&
+    getInstance();
+
+    ~WorkerPoolExecutor();
+
+private:
+
+    /** \brief Public, direct construction not permitted (singleton pattern) */
+    explicit
+    WorkerPoolExecutor(uint32_t workerCount);
+
+    /** \brief Copy construction not permitted */
+    WorkerPoolExecutor(WorkerPoolExecutor const&) = delete;
+
+    /** \brief Copy assignment operation not permitted */
+    void operator=(WorkerPoolExecutor const&) = delete;
+
+public:
+
+    /** \brief Create a strand that executes on this pool. */
+    std::shared_ptr<Strand>
+    createStrand();
+
+    /** \brief Submit a task for execution by any worker (any thread). */
+    void
+    submit(std::function<void()> task);
+
+    /** \brief Execute work(index) for each index in [0, count) on the pool and
+     * wait for completion. The calling thread also executes indices, so
+     * the call completes even when all workers are busy (e.g. when called
+     * from a pool task).
+     */
+    void
+    parallelFor(uint32_t count, const std::function<void(uint32_t)>& work);
+
+    uint32_t
+    getWorkerCount() const { return (static_cast<uint32_t>(m_workers.size())); };
+
+private:
+
+    struct WorkerQueue
+    {
+        std::mutex m_mutex;
+        std::deque< std::function<void()> > m_tasks;
+    };
+
+    void
+    executeWorker(uint32_t workerIndex);
+
+    bool
+    tryTakeTask(uint32_t workerIndex, std::function<void()>& task);
+
+    static std::unique_ptr<WorkerPoolExecutor> s_instance;
+
+    /** \brief index of the pool worker running on the current thread (-1 if not a worker) */
+    static thread_local int32_t s_workerIndex;
+
+    std::vector< std::unique_ptr<WorkerQueue> > m_workerQueues;
+    std::vector<std::thread> m_workers;
+    std::atomic<uint32_t> m_nextQueueIndex{0};
+    std::atomic<int32_t> m_queuedTaskCount{0};
+    std::atomic<uint32_t> m_idleWorkerCount{0};
+    std::atomic<bool> m_isTerminate{false};
+    std::mutex m_idleMutex;
+    std::condition_variable m_idleCondition;
+
+};
+
+}; //namespace common
+}; //namespace uxas
+
+#endif /* UXAS_COMMON_WORKER_POOL_EXECUTOR_H */
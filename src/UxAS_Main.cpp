@@ -267,6 +267,9 @@ main(int argc, char** argv)
     networkServer.reset();
     uxas::communications::transport::ZeroMqFabric::Destroy();
 
+    // output buffered (asynchronous) log statements
+    uxas::common::log::LogManager::getInstance().stopAsyncLogging();
+
     std::cout << std::endl;
     std::cout << "***************************************************" << std::endl;
     std::cout << "****** UxAS is Shutting Down immediately !!! ******" << std::endl;
@@ -0,0 +1,180 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * Converts a MessageLoggerDataService binary message log (LogFormat="Binary")
+ * to the SQLite database form of the service "Database" log format (table
+ * "msg") and, optionally, to a text file of message attributes and XML.
+ *
+ * Usage: UxASMessageLogConverter -logPath <binary log path prefix>
+ *          [-outPath <output path prefix>] [-messageType <descriptor>]
+ *          [-startTime_ms <time>] [-endTime_ms <time>] [-xml]
+ *
+ * Example: UxASMessageLogConverter -logPath ./datawork/SavedMessages/messageLog
+ */
+
+#include "BinaryMessageLog.h"
+#include "LmcpObjectMessageReceiverPipe.h"
+
+#include "UxAS_DatabaseLogger.h"
+#include "UxAS_Log.h"
+#include "UxAS_LogManagerDefaultInitializer.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#define ARG_LOG_PATH "-logPath"
+#define ARG_OUT_PATH "-outPath"
+#define ARG_MESSAGE_TYPE "-messageType"
+#define ARG_START_TIME "-startTime_ms"
+#define ARG_END_TIME "-endTime_ms"
+#define ARG_XML "-xml"
+
+int
+main(int argc, char** argv)
+{
+    std::string logPath;
+    std::string outPath;
+    std::string messageType;
+    int64_t startTime_ms{INT64_MIN};
+    int64_t endTime_ms{INT64_MAX};
+    bool isXmlTextOutput{false};
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool isValueArgument = (i + 1 < argc);
+        if (strcmp((const char *) argv[i], ARG_LOG_PATH) == 0 && isValueArgument)
+        {
+            logPath = std::string(argv[++i]);
+        }
+        else if (strcmp((const char *) argv[i], ARG_OUT_PATH) == 0 && isValueArgument)
+        {
+            outPath = std::string(argv[++i]);
+        }
+        else if (strcmp((const char *) argv[i], ARG_MESSAGE_TYPE) == 0 && isValueArgument)
+        {
+            messageType = std::string(argv[++i]);
+        }
+        else if (strcmp((const char *) argv[i], ARG_START_TIME) == 0 && isValueArgument)
+        {
+            startTime_ms = std::stoll(argv[++i]);
+        }
+        else if (strcmp((const char *) argv[i], ARG_END_TIME) == 0 && isValueArgument)
+        {
+            endTime_ms = std::stoll(argv[++i]);
+        }
+        else if (strcmp((const char *) argv[i], ARG_XML) == 0)
+        {
+            isXmlTextOutput = true;
+        }
+        else
+        {
+            std::cerr << "Unrecognized argument " << argv[i] << std::endl;
+            std::cerr.flush();
+            return -1;
+        }
+    }
+
+    if (logPath.empty())
+    {
+        std::cerr << "Usage: " << argv[0] << " " << ARG_LOG_PATH << " <binary log path prefix> [" << ARG_OUT_PATH << " <output path prefix>] ["
+                << ARG_MESSAGE_TYPE << " <descriptor>] [" << ARG_START_TIME << " <time>] [" << ARG_END_TIME << " <time>] [" << ARG_XML << "]" << std::endl;
+        return -1;
+    }
+    if (outPath.empty())
+    {
+        outPath = logPath;
+    }
+
+    uxas::common::log::LogManagerDefaultInitializer::initializeConsoleLogger();
+
+    uxas::communications::data::BinaryMessageLogReader binaryLogReader;
+    if (!binaryLogReader.open(logPath))
+    {
+        UXAS_LOG_ERROR("UxAS_MessageLogConverter failed to open binary message log [", logPath, "]");
+        return -1;
+    }
+    binaryLogReader.setTimeRange(startTime_ms, endTime_ms);
+    binaryLogReader.setMessageType(messageType);
+
+    // same table as MessageLoggerDataService "Database" log format
+    std::string dbTableCreate{"CREATE TABLE msg ("};
+    dbTableCreate.append("id INTEGER PRIMARY KEY");
+    dbTableCreate.append(", time_ms INTEGER NOT NULL");
+    dbTableCreate.append(", descriptor TEXT NOT NULL");
+    dbTableCreate.append(", groupID TEXT NOT NULL");
+    dbTableCreate.append(", entityID INTEGER NOT NULL");
+    dbTableCreate.append(", serviceID INTEGER NOT NULL");
+    dbTableCreate.append(", xml BLOB NOT NULL)");
+
+    uxas::common::log::DatabaseLogger databaseLogger;
+    std::string dbFilePath;
+    if (!databaseLogger.configure(outPath, false, false, UINT32_MAX)
+            || !databaseLogger.configureDatabase(dbTableCreate, "msg", "time_ms,descriptor,groupID,entityID,serviceID,xml")
+            || !databaseLogger.openStream(dbFilePath))
+    {
+        UXAS_LOG_ERROR("UxAS_MessageLogConverter failed to open database [", outPath, "]");
+        return -1;
+    }
+
+    std::ofstream xmlTextStream;
+    if (isXmlTextOutput)
+    {
+        xmlTextStream.open(outPath + ".txt", std::ofstream::out | std::ofstream::trunc);
+        if (!xmlTextStream.is_open())
+        {
+            UXAS_LOG_ERROR("UxAS_MessageLogConverter failed to open text file [", outPath, ".txt]");
+            return -1;
+        }
+    }
+
+    uint64_t convertedMessageCount{0};
+    uint64_t failedMessageCount{0};
+    uxas::communications::data::BinaryMessageLogReader::Record record;
+    while (binaryLogReader.readNext(record))
+    {
+        std::unique_ptr<avtas::lmcp::Object> lmcpObject = uxas::communications::LmcpObjectMessageReceiverPipe::deserializeMessage(record.m_message->getPayloadView());
+        if (!lmcpObject)
+        {
+            failedMessageCount++;
+            continue;
+        }
+        std::string xml = lmcpObject->toXML();
+        const std::unique_ptr<uxas::communications::data::MessageAttributes>& attributes = record.m_message->getMessageAttributesReference();
+
+        if (isXmlTextOutput)
+        {
+            xmlTextStream << record.m_time_ms << " " << attributes->getString() << "\n" << xml << "\n";
+        }
+
+        std::vector<std::string> rowValues;
+        rowValues.reserve(6);
+        rowValues.push_back(std::to_string(record.m_time_ms));
+        rowValues.push_back(attributes->getDescriptor());
+        rowValues.push_back(attributes->getSourceGroup());
+        rowValues.push_back(attributes->getSourceEntityId());
+        rowValues.push_back(attributes->getSourceServiceId());
+        rowValues.push_back(std::move(xml));
+        databaseLogger.outputRowToStream(std::move(rowValues));
+        convertedMessageCount++;
+    }
+
+    databaseLogger.closeStream();
+    UXAS_LOG_INFORM("UxAS_MessageLogConverter converted ", convertedMessageCount, " messages of [", logPath, "] to [", dbFilePath, "]");
+    if (failedMessageCount > 0)
+    {
+        UXAS_LOG_WARN("UxAS_MessageLogConverter failed to de-serialize ", failedMessageCount, " messages");
+    }
+
+    return 0;
+}
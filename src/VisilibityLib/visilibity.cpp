@@ -40,7 +40,9 @@ License along with VisiLibity.  If not, see <http://www.gnu.org/licenses/>.
 #include <set>           //priority queues with iteration,
                          //integrated keys
 #include <list>
+#include <map>
 #include <algorithm>     //sorting, min, max, reverse
+#include <functional>    //greater
 #include <cstdlib>       //rand and srand
 #include <ctime>         //Unix time
 #include <fstream>       //file I/O
@@ -53,10 +55,24 @@ License along with VisiLibity.  If not, see <http://www.gnu.org/licenses/>.
 #include "boost/geometry/algorithms/is_valid.hpp"
 #include "boost/geometry/algorithms/validity_failure_type.hpp"
 
+#if defined(_MSC_VER)
+#include <intrin.h>      //_BitScanForward64
+#endif
+
 ///Hide helping functions in unnamed namespace (local to .C file).
 namespace
 {
-  
+  //index of the lowest set bit of a nonzero word
+  inline unsigned lowest_set_bit(uint64_t word)
+  {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#endif
+  }
 }
 
 
@@ -2409,7 +2425,7 @@ namespace VisiLibity
   Polyline Environment::shortest_path(const Point& start,
                       const Point& finish,
                       const Visibility_Graph& visibility_graph,
-                      double epsilon)
+                      double epsilon) const
   {
     //true  => data printed to terminal
     //false => silent
@@ -2434,235 +2450,104 @@ namespace VisiLibity
     Visibility_Polygon finish_visibility_polygon(finish, *this, epsilon);
 
     //Connect start and finish Points to the visibility graph
-    bool *start_visible;  //start row of visibility graph
-    bool *finish_visible; //finish row of visibility graph
-    start_visible = new bool[n()];
-    finish_visible = new bool[n()];
+    std::vector<bool> start_visible( n(), false );  //start row of visibility graph
+    std::vector<bool> finish_visible( n(), false ); //finish row of visibility graph
+    //vertices outside of a bounding box cannot be in its polygon
+    Bounding_Box start_box = start_visibility_polygon.bbox();
+    Bounding_Box finish_box = finish_visibility_polygon.bbox();
+    auto in_box = [epsilon](const Point& point, const Bounding_Box& box)
+    {
+      return point.x() >= box.x_min - epsilon and point.x() <= box.x_max + epsilon
+        and point.y() >= box.y_min - epsilon and point.y() <= box.y_max + epsilon;
+    };
     for(unsigned k=0; k<n(); k++){
-      if(  (*this)(k).in( start_visibility_polygon , epsilon )  )
-    start_visible[k] = true;
-      else
-    start_visible[k] = false;
-      if(  (*this)(k).in( finish_visibility_polygon , epsilon )  )
-    finish_visible[k] = true;
-      else
-    finish_visible[k] = false;
+      start_visible[k] = in_box( (*this)(k), start_box )
+        and (*this)(k).in( start_visibility_polygon , epsilon );
+      finish_visible[k] = in_box( (*this)(k), finish_box )
+        and (*this)(k).in( finish_visibility_polygon , epsilon );
     }
 
-    //Initialize search tree of visited nodes
-    std::list<Shortest_Path_Node> T;
-    //:WARNING:
-    //If T is a vector it is crucial to make T large enough that it
-    //will not be resized.  If T were resized, any iterators pointing
-    //to its contents would be invalidated, thus causing the program
-    //to fail.
-    //T.reserve( n() + 3 );
-
-    //Initialize priority queue of unexpanded nodes
-    std::set<Shortest_Path_Node> Q;
-
-    //Construct initial node
-    Shortest_Path_Node current_node;
-    //convention vertex_index == n() => corresponds to start Point
-    //vertex_index == n() + 1 => corresponds to finish Point
-    current_node.vertex_index = n();
-    current_node.cost_to_come = 0;
-    current_node.estimated_cost_to_go = distance( start , finish );
-    //Put in T and on Q
-    T.push_back( current_node );
-    T.begin()->search_tree_location = T.begin();
-    current_node.search_tree_location = T.begin();
-    T.begin()->parent_search_tree_location = T.begin();
-    current_node.parent_search_tree_location = T.begin();
-    Q.insert( current_node );
-
-    //Initialize temporary variables
-    Shortest_Path_Node child; //children of current_node
-    std::vector<Shortest_Path_Node> children;
-    //flags
+    //A* search over node indices,
+    //convention node == n() => corresponds to start Point
+    //node == n() + 1 => corresponds to finish Point
+    const unsigned start_node = n();
+    const unsigned finish_node = n() + 1;
+    std::vector<double> cost_to_come( n() + 2, INFINITY );
+    std::vector<unsigned> parent( n() + 2, start_node );
+    //binary heap of (cost_to_come + estimated_cost_to_go, node),
+    //entries whose cost is outdated are skipped when popped
+    typedef std::pair<double,unsigned> Queue_Entry;
+    std::priority_queue< Queue_Entry,
+                         std::vector<Queue_Entry>,
+                         std::greater<Queue_Entry> > Q;
+
+    cost_to_come[ start_node ] = 0;
+    Q.push( Queue_Entry( distance( start , finish ), start_node ) );
+
+    //relaxes the edge from node to child with length edge_length
+    auto relax = [&](unsigned node, unsigned child, double edge_length)
+    {
+      double child_cost_to_come = cost_to_come[ node ] + edge_length;
+      if( child_cost_to_come < cost_to_come[ child ] ){
+        cost_to_come[ child ] = child_cost_to_come;
+        parent[ child ] = node;
+        double estimated_cost_to_go = ( child == finish_node ) ?
+          0 : distance( (*this)(child) , finish );
+        Q.push( Queue_Entry( child_cost_to_come + estimated_cost_to_go,
+                             child ) );
+      }
+    };
+
     bool solution_found = false;
-    bool child_already_visited = false;
     //-----------Begin Main Loop-----------
     while( !Q.empty() ){
 
-      //Pop top element off Q onto current_node
-      current_node = *Q.begin(); Q.erase( Q.begin() );
+      //Pop top element off Q
+      Queue_Entry current_entry = Q.top(); Q.pop();
+      unsigned current_node = current_entry.second;
+      double estimated_cost_to_go = ( current_node == finish_node ) ?
+        0 : ( ( current_node == start_node ) ? distance( start , finish )
+              : distance( (*this)(current_node) , finish ) );
+      if( current_entry.first > cost_to_come[ current_node ]
+          + estimated_cost_to_go )
+        continue;
 
       if(PRINTING_DEBUG_DATA){
-    std::cout << std::endl
-          <<"=============="
-          <<" current_node just poped off of Q "
-          <<"=============="
-          << std::endl;
-          current_node.print();
-          std::cout << std::endl;
+        std::cout << "node " << current_node
+                  << " popped off of Q, cost_to_come = "
+                  << cost_to_come[ current_node ] << std::endl;
       }
-      
+
       //Check for goal state
       //(if current node corresponds to finish)
-      if( current_node.vertex_index == n() + 1 ){
-    
-    if( PRINTING_DEBUG_DATA ){
-      std::cout <<"solution found!" 
-            << std::endl
-            << std::endl;
-    }
-
-    solution_found = true;
-    break;
+      if( current_node == finish_node ){
+        solution_found = true;
+        break;
       }
 
-      //Expand current_node (compute children)
-      children.clear();
-
-      if( PRINTING_DEBUG_DATA ){
-    std::cout << "-------------------------------------------"
-          << std::endl
-          << "Expanding Current Node (Computing Children)"
-          << std::endl
-          << "current size of search tree T = " 
-          << T.size()
-          << std::endl
-          << "-------------------------------------------"
-          << std::endl;      
+      //Expand current node
+      if( current_node == start_node ){
+        for(unsigned i=0; i < n(); i++)
+          if( start_visible[i] )
+            relax( current_node, i, distance( start , (*this)(i) ) );
       }
-
-      //if current_node corresponds to start
-      if( current_node.vertex_index == n() ){
-    //loop over environment vertices
-    for(unsigned i=0; i < n(); i++){
-      if( start_visible[i] ){
-        child.vertex_index = i;
-        child.parent_search_tree_location 
-          = current_node.search_tree_location;
-        child.cost_to_come = distance( start , (*this)(i) );
-        child.estimated_cost_to_go = distance( (*this)(i) , finish );        
-        children.push_back( child );
-        
-        if( PRINTING_DEBUG_DATA ){
-          std::cout << std::endl << "computed child: " 
-            << std::endl;
-          child.print();
-        }
-
-      }
-    }
-      }
-      //else current_node corresponds to a vertex of the environment
       else{
-    //check which environment vertices are visible
-    for(unsigned i=0; i < n(); i++){
-      if( current_node.vertex_index != i )
-        if( visibility_graph( current_node.vertex_index , i ) ){
-          child.vertex_index = i;
-          child.parent_search_tree_location 
-        = current_node.search_tree_location;
-          child.cost_to_come = current_node.cost_to_come
-        + distance( (*this)(current_node.vertex_index),
-                (*this)(i) );
-          child.estimated_cost_to_go = distance( (*this)(i) , finish );
-          children.push_back( child );
-
-          if( PRINTING_DEBUG_DATA ){
-        std::cout << std::endl << "computed child: " 
-              << std::endl;
-        child.print();
+        //scan the bit-packed row of the visibility graph a word at a
+        //time, visiting only the set bits
+        const uint64_t* row = &visibility_graph.adjacency_bits_[
+          static_cast<size_t>(current_node)*visibility_graph.words_per_row_ ];
+        for(unsigned w=0; w < visibility_graph.words_per_row_; w++){
+          for(uint64_t word = row[w]; word != 0; word &= word - 1){
+            unsigned i = 64*w + lowest_set_bit(word);
+            if( i != current_node )
+              relax( current_node, i,
+                     distance( (*this)(current_node) , (*this)(i) ) );
           }
-          
         }
-    }
-    //check if finish is visible
-    if( finish_visible[ current_node.vertex_index ] ){
-      child.vertex_index = n() + 1;
-      child.parent_search_tree_location 
-        = current_node.search_tree_location;
-      child.cost_to_come = current_node.cost_to_come
-        + distance( (*this)(current_node.vertex_index) , finish );
-      child.estimated_cost_to_go = 0;        
-      children.push_back( child );
-
-      if( PRINTING_DEBUG_DATA ){
-        std::cout << std::endl << "computed child: " 
-              << std::endl;
-        child.print();
-      }
-
-    }
-      }
-      
-      if( PRINTING_DEBUG_DATA ){
-    std::cout << std::endl
-          <<"-----------------------------------------"
-          << std::endl
-          << "Processing " << children.size() 
-          << " children" << std::endl
-          << "-----------------------------------------"
-          << std::endl;      
-      }
-
-      //Process children
-      for( std::vector<Shortest_Path_Node>::iterator
-         children_itr = children.begin();
-       children_itr != children.end();
-       children_itr++ ){
-    child_already_visited = false;
-
-    if( PRINTING_DEBUG_DATA ){
-      std::cout << std::endl << "current child being processed: " 
-            << std::endl;
-      children_itr->print();      
-    }
-
-    //Check if child state has already been visited 
-    //(by looking in search tree T) 
-    for( std::list<Shortest_Path_Node>::iterator T_itr = T.begin();
-         T_itr != T.end(); T_itr++ ){
-      if( children_itr->vertex_index 
-          == T_itr->vertex_index ){
-        children_itr->search_tree_location = T_itr;
-        child_already_visited = true;
-        break;
-      }    
-    }    
-
-    if( !child_already_visited ){
-      //Add child to search tree T
-      T.push_back( *children_itr );
-      (--T.end())->search_tree_location = --T.end();
-      children_itr->search_tree_location = --T.end();
-      Q.insert( *children_itr );
-    }
-    else if( children_itr->search_tree_location->cost_to_come > 
-         children_itr->cost_to_come ){
-      //redirect parent pointer in search tree
-      children_itr->search_tree_location->parent_search_tree_location
-        = children_itr->parent_search_tree_location;
-      //and update cost data
-      children_itr->search_tree_location->cost_to_come
-        = children_itr->cost_to_come;
-      //update Q
-      for(std::set<Shortest_Path_Node>::iterator 
-        Q_itr = Q.begin();
-          Q_itr!= Q.end();
-          Q_itr++){
-        if( children_itr->vertex_index == Q_itr->vertex_index ){
-          Q.erase( Q_itr );
-          break;
-        }      
-      }
-      Q.insert( *children_itr );      
-    }
-
-    //If not already visited, insert into Q
-    if( !child_already_visited )
-      Q.insert( *children_itr );
-
-    if( PRINTING_DEBUG_DATA ){
-      std::cout << "child already visited? "
-            << child_already_visited
-            << std::endl;      
-    }
-      
+        //check if finish is visible
+        if( finish_visible[ current_node ] )
+          relax( current_node, finish_node,
+                 distance( (*this)(current_node) , finish ) );
       }
     }
     //-----------End Main Loop-----------
@@ -2670,47 +2555,25 @@ namespace VisiLibity
     //Recover solution
     if( solution_found ){
       shortest_path_output.push_back( finish );
-      std::list<Shortest_Path_Node>::iterator
-    backtrace_itr = current_node.parent_search_tree_location;
       Point waypoint;
-
-      if( PRINTING_DEBUG_DATA ){
-    std::cout << "----------------------------" << std::endl
-          << "backtracing to find solution" << std::endl
-          << "----------------------------" << std::endl;
-
-      }
-
+      unsigned backtrace_node = parent[ finish_node ];
       while( true ){
-
-    if( PRINTING_DEBUG_DATA ){
-      std::cout << "backtrace node is "
-            << std::endl;
-      backtrace_itr->print();
-      std::cout << std::endl;      
-    }
-
-    if( backtrace_itr->vertex_index < n() )
-      waypoint = (*this)( backtrace_itr->vertex_index );
-    else if( backtrace_itr->vertex_index == n() )
-      waypoint = start;
-    //Add vertex if not redundant
-    if( shortest_path_output.size() > 0
-        and distance( shortest_path_output[ shortest_path_output.size()
-                        - 1 ],
-              waypoint ) > epsilon )
-      shortest_path_output.push_back( waypoint );
-    if( backtrace_itr->cost_to_come == 0 )
-      break;
-    backtrace_itr = backtrace_itr->parent_search_tree_location;
+        if( backtrace_node < n() )
+          waypoint = (*this)( backtrace_node );
+        else
+          waypoint = start;
+        //Add vertex if not redundant
+        if( distance( shortest_path_output[ shortest_path_output.size()
+                                            - 1 ],
+                      waypoint ) > epsilon )
+          shortest_path_output.push_back( waypoint );
+        if( backtrace_node == start_node )
+          break;
+        backtrace_node = parent[ backtrace_node ];
       }
       shortest_path_output.reverse();
     }
 
-    //free memory
-    delete [] start_visible;
-    delete [] finish_visible;
-
     //shortest_path_output.eliminate_redundant_vertices( epsilon );
     //May not be desirable to eliminate redundant vertices, because
     //those redundant vertices can make successive waypoints along the
@@ -2721,7 +2584,7 @@ namespace VisiLibity
   }
   Polyline Environment::shortest_path(const Point& start,
                       const Point& finish,
-                      double epsilon)
+                      double epsilon) const
   {
     return shortest_path( start,
               finish,
@@ -3753,19 +3616,8 @@ namespace VisiLibity
   {
     n_ = vg2.n_;
     vertex_counts_ = vg2.vertex_counts_;
-
-    //Allocate adjacency matrix
-    adjacency_matrix_ = new bool*[n_];
-    adjacency_matrix_[0] = new bool[n_*n_];
-    for(unsigned i=1; i<n_; i++)
-      adjacency_matrix_[i] = adjacency_matrix_[i-1] + n_;
-
-    //copy each entry
-    for(unsigned i=0; i<n_; i++){
-    for(unsigned j=0; j<n_; j++){
-      adjacency_matrix_[i][j] 
-    = vg2.adjacency_matrix_[i][j];
-    }}
+    words_per_row_ = vg2.words_per_row_;
+    adjacency_bits_ = vg2.adjacency_bits_;
   }
 
 
@@ -3779,11 +3631,8 @@ namespace VisiLibity
     for(unsigned i=0; i<environment.h(); i++)
       vertex_counts_.push_back( environment[i].n() );
 
-    //allocate a contiguous chunk of memory for adjacency_matrix_
-    adjacency_matrix_ = new bool*[n_];
-    adjacency_matrix_[0] = new bool[n_*n_];
-    for(unsigned i=1; i<n_; i++)
-      adjacency_matrix_[i] = adjacency_matrix_[i-1] + n_;
+    //allocate the bit-packed rows of the adjacency matrix
+    allocate( n_ );
     
     // fill adjacency matrix by checking for inclusion in the
     // visibility polygons
@@ -3794,11 +3643,12 @@ namespace VisiLibity
                      epsilon );
       for(unsigned k2=0; k2<n_; k2++){
     if( k1 == k2 )
-      adjacency_matrix_[ k1 ][ k1 ] = true;
-    else
-      adjacency_matrix_[ k1 ][ k2 ] =
-        adjacency_matrix_[ k2 ][ k1 ] =    
-        environment(k2).in( polygon_temp , epsilon ); 
+      set( k1, k1, true );
+    else{
+      bool is_visible = environment(k2).in( polygon_temp , epsilon );
+      set( k1, k2, is_visible );
+      set( k2, k1, is_visible );
+    }
       }
     }
   }
@@ -3813,11 +3663,8 @@ namespace VisiLibity
     //fill vertex_counts_
     vertex_counts_.push_back( n_ );
 
-    //allocate a contiguous chunk of memory for adjacency_matrix_
-    adjacency_matrix_ = new bool*[n_];
-    adjacency_matrix_[0] = new bool[n_*n_];
-    for(unsigned i=1; i<n_; i++)
-      adjacency_matrix_[i] = adjacency_matrix_[i-1] + n_;
+    //allocate the bit-packed rows of the adjacency matrix
+    allocate( n_ );
     
     // fill adjacency matrix by checking for inclusion in the
     // visibility polygons
@@ -3828,16 +3675,158 @@ namespace VisiLibity
                      epsilon );
       for(unsigned k2=0; k2<n_; k2++){
     if( k1 == k2 )
-      adjacency_matrix_[ k1 ][ k1 ] = true;
-    else
-      adjacency_matrix_[ k1 ][ k2 ] =
-        adjacency_matrix_[ k2 ][ k1 ] =    
-        points[k2].in( polygon_temp , epsilon ); 
+      set( k1, k1, true );
+    else{
+      bool is_visible = points[k2].in( polygon_temp , epsilon );
+      set( k1, k2, is_visible );
+      set( k2, k1, is_visible );
+    }
       }
     }
   }
 
   
+  Visibility_Graph::Visibility_Graph(const Visibility_Graph& visibility_graph_previous,
+                     const Environment& environment_previous,
+                     const Environment& environment,
+                     double epsilon)
+  {
+    n_ = environment.n();
+
+    //fill vertex_counts_
+    vertex_counts_.reserve( environment.h() );
+    for(unsigned i=0; i<environment.h(); i++)
+      vertex_counts_.push_back( environment[i].n() );
+
+    //allocate the bit-packed rows of the adjacency matrix
+    allocate( n_ );
+
+    //match vertices to vertices of the previous Environment
+    const unsigned unmatched = static_cast<unsigned>(-1);
+    unsigned n_previous = environment_previous.n();
+    if( visibility_graph_previous.n() != n_previous )
+      n_previous = 0;
+    std::map< std::pair<double,double>, unsigned > previous_indices;
+    for(unsigned k=0; k<n_previous; k++)
+      previous_indices.insert( std::make_pair( std::make_pair( environment_previous(k).x(),
+                                                               environment_previous(k).y() ), k ) );
+    std::vector<unsigned> matches( n_, unmatched );
+    for(unsigned k=0; k<n_; k++){
+      std::map< std::pair<double,double>, unsigned >::const_iterator
+        previous_index = previous_indices.find( std::make_pair( environment(k).x(),
+                                                                environment(k).y() ) );
+      if( previous_index != previous_indices.end() )
+        matches[k] = previous_index->second;
+    }
+
+    //boundary edges (as previous vertex index pairs) in both Environments,
+    //edges in only one of them are changed edges
+    std::set< std::pair<unsigned,unsigned> > previous_edges, current_edges;
+    if( n_previous > 0 ){
+      unsigned k_first = 0;
+      for(unsigned i=0; i<=environment_previous.h(); i++){
+        unsigned n_polygon = environment_previous[i].n();
+        for(unsigned j=0; j<n_polygon; j++){
+          unsigned k1 = k_first + j, k2 = k_first + (j+1)%n_polygon;
+          previous_edges.insert( std::make_pair( std::min(k1,k2), std::max(k1,k2) ) );
+        }
+        k_first += n_polygon;
+      }
+    }
+    std::vector<Line_Segment> changed_edges;
+    unsigned k_first = 0;
+    for(unsigned i=0; i<=environment.h(); i++){
+      unsigned n_polygon = environment[i].n();
+      for(unsigned j=0; j<n_polygon; j++){
+        unsigned k1 = k_first + j, k2 = k_first + (j+1)%n_polygon;
+        std::pair<unsigned,unsigned> previous_edge( std::min(matches[k1],matches[k2]),
+                                                    std::max(matches[k1],matches[k2]) );
+        if( previous_edge.second != unmatched
+            and previous_edges.find(previous_edge) != previous_edges.end() )
+          current_edges.insert( previous_edge );
+        else
+          changed_edges.push_back( Line_Segment( environment(k1), environment(k2) ) );
+      }
+      k_first += n_polygon;
+    }
+    for(std::set< std::pair<unsigned,unsigned> >::const_iterator
+          previous_edge = previous_edges.begin();
+        previous_edge != previous_edges.end(); previous_edge++){
+      if( current_edges.find(*previous_edge) == current_edges.end() )
+        changed_edges.push_back( Line_Segment( environment_previous(previous_edge->first),
+                                               environment_previous(previous_edge->second) ) );
+    }
+    std::vector<Bounding_Box> changed_boxes( changed_edges.size() );
+    for(unsigned c=0; c<changed_edges.size(); c++){
+      changed_boxes[c].x_min = std::min( changed_edges[c].first().x(), changed_edges[c].second().x() ) - epsilon;
+      changed_boxes[c].x_max = std::max( changed_edges[c].first().x(), changed_edges[c].second().x() ) + epsilon;
+      changed_boxes[c].y_min = std::min( changed_edges[c].first().y(), changed_edges[c].second().y() ) - epsilon;
+      changed_boxes[c].y_max = std::max( changed_edges[c].first().y(), changed_edges[c].second().y() ) + epsilon;
+    }
+
+    //copy the visibility of matched vertex pairs whose line of sight
+    //does not pass near a changed edge, mark the other pairs
+    std::vector<bool> is_changed_pair( static_cast<size_t>(n_)*n_, false );
+    std::vector<unsigned> changed_pair_counts( n_, 0 );
+    for(unsigned k1=0; k1<n_; k1++){
+      set( k1, k1, true );
+      for(unsigned k2=k1+1; k2<n_; k2++){
+        bool is_unchanged = ( matches[k1] != unmatched ) and ( matches[k2] != unmatched );
+        for(unsigned c=0; is_unchanged and c<changed_edges.size(); c++){
+          if( std::max( environment(k1).x(), environment(k2).x() ) < changed_boxes[c].x_min
+              or std::min( environment(k1).x(), environment(k2).x() ) > changed_boxes[c].x_max
+              or std::max( environment(k1).y(), environment(k2).y() ) < changed_boxes[c].y_min
+              or std::min( environment(k1).y(), environment(k2).y() ) > changed_boxes[c].y_max )
+            continue;
+          if( intersect( Line_Segment( environment(k1), environment(k2) ),
+                         changed_edges[c], epsilon ) )
+            is_unchanged = false;
+        }
+        if( is_unchanged ){
+          bool is_visible = visibility_graph_previous( matches[k1], matches[k2] );
+          set( k1, k2, is_visible );
+          set( k2, k1, is_visible );
+        }
+        else{
+          is_changed_pair[ static_cast<size_t>(k1)*n_ + k2 ] =
+            is_changed_pair[ static_cast<size_t>(k2)*n_ + k1 ] = true;
+          changed_pair_counts[k1]++;
+          changed_pair_counts[k2]++;
+        }
+      }
+    }
+
+    // fill the changed pairs from the visibility polygons, starting with
+    // the vertices that have the most changed pairs
+    std::vector<unsigned> vertex_order( n_ );
+    for(unsigned k=0; k<n_; k++)
+      vertex_order[k] = k;
+    std::stable_sort( vertex_order.begin(), vertex_order.end(),
+                      [&changed_pair_counts](unsigned k1, unsigned k2)
+                      { return changed_pair_counts[k1] > changed_pair_counts[k2]; } );
+    Polygon polygon_temp;
+    for(unsigned count=0; count<n_; count++){
+      unsigned k1 = vertex_order[count];
+      if( changed_pair_counts[k1] == 0 )
+        continue;
+      polygon_temp = Visibility_Polygon( environment(k1),
+                     environment,
+                     epsilon );
+      for(unsigned k2=0; k2<n_; k2++){
+        if( not is_changed_pair[ static_cast<size_t>(k1)*n_ + k2 ] )
+          continue;
+        bool is_visible = environment(k2).in( polygon_temp , epsilon );
+        set( k1, k2, is_visible );
+        set( k2, k1, is_visible );
+        is_changed_pair[ static_cast<size_t>(k1)*n_ + k2 ] =
+          is_changed_pair[ static_cast<size_t>(k2)*n_ + k1 ] = false;
+        changed_pair_counts[k1]--;
+        changed_pair_counts[k2]--;
+      }
+    }
+  }
+
+
   Visibility_Graph::Visibility_Graph(const Guards& guards,
                      const Environment& environment, 
                      double epsilon)
@@ -3853,24 +3842,26 @@ namespace VisiLibity
                       unsigned i2,
                       unsigned j2) const 
   {
-    return adjacency_matrix_[ two_to_one(i1,j1) ][ two_to_one(i2,j2) ];
+    return (*this)( two_to_one(i1,j1), two_to_one(i2,j2) );
   }
   bool Visibility_Graph::operator () (unsigned k1,
                       unsigned k2) const 
   {
-    return adjacency_matrix_[ k1 ][ k2 ];
+    return ( adjacency_bits_[ static_cast<size_t>(k1)*words_per_row_ + k2/64 ]
+             >> (k2%64) ) & 1;
   }
-  bool& Visibility_Graph::operator () (unsigned i1,
+  Visibility_Graph::reference Visibility_Graph::operator () (unsigned i1,
                        unsigned j1,
                        unsigned i2,
                        unsigned j2)
   {
-    return adjacency_matrix_[ two_to_one(i1,j1) ][ two_to_one(i2,j2) ];
+    return (*this)( two_to_one(i1,j1), two_to_one(i2,j2) );
   }
-  bool& Visibility_Graph::operator () (unsigned k1,
+  Visibility_Graph::reference Visibility_Graph::operator () (unsigned k1,
                        unsigned k2)
   {
-    return adjacency_matrix_[ k1 ][ k2 ];
+    return reference( adjacency_bits_[ static_cast<size_t>(k1)*words_per_row_ + k2/64 ],
+                      uint64_t(1) << (k2%64) );
   }
 
 
@@ -3882,28 +3873,21 @@ namespace VisiLibity
     
     n_ = visibility_graph_temp.n_;
     vertex_counts_ = visibility_graph_temp.vertex_counts_;
-
-    //resize adjacency_matrix_
-    if( adjacency_matrix_ != NULL ){
-      delete [] adjacency_matrix_[0];
-      delete [] adjacency_matrix_; 
-    }
-    adjacency_matrix_ = new bool*[n_];
-    adjacency_matrix_[0] = new bool[n_*n_];
-    for(unsigned i=1; i<n_; i++)
-      adjacency_matrix_[i] = adjacency_matrix_[i-1] + n_;
-
-    //copy each entry
-    for(unsigned i=0; i<n_; i++){
-    for(unsigned j=0; j<n_; j++){
-      adjacency_matrix_[i][j] 
-    = visibility_graph_temp.adjacency_matrix_[i][j];
-    }}
+    words_per_row_ = visibility_graph_temp.words_per_row_;
+    adjacency_bits_ = visibility_graph_temp.adjacency_bits_;
     
     return *this;
   }
   
   
+  void Visibility_Graph::allocate(unsigned n)
+  {
+    n_ = n;
+    words_per_row_ = (n_ + 63)/64;
+    adjacency_bits_.assign( static_cast<size_t>(n_)*words_per_row_, 0 );
+  }
+
+
   unsigned Visibility_Graph::two_to_one(unsigned i,
                     unsigned j) const
   {
@@ -3919,10 +3903,6 @@ namespace VisiLibity
 
   Visibility_Graph::~Visibility_Graph()    
   { 
-    if( adjacency_matrix_ != NULL ){
-      delete [] adjacency_matrix_[0];
-      delete [] adjacency_matrix_; 
-    }
   }
 
 
@@ -70,6 +70,7 @@ License along with VisiLibity.  If not, see <http://www.gnu.org/licenses/>.
 #include <iso646.h>   //aliases for boolean operators
 
 #include <cmath>      //math functions in std namespace
+#include <cstdint>    //fixed width integers
 #include <vector>
 #include <queue>      //queue and priority_queue.
 #include <set>        //priority queues with iteration, 
@@ -1608,8 +1609,11 @@ namespace VisiLibity
      * \remarks  If multiple shortest path queries are made for the
      * same Envrionment, it is better to precompute the
      * Visibility_Graph. For a precomputed Visibility_Graph, the time
-     * complexity of a shortest_path() query is O(n^2), where n is the
-     * number of vertices representing the Environment.
+     * complexity of a shortest_path() query is O(n^2/64 + m log(n)),
+     * where n is the number of vertices representing the Environment
+     * and m is the number of visible vertex pairs.  Open nodes are
+     * kept in a binary heap and adjacent vertices are found by
+     * scanning the bit-packed rows of the Visibility_Graph.
      *
      * \todo  return not just one, but all shortest paths (w/in
      * epsilon), e.g., returning a std::vector<Polyline>)
@@ -1617,7 +1621,7 @@ namespace VisiLibity
     Polyline shortest_path(const Point& start,
                const Point& finish,
                const Visibility_Graph& visibility_graph,
-               double epsilon=0.0);
+               double epsilon=0.0) const;
     /** \brief  compute shortest path between 2 Points
      *
      * \author  Karl J. Obermeyer
@@ -1632,7 +1636,7 @@ namespace VisiLibity
      */
     Polyline shortest_path(const Point& start,
                const Point& finish,
-               double epsilon=0.0);
+               double epsilon=0.0) const;
     /** \brief  compute the faces (partition cells) of an arrangement
      *          of Line_Segments inside the Environment
      *
@@ -1728,53 +1732,6 @@ namespace VisiLibity
     //time O(n), where n is the number of vertices representing the
     //Environment
     std::pair<unsigned,unsigned> one_to_two(unsigned k) const;
-    //node used for search tree of A* search in shortest_path() method
-    class Shortest_Path_Node
-    {
-    public:
-      //flattened index of corresponding Environment vertex
-      //convention vertex_index = n() => corresponds to start Point
-      //vertex_index = n() + 1 => corresponds to finish Point
-      unsigned vertex_index;
-      //pointer to self in search tree.
-      std::list<Shortest_Path_Node>::iterator search_tree_location;
-      //pointer to parent in search tree.
-      std::list<Shortest_Path_Node>::iterator parent_search_tree_location;
-      //Geodesic distance from start Point.
-      double cost_to_come;
-      //Euclidean distance to finish Point.
-      double estimated_cost_to_go;
-      //std::vector<Shortest_Path_Node> expand();
-      bool operator < (const Shortest_Path_Node& spn2) const
-      { 
-    double f1 = this->cost_to_come + this->estimated_cost_to_go;
-    double f2 = spn2.cost_to_come + spn2.estimated_cost_to_go;
-    if( f1 < f2 )
-      return true;
-    else if( f2 < f1 )
-      return false;
-    else if( this->vertex_index < spn2.vertex_index )
-      return true;
-    else if( this->vertex_index > spn2.vertex_index )
-      return false;
-    else if( &(*(this->parent_search_tree_location)) 
-         < &(*(spn2.parent_search_tree_location)) ) 
-      return true;
-    else
-      return false;
-      }
-      // print member data for debugging
-      void print() const
-      {
-    std::cout << "         vertex_index = " << vertex_index << std::endl
-          << "parent's vertex_index = " 
-          << parent_search_tree_location->vertex_index 
-          << std::endl
-          << "         cost_to_come = " << cost_to_come << std::endl
-          << " estimated_cost_to_go = " 
-          << estimated_cost_to_go << std::endl;      
-      }
-    };
   };
   
   
@@ -2130,7 +2087,9 @@ namespace VisiLibity
    *          represented by adjacency matrix
    *
    * \remarks  used for shortest path planning in the
-   * Environment::shortest_path() method
+   * Environment::shortest_path() method.  The adjacency matrix is
+   * stored as bit-packed rows (one bit per vertex pair), so an
+   * n-vertex graph takes about n^2/8 bytes.
    *
    * \todo Add method to prune edges for faster shortest path
    * calculation, e.g., exclude concave vertices and only include
@@ -2140,9 +2099,35 @@ namespace VisiLibity
   class  Visibility_Graph
   {
   public:
+    friend class Environment;
+    /** \brief  writable reference to one adjacency matrix entry
+     *
+     * returned by the mutating operator () in place of bool&, since
+     * entries are single bits
+     */
+    class reference
+    {
+    public:
+      reference(uint64_t& word, uint64_t mask)
+        : word_(word), mask_(mask) { }
+      operator bool () const { return (word_ & mask_) != 0; }
+      reference& operator = (bool is_visible)
+      {
+        if( is_visible )
+          word_ |= mask_;
+        else
+          word_ &= ~mask_;
+        return *this;
+      }
+      reference& operator = (const reference& reference_temp)
+      { return *this = static_cast<bool>(reference_temp); }
+    private:
+      uint64_t& word_;
+      uint64_t mask_;
+    };
     //Constructors
     /// default to empty 
-    Visibility_Graph() { n_=0; adjacency_matrix_ = NULL; }
+    Visibility_Graph() { n_=0; words_per_row_=0; }
     /// copy 
     Visibility_Graph( const Visibility_Graph& vg2 );
     /** \brief  construct the visibility graph of Environment vertices
@@ -2201,6 +2186,29 @@ namespace VisiLibity
      */
     Visibility_Graph(const Guards& guards,
              const Environment& environment, double epsilon=0.0);
+    /** \brief  update the visibility graph of a previous Environment
+     *          for a changed Environment
+     *
+     * Vertices of \a environment are matched (by exact position) to
+     * vertices of \a environment_previous.  Visibility between two
+     * matched vertices is copied from \a visibility_graph_previous
+     * unless their line of sight comes within \a epsilon of a
+     * boundary edge that was added or removed.  The remaining vertex
+     * pairs are found from the Visibility_Polygons of as few vertices
+     * as practical.
+     *
+     * \pre \a visibility_graph_previous is the visibility graph of
+     * \a environment_previous, \a environment must be \a epsilon
+     * -valid.  Test with Environment::is_valid(epsilon).
+     *
+     * \remarks  time complexity O(n^2 c) to find the changed vertex
+     * pairs, where c is the number of changed edges, plus O(n log(n))
+     * for each Visibility_Polygon computed.  With no matched vertices
+     * this is the same as Visibility_Graph(environment, epsilon).
+     */
+    Visibility_Graph(const Visibility_Graph& visibility_graph_previous,
+             const Environment& environment_previous,
+             const Environment& environment, double epsilon=0.0);
     //Accessors
     /** \brief  raw access to adjacency matrix data
      *
@@ -2249,7 +2257,7 @@ namespace VisiLibity
      * \remarks  for efficiency, no bounds check; usually trying to
      * access out of bounds causes a bus error
      */
-    bool& operator () (unsigned i1,
+    reference operator () (unsigned i1,
                unsigned j1,
                unsigned i2,
                unsigned j2);
@@ -2269,7 +2277,7 @@ namespace VisiLibity
      * \remarks  for efficiency, no bounds check; usually trying to
      * access out of bounds causes a bus error
      */
-    bool& operator () (unsigned k1,
+    reference operator () (unsigned k1,
                unsigned k2);
     /// assignment operator
     Visibility_Graph& operator = 
@@ -2281,8 +2289,21 @@ namespace VisiLibity
     unsigned n_;
     //the number of vertices in each Polygon of corresponding Environment
     std::vector<unsigned> vertex_counts_;
-    // n_-by-n_ adjacency matrix data stored as 2D dynamic array
-    bool **adjacency_matrix_;
+    //number of 64 bit words in each row of adjacency_bits_
+    unsigned words_per_row_;
+    // n_-by-n_ adjacency matrix data stored as bit-packed rows
+    std::vector<uint64_t> adjacency_bits_;
+    //sets n_ and allocates an all false adjacency matrix
+    void allocate(unsigned n);
+    //sets the adjacency matrix entry of flattened indices k1, k2
+    void set(unsigned k1, unsigned k2, bool is_visible)
+    {
+      uint64_t& word = adjacency_bits_[ static_cast<size_t>(k1)*words_per_row_ + k2/64 ];
+      if( is_visible )
+        word |= ( uint64_t(1) << (k2%64) );
+      else
+        word &= ~( uint64_t(1) << (k2%64) );
+    }
     //converts vertex pairs (hole #, vertex #) to flattened index
     unsigned two_to_one(unsigned i,
             unsigned j) const;
@@ -0,0 +1,179 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   AssignmentSolverBenchmark.cpp
+ *
+ * Compares the assignment solver engines on a generated scenario: vehicles
+ * and single option tasks at random locations, with travel times proportional
+ * to distance and no ordering constraints between the tasks. For each engine
+ * the cost (largest vehicle travel time) and the time to solution are printed:
+ *  - branch and bound, first (greedy) assignment (NumberNodesMaximum = 0)
+ *  - branch and bound, limited to a maximum number of nodes
+ *  - large neighborhood search, on the given number of search threads
+ *  - Hungarian, when there are no more tasks than vehicles
+ *
+ * Usage: AssignmentSolverBenchmark [number of vehicles] [number of task options] [maximum number of nodes] [solver iterations] [number of search threads]
+ */
+
+#include "AssignmentTreeBranchBoundService.h"
+#include "AssignmentSolverEngines.h"
+#include "TimeUtilities.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct Location
+{
+    double m_north_m;
+    double m_east_m;
+};
+
+struct Scenario
+{
+    std::vector<Location> m_vehicleLocations;
+    std::vector<Location> m_taskLocations;
+    std::vector<int64_t> m_taskTimes_ms;
+    std::vector<int64_t> m_taskOptionIds;
+};
+
+int64_t
+travelTime_ms(const Location& from, const Location& to)
+{
+    const double speed_mps{20.0};
+    return (static_cast<int64_t> (1000.0 * std::hypot(to.m_north_m - from.m_north_m, to.m_east_m - from.m_east_m) / speed_mps));
+}
+
+/*! \brief  runs the search of "nodeAssignment" on the scenario, returns false if the assignment is not complete*/
+bool
+runSolver(const std::string& solverName, std::unique_ptr<uxas::service::c_Node_Base> nodeAssignment, const Scenario& scenario,
+          const int64_t& numberNodesMaximum, const int64_t& numberSolverIterations, const uint32_t& numberSearchThreads)
+{
+    // same inputs as AssignmentTreeBranchBoundBase::calculateAssignment constructs
+    uxas::service::c_Node_Base::m_staticAssignmentParameters.reset(new uxas::service::c_StaticAssignmentParameters);
+    auto& staticParameters = uxas::service::c_Node_Base::m_staticAssignmentParameters;
+    staticParameters->m_numberNodesMaximum = numberNodesMaximum;
+    staticParameters->m_numberSolverIterations = numberSolverIterations;
+    staticParameters->m_numberSearchThreads = numberSearchThreads;
+    uxas::service::c_Node_Base::m_isFinalAssignmentCalculated = false;
+
+    uint32_t numberTaskOptions = static_cast<uint32_t> (scenario.m_taskOptionIds.size());
+    for (uint32_t vehicle = 0; vehicle < scenario.m_vehicleLocations.size(); vehicle++)
+    {
+        int64_t vehicleId = vehicle + 1;
+        nodeAssignment->m_vehicleIdVsAssignmentState[vehicleId].reset(new uxas::service::c_VehicleAssignmentState(vehicleId));
+        auto vehicleInformation = new uxas::service::c_VehicleInformationStatic(vehicleId);
+        staticParameters->m_vehicleIdVsInformation[vehicleId].reset(vehicleInformation);
+        for (int32_t from = -1; from < static_cast<int32_t> (numberTaskOptions); from++)
+        {
+            int64_t fromId = (from < 0) ? (vehicleId) : (scenario.m_taskOptionIds[from]);
+            const Location& fromLocation = (from < 0) ? (scenario.m_vehicleLocations[vehicle]) : (scenario.m_taskLocations[from]);
+            auto toIdVsTravelTime = new std::unordered_map<int64_t, int64_t>;
+            vehicleInformation->m_FromIdVsToIdVsTravelTime[fromId].reset(toIdVsTravelTime);
+            for (uint32_t to = 0; to < numberTaskOptions; to++)
+            {
+                if (static_cast<int32_t> (to) != from)
+                {
+                    (*toIdVsTravelTime)[scenario.m_taskOptionIds[to]] = travelTime_ms(fromLocation, scenario.m_taskLocations[to]);
+                }
+            }
+        }
+    }
+    std::string algebraString = "|(";
+    for (uint32_t task = 0; task < numberTaskOptions; task++)
+    {
+        auto taskInformation = new uxas::service::c_TaskInformationStatic();
+        staticParameters->m_taskOptionIdVsInformation[scenario.m_taskOptionIds[task]].reset(taskInformation);
+        for (uint32_t vehicle = 0; vehicle < scenario.m_vehicleLocations.size(); vehicle++)
+        {
+            taskInformation->m_VehicleIdVsTaskTravelTime[vehicle + 1] = scenario.m_taskTimes_ms[task];
+        }
+        algebraString += "p" + std::to_string(scenario.m_taskOptionIds[task]) + " ";
+    }
+    algebraString += ")";
+    if (!staticParameters->algebra.initAtomicObjectives(scenario.m_taskOptionIds) || !staticParameters->algebra.initAlgebraString(algebraString))
+    {
+        std::cerr << "failed to initialize the process algebra" << std::endl;
+        return (false);
+    }
+
+    staticParameters->m_assignmentStartTime_ms = uxas::common::utilities::c_TimeUtilities::getTimeNow_ms();
+    auto start = std::chrono::steady_clock::now();
+    nodeAssignment->ExpandNode();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    size_t numberAssigned{0};
+    for (auto& vehicleAssignmentState : staticParameters->m_candidateVehicleIdVsAssignmentState)
+    {
+        numberAssigned += vehicleAssignmentState.second->m_taskAssignments.size();
+    }
+
+    std::cout << "solver " << solverName
+            << " vehicles " << scenario.m_vehicleLocations.size()
+            << " task_options " << numberTaskOptions
+            << " nodes " << staticParameters->m_numberNodesVisited
+            << " cost_ms " << staticParameters->m_minimumAssignmentCostCandidate
+            << " search_s " << seconds
+            << ((numberAssigned == numberTaskOptions) ? "" : " INCOMPLETE") << std::endl;
+
+    return (numberAssigned == numberTaskOptions);
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+    uint32_t numberVehicles = (argc > 1) ? std::stoul(argv[1]) : 10;
+    uint32_t numberTaskOptions = (argc > 2) ? std::stoul(argv[2]) : 40;
+    int64_t numberNodesMaximum = (argc > 3) ? std::stoll(argv[3]) : 2000000;
+    int64_t numberSolverIterations = (argc > 4) ? std::stoll(argv[4]) : 1000;
+    uint32_t numberSearchThreads = (argc > 5) ? std::stoul(argv[5]) : 1;
+
+    Scenario scenario;
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> coordinate_m(0.0, 10000.0);
+    std::uniform_int_distribution<int64_t> taskTime_ms(10000, 60000);
+    for (uint32_t vehicle = 0; vehicle < numberVehicles; vehicle++)
+    {
+        scenario.m_vehicleLocations.push_back(Location{coordinate_m(generator), coordinate_m(generator)});
+    }
+    for (uint32_t task = 0; task < numberTaskOptions; task++)
+    {
+        scenario.m_taskLocations.push_back(Location{coordinate_m(generator), coordinate_m(generator)});
+        scenario.m_taskOptionIds.push_back(uxas::service::c_TaskAssignmentState::getTaskAndOptionId(task + 1, 1));
+    }
+    for (uint32_t task = 0; task < numberTaskOptions; task++)
+    {
+        scenario.m_taskTimes_ms.push_back(taskTime_ms(generator));
+    }
+
+    bool isComplete(true);
+    isComplete = runSolver("branch_and_bound_greedy", std::unique_ptr<uxas::service::c_Node_Base>(new uxas::service::c_Node_TreeBranchAndBound),
+                           scenario, 0, numberSolverIterations, numberSearchThreads) && isComplete;
+    isComplete = runSolver("branch_and_bound", std::unique_ptr<uxas::service::c_Node_Base>(new uxas::service::c_Node_TreeBranchAndBound),
+                           scenario, numberNodesMaximum, numberSolverIterations, numberSearchThreads) && isComplete;
+    isComplete = runSolver("large_neighborhood_search", std::unique_ptr<uxas::service::c_Node_Base>(new uxas::service::c_Node_LargeNeighborhoodSearch),
+                           scenario, numberNodesMaximum, numberSolverIterations, numberSearchThreads) && isComplete;
+    if (numberTaskOptions <= numberVehicles)
+    {
+        isComplete = runSolver("hungarian", std::unique_ptr<uxas::service::c_Node_Base>(new uxas::service::c_Node_Hungarian),
+                               scenario, numberNodesMaximum, numberSolverIterations, numberSearchThreads) && isComplete;
+    }
+
+    return (isComplete ? 0 : 1);
+}
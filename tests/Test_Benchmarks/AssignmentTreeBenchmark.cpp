@@ -0,0 +1,147 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   AssignmentTreeBenchmark.cpp
+ *
+ * Measures the node rate (nodes per second) of the branch and bound
+ * assignment search (c_Node_TreeBranchAndBound) on a generated scenario:
+ * vehicles and single option tasks at random locations, with travel times
+ * proportional to distance and no ordering constraints between the tasks.
+ * The search is limited to a maximum number of nodes and runs on the given
+ * number of search threads (0 -> one per worker pool thread).
+ *
+ * Usage: AssignmentTreeBenchmark [number of vehicles] [number of task options] [maximum number of nodes] [number of search threads]
+ */
+
+#include "AssignmentTreeBranchBoundService.h"
+#include "TimeUtilities.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct Location
+{
+    double m_north_m;
+    double m_east_m;
+};
+
+int64_t
+travelTime_ms(const Location& from, const Location& to)
+{
+    const double speed_mps{20.0};
+    return (static_cast<int64_t> (1000.0 * std::hypot(to.m_north_m - from.m_north_m, to.m_east_m - from.m_east_m) / speed_mps));
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+    uint32_t numberVehicles = (argc > 1) ? std::stoul(argv[1]) : 10;
+    uint32_t numberTaskOptions = (argc > 2) ? std::stoul(argv[2]) : 40;
+    int64_t numberNodesMaximum = (argc > 3) ? std::stoll(argv[3]) : 2000000;
+    uint32_t numberSearchThreads = (argc > 4) ? std::stoul(argv[4]) : 1;
+
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> coordinate_m(0.0, 10000.0);
+    std::uniform_int_distribution<int64_t> taskTime_ms(10000, 60000);
+
+    std::vector<Location> vehicleLocations;
+    for (uint32_t vehicle = 0; vehicle < numberVehicles; vehicle++)
+    {
+        vehicleLocations.push_back(Location{coordinate_m(generator), coordinate_m(generator)});
+    }
+    std::vector<Location> taskLocations;
+    std::vector<int64_t> taskOptionIds;
+    for (uint32_t task = 0; task < numberTaskOptions; task++)
+    {
+        taskLocations.push_back(Location{coordinate_m(generator), coordinate_m(generator)});
+        taskOptionIds.push_back(uxas::service::c_TaskAssignmentState::getTaskAndOptionId(task + 1, 1));
+    }
+
+    // same inputs as AssignmentTreeBranchBoundBase::calculateAssignment constructs
+    uxas::service::c_Node_Base::m_staticAssignmentParameters.reset(new uxas::service::c_StaticAssignmentParameters);
+    auto& staticParameters = uxas::service::c_Node_Base::m_staticAssignmentParameters;
+    std::unique_ptr<uxas::service::c_Node_Base> nodeAssignment(new uxas::service::c_Node_TreeBranchAndBound);
+    staticParameters->m_numberNodesMaximum = numberNodesMaximum;
+    staticParameters->m_numberSearchThreads = numberSearchThreads;
+    uxas::service::c_Node_Base::m_isFinalAssignmentCalculated = false;
+
+    for (uint32_t vehicle = 0; vehicle < numberVehicles; vehicle++)
+    {
+        int64_t vehicleId = vehicle + 1;
+        nodeAssignment->m_vehicleIdVsAssignmentState[vehicleId].reset(new uxas::service::c_VehicleAssignmentState(vehicleId));
+        auto vehicleInformation = new uxas::service::c_VehicleInformationStatic(vehicleId);
+        staticParameters->m_vehicleIdVsInformation[vehicleId].reset(vehicleInformation);
+        for (int32_t from = -1; from < static_cast<int32_t> (numberTaskOptions); from++)
+        {
+            int64_t fromId = (from < 0) ? (vehicleId) : (taskOptionIds[from]);
+            const Location& fromLocation = (from < 0) ? (vehicleLocations[vehicle]) : (taskLocations[from]);
+            auto toIdVsTravelTime = new std::unordered_map<int64_t, int64_t>;
+            vehicleInformation->m_FromIdVsToIdVsTravelTime[fromId].reset(toIdVsTravelTime);
+            for (uint32_t to = 0; to < numberTaskOptions; to++)
+            {
+                if (static_cast<int32_t> (to) != from)
+                {
+                    (*toIdVsTravelTime)[taskOptionIds[to]] = travelTime_ms(fromLocation, taskLocations[to]);
+                }
+            }
+        }
+    }
+    std::string algebraString = "|(";
+    for (uint32_t task = 0; task < numberTaskOptions; task++)
+    {
+        auto taskInformation = new uxas::service::c_TaskInformationStatic();
+        staticParameters->m_taskOptionIdVsInformation[taskOptionIds[task]].reset(taskInformation);
+        int64_t time_ms = taskTime_ms(generator);
+        for (uint32_t vehicle = 0; vehicle < numberVehicles; vehicle++)
+        {
+            taskInformation->m_VehicleIdVsTaskTravelTime[vehicle + 1] = time_ms;
+        }
+        algebraString += "p" + std::to_string(taskOptionIds[task]) + " ";
+    }
+    algebraString += ")";
+    if (!staticParameters->algebra.initAtomicObjectives(taskOptionIds) || !staticParameters->algebra.initAlgebraString(algebraString))
+    {
+        std::cerr << "failed to initialize the process algebra" << std::endl;
+        return (1);
+    }
+
+    staticParameters->m_assignmentStartTime_ms = uxas::common::utilities::c_TimeUtilities::getTimeNow_ms();
+    auto start = std::chrono::steady_clock::now();
+    nodeAssignment->ExpandNode();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    size_t numberAssigned{0};
+    for (auto& vehicleAssignmentState : staticParameters->m_candidateVehicleIdVsAssignmentState)
+    {
+        numberAssigned += vehicleAssignmentState.second->m_taskAssignments.size();
+    }
+
+    std::cout << "vehicles " << numberVehicles
+            << " task_options " << numberTaskOptions
+            << " search_threads " << numberSearchThreads
+            << " nodes " << staticParameters->m_numberNodesVisited
+            << " complete_assignments " << staticParameters->m_numberCompleteAssignments
+            << " cost_ms " << staticParameters->m_minimumAssignmentCostCandidate
+            << " search_s " << seconds
+            << " nodes_per_s " << ((seconds > 0.0) ? (staticParameters->m_numberNodesVisited / seconds) : (0.0))
+            << ((numberAssigned == numberTaskOptions) ? "" : " INCOMPLETE") << std::endl;
+
+    return ((numberAssigned == numberTaskOptions) ? 0 : 1);
+}
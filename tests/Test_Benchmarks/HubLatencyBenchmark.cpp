@@ -0,0 +1,213 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   HubLatencyBenchmark.cpp
+ *
+ * Measures end-to-end latency (sender network client -> LMCP network hub ->
+ * receiver network client) and idle process CPU usage for polled (default)
+ * and event-driven (isEventDrivenReceive) Zero MQ receive.
+ *
+ * Usage: HubLatencyBenchmark [poll|event]
+ */
+
+#include "LmcpObjectNetworkClientBase.h"
+#include "LmcpObjectNetworkServer.h"
+#include "UxAS_ConfigurationManager.h"
+
+#include "stdUniquePtr.h"
+
+#include "afrl/cmasi/KeyValuePair.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+const size_t s_messageCount{2000};
+const size_t s_idleClientCount{32};
+
+std::vector< std::chrono::steady_clock::time_point > s_sendTimes(s_messageCount);
+std::vector<int64_t> s_latencies_us(s_messageCount, -1);
+std::atomic<size_t> s_receivedCount{0};
+
+class BenchmarkClient : public uxas::communications::LmcpObjectNetworkClientBase
+{
+public:
+
+    bool
+    start(bool isReceiver)
+    {
+        if (isReceiver)
+        {
+            addSubscriptionAddress(afrl::cmasi::KeyValuePair::Subscription);
+        }
+        return (configureNetworkClient("BenchmarkClient", ReceiveProcessingType::LMCP, pugi::xml_node()) && initializeAndStart());
+    };
+
+    void
+    send(size_t messageIndex)
+    {
+        auto keyValuePair = uxas::stduxas::make_unique<afrl::cmasi::KeyValuePair>();
+        keyValuePair->setKey(std::to_string(messageIndex));
+        s_sendTimes[messageIndex] = std::chrono::steady_clock::now();
+        sendLmcpObjectBroadcastMessage(std::move(keyValuePair));
+    };
+
+    void
+    stop()
+    {
+        stopNetworkClient();
+    };
+
+protected:
+
+    bool
+    processReceivedLmcpMessage(std::unique_ptr<uxas::communications::data::LmcpMessage> receivedLmcpMessage) override
+    {
+        std::chrono::steady_clock::time_point receiveTime = std::chrono::steady_clock::now();
+        if (afrl::cmasi::isKeyValuePair(receivedLmcpMessage->m_object.get()))
+        {
+            size_t messageIndex = std::stoul(static_cast<afrl::cmasi::KeyValuePair*>(receivedLmcpMessage->m_object.get())->getKey());
+            if (messageIndex < s_messageCount)
+            {
+                s_latencies_us[messageIndex] = std::chrono::duration_cast<std::chrono::microseconds>(receiveTime - s_sendTimes[messageIndex]).count();
+                s_receivedCount++;
+            }
+        }
+        return (false);
+    };
+};
+
+int64_t
+percentile(const std::vector<int64_t>& sortedLatencies_us, double fraction)
+{
+    size_t index = static_cast<size_t>(fraction * static_cast<double>(sortedLatencies_us.size() - 1));
+    return (sortedLatencies_us[index]);
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+    bool isEventDriven = (argc > 1 && std::string(argv[1]) == "event");
+    uxas::common::ConfigurationManager::getInstance().loadBaseXmlString(
+        std::string("<UxAS EntityID=\"1\" EntityType=\"Aircraft\" isEventDrivenReceive=\"")
+        + (isEventDriven ? "true" : "false") + "\"/>");
+
+    auto networkServer = uxas::stduxas::make_unique<uxas::communications::LmcpObjectNetworkServer>();
+    if (!networkServer->configure() || !networkServer->initializeAndStart())
+    {
+        std::cerr << "failed to start LMCP network server" << std::endl;
+        return (1);
+    }
+
+    BenchmarkClient receiver;
+    BenchmarkClient sender;
+    std::vector< std::unique_ptr<BenchmarkClient> > idleClients;
+    bool isStarted = receiver.start(true) && sender.start(false);
+    for (size_t clientIndex = 0; isStarted && clientIndex < s_idleClientCount; clientIndex++)
+    {
+        idleClients.push_back(uxas::stduxas::make_unique<BenchmarkClient>());
+        isStarted = idleClients.back()->start(false);
+    }
+    if (!isStarted)
+    {
+        std::cerr << "failed to start network clients" << std::endl;
+        return (1);
+    }
+    // allow subscriptions to propagate
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    // idle CPU usage (hub + 2 + idle client count receivers)
+    std::clock_t idleStartClock = std::clock();
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    double idleCpuPercent = 100.0 * static_cast<double>(std::clock() - idleStartClock) / CLOCKS_PER_SEC / 2.0;
+
+    // paced sends so that each message measures unloaded latency
+    for (size_t messageIndex = 0; messageIndex < s_messageCount; messageIndex++)
+    {
+        sender.send(messageIndex);
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+    std::chrono::steady_clock::time_point drainDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (s_receivedCount < s_messageCount && std::chrono::steady_clock::now() < drainDeadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    std::vector<int64_t> sortedLatencies_us;
+    for (int64_t latency_us : s_latencies_us)
+    {
+        if (latency_us >= 0)
+        {
+            sortedLatencies_us.push_back(latency_us);
+        }
+    }
+    std::sort(sortedLatencies_us.begin(), sortedLatencies_us.end());
+
+    std::cout << "receive mode " << (isEventDriven ? "event-driven" : "polled")
+            << " received " << sortedLatencies_us.size() << "/" << s_messageCount
+            << " idle CPU " << idleCpuPercent << "% (" << (s_idleClientCount + 3) << " receivers)" << std::endl;
+    if (!sortedLatencies_us.empty())
+    {
+        std::cout << "latency us p50 " << percentile(sortedLatencies_us, 0.50)
+                << " p90 " << percentile(sortedLatencies_us, 0.90)
+                << " p99 " << percentile(sortedLatencies_us, 0.99)
+                << " max " << sortedLatencies_us.back() << std::endl;
+
+        // power-of-two microsecond buckets
+        std::vector<size_t> bucketCounts(1);
+        for (int64_t latency_us : sortedLatencies_us)
+        {
+            size_t bucketIndex = 0;
+            while ((int64_t{1} << bucketIndex) <= latency_us)
+            {
+                bucketIndex++;
+            }
+            if (bucketIndex >= bucketCounts.size())
+            {
+                bucketCounts.resize(bucketIndex + 1, 0);
+            }
+            bucketCounts[bucketIndex]++;
+        }
+        for (size_t bucketIndex = 0; bucketIndex < bucketCounts.size(); bucketIndex++)
+        {
+            if (bucketCounts[bucketIndex] > 0)
+            {
+                std::cout << "  < " << (int64_t{1} << bucketIndex) << " us: " << bucketCounts[bucketIndex] << std::endl;
+            }
+        }
+    }
+
+    receiver.stop();
+    sender.stop();
+    for (auto& idleClient : idleClients)
+    {
+        idleClient->stop();
+    }
+    networkServer->terminate();
+    std::chrono::steady_clock::time_point stopDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!receiver.getIsTerminationFinished() && std::chrono::steady_clock::now() < stopDeadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    return ((sortedLatencies_us.size() == s_messageCount) ? 0 : 1);
+}
@@ -0,0 +1,122 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   LmcpDeserializeBenchmark.cpp
+ *
+ * Measures de-serialization throughput (bytes/s) of received LMCP payload
+ * strings for the legacy byte-by-byte buffer fill and the block-copy path
+ * used by LmcpObjectMessageReceiverPipe::deserializeMessage.
+ */
+
+#include "LmcpObjectMessageReceiverPipe.h"
+
+#include "avtas/lmcp/ByteBuffer.h"
+#include "avtas/lmcp/Factory.h"
+#include "afrl/cmasi/EntityState.h"
+#include "afrl/cmasi/Location3D.h"
+#include "afrl/cmasi/MissionCommand.h"
+#include "afrl/cmasi/Waypoint.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace
+{
+
+std::string
+serialize(avtas::lmcp::Object* lmcpObject)
+{
+    avtas::lmcp::ByteBuffer* lmcpByteBuffer = avtas::lmcp::Factory::packMessage(lmcpObject, true);
+    std::string serializedPayload = std::string(reinterpret_cast<char*>(lmcpByteBuffer->array()), lmcpByteBuffer->capacity());
+    delete lmcpByteBuffer;
+    return (serializedPayload);
+}
+
+// de-serialization as previously implemented by the receiver pipes
+avtas::lmcp::Object*
+deserializeByteByByte(const std::string& payload)
+{
+    avtas::lmcp::ByteBuffer lmcpByteBuffer;
+    lmcpByteBuffer.allocate(payload.size());
+    lmcpByteBuffer.rewind();
+    for (size_t charIndex = 0; charIndex < payload.size(); charIndex++)
+    {
+        lmcpByteBuffer.putByte(payload[charIndex]);
+    }
+    lmcpByteBuffer.rewind();
+    return (avtas::lmcp::Factory::getObject(lmcpByteBuffer));
+}
+
+template <typename Deserializer>
+double
+measureBytesPerSecond(const std::string& payload, uint32_t iterations, Deserializer deserializer)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        deserializer(payload);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return (static_cast<double>(payload.size()) * iterations / elapsed.count());
+}
+
+void
+runBenchmark(const std::string& name, const std::string& payload, uint32_t iterations)
+{
+    double legacyRate = measureBytesPerSecond(payload, iterations, [](const std::string& p)
+    {
+        std::unique_ptr<avtas::lmcp::Object> object(deserializeByteByByte(p));
+    });
+    double blockRate = measureBytesPerSecond(payload, iterations, [](const std::string& p)
+    {
+        std::unique_ptr<avtas::lmcp::Object> object = uxas::communications::LmcpObjectMessageReceiverPipe::deserializeMessage(p);
+    });
+
+    std::cout << name << " (" << payload.size() << " bytes x " << iterations << ")" << std::endl;
+    std::cout << "  byte-by-byte: " << legacyRate / 1.0e6 << " MB/s" << std::endl;
+    std::cout << "  block copy:   " << blockRate / 1.0e6 << " MB/s" << std::endl;
+    std::cout << "  speedup:      " << blockRate / legacyRate << "x" << std::endl;
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+    uint32_t iterations = (argc > 1) ? static_cast<uint32_t>(std::stoul(argv[1])) : 20000;
+
+    afrl::cmasi::EntityState entityState;
+    entityState.setID(400);
+    entityState.setHeading(90.0f);
+    entityState.setLocation(new afrl::cmasi::Location3D());
+    entityState.setTime(1000);
+    runBenchmark("EntityState", serialize(&entityState), iterations * 10);
+
+    afrl::cmasi::MissionCommand missionCommand;
+    missionCommand.setVehicleID(400);
+    missionCommand.setFirstWaypoint(1);
+    for (int64_t waypointNumber = 1; waypointNumber <= 2000; waypointNumber++)
+    {
+        auto waypoint = new afrl::cmasi::Waypoint();
+        waypoint->setNumber(waypointNumber);
+        waypoint->setNextWaypoint(waypointNumber + 1);
+        waypoint->setLatitude(45.3 + 1.0e-4 * waypointNumber);
+        waypoint->setLongitude(-121.0 - 1.0e-4 * waypointNumber);
+        waypoint->setAltitude(700.0f);
+        waypoint->setSpeed(20.0f);
+        missionCommand.getWaypointList().push_back(waypoint);
+    }
+    runBenchmark("MissionCommand", serialize(&missionCommand), iterations / 20);
+
+    return (0);
+}
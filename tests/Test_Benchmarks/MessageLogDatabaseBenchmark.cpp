@@ -0,0 +1,137 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   MessageLogDatabaseBenchmark.cpp
+ *
+ * Measures MessageLoggerDataService database logging throughput (rows/s) of
+ * rows of the service "msg" table (AirVehicleState XML):
+ *  - former behavior: concatenated INSERT statement executed in its own
+ *    transaction for each row (rollback journal), on the calling thread
+ *  - DatabaseLogger: bound rows group-committed (WAL) by the writer thread
+ *    in batches of 10 through 1000 rows
+ *
+ * Usage: MessageLogDatabaseBenchmark [row count]
+ */
+
+#include "UxAS_DatabaseLogger.h"
+
+#include <SQLiteCpp/Database.h>
+#include <SQLiteCpp/SQLiteCpp.h>
+
+#include "afrl/cmasi/AirVehicleState.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+const std::string&
+dbTableCreate()
+{
+    static std::string s_string{"CREATE TABLE msg (id INTEGER PRIMARY KEY, time_ms INTEGER NOT NULL, descriptor TEXT NOT NULL"
+            ", groupID TEXT NOT NULL, entityID INTEGER NOT NULL, serviceID INTEGER NOT NULL, xml BLOB NOT NULL)"};
+    return (s_string);
+}
+
+void
+reportRate(const std::string& name, size_t rowCount, double queueSeconds, double commitSeconds)
+{
+    std::cout << name << " rows " << rowCount
+            << " queued " << static_cast<uint64_t>(rowCount / queueSeconds) << " rows/s"
+            << " committed " << static_cast<uint64_t>(rowCount / commitSeconds) << " rows/s" << std::endl;
+}
+
+bool
+runFormerBenchmark(const std::string& xml, size_t rowCount)
+{
+    std::string dbFilePath{"MessageLogDatabaseBenchmark_former.db3"};
+    std::remove(dbFilePath.c_str());
+    try
+    {
+        SQLite::Database db(dbFilePath, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
+        db.exec(dbTableCreate());
+        auto start = std::chrono::steady_clock::now();
+        for (size_t rowIndex = 0; rowIndex < rowCount; rowIndex++)
+        {
+            SQLite::Transaction transaction(db);
+            db.exec("INSERT INTO msg (id,time_ms,descriptor,groupID,entityID,serviceID,xml) VALUES (NULL,'"
+                    + std::to_string(1500000000000 + rowIndex) + "','afrl.cmasi.AirVehicleState','','400','7','" + xml + "')");
+            transaction.commit();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        reportRate("former_row_transaction", rowCount, seconds, seconds);
+    }
+    catch (std::exception& ex)
+    {
+        std::cerr << "former behavior benchmark failed: " << ex.what() << std::endl;
+        return (false);
+    }
+    std::remove(dbFilePath.c_str());
+    return (true);
+}
+
+bool
+runBenchmark(const std::string& name, const std::string& xml, size_t rowCount, uint32_t batchRowCount)
+{
+    uxas::common::log::DatabaseLogger databaseLogger;
+    std::string logFilePath;
+    if (!databaseLogger.configure("MessageLogDatabaseBenchmark_" + name, false, false, UINT32_MAX)
+            || !databaseLogger.configureDatabase(dbTableCreate(), "msg", "time_ms,descriptor,groupID,entityID,serviceID,xml"))
+    {
+        std::cerr << "failed to configure database logger" << std::endl;
+        return (false);
+    }
+    databaseLogger.configureBatching(batchRowCount, 100);
+    if (!databaseLogger.openStream(logFilePath))
+    {
+        std::cerr << "failed to open database " << logFilePath << std::endl;
+        return (false);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t rowIndex = 0; rowIndex < rowCount; rowIndex++)
+    {
+        databaseLogger.outputRowToStream(std::vector<std::string>{std::to_string(1500000000000 + rowIndex), "afrl.cmasi.AirVehicleState", "", "400", "7", xml});
+    }
+    auto queued = std::chrono::steady_clock::now();
+    databaseLogger.closeStream();
+    auto committed = std::chrono::steady_clock::now();
+
+    reportRate(name, rowCount, std::chrono::duration<double>(queued - start).count(), std::chrono::duration<double>(committed - start).count());
+    std::remove(logFilePath.c_str());
+    return (true);
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+    size_t rowCount = (argc > 1) ? std::stoul(argv[1]) : 20000;
+
+    afrl::cmasi::AirVehicleState airVehicleState;
+    airVehicleState.setID(400);
+    airVehicleState.setAirspeed(22.5f);
+    airVehicleState.setHeading(90.0f);
+    std::string xml = airVehicleState.toXML();
+
+    // (per-row commits are slow; fewer rows)
+    bool isSuccess = runFormerBenchmark(xml, rowCount / 10)
+            && runBenchmark("batch_10", xml, rowCount, 10)
+            && runBenchmark("batch_100", xml, rowCount, 100)
+            && runBenchmark("batch_1000", xml, rowCount, 1000);
+
+    return (isSuccess ? 0 : 1);
+}
@@ -0,0 +1,291 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   RoadGraphRouterBenchmark.cpp
+ *
+ * Measures per-query latency of shortest route searches on a road graph:
+ *  - boost::astar_search with a straight line heuristic, as previously used by
+ *    the OsmPlannerService (new distance/predecessor vectors per query, goal
+ *    reported by an exception)
+ *  - CRoadGraphRouter (A* with landmark lower bounds, reused search buffers)
+ * The road graph is either read from an Open Street Map file (all nodes of
+ * "highway" ways, edges between consecutive nodes) or, without a file, a
+ * synthetic N x N street grid with jittered intersections and missing blocks.
+ * The path costs of both searches must be identical.
+ *
+ * Usage: RoadGraphRouterBenchmark [osm file | grid size N] [number of queries] [number of landmarks]
+ */
+
+#include "RoadGraphRouter.h"
+#include "Position.h"
+
+#include "pugixml.hpp"
+
+#include "boost/graph/adjacency_list.hpp"
+#include "boost/graph/astar_search.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+double
+distance_m(const n_FrameworkLib::CPosition& position1, const n_FrameworkLib::CPosition& position2)
+{
+    return (std::hypot(position1.m_north_m - position2.m_north_m, position1.m_east_m - position2.m_east_m));
+}
+
+using Graph_t = boost::adjacency_list < boost::listS, boost::vecS, boost::undirectedS, boost::no_property, boost::property < boost::edge_weight_t, int32_t > >;
+using VertexDescriptor_t = boost::graph_traits<Graph_t>::vertex_descriptor;
+
+struct found_goal
+{
+};
+
+class astar_goal_visitor : public boost::default_astar_visitor
+{
+public:
+
+    astar_goal_visitor(VertexDescriptor_t goal) : m_goal(goal) { }
+
+    void examine_vertex(VertexDescriptor_t u, const Graph_t&)
+    {
+        if (u == m_goal)
+        {
+            throw found_goal();
+        }
+    }
+private:
+    VertexDescriptor_t m_goal;
+};
+
+class euclidean_distance_heuristic : public boost::astar_heuristic<Graph_t, int64_t>
+{
+public:
+
+    euclidean_distance_heuristic(const n_FrameworkLib::V_POSITION_t& positions, VertexDescriptor_t goal)
+    : m_positions(positions), m_goal(goal) { }
+
+    int64_t operator()(VertexDescriptor_t v)
+    {
+        return (static_cast<int64_t> (distance_m(m_positions[v], m_positions[m_goal])));
+    }
+
+private:
+    const n_FrameworkLib::V_POSITION_t& m_positions;
+    VertexDescriptor_t m_goal;
+};
+
+double
+secondsSince(const std::chrono::steady_clock::time_point& start)
+{
+    return (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+}
+
+void
+addEdge(const n_FrameworkLib::V_POSITION_t& positions, uint32_t from, uint32_t to, n_FrameworkLib::CEdge::V_EDGE_t& edges)
+{
+    // lengths are rounded up, so the straight line distance is a lower bound on every path
+    edges.push_back(n_FrameworkLib::CEdge(from, to, static_cast<int32_t> (std::ceil(distance_m(positions[from], positions[to])))));
+}
+
+void
+buildGrid(uint32_t gridSize, n_FrameworkLib::V_POSITION_t& positions, n_FrameworkLib::CEdge::V_EDGE_t& edges)
+{
+    const double spacing_m{100.0};
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> jitter(-0.3 * spacing_m, 0.3 * spacing_m);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    for (uint32_t row = 0; row < gridSize; row++)
+    {
+        for (uint32_t column = 0; column < gridSize; column++)
+        {
+            positions.push_back(n_FrameworkLib::CPosition(row * spacing_m + jitter(generator), column * spacing_m + jitter(generator), 0.0));
+        }
+    }
+    for (uint32_t row = 0; row < gridSize; row++)
+    {
+        for (uint32_t column = 0; column < gridSize; column++)
+        {
+            uint32_t vertex = row * gridSize + column;
+            // every tenth street is a main road, the rest are missing some blocks
+            if ((column + 1 < gridSize) && ((row % 10 == 0) || (uniform(generator) > 0.2)))
+            {
+                addEdge(positions, vertex, vertex + 1, edges);
+            }
+            if ((row + 1 < gridSize) && ((column % 10 == 0) || (uniform(generator) > 0.2)))
+            {
+                addEdge(positions, vertex, vertex + gridSize, edges);
+            }
+        }
+    }
+}
+
+bool
+readOsmFile(const std::string& osmFile, n_FrameworkLib::V_POSITION_t& positions, n_FrameworkLib::CEdge::V_EDGE_t& edges)
+{
+    pugi::xml_document document;
+    if (!document.load_file(osmFile.c_str()))
+    {
+        std::cerr << "failed to load [" << osmFile << "]" << std::endl;
+        return (false);
+    }
+    pugi::xml_node osmMap = document.child("osm");
+
+    std::unordered_map<int64_t, uint32_t> nodeIdVsIndex;
+    double latitudeReference_rad{0.0};
+    for (pugi::xml_node node = osmMap.child("node"); node; node = node.next_sibling("node"))
+    {
+        double latitude_rad = node.attribute("lat").as_double() * M_PI / 180.0;
+        double longitude_rad = node.attribute("lon").as_double() * M_PI / 180.0;
+        if (positions.empty())
+        {
+            latitudeReference_rad = latitude_rad;
+        }
+        // equirectangular projection, adequate for a city sized map
+        nodeIdVsIndex[node.attribute("id").as_int64()] = static_cast<uint32_t> (positions.size());
+        positions.push_back(n_FrameworkLib::CPosition(latitude_rad * 6371000.0, longitude_rad * std::cos(latitudeReference_rad) * 6371000.0, 0.0));
+    }
+
+    for (pugi::xml_node way = osmMap.child("way"); way; way = way.next_sibling("way"))
+    {
+        bool isHighway{false};
+        for (pugi::xml_node tag = way.child("tag"); tag; tag = tag.next_sibling("tag"))
+        {
+            isHighway = isHighway || (std::string(tag.attribute("k").value()) == "highway");
+        }
+        if (!isHighway)
+        {
+            continue;
+        }
+        int64_t lastIndex{-1};
+        for (pugi::xml_node nd = way.child("nd"); nd; nd = nd.next_sibling("nd"))
+        {
+            auto itIndex = nodeIdVsIndex.find(nd.attribute("ref").as_int64());
+            if (itIndex != nodeIdVsIndex.end())
+            {
+                if (lastIndex >= 0)
+                {
+                    addEdge(positions, static_cast<uint32_t> (lastIndex), itIndex->second, edges);
+                }
+                lastIndex = itIndex->second;
+            }
+        }
+    }
+    return (true);
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+    std::string source = (argc > 1) ? argv[1] : "100";
+    uint32_t numberQueries = (argc > 2) ? std::stoul(argv[2]) : 200;
+    uint32_t numberLandmarks = (argc > 3) ? std::stoul(argv[3]) : 8;
+
+    n_FrameworkLib::V_POSITION_t positions;
+    n_FrameworkLib::CEdge::V_EDGE_t edges;
+    if (source.find_first_not_of("0123456789") == std::string::npos)
+    {
+        buildGrid(std::stoul(source), positions, edges);
+    }
+    else if (!readOsmFile(source, positions, edges))
+    {
+        return (1);
+    }
+    if (positions.size() < 2)
+    {
+        std::cerr << "road graph has less than two nodes" << std::endl;
+        return (1);
+    }
+
+    std::vector<int32_t> edgeLengths;
+    for (auto itEdge = edges.begin(); itEdge != edges.end(); itEdge++)
+    {
+        edgeLengths.push_back(itEdge->iGetLength());
+    }
+    Graph_t graph(edges.begin(), edges.end(), edgeLengths.begin(), positions.size());
+
+    auto start = std::chrono::steady_clock::now();
+    n_FrameworkLib::CRoadGraphRouter router;
+    router.Build(edges, static_cast<uint32_t> (positions.size()), numberLandmarks);
+    double buildSeconds = secondsSince(start);
+
+    std::mt19937 generator(2);
+    std::uniform_int_distribution<uint32_t> randomVertex(0, static_cast<uint32_t> (positions.size() - 1));
+    std::vector<std::pair<uint32_t, uint32_t> > queries;
+    for (uint32_t query = 0; query < numberQueries; query++)
+    {
+        queries.push_back(std::make_pair(randomVertex(generator), randomVertex(generator)));
+    }
+
+    std::vector<int32_t> boostCosts(queries.size(), -1);
+    start = std::chrono::steady_clock::now();
+    for (size_t query = 0; query < queries.size(); query++)
+    {
+        VertexDescriptor_t goal(queries[query].second);
+        std::vector<int32_t> d(boost::num_vertices(graph));
+        std::vector<VertexDescriptor_t> p(boost::num_vertices(graph));
+        try
+        {
+            boost::astar_search(graph, queries[query].first, euclidean_distance_heuristic(positions, goal),
+                    boost::predecessor_map(boost::make_iterator_property_map(p.begin(), boost::get(boost::vertex_index, graph))).
+                    distance_map(boost::make_iterator_property_map(d.begin(), boost::get(boost::vertex_index, graph))).
+                    visitor(astar_goal_visitor(goal)));
+        }
+        catch (found_goal)
+        {
+            boostCosts[query] = d[goal];
+        }
+    }
+    double boostSeconds = secondsSince(start);
+
+    std::vector<int32_t> routerCosts(queries.size(), -1);
+    std::vector<uint32_t> path;
+    start = std::chrono::steady_clock::now();
+    for (size_t query = 0; query < queries.size(); query++)
+    {
+        int32_t cost(-1);
+        if (router.bFindShortestPath(queries[query].first, queries[query].second, cost, path))
+        {
+            routerCosts[query] = cost;
+        }
+    }
+    double routerSeconds = secondsSince(start);
+
+    uint32_t numberMismatches{0};
+    for (size_t query = 0; query < queries.size(); query++)
+    {
+        numberMismatches += (boostCosts[query] != routerCosts[query]) ? 1 : 0;
+    }
+
+    double boostQuery_ms = (queries.empty()) ? (0.0) : (1000.0 * boostSeconds / queries.size());
+    double routerQuery_ms = (queries.empty()) ? (0.0) : (1000.0 * routerSeconds / queries.size());
+    std::cout << "nodes " << positions.size()
+            << " edges " << edges.size()
+            << " landmarks " << router.uiGetNumberLandmarks()
+            << " landmark_build_s " << buildSeconds
+            << " queries " << queries.size()
+            << " boost_astar_query_ms " << boostQuery_ms
+            << " landmark_astar_query_ms " << routerQuery_ms
+            << " speedup " << ((routerQuery_ms > 0.0) ? (boostQuery_ms / routerQuery_ms) : (0.0))
+            << ((numberMismatches == 0) ? "" : " MISMATCH " + std::to_string(numberMismatches)) << std::endl;
+
+    return ((numberMismatches == 0) ? 0 : 1);
+}
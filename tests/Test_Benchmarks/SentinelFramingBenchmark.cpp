@@ -0,0 +1,95 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   SentinelFramingBenchmark.cpp
+ *
+ * Measures SentinelSerialBuffer framing throughput (bytes/s) of multi-MB 
+ * sentinelized payloads received as a TCP/serial stream split into chunks of 
+ * 1 byte through 64KB.
+ *
+ * Usage: SentinelFramingBenchmark [payload size MB]
+ */
+
+#include "UxAS_SentinelSerialBuffer.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+namespace
+{
+
+std::string
+createPayload(size_t payloadSize)
+{
+    // printable characters that cannot form sentinel markers
+    static const std::string s_characters("abcdefghijklmnopqrstuvwxyz0123456789.|$");
+    std::string payload(payloadSize, ' ');
+    uint32_t state{12345};
+    for (size_t characterIndex = 0; characterIndex < payloadSize; characterIndex++)
+    {
+        state = state * 1103515245u + 12345u;
+        payload[characterIndex] = s_characters[(state >> 16) % s_characters.size()];
+    }
+    return (payload);
+}
+
+bool
+runBenchmark(const std::string& stream, size_t payloadCount, size_t payloadSize, size_t chunkSize)
+{
+    uxas::common::SentinelSerialBuffer sentinelSerialBuffer;
+    std::string payload;
+    size_t receivedPayloadCount{0};
+    size_t receivedPayloadSize{0};
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t streamIndex = 0; streamIndex < stream.size(); streamIndex += chunkSize)
+    {
+        size_t dataSize = (stream.size() - streamIndex < chunkSize) ? (stream.size() - streamIndex) : chunkSize;
+        sentinelSerialBuffer.appendData(reinterpret_cast<const uint8_t*>(stream.data()) + streamIndex, dataSize);
+        while (sentinelSerialBuffer.getNextPayload(payload))
+        {
+            receivedPayloadCount++;
+            receivedPayloadSize += payload.size();
+        }
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "  chunk " << chunkSize << " bytes: " << static_cast<double>(stream.size()) / elapsed.count() / 1.0e6 << " MB/s"
+            << " (" << receivedPayloadCount << "/" << payloadCount << " payloads)" << std::endl;
+    return (receivedPayloadCount == payloadCount && receivedPayloadSize == payloadCount * payloadSize);
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+    size_t payloadSize = ((argc > 1) ? static_cast<size_t>(std::stoul(argv[1])) : 4) * 1024 * 1024;
+    const size_t payloadCount{4};
+
+    std::string sentinelizedPayload = uxas::common::SentinelSerialBuffer::createSentinelizedString(createPayload(payloadSize));
+    std::string stream;
+    stream.reserve(payloadCount * sentinelizedPayload.size());
+    for (size_t payloadIndex = 0; payloadIndex < payloadCount; payloadIndex++)
+    {
+        stream.append(sentinelizedPayload);
+    }
+
+    std::cout << "SentinelSerialBuffer framing (" << payloadCount << " x " << payloadSize << " byte payloads)" << std::endl;
+    bool isValid{true};
+    for (size_t chunkSize : {size_t{1}, size_t{16}, size_t{256}, size_t{4096}, size_t{65536}})
+    {
+        isValid = runBenchmark(stream, payloadCount, payloadSize, chunkSize) && isValid;
+    }
+
+    return (isValid ? 0 : 1);
+}
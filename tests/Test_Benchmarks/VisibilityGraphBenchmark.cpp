@@ -0,0 +1,143 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   VisibilityGraphBenchmark.cpp
+ *
+ * Measures CVisibilityGraph base graph construction over synthetic polygon
+ * fields (N x N grid of square keep-out zones inside a keep-in zone) of
+ * increasing size:
+ *  - visibility edge construction (errBuildVisibilityGraph) on one thread and
+ *    on the worker pool; the visible edges of both must be identical
+ *  - all-pairs shortest paths (errInitializeGraphBase) on one thread and on
+ *    the worker pool; results of both must be identical
+ *
+ * Usage: VisibilityGraphBenchmark [largest grid size N]
+ */
+
+#include "VisibilityGraph.h"
+#include "UxAS_WorkerPoolExecutor.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+namespace
+{
+
+double
+secondsSince(const std::chrono::steady_clock::time_point& start)
+{
+    return (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+}
+
+void
+addSquare(n_FrameworkLib::CVisibilityGraph& visibilityGraph, int id, double north_m, double east_m, double side_m, bool isKeepIn)
+{
+    n_FrameworkLib::V_POSITION_t vposSquare;
+    vposSquare.push_back(n_FrameworkLib::CPosition(north_m, east_m, 0.0));
+    vposSquare.push_back(n_FrameworkLib::CPosition(north_m, east_m + side_m, 0.0));
+    vposSquare.push_back(n_FrameworkLib::CPosition(north_m + side_m, east_m + side_m, 0.0));
+    vposSquare.push_back(n_FrameworkLib::CPosition(north_m + side_m, east_m, 0.0));
+    visibilityGraph.errAddPolygon(id, vposSquare.begin(), vposSquare.end(), isKeepIn);
+}
+
+bool
+runBenchmark(uint32_t gridSize)
+{
+    const double spacing_m{1000.0};
+    const double side_m{400.0};
+
+    n_FrameworkLib::CVisibilityGraph visibilityGraph;
+    addSquare(visibilityGraph, 1, -spacing_m, -spacing_m, (gridSize + 1) * spacing_m, true);
+    int id{2};
+    for (uint32_t row = 0; row < gridSize; row++)
+    {
+        for (uint32_t column = 0; column < gridSize; column++)
+        {
+            addSquare(visibilityGraph, id++, row * spacing_m, column * spacing_m, side_m, false);
+        }
+    }
+    if (visibilityGraph.errFinalizePolygons() != n_FrameworkLib::CVisibilityGraph::errNoError)
+    {
+        std::cerr << "failed to finalize polygons" << std::endl;
+        return (false);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    if (visibilityGraph.errBuildVisibilityGraph(1) != n_FrameworkLib::CVisibilityGraph::errNoError)
+    {
+        std::cerr << "failed to build visibility graph" << std::endl;
+        return (false);
+    }
+    double buildSerialSeconds = secondsSince(start);
+    n_FrameworkLib::CEdge::V_EDGE_t serialEdges = visibilityGraph.veGetEdgesVisibleBase();
+
+    start = std::chrono::steady_clock::now();
+    visibilityGraph.errBuildVisibilityGraph();
+    double buildParallelSeconds = secondsSince(start);
+
+    bool isIdentical = (serialEdges.size() == visibilityGraph.veGetEdgesVisibleBase().size());
+    for (size_t edge = 0; isIdentical && edge < serialEdges.size(); edge++)
+    {
+        isIdentical = (serialEdges[edge] == visibilityGraph.veGetEdgesVisibleBase()[edge])
+                && (serialEdges[edge].iGetLength() == visibilityGraph.veGetEdgesVisibleBase()[edge].iGetLength());
+    }
+
+    start = std::chrono::steady_clock::now();
+    visibilityGraph.errInitializeGraphBase(1);
+    double serialSeconds = secondsSince(start);
+    n_FrameworkLib::CVisibilityGraph::SQM_I32_DISTANCE_t serialDistances = visibilityGraph.vviGetVertexDistancesBase();
+
+    start = std::chrono::steady_clock::now();
+    visibilityGraph.errInitializeGraphBase();
+    double parallelSeconds = secondsSince(start);
+
+    size_t vertexCount = visibilityGraph.vviGetVertexDistancesBase().size();
+    isIdentical = isIdentical && (serialDistances.size() == vertexCount);
+    for (size_t from = 0; isIdentical && from < vertexCount; from++)
+    {
+        for (size_t to = 0; to < vertexCount; to++)
+        {
+            if (serialDistances[from][to] != visibilityGraph.vviGetVertexDistancesBase()[from][to])
+            {
+                isIdentical = false;
+                break;
+            }
+        }
+    }
+
+    std::cout << "grid " << gridSize << "x" << gridSize
+            << " vertices " << vertexCount
+            << " edges " << visibilityGraph.veGetEdgesVisibleBase().size()
+            << " visibility_1_thread_s " << buildSerialSeconds
+            << " visibility_" << uxas::common::WorkerPoolExecutor::getInstance().getWorkerCount() << "_threads_s " << buildParallelSeconds
+            << " apsp_1_thread_s " << serialSeconds
+            << " apsp_" << uxas::common::WorkerPoolExecutor::getInstance().getWorkerCount() << "_threads_s " << parallelSeconds
+            << " speedup " << (parallelSeconds > 0.0 ? serialSeconds / parallelSeconds : 0.0)
+            << " matrix_MB " << (vertexCount * vertexCount * (sizeof(int32_t) + sizeof(uint32_t))) / (1024.0 * 1024.0)
+            << (isIdentical ? "" : " MISMATCH") << std::endl;
+    return (isIdentical);
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+    uint32_t largestGridSize = (argc > 1) ? std::stoul(argv[1]) : 16;
+
+    bool isSuccess{true};
+    for (uint32_t gridSize = 4; isSuccess && gridSize <= largestGridSize; gridSize += 4)
+    {
+        isSuccess = runBenchmark(gridSize);
+    }
+
+    return (isSuccess ? 0 : 1);
+}
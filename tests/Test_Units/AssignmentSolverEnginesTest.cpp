@@ -0,0 +1,251 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   AssignmentSolverEnginesTest.cpp
+ *
+ * Assignment costs (largest vehicle travel time) of the solver engines
+ * compared to the exhaustive branch and bound search on small scenarios.
+ */
+#include "gtest/gtest.h"
+
+#include "AssignmentTreeBranchBoundService.h"
+#include "AssignmentSolverEngines.h"
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using uxas::service::c_Node_Base;
+
+namespace
+{
+
+struct Location
+{
+    double m_north_m;
+    double m_east_m;
+};
+
+struct Scenario
+{
+    std::vector<Location> m_vehicleLocations;
+    std::vector<Location> m_taskLocations;
+    std::vector<int64_t> m_taskTimes_ms;
+    std::vector<int64_t> m_taskOptionIds;
+    /*! \brief  process algebra of the task options, empty -> no ordering constraints*/
+    std::string m_algebraString;
+    /*! \brief  number of task options of a complete assignment, 0 -> all*/
+    size_t m_numberAssigned{0};
+};
+
+int64_t
+travelTime_ms(const Location& from, const Location& to)
+{
+    const double speed_mps{20.0};
+    return (static_cast<int64_t> (1000.0 * std::hypot(to.m_north_m - from.m_north_m, to.m_east_m - from.m_east_m) / speed_mps));
+}
+
+void
+addTask(Scenario& scenario, const Location& location, const int64_t& taskTime_ms)
+{
+    scenario.m_taskLocations.push_back(location);
+    scenario.m_taskTimes_ms.push_back(taskTime_ms);
+    scenario.m_taskOptionIds.push_back(uxas::service::c_TaskAssignmentState::getTaskAndOptionId(static_cast<int64_t> (scenario.m_taskLocations.size()), 1));
+}
+
+Scenario
+createRandomScenario(const uint32_t& numberVehicles, const uint32_t& numberTasks, const uint32_t& seed)
+{
+    Scenario scenario;
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> coordinate_m(0.0, 10000.0);
+    std::uniform_int_distribution<int64_t> taskTime_ms(10000, 60000);
+    for (uint32_t vehicle = 0; vehicle < numberVehicles; vehicle++)
+    {
+        scenario.m_vehicleLocations.push_back(Location{coordinate_m(generator), coordinate_m(generator)});
+    }
+    for (uint32_t task = 0; task < numberTasks; task++)
+    {
+        Location location{coordinate_m(generator), coordinate_m(generator)};
+        addTask(scenario, location, taskTime_ms(generator));
+    }
+    return (scenario);
+}
+
+/*! \brief  runs the search of "nodeAssignment" on the scenario, returns the assignment cost, -1 if the assignment is not complete*/
+int64_t
+runSolver(c_Node_Base* nodeAssignment, const Scenario& scenario, const int64_t& numberNodesMaximum)
+{
+    std::unique_ptr<c_Node_Base> node(nodeAssignment);
+    // same inputs as AssignmentTreeBranchBoundBase::calculateAssignment constructs
+    c_Node_Base::m_staticAssignmentParameters.reset(new uxas::service::c_StaticAssignmentParameters);
+    auto& staticParameters = c_Node_Base::m_staticAssignmentParameters;
+    staticParameters->m_numberNodesMaximum = numberNodesMaximum;
+    staticParameters->m_numberSolverIterations = 1000;
+    staticParameters->m_numberSearchThreads = 1;
+    c_Node_Base::m_isFinalAssignmentCalculated = false;
+
+    uint32_t numberTaskOptions = static_cast<uint32_t> (scenario.m_taskOptionIds.size());
+    for (uint32_t vehicle = 0; vehicle < scenario.m_vehicleLocations.size(); vehicle++)
+    {
+        int64_t vehicleId = vehicle + 1;
+        node->m_vehicleIdVsAssignmentState[vehicleId].reset(new uxas::service::c_VehicleAssignmentState(vehicleId));
+        auto vehicleInformation = new uxas::service::c_VehicleInformationStatic(vehicleId);
+        staticParameters->m_vehicleIdVsInformation[vehicleId].reset(vehicleInformation);
+        for (int32_t from = -1; from < static_cast<int32_t> (numberTaskOptions); from++)
+        {
+            int64_t fromId = (from < 0) ? (vehicleId) : (scenario.m_taskOptionIds[from]);
+            const Location& fromLocation = (from < 0) ? (scenario.m_vehicleLocations[vehicle]) : (scenario.m_taskLocations[from]);
+            auto toIdVsTravelTime = new std::unordered_map<int64_t, int64_t>;
+            vehicleInformation->m_FromIdVsToIdVsTravelTime[fromId].reset(toIdVsTravelTime);
+            for (uint32_t to = 0; to < numberTaskOptions; to++)
+            {
+                if (static_cast<int32_t> (to) != from)
+                {
+                    (*toIdVsTravelTime)[scenario.m_taskOptionIds[to]] = travelTime_ms(fromLocation, scenario.m_taskLocations[to]);
+                }
+            }
+        }
+    }
+    std::string algebraString = scenario.m_algebraString;
+    if (algebraString.empty())
+    {
+        algebraString = "|(";
+        for (uint32_t task = 0; task < numberTaskOptions; task++)
+        {
+            algebraString += "p" + std::to_string(scenario.m_taskOptionIds[task]) + " ";
+        }
+        algebraString += ")";
+    }
+    for (uint32_t task = 0; task < numberTaskOptions; task++)
+    {
+        auto taskInformation = new uxas::service::c_TaskInformationStatic();
+        staticParameters->m_taskOptionIdVsInformation[scenario.m_taskOptionIds[task]].reset(taskInformation);
+        for (uint32_t vehicle = 0; vehicle < scenario.m_vehicleLocations.size(); vehicle++)
+        {
+            taskInformation->m_VehicleIdVsTaskTravelTime[vehicle + 1] = scenario.m_taskTimes_ms[task];
+        }
+    }
+    if (!staticParameters->algebra.initAtomicObjectives(scenario.m_taskOptionIds) || !staticParameters->algebra.initAlgebraString(algebraString))
+    {
+        ADD_FAILURE() << "failed to initialize the process algebra " << algebraString;
+        return (-1);
+    }
+
+    node->ExpandNode();
+
+    size_t numberAssigned{0};
+    for (auto& vehicleAssignmentState : staticParameters->m_candidateVehicleIdVsAssignmentState)
+    {
+        numberAssigned += vehicleAssignmentState.second->m_taskAssignments.size();
+    }
+    size_t numberComplete = (scenario.m_numberAssigned > 0) ? (scenario.m_numberAssigned) : (numberTaskOptions);
+    return ((numberAssigned == numberComplete) ? (staticParameters->m_minimumAssignmentCostCandidate.load()) : (-1));
+}
+
+int64_t
+runExhaustiveBranchAndBound(const Scenario& scenario)
+{
+    return (runSolver(new uxas::service::c_Node_TreeBranchAndBound, scenario, -1));
+}
+
+}
+
+TEST(AssignmentSolverEnginesTest, Hungarian_assigns_at_most_one_task_per_vehicle)
+{
+    // both tasks are next to the first vehicle, the optimal assignment gives both to it
+    Scenario scenario;
+    scenario.m_vehicleLocations.push_back(Location{0.0, 0.0});
+    scenario.m_vehicleLocations.push_back(Location{100000.0, 0.0});
+    addTask(scenario, Location{100.0, 0.0}, 10000);
+    addTask(scenario, Location{200.0, 0.0}, 10000);
+
+    int64_t optimalCost_ms = runExhaustiveBranchAndBound(scenario);
+    EXPECT_EQ(30000, optimalCost_ms);
+    EXPECT_EQ(optimalCost_ms, runSolver(new uxas::service::c_Node_LargeNeighborhoodSearch, scenario, -1));
+    // the second vehicle has to travel 99.8 km, so HUNGARIAN is never selected by AUTO (see AssignmentSolverEngines.h)
+    EXPECT_EQ(5000000, runSolver(new uxas::service::c_Node_Hungarian, scenario, -1));
+    EXPECT_TRUE(uxas::service::c_Node_Hungarian::isApplicable(scenario.m_vehicleLocations.size()));
+}
+
+TEST(AssignmentSolverEnginesTest, Hungarian_one_task_per_vehicle_is_optimal)
+{
+    // each vehicle is next to its own task
+    Scenario scenario;
+    for (uint32_t vehicle = 0; vehicle < 4; vehicle++)
+    {
+        scenario.m_vehicleLocations.push_back(Location{0.0, 10000.0 * vehicle});
+        addTask(scenario, Location{1000.0, 10000.0 * vehicle + 100.0 * vehicle}, 10000 + 1000 * vehicle);
+    }
+    int64_t optimalCost_ms = runExhaustiveBranchAndBound(scenario);
+    ASSERT_GT(optimalCost_ms, 0);
+    EXPECT_EQ(optimalCost_ms, runSolver(new uxas::service::c_Node_Hungarian, scenario, -1));
+    EXPECT_EQ(optimalCost_ms, runSolver(new uxas::service::c_Node_LargeNeighborhoodSearch, scenario, -1));
+}
+
+TEST(AssignmentSolverEnginesTest, Engines_compared_to_exhaustive_search)
+{
+    // the search is a heuristic, it has to find most of the optimal assignments and be close to the others
+    const uint32_t sizes[][2] = {{2, 5}, {3, 6}, {2, 7}, {4, 4}};
+    uint32_t numberOptimal{0};
+    uint32_t numberScenarios{0};
+    for (auto& size : sizes)
+    {
+        for (uint32_t seed = 1; seed <= 5; seed++)
+        {
+            Scenario scenario = createRandomScenario(size[0], size[1], seed);
+            int64_t optimalCost_ms = runExhaustiveBranchAndBound(scenario);
+            ASSERT_GT(optimalCost_ms, 0);
+            std::string name = std::to_string(size[0]) + " vehicles " + std::to_string(size[1]) + " tasks seed " + std::to_string(seed);
+
+            // first (greedy) branch and bound assignment
+            int64_t greedyCost_ms = runSolver(new uxas::service::c_Node_TreeBranchAndBound, scenario, 0);
+            EXPECT_GE(greedyCost_ms, optimalCost_ms) << name;
+
+            int64_t searchCost_ms = runSolver(new uxas::service::c_Node_LargeNeighborhoodSearch, scenario, -1);
+            EXPECT_GE(searchCost_ms, optimalCost_ms) << name;
+            EXPECT_LE(searchCost_ms, optimalCost_ms + optimalCost_ms / 10) << name;
+            numberOptimal += (searchCost_ms == optimalCost_ms) ? (1) : (0);
+            numberScenarios++;
+
+            int64_t hungarianCost_ms = runSolver(new uxas::service::c_Node_Hungarian, scenario, -1);
+            if (uxas::service::c_Node_Hungarian::isApplicable(size[0]))
+            {
+                EXPECT_GE(hungarianCost_ms, optimalCost_ms) << name;
+            }
+        }
+    }
+    EXPECT_GE(numberOptimal, numberScenarios - 2);
+}
+
+TEST(AssignmentSolverEnginesTest, Large_neighborhood_search_with_ordering_constraints)
+{
+    for (uint32_t seed = 1; seed <= 5; seed++)
+    {
+        Scenario scenario = createRandomScenario(3, 6, seed);
+        // task 1 before task 2 before task 3, one of tasks 4 and 5, task 6 in parallel
+        auto p = [&scenario](const uint32_t& task) { return ("p" + std::to_string(scenario.m_taskOptionIds[task - 1])); };
+        scenario.m_algebraString = "|(.(" + p(1) + " " + p(2) + " " + p(3) + ") +(" + p(4) + " " + p(5) + ") " + p(6) + ")";
+        scenario.m_numberAssigned = 5;
+        int64_t optimalCost_ms = runExhaustiveBranchAndBound(scenario);
+        ASSERT_GT(optimalCost_ms, 0);
+        EXPECT_GE(runSolver(new uxas::service::c_Node_TreeBranchAndBound, scenario, 0), optimalCost_ms) << "seed " << seed;
+        int64_t searchCost_ms = runSolver(new uxas::service::c_Node_LargeNeighborhoodSearch, scenario, -1);
+        EXPECT_GE(searchCost_ms, optimalCost_ms) << "seed " << seed;
+        EXPECT_LE(searchCost_ms, optimalCost_ms + optimalCost_ms / 10) << "seed " << seed;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
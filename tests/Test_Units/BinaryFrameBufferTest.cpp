@@ -0,0 +1,126 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   BinaryFrameBufferTest.cpp
+ *
+ * Binary frame round trip, split delivery and re-synchronization after
+ * corrupt frame headers.
+ */
+#include "gtest/gtest.h"
+
+#include "BinaryFrameBuffer.h"
+
+#include <string>
+#include <vector>
+
+using uxas::communications::transport::BinaryFrameBuffer;
+
+/** \brief binary frame of a message with address "address" and payload "payload"*/
+static std::string
+createTestFrame(const std::string& address, const std::string& payload)
+{
+    uxas::communications::data::AddressedAttributedMessage message;
+    EXPECT_TRUE(message.setAddressAttributesAndPayload(address, "lmcp", "afrl.cmasi.AirVehicleState", "fusion", "100", "20", payload));
+    return (BinaryFrameBuffer::createFrame(message));
+}
+
+static void
+appendString(BinaryFrameBuffer& frameBuffer, const std::string& data)
+{
+    frameBuffer.appendData(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+}
+
+/** \brief number of received messages, checks their payloads are "payload"*/
+static uint32_t
+countMessages(BinaryFrameBuffer& frameBuffer, const std::string& payload)
+{
+    uint32_t messageCount{0};
+    for (auto message = frameBuffer.getNextMessage(); message; message = frameBuffer.getNextMessage())
+    {
+        EXPECT_EQ(payload, message->getPayload());
+        EXPECT_EQ("afrl.cmasi.AirVehicleState", message->getAddress());
+        EXPECT_EQ("20", message->getMessageAttributesReference()->getSourceServiceId());
+        messageCount++;
+    }
+    return (messageCount);
+}
+
+TEST(BinaryFrameBufferTest, Round_trip_byte_by_byte)
+{
+    std::string frame = createTestFrame("afrl.cmasi.AirVehicleState", "payload-0123456789");
+    ASSERT_FALSE(frame.empty());
+
+    BinaryFrameBuffer frameBuffer;
+    for (uint32_t frameIndex = 0; frameIndex < 3; frameIndex++)
+    {
+        for (size_t byteIndex = 0; byteIndex < frame.size(); byteIndex++)
+        {
+            frameBuffer.appendData(reinterpret_cast<const uint8_t*>(frame.data()) + byteIndex, 1);
+        }
+    }
+    EXPECT_EQ(3u, countMessages(frameBuffer, "payload-0123456789"));
+    EXPECT_EQ(0u, frameBuffer.m_invalidFrameCount);
+}
+
+TEST(BinaryFrameBufferTest, Resync_after_oversized_body)
+{
+    // body size varint 0x0FFFFFFF exceeds the maximum frame size
+    const std::string corruptHeader("\xA5\x5A\x01\xFF\xFF\xFF\x7F", 7);
+    std::string frame = createTestFrame("afrl.cmasi.AirVehicleState", "payload");
+    std::string data = corruptHeader;
+    for (uint32_t frameIndex = 0; frameIndex < 1000; frameIndex++)
+    {
+        data += frame;
+    }
+
+    BinaryFrameBuffer frameBuffer;
+    appendString(frameBuffer, data);
+    EXPECT_EQ(1000u, countMessages(frameBuffer, "payload"));
+    EXPECT_EQ(1u, frameBuffer.m_invalidFrameCount);
+}
+
+TEST(BinaryFrameBufferTest, Resync_after_corrupt_attribute_block_split_delivery)
+{
+    // plausible body size, but the "attribute block" is the next frame's header
+    const std::string corruptHeader("\xA5\x5A\x01\x80\x08", 5);
+    std::string frame = createTestFrame("afrl.cmasi.AirVehicleState", "payload");
+    std::string data = corruptHeader;
+    for (uint32_t frameIndex = 0; frameIndex < 10; frameIndex++)
+    {
+        data += frame;
+    }
+
+    // delivered in small pieces, so that frames are re-scanned across appendData calls
+    BinaryFrameBuffer frameBuffer;
+    for (size_t offset = 0; offset < data.size(); offset += 5)
+    {
+        appendString(frameBuffer, data.substr(offset, 5));
+    }
+    EXPECT_EQ(10u, countMessages(frameBuffer, "payload"));
+    EXPECT_EQ(1u, frameBuffer.m_invalidFrameCount);
+}
+
+TEST(BinaryFrameBufferTest, Resync_after_unsupported_version_and_truncated_frame)
+{
+    std::string frame = createTestFrame("afrl.cmasi.AirVehicleState", "payload");
+    std::string data = std::string("\xA5\x5A\x07", 3) + frame + frame.substr(0, frame.size() / 2) + frame + frame;
+
+    BinaryFrameBuffer frameBuffer;
+    appendString(frameBuffer, data);
+    // the truncated frame swallows the start of the following frame (CRC mismatch)
+    EXPECT_GE(countMessages(frameBuffer, "payload"), 2u);
+    EXPECT_GE(frameBuffer.m_invalidFrameCount, 2u);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
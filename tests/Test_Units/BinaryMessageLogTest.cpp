@@ -0,0 +1,188 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   BinaryMessageLogTest.cpp
+ *
+ * Binary message log write/read round trip across segments, record selection
+ * and replacement of a previous log at the same location.
+ */
+#include "gtest/gtest.h"
+
+#include "BinaryMessageLog.h"
+
+#include <string>
+#include <vector>
+
+using uxas::communications::data::AddressedAttributedMessage;
+using uxas::communications::data::BinaryMessageLog;
+using uxas::communications::data::BinaryMessageLogReader;
+using uxas::communications::data::BinaryMessageLogWriter;
+
+static const std::string s_location("BinaryMessageLogTest_messageLog");
+
+static std::string
+getMessageType(uint32_t messageIndex)
+{
+    return (messageIndex % 3 == 0 ? "afrl.cmasi.AirVehicleState" : (messageIndex % 3 == 1 ? "afrl.cmasi.KeepInZone" : "afrl.cmasi.KeyValuePair"));
+}
+
+/** \brief writes "messageCount" messages (time = 1000 + index), returns the number of segments*/
+static uint32_t
+writeLog(uint32_t messageCount, const std::string& payloadPrefix)
+{
+    BinaryMessageLogWriter writer;
+    EXPECT_TRUE(writer.open(s_location, 4096));
+    for (uint32_t messageIndex = 0; messageIndex < messageCount; messageIndex++)
+    {
+        AddressedAttributedMessage message;
+        EXPECT_TRUE(message.setAddressAttributesAndPayload(getMessageType(messageIndex), "lmcp", getMessageType(messageIndex),
+                                                           "fusion", "100", std::to_string(messageIndex), payloadPrefix + std::to_string(messageIndex)));
+        EXPECT_TRUE(writer.write(1000 + messageIndex, message));
+    }
+    EXPECT_EQ(messageCount, writer.getMessageCount());
+    writer.close();
+
+    uint32_t segmentCount{0};
+    while (std::ifstream(BinaryMessageLog::getSegmentFilePath(s_location, segmentCount + 1)).good())
+    {
+        segmentCount++;
+    }
+    return (segmentCount);
+}
+
+TEST(BinaryMessageLogTest, Round_trip_across_segments)
+{
+    uint32_t segmentCount = writeLog(500, "payload-");
+    EXPECT_GT(segmentCount, 3u);
+
+    BinaryMessageLogReader reader;
+    ASSERT_TRUE(reader.open(s_location));
+    EXPECT_EQ(segmentCount, reader.getSegmentCount());
+    BinaryMessageLogReader::Record record;
+    uint32_t messageIndex{0};
+    while (reader.readNext(record))
+    {
+        ASSERT_TRUE(record.m_message);
+        EXPECT_EQ(1000 + messageIndex, record.m_time_ms);
+        EXPECT_EQ(getMessageType(messageIndex), record.m_messageType);
+        EXPECT_EQ("payload-" + std::to_string(messageIndex), record.m_message->getPayload());
+        EXPECT_EQ(std::to_string(messageIndex), record.m_message->getMessageAttributesReference()->getSourceServiceId());
+        messageIndex++;
+    }
+    EXPECT_EQ(500u, messageIndex);
+}
+
+TEST(BinaryMessageLogTest, Time_range_and_message_type_selection)
+{
+    writeLog(500, "payload-");
+
+    BinaryMessageLogReader reader;
+    reader.setTimeRange(1100, 1399);
+    reader.setMessageType("afrl.cmasi.AirVehicleState");
+    ASSERT_TRUE(reader.open(s_location));
+    BinaryMessageLogReader::Record record;
+    uint32_t messageCount{0};
+    while (reader.readNext(record))
+    {
+        EXPECT_GE(record.m_time_ms, 1100);
+        EXPECT_LE(record.m_time_ms, 1399);
+        EXPECT_EQ("afrl.cmasi.AirVehicleState", record.m_messageType);
+        messageCount++;
+    }
+    // indices 100..399 divisible by 3
+    EXPECT_EQ(100u, messageCount);
+}
+
+TEST(BinaryMessageLogTest, Replay_time_range_and_message_types_selection)
+{
+    writeLog(500, "payload-");
+
+    // as configured by the MessageLogReplayService (StartTime_ms, EndTime_ms and ReplayMessage entries)
+    BinaryMessageLogReader reader;
+    ASSERT_TRUE(reader.open(s_location));
+    reader.setTimeRange(1200, 1299);
+    reader.setMessageTypes({"afrl.cmasi.AirVehicleState", "afrl.cmasi.KeyValuePair", "afrl.cmasi.NotLogged"});
+    BinaryMessageLogReader::Record record;
+    std::vector<uint32_t> messageIndices;
+    while (reader.readNext(record))
+    {
+        messageIndices.push_back(static_cast<uint32_t>(record.m_time_ms - 1000));
+        EXPECT_EQ(getMessageType(messageIndices.back()), record.m_messageType);
+        EXPECT_EQ("payload-" + std::to_string(messageIndices.back()), record.m_message->getPayload());
+    }
+    std::vector<uint32_t> expectedMessageIndices;
+    for (uint32_t messageIndex = 200; messageIndex < 300; messageIndex++)
+    {
+        if (messageIndex % 3 != 1)
+        {
+            expectedMessageIndices.push_back(messageIndex);
+        }
+    }
+    EXPECT_EQ(expectedMessageIndices, messageIndices);
+
+    // a type that was never logged selects no records
+    ASSERT_TRUE(reader.open(s_location));
+    reader.setMessageTypes({"afrl.cmasi.NotLogged"});
+    EXPECT_FALSE(reader.readNext(record));
+}
+
+TEST(BinaryMessageLogTest, Time_range_selection_after_clock_step_back)
+{
+    // the wall clock steps forward past the end of the time range, then back into it
+    BinaryMessageLogWriter writer;
+    ASSERT_TRUE(writer.open(s_location, 4096));
+    for (uint32_t messageIndex = 0; messageIndex < 300; messageIndex++)
+    {
+        int64_t time_ms = (messageIndex >= 100 && messageIndex < 200) ? (5000 + messageIndex) : (1000 + messageIndex);
+        AddressedAttributedMessage message;
+        EXPECT_TRUE(message.setAddressAttributesAndPayload(getMessageType(messageIndex), "lmcp", getMessageType(messageIndex),
+                                                           "fusion", "100", std::to_string(messageIndex), "payload-" + std::to_string(messageIndex)));
+        EXPECT_TRUE(writer.write(time_ms, message));
+    }
+    writer.close();
+
+    BinaryMessageLogReader reader;
+    reader.setTimeRange(1000, 1299);
+    ASSERT_TRUE(reader.open(s_location));
+    BinaryMessageLogReader::Record record;
+    uint32_t messageCount{0};
+    while (reader.readNext(record))
+    {
+        EXPECT_LE(record.m_time_ms, 1299);
+        messageCount++;
+    }
+    // indices 0..99 and 200..299
+    EXPECT_EQ(200u, messageCount);
+}
+
+TEST(BinaryMessageLogTest, Previous_log_segments_are_not_read)
+{
+    uint32_t previousSegmentCount = writeLog(500, "previous-");
+    uint32_t segmentCount = writeLog(20, "current-");
+    EXPECT_LT(segmentCount, previousSegmentCount);
+
+    BinaryMessageLogReader reader;
+    ASSERT_TRUE(reader.open(s_location));
+    EXPECT_EQ(segmentCount, reader.getSegmentCount());
+    BinaryMessageLogReader::Record record;
+    uint32_t messageIndex{0};
+    while (reader.readNext(record))
+    {
+        EXPECT_EQ("current-" + std::to_string(messageIndex), record.m_message->getPayload());
+        messageIndex++;
+    }
+    EXPECT_EQ(20u, messageIndex);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
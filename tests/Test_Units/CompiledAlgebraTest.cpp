@@ -0,0 +1,150 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   CompiledAlgebraTest.cpp
+ *
+ * Next actions of CCompiledAlgebra compared to CAlgebra::searchNext on a
+ * known process algebra and on random process algebra trees.
+ */
+#include "gtest/gtest.h"
+
+#include "Algebra.h"
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using uxas::common::utilities::CAlgebra;
+using uxas::common::utilities::CCompiledAlgebra;
+using uxas::common::utilities::action_t;
+using uxas::common::utilities::v_action_t;
+
+/** \brief random process algebra string of depth up to "depth", the actions are numbered from "nextActionID"*/
+static std::string
+createRandomAlgebraString(uint32_t depth, std::mt19937& random, action_t& nextActionID, v_action_t& actionIDs)
+{
+    if ((depth == 0) || (random() % 3 == 0))
+    {
+        actionIDs.push_back(nextActionID);
+        return ("p" + std::to_string(nextActionID++));
+    }
+    const char* operators = ".+|";
+    std::string algebraString = std::string(1, operators[random() % 3]) + "(";
+    uint32_t numberChildren = 1 + random() % 4;
+    for (uint32_t child = 0; child < numberChildren; child++)
+    {
+        algebraString += createRandomAlgebraString(depth - 1, random, nextActionID, actionIDs) + " ";
+    }
+    return (algebraString + ")");
+}
+
+/** \brief parses "algebraString", CAlgebra reports the parse on std::cout*/
+static bool
+isInitialized(CAlgebra& algebra, const v_action_t& actionIDs, const std::string& algebraString)
+{
+    std::cout.setstate(std::ios::failbit);
+    bool isInitialized = algebra.initAtomicObjectives(actionIDs) && algebra.initAlgebraString(algebraString);
+    std::cout.clear();
+    return (isInitialized);
+}
+
+/** \brief next action IDs of the compiled algebra*/
+static v_action_t
+searchNext(const CCompiledAlgebra& compiledAlgebra, const v_action_t& executedActions)
+{
+    std::vector<uint64_t> executedBits(compiledAlgebra.getNumberWords(), 0);
+    for (uint32_t action = 0; action < compiledAlgebra.getNumberActions(); action++)
+    {
+        if (std::find(executedActions.begin(), executedActions.end(), compiledAlgebra.getActionID(action)) != executedActions.end())
+        {
+            CCompiledAlgebra::setBit(executedBits, action);
+        }
+    }
+    CCompiledAlgebra::s_SearchBuffers buffers;
+    std::vector<uint32_t> nextActions;
+    compiledAlgebra.searchNext(executedBits, nextActions, buffers);
+    v_action_t nextActionIDs;
+    for (auto action : nextActions)
+    {
+        nextActionIDs.push_back(compiledAlgebra.getActionID(action));
+    }
+    return (nextActionIDs);
+}
+
+TEST(CompiledAlgebraTest, Sequence_alternative_and_parallel)
+{
+    // 1 before 2 before 3, one of 4 and 5, 6 at any time
+    v_action_t actionIDs = {1, 2, 3, 4, 5, 6};
+    CAlgebra algebra;
+    ASSERT_TRUE(isInitialized(algebra, actionIDs, "|(.(p1 p2 p3 ) +(p4 p5 ) p6 )"));
+    CCompiledAlgebra compiledAlgebra;
+    ASSERT_TRUE(compiledAlgebra.compile(algebra, actionIDs));
+    EXPECT_EQ(6u, compiledAlgebra.getNumberActions());
+
+    std::vector<v_action_t> executedSequences = {{}, {1}, {1, 2}, {4}, {5, 6}, {1, 2, 3, 4, 6}};
+    for (auto& executedActions : executedSequences)
+    {
+        v_action_t nextActionIDs;
+        algebra.searchNext(executedActions, nextActionIDs);
+        EXPECT_EQ(nextActionIDs, searchNext(compiledAlgebra, executedActions));
+    }
+    v_action_t nextActionIDs = searchNext(compiledAlgebra, {1, 4});
+    EXPECT_TRUE(std::find(nextActionIDs.begin(), nextActionIDs.end(), 2) != nextActionIDs.end());
+    EXPECT_TRUE(std::find(nextActionIDs.begin(), nextActionIDs.end(), 3) == nextActionIDs.end());
+    EXPECT_TRUE(std::find(nextActionIDs.begin(), nextActionIDs.end(), 5) == nextActionIDs.end());
+    EXPECT_TRUE(searchNext(compiledAlgebra, {1, 2, 3, 4, 6}).empty());
+}
+
+TEST(CompiledAlgebraTest, Random_trees_match_CAlgebra)
+{
+    std::mt19937 random(3);
+    uint32_t numberCompared{0};
+    for (uint32_t tree = 0; tree < 1000; tree++)
+    {
+        action_t nextActionID{1};
+        v_action_t actionIDs;
+        std::string algebraString = createRandomAlgebraString(4, random, nextActionID, actionIDs);
+        CAlgebra algebra;
+        if (!isInitialized(algebra, actionIDs, algebraString))
+        {
+            continue;
+        }
+        // one action is not in the compiled action list, it is numbered after the listed ones
+        v_action_t listedActionIDs(actionIDs.begin(), actionIDs.end() - ((actionIDs.size() > 2) ? (1) : (0)));
+        CCompiledAlgebra compiledAlgebra;
+        ASSERT_TRUE(compiledAlgebra.compile(algebra, listedActionIDs)) << algebraString;
+
+        v_action_t executedActions;
+        for (uint32_t step = 0; step < 30; step++)
+        {
+            v_action_t nextActionIDs;
+            algebra.searchNext(executedActions, nextActionIDs);
+            ASSERT_EQ(nextActionIDs, searchNext(compiledAlgebra, executedActions)) << algebraString << " step " << step;
+            numberCompared++;
+
+            // mostly one of the next actions, sometimes an action that is not next
+            action_t actionID = (!nextActionIDs.empty() && ((random() % 4) != 0)) ?
+                    (nextActionIDs[random() % nextActionIDs.size()]) : (actionIDs[random() % actionIDs.size()]);
+            if (std::find(executedActions.begin(), executedActions.end(), actionID) == executedActions.end())
+            {
+                executedActions.push_back(actionID);
+            }
+        }
+    }
+    EXPECT_GT(numberCompared, 10000u);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,207 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   DatabaseLoggerHelperTest.cpp
+ *
+ * Database row writer: batches written by row count and by batch period,
+ * database file rollover at the statement count limit, flush, and SQL
+ * values lists bound as parameters.
+ */
+#include "gtest/gtest.h"
+
+#include "UxAS_DatabaseLoggerHelper.h"
+
+#include <SQLiteCpp/Database.h>
+#include <SQLiteCpp/SQLiteCpp.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using uxas::common::log::DatabaseLoggerHelper;
+
+static const std::string s_tableCreate("CREATE TABLE msg (id INTEGER PRIMARY KEY AUTOINCREMENT, time_ms INTEGER, text TEXT, value REAL)");
+
+/** \brief configures "databaseLoggerHelper" to write the "msg" table into "<location>_<file number>.db3"*/
+static void
+configureHelper(DatabaseLoggerHelper& databaseLoggerHelper, const std::string& location, uint32_t statementCountLimit)
+{
+    for (uint32_t fileNumber = 1; fileNumber <= 5; fileNumber++)
+    {
+        for (const char* suffix : {".db3", ".db3-wal", ".db3-shm"})
+        {
+            std::remove((location + "_" + std::to_string(fileNumber) + suffix).c_str());
+        }
+    }
+    ASSERT_TRUE(databaseLoggerHelper.configureDatabaseHelper(location, false, statementCountLimit, s_tableCreate, "msg", "time_ms,text,value"));
+}
+
+/** \brief number of rows of the "msg" table of the database file (-1 if it cannot be read)*/
+static int32_t
+countRows(const std::string& dbFilePath)
+{
+    try
+    {
+        SQLite::Database db(dbFilePath, SQLITE_OPEN_READONLY);
+        SQLite::Statement query(db, "SELECT COUNT(*) FROM msg");
+        return (query.executeStep() ? query.getColumn(0).getInt() : -1);
+    }
+    catch (std::exception&)
+    {
+        return (-1);
+    }
+}
+
+/** \brief waits (at most 10 s) until the database file holds "rowCount" rows*/
+static bool
+isRowCountReached(const std::string& dbFilePath, int32_t rowCount)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (countRows(dbFilePath) != rowCount)
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+            return (false);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return (true);
+}
+
+static void
+insertRows(DatabaseLoggerHelper& databaseLoggerHelper, uint32_t rowCount)
+{
+    for (uint32_t row = 0; row < rowCount; row++)
+    {
+        EXPECT_TRUE(databaseLoggerHelper.insertRowIntoTable({std::to_string(row), "row " + std::to_string(row), "0.5"}));
+    }
+}
+
+TEST(DatabaseLoggerHelperTest, Batch_by_row_count)
+{
+    DatabaseLoggerHelper databaseLoggerHelper;
+    configureHelper(databaseLoggerHelper, "DatabaseLoggerHelperTest_count", 100000);
+    // the batch period does not elapse during the test
+    databaseLoggerHelper.configureBatching(10, 600000);
+    std::string logFilePath;
+    ASSERT_TRUE(databaseLoggerHelper.openStream(logFilePath));
+
+    insertRows(databaseLoggerHelper, 9);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(0, countRows(logFilePath));
+    insertRows(databaseLoggerHelper, 1);
+    EXPECT_TRUE(isRowCountReached(logFilePath, 10));
+    insertRows(databaseLoggerHelper, 3);
+    databaseLoggerHelper.closeStream();
+    EXPECT_EQ(13, countRows(logFilePath));
+}
+
+TEST(DatabaseLoggerHelperTest, Batch_by_period)
+{
+    DatabaseLoggerHelper databaseLoggerHelper;
+    configureHelper(databaseLoggerHelper, "DatabaseLoggerHelperTest_period", 100000);
+    databaseLoggerHelper.configureBatching(1000, 300);
+    std::string logFilePath;
+    ASSERT_TRUE(databaseLoggerHelper.openStream(logFilePath));
+
+    auto insertTime = std::chrono::steady_clock::now();
+    insertRows(databaseLoggerHelper, 3);
+    EXPECT_TRUE(isRowCountReached(logFilePath, 3));
+    EXPECT_GE(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - insertTime).count(), 200);
+    databaseLoggerHelper.closeStream();
+}
+
+TEST(DatabaseLoggerHelperTest, Rollover_at_statement_count_limit)
+{
+    const std::string location("DatabaseLoggerHelperTest_rollover");
+    DatabaseLoggerHelper databaseLoggerHelper;
+    configureHelper(databaseLoggerHelper, location, 5);
+    databaseLoggerHelper.configureBatching(4, 10);
+
+    // the stream is opened by the first row
+    insertRows(databaseLoggerHelper, 12);
+    databaseLoggerHelper.flush();
+    EXPECT_EQ(5, countRows(location + "_1.db3"));
+    EXPECT_EQ(5, countRows(location + "_2.db3"));
+    EXPECT_EQ(2, countRows(location + "_3.db3"));
+    databaseLoggerHelper.closeStream();
+}
+
+TEST(DatabaseLoggerHelperTest, Flush_writes_queued_rows)
+{
+    DatabaseLoggerHelper databaseLoggerHelper;
+    configureHelper(databaseLoggerHelper, "DatabaseLoggerHelperTest_flush", 100000);
+    databaseLoggerHelper.configureBatching(1000, 600000);
+    std::string logFilePath;
+    ASSERT_TRUE(databaseLoggerHelper.openStream(logFilePath));
+
+    insertRows(databaseLoggerHelper, 7);
+    EXPECT_EQ(0, countRows(logFilePath));
+    databaseLoggerHelper.flush();
+    EXPECT_EQ(7, countRows(logFilePath));
+    databaseLoggerHelper.closeStream();
+}
+
+TEST(DatabaseLoggerHelperTest, Sql_values_lists_are_bound)
+{
+    DatabaseLoggerHelper databaseLoggerHelper;
+    configureHelper(databaseLoggerHelper, "DatabaseLoggerHelperTest_values", 100000);
+    databaseLoggerHelper.configureBatching(1, 10);
+    std::string logFilePath;
+    ASSERT_TRUE(databaseLoggerHelper.openStream(logFilePath));
+
+    EXPECT_TRUE(databaseLoggerHelper.insertValuesIntoTable("12, 'it''s, quoted' ,2.5"));
+    EXPECT_TRUE(databaseLoggerHelper.insertValuesIntoTable("-3,'',NULL"));
+    EXPECT_FALSE(databaseLoggerHelper.insertValuesIntoTable("1,'unterminated,2"));
+    EXPECT_FALSE(databaseLoggerHelper.insertValuesIntoTable("1,(SELECT 2),3"));
+    databaseLoggerHelper.flush();
+
+    SQLite::Database db(logFilePath, SQLITE_OPEN_READONLY);
+    SQLite::Statement query(db, "SELECT time_ms, text, value FROM msg ORDER BY id");
+    ASSERT_TRUE(query.executeStep());
+    EXPECT_EQ(12, query.getColumn(0).getInt());
+    EXPECT_EQ(std::string("it's, quoted"), query.getColumn(1).getText());
+    EXPECT_EQ(SQLITE_FLOAT, query.getColumn(2).getType());
+    ASSERT_TRUE(query.executeStep());
+    EXPECT_EQ(-3, query.getColumn(0).getInt());
+    EXPECT_EQ(std::string(""), query.getColumn(1).getText());
+    EXPECT_TRUE(query.getColumn(2).isNull());
+    EXPECT_FALSE(query.executeStep());
+    databaseLoggerHelper.closeStream();
+}
+
+TEST(DatabaseLoggerHelperTest, Concurrent_first_rows_open_one_stream)
+{
+    DatabaseLoggerHelper databaseLoggerHelper;
+    const std::string location("DatabaseLoggerHelperTest_concurrent");
+    configureHelper(databaseLoggerHelper, location, 100000);
+    databaseLoggerHelper.configureBatching(100, 10);
+
+    std::vector<std::thread> threads;
+    for (uint32_t thread = 0; thread < 4; thread++)
+    {
+        threads.emplace_back([&databaseLoggerHelper]() { insertRows(databaseLoggerHelper, 100); });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    databaseLoggerHelper.closeStream();
+    EXPECT_EQ(400, countRows(location + "_1.db3"));
+    EXPECT_EQ(-1, countRows(location + "_2.db3"));
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,192 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   LmcpObjectInProcessBusTest.cpp
+ *
+ * Lock-free multiple-producer queue and in-process bus delivery to co-located
+ * subscribers: every item is delivered exactly once, in order per producer.
+ */
+#include "gtest/gtest.h"
+
+#include "LmcpObjectInProcessBus.h"
+#include "UxAS_MpscQueue.h"
+
+#include "stdUniquePtr.h"
+
+#include "afrl/cmasi/KeyValuePair.h"
+
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using uxas::communications::LmcpObjectInProcessBus;
+using uxas::communications::LmcpObjectInProcessSubscriber;
+using uxas::communications::data::LmcpMessage;
+
+static const uint32_t s_numberProducers = 4;
+static const uint32_t s_numberItemsPerProducer = 20000;
+
+TEST(LmcpObjectInProcessBusTest, Mpsc_queue_multiple_producers)
+{
+    uxas::common::MpscQueue< std::pair<uint32_t, uint32_t> > queue;
+    std::vector<std::thread> producers;
+    for (uint32_t producer = 0; producer < s_numberProducers; producer++)
+    {
+        producers.emplace_back([&queue, producer]()
+        {
+            for (uint32_t item = 0; item < s_numberItemsPerProducer; item++)
+            {
+                queue.push(std::make_pair(producer, item));
+            }
+        });
+    }
+
+    // consume while the producers are pushing
+    std::vector<uint32_t> nextItems(s_numberProducers, 0);
+    uint32_t numberReceived{0};
+    while (numberReceived < s_numberProducers * s_numberItemsPerProducer)
+    {
+        std::pair<uint32_t, uint32_t> value;
+        if (!queue.tryPop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_LT(value.first, s_numberProducers);
+        ASSERT_EQ(nextItems[value.first], value.second) << "producer " << value.first;
+        nextItems[value.first]++;
+        numberReceived++;
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    EXPECT_TRUE(queue.isEmpty());
+    for (uint32_t producer = 0; producer < s_numberProducers; producer++)
+    {
+        EXPECT_EQ(s_numberItemsPerProducer, nextItems[producer]);
+    }
+}
+
+TEST(LmcpObjectInProcessBusTest, Routes_follow_prefix_subscriptions)
+{
+    auto& bus = LmcpObjectInProcessBus::getInstance();
+    auto receiver = bus.registerSubscriber(10, 1001, true);
+    auto bridge = bus.registerSubscriber(10, 1002, false);
+    uint64_t generation = bus.getRoutingGeneration();
+    EXPECT_TRUE(bus.addSubscriptionAddress(receiver, "afrl.cmasi"));
+    EXPECT_FALSE(bus.addSubscriptionAddress(receiver, "afrl.cmasi"));
+    EXPECT_TRUE(bus.addSubscriptionAddress(bridge, "afrl.cmasi.AirVehicleState"));
+    EXPECT_NE(generation, bus.getRoutingGeneration());
+
+    auto route = bus.getRoute("afrl.cmasi.AirVehicleState");
+    ASSERT_EQ(1u, route.m_objectReceivers.size());
+    EXPECT_EQ(receiver, route.m_objectReceivers.front());
+    EXPECT_TRUE(route.m_isSerializedRequired);
+
+    route = bus.getRoute("afrl.cmasi.KeyValuePair");
+    EXPECT_EQ(1u, route.m_objectReceivers.size());
+    EXPECT_FALSE(route.m_isSerializedRequired);
+
+    route = bus.getRoute("afrl.impact.AreaOfInterest");
+    EXPECT_TRUE(route.m_objectReceivers.empty());
+    EXPECT_FALSE(route.m_isSerializedRequired);
+
+    EXPECT_TRUE(bus.removeSubscriptionAddress(receiver, "afrl.cmasi"));
+    EXPECT_TRUE(bus.getRoute("afrl.cmasi.KeyValuePair").m_objectReceivers.empty());
+    bus.unregisterSubscriber(receiver);
+    bus.unregisterSubscriber(bridge);
+    EXPECT_FALSE(bus.getRoute("afrl.cmasi.AirVehicleState").m_isSerializedRequired);
+}
+
+TEST(LmcpObjectInProcessBusTest, Delivery_to_co_located_subscribers)
+{
+    auto& bus = LmcpObjectInProcessBus::getInstance();
+    std::vector< std::shared_ptr<LmcpObjectInProcessSubscriber> > receivers;
+    for (uint32_t receiver = 0; receiver < 2; receiver++)
+    {
+        receivers.push_back(bus.registerSubscriber(10, 2000 + receiver, true));
+        bus.addSubscriptionAddress(receivers.back(), "afrl.cmasi.KeyValuePair");
+    }
+
+    // each receiver thread waits for its messages while the senders push them
+    std::vector< std::vector<uint32_t> > nextItems(receivers.size(), std::vector<uint32_t>(s_numberProducers, 0));
+    std::vector<uint32_t> numberErrors(receivers.size(), 0);
+    std::vector<std::thread> receiverThreads;
+    for (uint32_t receiver = 0; receiver < receivers.size(); receiver++)
+    {
+        receiverThreads.emplace_back([&, receiver]()
+        {
+            uint32_t numberReceived{0};
+            while (numberReceived < s_numberProducers * s_numberItemsPerProducer)
+            {
+                auto message = receivers[receiver]->getNextMessage(1000);
+                if (!message)
+                {
+                    numberErrors[receiver]++;
+                    return;
+                }
+                auto keyValuePair = std::static_pointer_cast<afrl::cmasi::KeyValuePair>(message->m_object);
+                uint32_t producer = std::stoul(keyValuePair->getKey());
+                uint32_t item = std::stoul(keyValuePair->getValue());
+                if ((producer >= s_numberProducers) || (nextItems[receiver][producer] != item))
+                {
+                    numberErrors[receiver]++;
+                }
+                nextItems[receiver][producer] = item + 1;
+                numberReceived++;
+            }
+        });
+    }
+
+    std::vector<std::thread> senders;
+    for (uint32_t producer = 0; producer < s_numberProducers; producer++)
+    {
+        senders.emplace_back([&bus, producer]()
+        {
+            auto route = bus.getRoute("afrl.cmasi.KeyValuePair");
+            for (uint32_t item = 0; item < s_numberItemsPerProducer; item++)
+            {
+                for (auto& receiver : route.m_objectReceivers)
+                {
+                    auto keyValuePair = uxas::stduxas::make_unique<afrl::cmasi::KeyValuePair>();
+                    keyValuePair->setKey(std::to_string(producer));
+                    keyValuePair->setValue(std::to_string(item));
+                    receiver->pushMessage(uxas::stduxas::make_unique<LmcpMessage>(
+                        uxas::stduxas::make_unique<uxas::communications::data::MessageAttributes>(), std::move(keyValuePair)));
+                }
+            }
+        });
+    }
+    for (auto& sender : senders)
+    {
+        sender.join();
+    }
+    for (auto& receiverThread : receiverThreads)
+    {
+        receiverThread.join();
+    }
+
+    for (uint32_t receiver = 0; receiver < receivers.size(); receiver++)
+    {
+        EXPECT_EQ(0u, numberErrors[receiver]) << "receiver " << receiver;
+        EXPECT_EQ(std::vector<uint32_t>(s_numberProducers, s_numberItemsPerProducer), nextItems[receiver]) << "receiver " << receiver;
+        // nothing is delivered twice
+        EXPECT_FALSE(receivers[receiver]->getNextMessage(0));
+        bus.unregisterSubscriber(receivers[receiver]);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,245 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   LogManagerAsyncTest.cpp
+ *
+ * Asynchronous logging: drain order of the records of several threads, the
+ * drop policy and its counters, and stopping while producers are blocked.
+ */
+#include "gtest/gtest.h"
+
+#include "UxAS_Log.h"
+#include "UxAS_LogManager.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using uxas::common::log::HeadLogData;
+using uxas::common::log::LogManager;
+using uxas::common::log::LogOverflowPolicy;
+using uxas::common::log::LoggerBase;
+using uxas::common::log::LogSeverityLevel;
+
+/** \class TestLogger
+ * \brief Keeps the output messages; output can be held (gate closed) to fill
+ * the ring buffers.
+ */
+class TestLogger : public LoggerBase
+{
+public:
+
+    static const std::string&
+    s_typeName() { static std::string s_string("TestLogger"); return (s_string); };
+
+    static LoggerBase*
+    create() { return new TestLogger; };
+
+    TestLogger() : LoggerBase(s_typeName()) { };
+
+    bool
+    outputToStream(HeadLogData& headerAndData) override
+    {
+        std::unique_lock<std::mutex> lock(s_mutex);
+        s_gateCondition.wait(lock, []() { return (s_isGateOpen); });
+        s_messages.push_back(headerAndData.m_message.str());
+        return (true);
+    };
+
+    static void
+    setGateOpen(bool isGateOpen)
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_isGateOpen = isGateOpen;
+        s_gateCondition.notify_all();
+    };
+
+    /** \brief returns and clears the output messages*/
+    static std::vector<std::string>
+    takeMessages()
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        std::vector<std::string> messages;
+        messages.swap(s_messages);
+        return (messages);
+    };
+
+    static std::mutex s_mutex;
+    static std::condition_variable s_gateCondition;
+    static bool s_isGateOpen;
+    static std::vector<std::string> s_messages;
+
+private:
+
+    static LoggerBase::CreationRegistrar<TestLogger> s_registrar;
+};
+
+std::mutex TestLogger::s_mutex;
+std::condition_variable TestLogger::s_gateCondition;
+bool TestLogger::s_isGateOpen{true};
+std::vector<std::string> TestLogger::s_messages;
+LoggerBase::CreationRegistrar<TestLogger> TestLogger::s_registrar(TestLogger::s_typeName());
+
+static const uint32_t s_numberThreads = 4;
+
+/** \brief each thread logs "thread <thread> item <item>" for "itemCount" items*/
+static void
+logFromThreads(uint32_t itemCount)
+{
+    std::vector<std::thread> threads;
+    for (uint32_t thread = 0; thread < s_numberThreads; thread++)
+    {
+        threads.emplace_back([thread, itemCount]()
+        {
+            for (uint32_t item = 0; item < itemCount; item++)
+            {
+                UXAS_LOG_WARN("thread ", thread, " item ", item);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+/** \brief checks the items of each thread are increasing, returns the number of "thread" messages*/
+static uint32_t
+countThreadMessages(const std::vector<std::string>& messages)
+{
+    std::vector<int64_t> lastItems(s_numberThreads, -1);
+    uint32_t messageCount{0};
+    for (const auto& message : messages)
+    {
+        std::istringstream messageStream(message);
+        std::string threadText, itemText;
+        uint32_t thread;
+        int64_t item;
+        if (!(messageStream >> threadText >> thread >> itemText >> item) || threadText != "thread")
+        {
+            continue;
+        }
+        EXPECT_LT(thread, s_numberThreads);
+        EXPECT_GT(item, lastItems[thread]) << "thread " << thread;
+        lastItems[thread] = item;
+        messageCount++;
+    }
+    return (messageCount);
+}
+
+static void
+addTestLogger()
+{
+    static bool s_isAdded{false};
+    if (!s_isAdded)
+    {
+        std::string logFilePath;
+        ASSERT_TRUE(LogManager::getInstance().addLogger("test", TestLogger::s_typeName(), LogSeverityLevel::UXASWARNING, "", logFilePath));
+        s_isAdded = true;
+    }
+    TestLogger::takeMessages();
+}
+
+TEST(LogManagerAsyncTest, Drain_order)
+{
+    addTestLogger();
+    auto& logManager = LogManager::getInstance();
+    ASSERT_TRUE(logManager.startAsyncLogging(LogOverflowPolicy::BLOCK, 64));
+    logFromThreads(5000);
+
+    // a log statement that follows another one (on a different thread) is output after it
+    for (uint32_t exchange = 0; exchange < 100; exchange++)
+    {
+        UXAS_LOG_WARN("first ", exchange);
+        std::thread([exchange]() { UXAS_LOG_WARN("second ", exchange); }).join();
+    }
+    logManager.stopAsyncLogging();
+
+    std::vector<std::string> messages = TestLogger::takeMessages();
+    EXPECT_EQ(s_numberThreads * 5000, countThreadMessages(messages));
+    std::vector<std::string> exchangeMessages;
+    for (const auto& message : messages)
+    {
+        if (message.compare(0, 6, "first ") == 0 || message.compare(0, 7, "second ") == 0)
+        {
+            exchangeMessages.push_back(message);
+        }
+    }
+    ASSERT_EQ(200u, exchangeMessages.size());
+    for (uint32_t exchange = 0; exchange < 100; exchange++)
+    {
+        EXPECT_EQ("first " + std::to_string(exchange), exchangeMessages[2 * exchange]);
+        EXPECT_EQ("second " + std::to_string(exchange), exchangeMessages[2 * exchange + 1]);
+    }
+    EXPECT_EQ(0u, logManager.getDroppedRecordCount());
+}
+
+TEST(LogManagerAsyncTest, Drop_policy_counts_dropped_records)
+{
+    addTestLogger();
+    auto& logManager = LogManager::getInstance();
+    uint64_t initialDroppedRecordCount = logManager.getDroppedRecordCount();
+    ASSERT_TRUE(logManager.startAsyncLogging(LogOverflowPolicy::DROP, 16));
+
+    // the held logger stops the drain thread, the ring buffers fill up
+    TestLogger::setGateOpen(false);
+    logFromThreads(1000);
+    TestLogger::setGateOpen(true);
+    logManager.stopAsyncLogging();
+
+    std::vector<std::string> messages = TestLogger::takeMessages();
+    uint64_t droppedRecordCount = logManager.getDroppedRecordCount() - initialDroppedRecordCount;
+    uint32_t messageCount = countThreadMessages(messages);
+    EXPECT_EQ(s_numberThreads * 1000, messageCount + droppedRecordCount);
+    // at most one drain pass (held by the logger) and the ring buffer capacity per thread
+    EXPECT_LE(messageCount, s_numberThreads * (256 + 16));
+    EXPECT_GT(droppedRecordCount, 0u);
+
+    // the drops are reported in the log
+    bool isDropReported{false};
+    for (const auto& message : messages)
+    {
+        isDropReported |= (message.find("dropped") != std::string::npos && message.find("log records") != std::string::npos);
+    }
+    EXPECT_TRUE(isDropReported);
+}
+
+TEST(LogManagerAsyncTest, Block_policy_stops_with_blocked_producers)
+{
+    addTestLogger();
+    auto& logManager = LogManager::getInstance();
+    ASSERT_TRUE(logManager.startAsyncLogging(LogOverflowPolicy::BLOCK, 16));
+
+    // producers block on their full ring buffers while the logger is held
+    TestLogger::setGateOpen(false);
+    auto logging = std::async(std::launch::async, []() { logFromThreads(1000); });
+    EXPECT_EQ(std::future_status::timeout, logging.wait_for(std::chrono::milliseconds(100)));
+    auto stopping = std::async(std::launch::async, [&logManager]() { logManager.stopAsyncLogging(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    TestLogger::setGateOpen(true);
+
+    ASSERT_EQ(std::future_status::ready, stopping.wait_for(std::chrono::seconds(30)));
+    ASSERT_EQ(std::future_status::ready, logging.wait_for(std::chrono::seconds(30)));
+    EXPECT_FALSE(logManager.getIsAsyncLogging());
+    // nothing is lost, records of stopped producers are output synchronously
+    EXPECT_EQ(s_numberThreads * 1000, countThreadMessages(TestLogger::takeMessages()));
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
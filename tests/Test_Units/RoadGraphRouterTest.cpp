@@ -0,0 +1,172 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   RoadGraphRouterTest.cpp
+ *
+ * Landmark A* shortest paths of CRoadGraphRouter compared to plain Dijkstra
+ * on random road-like graphs with several connected components.
+ */
+#include "gtest/gtest.h"
+
+#include "RoadGraphRouter.h"
+
+#include <functional>
+#include <limits>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using n_FrameworkLib::CEdge;
+using n_FrameworkLib::CRoadGraphRouter;
+
+static const int32_t s_unreached = (std::numeric_limits<int32_t>::max)();
+
+/** \brief plain Dijkstra costs from "source" to all vertices*/
+static std::vector<int32_t>
+calculateDijkstraCosts(const CEdge::V_EDGE_t& edges, uint32_t numberVertices, uint32_t source)
+{
+    std::vector<std::vector<std::pair<uint32_t, int32_t> > > adjacency(numberVertices);
+    for (auto& edge : edges)
+    {
+        adjacency[edge.first].push_back(std::make_pair(static_cast<uint32_t>(edge.second), edge.iGetLength()));
+        adjacency[edge.second].push_back(std::make_pair(static_cast<uint32_t>(edge.first), edge.iGetLength()));
+    }
+    std::vector<int32_t> costs(numberVertices, s_unreached);
+    std::set<std::pair<int32_t, uint32_t> > open;
+    costs[source] = 0;
+    open.insert(std::make_pair(0, source));
+    while (!open.empty())
+    {
+        uint32_t vertex = open.begin()->second;
+        open.erase(open.begin());
+        for (auto& neighbor : adjacency[vertex])
+        {
+            int32_t cost = costs[vertex] + neighbor.second;
+            if (cost < costs[neighbor.first])
+            {
+                open.erase(std::make_pair(costs[neighbor.first], neighbor.first));
+                costs[neighbor.first] = cost;
+                open.insert(std::make_pair(cost, neighbor.first));
+            }
+        }
+    }
+    return (costs);
+}
+
+/** \brief "gridSize" x "gridSize" grid with random lengths and some random shortcuts, returns the number of vertices*/
+static uint32_t
+createGridGraph(uint32_t gridSize, uint32_t firstVertex, std::mt19937& random, CEdge::V_EDGE_t& edges)
+{
+    std::uniform_int_distribution<int32_t> lengthDistribution(10, 1000);
+    std::uniform_int_distribution<uint32_t> vertexDistribution(0, gridSize * gridSize - 1);
+    for (uint32_t row = 0; row < gridSize; row++)
+    {
+        for (uint32_t column = 0; column < gridSize; column++)
+        {
+            uint32_t vertex = firstVertex + row * gridSize + column;
+            if (column + 1 < gridSize)
+            {
+                edges.push_back(CEdge(vertex, vertex + 1, lengthDistribution(random)));
+            }
+            if (row + 1 < gridSize)
+            {
+                edges.push_back(CEdge(vertex, vertex + gridSize, lengthDistribution(random)));
+            }
+        }
+    }
+    for (uint32_t shortcut = 0; shortcut < gridSize; shortcut++)
+    {
+        uint32_t vertex1 = firstVertex + vertexDistribution(random);
+        uint32_t vertex2 = firstVertex + vertexDistribution(random);
+        if (vertex1 != vertex2)
+        {
+            edges.push_back(CEdge(vertex1, vertex2, 20 * lengthDistribution(random)));
+        }
+    }
+    return (gridSize * gridSize);
+}
+
+TEST(RoadGraphRouterTest, Shortest_paths_match_Dijkstra)
+{
+    std::mt19937 random(20170101);
+    CEdge::V_EDGE_t edges;
+    // two road networks and an isolated vertex
+    uint32_t numberVertices = createGridGraph(20, 0, random, edges);
+    numberVertices += createGridGraph(6, numberVertices, random, edges);
+    uint32_t isolatedVertex = numberVertices++;
+
+    CRoadGraphRouter router;
+    router.Build(edges, numberVertices, 8);
+    ASSERT_EQ(numberVertices, router.uiGetNumberVertices());
+    EXPECT_GT(router.uiGetNumberLandmarks(), 1u);
+
+    std::set<std::pair<uint32_t, uint32_t> > edgeVertices;
+    for (auto& edge : edges)
+    {
+        edgeVertices.insert(std::make_pair(static_cast<uint32_t>(edge.first), static_cast<uint32_t>(edge.second)));
+        edgeVertices.insert(std::make_pair(static_cast<uint32_t>(edge.second), static_cast<uint32_t>(edge.first)));
+    }
+
+    std::uniform_int_distribution<uint32_t> vertexDistribution(0, numberVertices - 1);
+    uint32_t reachedCount{0};
+    for (uint32_t query = 0; query < 40; query++)
+    {
+        uint32_t start = (query == 0) ? isolatedVertex : vertexDistribution(random);
+        std::vector<int32_t> costs = calculateDijkstraCosts(edges, numberVertices, start);
+        for (uint32_t goalQuery = 0; goalQuery < 25; goalQuery++)
+        {
+            uint32_t goal = vertexDistribution(random);
+            int32_t pathCost{-1};
+            std::vector<uint32_t> path;
+            bool isFound = router.bFindShortestPath(start, goal, pathCost, path);
+            ASSERT_EQ(costs[goal] != s_unreached, isFound) << start << " -> " << goal;
+            if (!isFound)
+            {
+                EXPECT_TRUE(path.empty());
+                continue;
+            }
+            reachedCount++;
+            EXPECT_EQ(costs[goal], pathCost) << start << " -> " << goal;
+            ASSERT_FALSE(path.empty());
+            EXPECT_EQ(start, path.front());
+            EXPECT_EQ(goal, path.back());
+            for (size_t pathIndex = 1; pathIndex < path.size(); pathIndex++)
+            {
+                EXPECT_TRUE(edgeVertices.count(std::make_pair(path[pathIndex - 1], path[pathIndex])) > 0);
+            }
+        }
+    }
+    EXPECT_GT(reachedCount, 500u);
+}
+
+TEST(RoadGraphRouterTest, Start_equals_goal_and_invalid_vertices)
+{
+    CEdge::V_EDGE_t edges;
+    edges.push_back(CEdge(0, 1, 5));
+    edges.push_back(CEdge(1, 2, 7));
+    CRoadGraphRouter router;
+    router.Build(edges, 3);
+
+    int32_t pathCost{-1};
+    std::vector<uint32_t> path;
+    EXPECT_TRUE(router.bFindShortestPath(1, 1, pathCost, path));
+    EXPECT_EQ(0, pathCost);
+    EXPECT_EQ(std::vector<uint32_t>{1}, path);
+    EXPECT_TRUE(router.bFindShortestPath(2, 0, pathCost, path));
+    EXPECT_EQ(12, pathCost);
+    EXPECT_FALSE(router.bFindShortestPath(0, 3, pathCost, path));
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,128 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   RoutePlanCacheTest.cpp
+ *
+ * Route plan cache hits and misses: key components, tolerance cells,
+ * least-recently-used replacement, invalidation and status throttling.
+ */
+#include "gtest/gtest.h"
+
+#include "RoutePlanCache.h"
+
+using uxas::common::utilities::RoutePlanCache;
+
+TEST(RoutePlanCacheTest, Hit_and_miss)
+{
+    RoutePlanCache<int> cache(100, 1.0);
+    int value{0};
+    EXPECT_FALSE(cache.find(1, "speed=20", 0.0, 0.0, 100.0, 200.0, value));
+    cache.insert(1, "speed=20", 0.0, 0.0, 100.0, 200.0, 7);
+
+    EXPECT_TRUE(cache.find(1, "speed=20", 0.0, 0.0, 100.0, 200.0, value));
+    EXPECT_EQ(7, value);
+    // same tolerance cells
+    EXPECT_TRUE(cache.find(1, "speed=20", 0.2, -0.3, 100.4, 199.6, value));
+    EXPECT_EQ(7, value);
+
+    // each key component selects a different entry
+    EXPECT_FALSE(cache.find(2, "speed=20", 0.0, 0.0, 100.0, 200.0, value));
+    EXPECT_FALSE(cache.find(1, "speed=30", 0.0, 0.0, 100.0, 200.0, value));
+    EXPECT_FALSE(cache.find(1, "speed=20", 2.0, 0.0, 100.0, 200.0, value));
+    EXPECT_FALSE(cache.find(1, "speed=20", 0.0, 0.0, 200.0, 100.0, value));
+
+    EXPECT_EQ(2u, cache.getHitCount());
+    EXPECT_EQ(5u, cache.getMissCount());
+
+    // insert of an existing key replaces the value
+    cache.insert(1, "speed=20", 0.0, 0.0, 100.0, 200.0, 8);
+    EXPECT_TRUE(cache.find(1, "speed=20", 0.0, 0.0, 100.0, 200.0, value));
+    EXPECT_EQ(8, value);
+}
+
+TEST(RoutePlanCacheTest, Least_recently_used_replacement)
+{
+    RoutePlanCache<int> cache(3, 1.0);
+    cache.insert(1, "", 0.0, 0.0, 1.0, 0.0, 1);
+    cache.insert(1, "", 0.0, 0.0, 2.0, 0.0, 2);
+    cache.insert(1, "", 0.0, 0.0, 3.0, 0.0, 3);
+    int value{0};
+    // entry 1 becomes the most recently used, entry 2 is replaced
+    EXPECT_TRUE(cache.find(1, "", 0.0, 0.0, 1.0, 0.0, value));
+    cache.insert(1, "", 0.0, 0.0, 4.0, 0.0, 4);
+
+    EXPECT_TRUE(cache.find(1, "", 0.0, 0.0, 1.0, 0.0, value));
+    EXPECT_EQ(1, value);
+    EXPECT_FALSE(cache.find(1, "", 0.0, 0.0, 2.0, 0.0, value));
+    EXPECT_TRUE(cache.find(1, "", 0.0, 0.0, 3.0, 0.0, value));
+    EXPECT_TRUE(cache.find(1, "", 0.0, 0.0, 4.0, 0.0, value));
+
+    cache.setCapacity(1);
+    EXPECT_TRUE(cache.find(1, "", 0.0, 0.0, 4.0, 0.0, value));
+    EXPECT_FALSE(cache.find(1, "", 0.0, 0.0, 3.0, 0.0, value));
+}
+
+TEST(RoutePlanCacheTest, Invalidation_and_disabled_cache)
+{
+    RoutePlanCache<int> cache(100, 1.0);
+    cache.insert(1, "", 0.0, 0.0, 10.0, 0.0, 1);
+    cache.insert(2, "", 0.0, 0.0, 10.0, 0.0, 2);
+    int value{0};
+
+    cache.invalidate(1);
+    EXPECT_FALSE(cache.find(1, "", 0.0, 0.0, 10.0, 0.0, value));
+    EXPECT_TRUE(cache.find(2, "", 0.0, 0.0, 10.0, 0.0, value));
+    EXPECT_EQ(2, value);
+
+    // a new tolerance changes the cells, entries are removed
+    cache.setTolerance(5.0);
+    EXPECT_FALSE(cache.find(2, "", 0.0, 0.0, 10.0, 0.0, value));
+    cache.insert(2, "", 0.0, 0.0, 10.0, 0.0, 3);
+    cache.invalidate();
+    EXPECT_FALSE(cache.find(2, "", 0.0, 0.0, 10.0, 0.0, value));
+
+    cache.setCapacity(0);
+    EXPECT_FALSE(cache.isEnabled());
+    cache.insert(2, "", 0.0, 0.0, 10.0, 0.0, 4);
+    uint64_t missCount = cache.getMissCount();
+    EXPECT_FALSE(cache.find(2, "", 0.0, 0.0, 10.0, 0.0, value));
+    // lookups of a disabled cache are not counted
+    EXPECT_EQ(missCount, cache.getMissCount());
+}
+
+TEST(RoutePlanCacheTest, Status_after_lookups)
+{
+    RoutePlanCache<int> cache(100, 1.0);
+    // no lookups, nothing to report
+    EXPECT_FALSE(cache.isStatusDue(0));
+    int value{0};
+    cache.insert(1, "", 0.0, 0.0, 10.0, 0.0, 1);
+    EXPECT_TRUE(cache.find(1, "", 0.0, 0.0, 10.0, 0.0, value));
+    EXPECT_TRUE(cache.isStatusDue(0));
+    EXPECT_FALSE(cache.isStatusDue(0));
+
+    // throttled by the status period, the final (zero period) status reports the remaining lookups
+    EXPECT_FALSE(cache.find(1, "", 0.0, 0.0, 20.0, 0.0, value));
+    EXPECT_FALSE(cache.isStatusDue(60000));
+    EXPECT_TRUE(cache.isStatusDue(0));
+
+    auto serviceStatus = cache.getServiceStatus();
+    ASSERT_EQ(3u, serviceStatus->getInfo().size());
+    EXPECT_EQ("RouteCacheHits", serviceStatus->getInfo()[0]->getKey());
+    EXPECT_EQ("1", serviceStatus->getInfo()[0]->getValue());
+    EXPECT_EQ("1", serviceStatus->getInfo()[1]->getValue());
+    EXPECT_EQ("1", serviceStatus->getInfo()[2]->getValue());
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,142 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   SentinelSerialBufferTest.cpp
+ *
+ * Sentinelized payload extraction with sentinels split across chunks,
+ * back-to-back frames in one chunk and frames with bad checksums.
+ */
+#include "gtest/gtest.h"
+
+#include "UxAS_SentinelSerialBuffer.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using uxas::common::SentinelSerialBuffer;
+
+static void
+appendString(SentinelSerialBuffer& serialBuffer, const std::string& data)
+{
+    serialBuffer.appendData(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+}
+
+/** \brief all payloads that are complete in the buffer*/
+static std::vector<std::string>
+getPayloads(SentinelSerialBuffer& serialBuffer)
+{
+    std::vector<std::string> payloads;
+    std::string payload;
+    while (serialBuffer.getNextPayload(payload))
+    {
+        payloads.push_back(payload);
+    }
+    return (payloads);
+}
+
+/** \brief payloads "payload-<index>" of different sizes*/
+static std::vector<std::string>
+createPayloads(uint32_t payloadCount)
+{
+    std::vector<std::string> payloads;
+    for (uint32_t payloadIndex = 0; payloadIndex < payloadCount; payloadIndex++)
+    {
+        payloads.push_back("payload-" + std::to_string(payloadIndex) + std::string(payloadIndex * 7, 'x'));
+    }
+    return (payloads);
+}
+
+TEST(SentinelSerialBufferTest, Sentinels_split_across_chunks)
+{
+    std::vector<std::string> payloads = createPayloads(10);
+    std::string data;
+    for (const auto& payload : payloads)
+    {
+        data += SentinelSerialBuffer::createSentinelizedString(payload);
+    }
+
+    // chunk sizes split every sentinel and the payload size and checksum digits at different offsets
+    for (size_t chunkSize : {1, 2, 3, 5, 7, 13})
+    {
+        SentinelSerialBuffer serialBuffer;
+        std::vector<std::string> receivedPayloads;
+        for (size_t offset = 0; offset < data.size(); offset += chunkSize)
+        {
+            appendString(serialBuffer, data.substr(offset, chunkSize));
+            std::vector<std::string> chunkPayloads = getPayloads(serialBuffer);
+            receivedPayloads.insert(receivedPayloads.end(), chunkPayloads.begin(), chunkPayloads.end());
+        }
+        EXPECT_EQ(payloads, receivedPayloads) << "chunk size " << chunkSize;
+        EXPECT_EQ(payloads.size(), serialBuffer.m_validDeserializeCount);
+        EXPECT_EQ(0u, serialBuffer.m_invalidDeserializeCount);
+    }
+}
+
+TEST(SentinelSerialBufferTest, Back_to_back_frames_in_one_chunk)
+{
+    std::vector<std::string> payloads = createPayloads(100);
+    std::string data;
+    for (const auto& payload : payloads)
+    {
+        data += SentinelSerialBuffer::createSentinelizedString(payload);
+    }
+
+    SentinelSerialBuffer serialBuffer;
+    uint8_t* writeBuffer = serialBuffer.getWriteBuffer(data.size());
+    std::memcpy(writeBuffer, data.data(), data.size());
+    serialBuffer.commitData(data.size());
+    EXPECT_EQ(payloads, getPayloads(serialBuffer));
+
+    // getNextPayloadString returns one payload per call
+    appendString(serialBuffer, data);
+    EXPECT_EQ(payloads[0], serialBuffer.getNextPayloadString(""));
+    EXPECT_EQ(payloads[1], serialBuffer.getNextPayloadString(""));
+    std::vector<std::string> remainingPayloads = getPayloads(serialBuffer);
+    EXPECT_EQ(std::vector<std::string>(payloads.begin() + 2, payloads.end()), remainingPayloads);
+    EXPECT_EQ(0u, serialBuffer.m_invalidDeserializeCount);
+}
+
+TEST(SentinelSerialBufferTest, Bad_checksums_are_discarded)
+{
+    std::string goodFrame = SentinelSerialBuffer::createSentinelizedString("good-payload");
+
+    // same payload size, changed payload byte (checksum mismatch)
+    std::string corruptPayloadFrame = SentinelSerialBuffer::createSentinelizedString("bad-payload!");
+    corruptPayloadFrame[corruptPayloadFrame.find("bad") + 1] = 'e';
+
+    // checksum digits changed
+    std::string corruptChecksumFrame = SentinelSerialBuffer::createSentinelizedString("bad-payload!");
+    size_t checksumOffset = corruptChecksumFrame.find(SentinelSerialBuffer::getSerialSentinelBeforeChecksum())
+            + SentinelSerialBuffer::getSerialSentinelBeforeChecksumSize();
+    corruptChecksumFrame[checksumOffset] = (corruptChecksumFrame[checksumOffset] == '9') ? ('1') : (corruptChecksumFrame[checksumOffset] + 1);
+
+    std::string data = goodFrame + corruptPayloadFrame + goodFrame + corruptChecksumFrame + goodFrame;
+    for (size_t chunkSize : {static_cast<size_t>(3), data.size()})
+    {
+        SentinelSerialBuffer serialBuffer;
+        std::vector<std::string> receivedPayloads;
+        for (size_t offset = 0; offset < data.size(); offset += chunkSize)
+        {
+            appendString(serialBuffer, data.substr(offset, chunkSize));
+            std::vector<std::string> chunkPayloads = getPayloads(serialBuffer);
+            receivedPayloads.insert(receivedPayloads.end(), chunkPayloads.begin(), chunkPayloads.end());
+        }
+        EXPECT_EQ(std::vector<std::string>(3, "good-payload"), receivedPayloads) << "chunk size " << chunkSize;
+        EXPECT_EQ(3u, serialBuffer.m_validDeserializeCount);
+        EXPECT_EQ(2u, serialBuffer.m_invalidDeserializeCount);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -19,6 +19,9 @@
 
 #include "boost/foreach.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 #include "visilibity.h"
 #include "TestReport.h"
 
@@ -849,6 +852,213 @@ TEST(VisiLibityTest, OffsetPolygon)
     TestShape::m_report_static.addPlot(actualPlot);
 }
 
+/** \brief square with its lower left corner at (x, y), CCW (boundary) or CW (hole) */
+static VisiLibity::Polygon
+squarePolygon(double x, double y, double side, bool isHole)
+{
+    std::vector<VisiLibity::Point> points({VisiLibity::Point(x, y), VisiLibity::Point(x + side, y),
+                                           VisiLibity::Point(x + side, y + side), VisiLibity::Point(x, y + side)});
+    if (isHole)
+    {
+        std::reverse(points.begin(), points.end());
+    }
+    return (VisiLibity::Polygon(points));
+}
+
+/** \brief 100 x 100 boundary with a hole at each of the lower left corners*/
+static VisiLibity::Environment
+squareHolesEnvironment(const std::vector<VisiLibity::Point>& holeCorners)
+{
+    std::vector<VisiLibity::Polygon> polygons(1, squarePolygon(0.0, 0.0, 100.0, false));
+    for (auto& holeCorner : holeCorners)
+    {
+        polygons.push_back(squarePolygon(holeCorner.x(), holeCorner.y(), 10.0, true));
+    }
+    return (VisiLibity::Environment(polygons));
+}
+
+/** \brief the visibility graph updated from the previous environment must equal the graph built from scratch*/
+static void
+expectIncrementalVisibilityGraph(const std::vector<VisiLibity::Point>& previousHoleCorners, const std::vector<VisiLibity::Point>& holeCorners)
+{
+    const double epsilon(1e-4);
+    VisiLibity::Environment previousEnvironment = squareHolesEnvironment(previousHoleCorners);
+    VisiLibity::Environment environment = squareHolesEnvironment(holeCorners);
+    ASSERT_TRUE(previousEnvironment.is_valid(epsilon));
+    ASSERT_TRUE(environment.is_valid(epsilon));
+
+    VisiLibity::Visibility_Graph previousVisibilityGraph(previousEnvironment, epsilon);
+    VisiLibity::Visibility_Graph incrementalVisibilityGraph(previousVisibilityGraph, previousEnvironment, environment, epsilon);
+    VisiLibity::Visibility_Graph visibilityGraph(environment, epsilon);
+    ASSERT_EQ(visibilityGraph.n(), incrementalVisibilityGraph.n());
+    uint32_t visiblePairCount{0};
+    for (unsigned k1 = 0; k1 < visibilityGraph.n(); k1++)
+    {
+        for (unsigned k2 = 0; k2 < visibilityGraph.n(); k2++)
+        {
+            EXPECT_EQ(visibilityGraph(k1, k2), incrementalVisibilityGraph(k1, k2)) << "vertices " << k1 << ", " << k2;
+            visiblePairCount += visibilityGraph(k1, k2) ? 1 : 0;
+        }
+    }
+    // the holes block some (not all) lines of sight
+    EXPECT_GT(visiblePairCount, visibilityGraph.n());
+    EXPECT_LT(visiblePairCount, visibilityGraph.n() * visibilityGraph.n());
+}
+
+TEST(VisiLibityTest, Incremental_visibility_graph_hole_added)
+{
+    expectIncrementalVisibilityGraph({VisiLibity::Point(20, 20), VisiLibity::Point(60, 30)},
+                                     {VisiLibity::Point(20, 20), VisiLibity::Point(60, 30), VisiLibity::Point(40, 60)});
+}
+
+TEST(VisiLibityTest, Incremental_visibility_graph_hole_removed)
+{
+    expectIncrementalVisibilityGraph({VisiLibity::Point(20, 20), VisiLibity::Point(60, 30), VisiLibity::Point(40, 60)},
+                                     {VisiLibity::Point(20, 20), VisiLibity::Point(40, 60)});
+}
+
+TEST(VisiLibityTest, Incremental_visibility_graph_hole_moved)
+{
+    expectIncrementalVisibilityGraph({VisiLibity::Point(20, 20), VisiLibity::Point(60, 30), VisiLibity::Point(40, 60)},
+                                     {VisiLibity::Point(20, 20), VisiLibity::Point(65, 45), VisiLibity::Point(40, 60)});
+}
+
+/** \brief 100 x 100 boundary with a 4 x 4 grid of holes of different sizes and offsets*/
+static VisiLibity::Environment
+gridHolesEnvironment()
+{
+    std::vector<VisiLibity::Polygon> polygons(1, squarePolygon(0.0, 0.0, 100.0, false));
+    for (int column = 0; column < 4; column++)
+    {
+        for (int row = 0; row < 4; row++)
+        {
+            polygons.push_back(squarePolygon(10 + column * 22 + (column * row) % 3, 10 + row * 22 + (column + 2 * row) % 4, 8 + (column + row) % 3, true));
+        }
+    }
+    return (VisiLibity::Environment(polygons));
+}
+
+/** \brief shortest path length from "start" to "finish" by Dijkstra's algorithm over all visible vertex pairs*/
+static double
+referenceShortestPathLength(const VisiLibity::Environment& environment, const VisiLibity::Visibility_Graph& visibilityGraph,
+                            const VisiLibity::Point& start, const VisiLibity::Point& finish, double epsilon)
+{
+    // nodes: environment vertices, then start, then finish
+    const unsigned n = environment.n();
+    std::vector<VisiLibity::Point> points;
+    for (unsigned k = 0; k < n; k++)
+    {
+        points.push_back(environment(k));
+    }
+    points.push_back(start);
+    points.push_back(finish);
+    VisiLibity::Visibility_Polygon startVisibilityPolygon(start, environment, epsilon);
+    VisiLibity::Visibility_Polygon finishVisibilityPolygon(finish, environment, epsilon);
+    auto isVisible = [&](unsigned node1, unsigned node2)
+    {
+        if (node1 > node2)
+        {
+            std::swap(node1, node2);
+        }
+        if (node2 < n)
+        {
+            return (visibilityGraph(node1, node2));
+        }
+        if (node1 == n && node2 == n + 1)
+        {
+            return (finish.in(startVisibilityPolygon, epsilon));
+        }
+        return (node1 < n && points[node1].in(node2 == n ? startVisibilityPolygon : finishVisibilityPolygon, epsilon));
+    };
+
+    std::vector<double> distances(n + 2, INFINITY);
+    std::vector<bool> isDone(n + 2, false);
+    distances[n] = 0.0;
+    for (unsigned iteration = 0; iteration < n + 2; iteration++)
+    {
+        unsigned node = n + 2;
+        for (unsigned candidate = 0; candidate < n + 2; candidate++)
+        {
+            if (!isDone[candidate] && distances[candidate] < INFINITY && (node == n + 2 || distances[candidate] < distances[node]))
+            {
+                node = candidate;
+            }
+        }
+        if (node == n + 2)
+        {
+            break;
+        }
+        isDone[node] = true;
+        for (unsigned next = 0; next < n + 2; next++)
+        {
+            if (next != node && !isDone[next] && isVisible(node, next))
+            {
+                distances[next] = (std::min)(distances[next], distances[node] + VisiLibity::distance(points[node], points[next]));
+            }
+        }
+    }
+    return (distances[n + 1]);
+}
+
+/** \brief the shortest path must have the vertices of the path found by the previous (set based) A* search*/
+static void
+expectShortestPath(const VisiLibity::Point& start, const VisiLibity::Point& finish, const std::vector<VisiLibity::Point>& expectedPath)
+{
+    const double epsilon(1e-4);
+    VisiLibity::Environment environment = gridHolesEnvironment();
+    ASSERT_TRUE(environment.is_valid(epsilon));
+    VisiLibity::Visibility_Graph visibilityGraph(environment, epsilon);
+
+    VisiLibity::Polyline path = environment.shortest_path(start, finish, visibilityGraph, epsilon);
+    ASSERT_EQ(expectedPath.size(), path.size());
+    double expectedLength{0.0};
+    for (unsigned k = 0; k < path.size(); k++)
+    {
+        EXPECT_LE(VisiLibity::distance(expectedPath[k], path[k]), epsilon) << "vertex " << k;
+        expectedLength += (k > 0) ? VisiLibity::distance(expectedPath[k - 1], expectedPath[k]) : 0.0;
+    }
+    EXPECT_NEAR(expectedLength, path.length(), epsilon);
+}
+
+TEST(VisiLibityTest, Shortest_path_around_holes)
+{
+    using VisiLibity::Point;
+    expectShortestPath(Point(2, 2), Point(98, 98), {Point(2, 2), Point(18, 10), Point(64, 56), Point(84, 77), Point(98, 98)});
+    expectShortestPath(Point(2, 98), Point(98, 3), {Point(2, 98), Point(18, 86), Point(42, 63), Point(84, 21), Point(98, 3)});
+    expectShortestPath(Point(5, 50), Point(95, 45), {Point(5, 50), Point(95, 45)});
+}
+
+TEST(VisiLibityTest, Shortest_path_start_is_goal)
+{
+    expectShortestPath(VisiLibity::Point(30, 30), VisiLibity::Point(30, 30), {VisiLibity::Point(30, 30)});
+}
+
+TEST(VisiLibityTest, Shortest_path_unreachable_goal)
+{
+    using VisiLibity::Point;
+    // goals inside a hole and outside of the boundary are reached through the visible vertices
+    expectShortestPath(Point(2, 2), Point(14, 14), {Point(2, 2), Point(10, 10), Point(14, 14)});
+    expectShortestPath(Point(2, 2), Point(150, 50), {Point(2, 2), Point(18, 10), Point(32, 20), Point(85, 33), Point(150, 50)});
+}
+
+TEST(VisiLibityTest, Shortest_path_lengths_match_reference)
+{
+    const double epsilon(1e-4);
+    VisiLibity::Environment environment = gridHolesEnvironment();
+    VisiLibity::Visibility_Graph visibilityGraph(environment, epsilon);
+    for (int query = 0; query < 20; query++)
+    {
+        VisiLibity::Point start(3 + (query * 37) % 95, 3 + (query * 11) % 6);
+        VisiLibity::Point finish(3 + (query * 53) % 95, 92 + (query * 7) % 6);
+        VisiLibity::Polyline path = environment.shortest_path(start, finish, visibilityGraph, epsilon);
+        ASSERT_GE(path.size(), 2u);
+        EXPECT_LE(VisiLibity::distance(start, path[0]), epsilon);
+        EXPECT_LE(VisiLibity::distance(finish, path[path.size() - 1]), epsilon);
+        EXPECT_NEAR(referenceShortestPathLength(environment, visibilityGraph, start, finish, epsilon), path.length(), epsilon)
+                << "query " << query;
+    }
+}
+
 //Initialize static report
 test::report::Report TestShape::m_report_static("VisiLibity");
 
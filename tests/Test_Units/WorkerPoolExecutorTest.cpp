@@ -0,0 +1,148 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   WorkerPoolExecutorTest.cpp
+ *
+ * Worker pool strands (posting order, no concurrent tasks of a strand while
+ * workers steal) and parallelFor coverage, also from pool tasks.
+ */
+#include "gtest/gtest.h"
+
+#include "UxAS_WorkerPoolExecutor.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using uxas::common::WorkerPoolExecutor;
+
+TEST(WorkerPoolExecutorTest, Strand_tasks_execute_in_posting_order)
+{
+    auto& executor = WorkerPoolExecutor::getInstance();
+    const uint32_t numberStrands = 8;
+    const uint32_t numberTasks = 5000;
+
+    struct StrandState
+    {
+        std::shared_ptr<WorkerPoolExecutor::Strand> m_strand;
+        std::vector<uint32_t> m_executed;
+        std::atomic<uint32_t> m_running{0};
+        std::atomic<uint32_t> m_overlapCount{0};
+    };
+    std::vector< std::unique_ptr<StrandState> > strands;
+    for (uint32_t strand = 0; strand < numberStrands; strand++)
+    {
+        strands.emplace_back(new StrandState);
+        strands.back()->m_strand = executor.createStrand();
+    }
+
+    // several posting threads, each strand is posted to by one of them, while
+    // plain submitted tasks keep the workers stealing from each other
+    std::vector<std::thread> posters;
+    for (uint32_t poster = 0; poster < 2; poster++)
+    {
+        posters.emplace_back([&, poster]()
+        {
+            for (uint32_t task = 0; task < numberTasks; task++)
+            {
+                for (uint32_t strand = poster; strand < numberStrands; strand += 2)
+                {
+                    StrandState* state = strands[strand].get();
+                    state->m_strand->post([state, task]()
+                    {
+                        if (state->m_running.fetch_add(1) != 0)
+                        {
+                            state->m_overlapCount++;
+                        }
+                        state->m_executed.push_back(task);
+                        state->m_running.fetch_sub(1);
+                    });
+                }
+                if (task % 100 == 0)
+                {
+                    executor.submit([]() { std::this_thread::sleep_for(std::chrono::microseconds(50)); });
+                }
+            }
+        });
+    }
+    for (auto& poster : posters)
+    {
+        poster.join();
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    for (auto& state : strands)
+    {
+        while (!state->m_strand->isIdle() && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ASSERT_TRUE(state->m_strand->isIdle());
+        EXPECT_EQ(0u, state->m_overlapCount.load());
+        ASSERT_EQ(numberTasks, state->m_executed.size());
+        for (uint32_t task = 0; task < numberTasks; task++)
+        {
+            ASSERT_EQ(task, state->m_executed[task]);
+        }
+    }
+}
+
+TEST(WorkerPoolExecutorTest, Parallel_for_executes_each_index_once)
+{
+    auto& executor = WorkerPoolExecutor::getInstance();
+    for (uint32_t count : {0u, 1u, 3u, 1000u})
+    {
+        std::vector< std::atomic<uint32_t> > executedCounts(count);
+        for (auto& executedCount : executedCounts)
+        {
+            executedCount = 0;
+        }
+        executor.parallelFor(count, [&executedCounts](uint32_t index) { executedCounts[index]++; });
+        for (uint32_t index = 0; index < count; index++)
+        {
+            EXPECT_EQ(1u, executedCounts[index].load()) << "count " << count << " index " << index;
+        }
+    }
+}
+
+TEST(WorkerPoolExecutorTest, Parallel_for_from_pool_tasks)
+{
+    // every worker calls parallelFor, the callers execute the indices themselves
+    auto& executor = WorkerPoolExecutor::getInstance();
+    uint32_t numberCallers = executor.getWorkerCount() + 1;
+    const uint32_t count = 200;
+    std::atomic<uint32_t> executedCount{0};
+    std::mutex mutex;
+    std::condition_variable condition;
+    uint32_t finishedCallers{0};
+    for (uint32_t caller = 0; caller < numberCallers; caller++)
+    {
+        executor.submit([&]()
+        {
+            executor.parallelFor(count, [&executedCount](uint32_t) { executedCount++; });
+            std::lock_guard<std::mutex> lock(mutex);
+            finishedCallers++;
+            condition.notify_all();
+        });
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    ASSERT_TRUE(condition.wait_for(lock, std::chrono::seconds(30), [&]() { return (finishedCallers == numberCallers); }));
+    EXPECT_EQ(numberCallers * count, executedCount.load());
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,153 @@
+// ===============================================================================
+// Authors: AFRL/RQQA
+// Organization: Air Force Research Laboratory, Aerospace Systems Directorate, Power and Control Division
+//
+// Copyright (c) 2017 Government of the United State of America, as represented by
+// the Secretary of the Air Force.  No copyright is claimed in the United States under
+// Title 17, U.S. Code.  All Other Rights Reserved.
+// ===============================================================================
+
+/*
+ * File:   ZeroMqMessageHubRouterTest.cpp
+ *
+ * Message hub routing: subscription address prefixes select the receiving
+ * network clients, each receives a message once and never its own messages.
+ */
+#include "gtest/gtest.h"
+
+#include "AddressedAttributedMessage.h"
+#include "TransportBase.h"
+#include "ZeroMqFabric.h"
+#include "ZeroMqMessageHubRouter.h"
+#include "ZeroMqSocketConfiguration.h"
+
+#include "Constants/UxAS_String.h"
+
+#include <memory>
+#include <string>
+
+using uxas::communications::data::AddressedAttributedMessage;
+using uxas::communications::transport::ZeroMqFabric;
+using uxas::communications::transport::ZeroMqMessageHubRouter;
+using uxas::communications::transport::ZeroMqSocketConfiguration;
+
+/** \brief network client DEALER socket with identity "<entityId>.<serviceId>"*/
+static std::unique_ptr<zmq::socket_t>
+createClientSocket(const std::string& identity)
+{
+    ZeroMqSocketConfiguration socketConfiguration(uxas::communications::transport::NETWORK_NAME::zmqLmcpNetwork(),
+                                                  uxas::common::LmcpNetworkSocketAddress::strGetInProc_FromMessageHub(),
+                                                  ZMQ_DEALER, false, true, 1000, 1000);
+    socketConfiguration.m_identity = identity;
+    return (ZeroMqFabric::getInstance().createSocket(socketConfiguration));
+}
+
+/** \brief send a subscription control frame to the hub*/
+static void
+sendControl(zmq::socket_t& socket, char control, const std::string& address)
+{
+    std::string subscriptionControl = control + address;
+    zmq_send(socket, subscriptionControl.data(), subscriptionControl.size(), 0);
+}
+
+/** \brief push a single-part message with the given source to the hub*/
+static void
+sendMessage(zmq::socket_t& socket, const std::string& address, const std::string& sourceEntityId, const std::string& sourceServiceId)
+{
+    AddressedAttributedMessage message;
+    message.setAddressAttributesAndPayload(address, "lmcp", address, "", sourceEntityId, sourceServiceId, "payload");
+    const std::string& messageString = message.getString();
+    zmq_send(socket, messageString.data(), messageString.size(), 0);
+}
+
+/** \brief number of messages ready on the socket, each must have the given address*/
+static uint32_t
+receiveMessages(zmq::socket_t& socket, const std::string& address)
+{
+    uint32_t messageCount{0};
+    char buffer[256];
+    int size;
+    while ((size = zmq_recv(socket, buffer, sizeof(buffer), ZMQ_DONTWAIT)) >= 0)
+    {
+        EXPECT_EQ(address, std::string(buffer, static_cast<size_t>(size)).substr(0, address.size()));
+        messageCount++;
+    }
+    return (messageCount);
+}
+
+/** \brief route everything sent so far, then give the inproc deliveries time to arrive*/
+static void
+routeAll(ZeroMqMessageHubRouter& router)
+{
+    for (uint32_t cycle = 0; cycle < 5; cycle++)
+    {
+        router.routeReadyMessages(20);
+    }
+}
+
+TEST(ZeroMqMessageHubRouterTest, Routes_by_subscription_prefix_without_loopback)
+{
+    ZeroMqMessageHubRouter router;
+    ASSERT_TRUE(router.initialize());
+    ZeroMqSocketConfiguration pushSocketConfiguration(uxas::communications::transport::NETWORK_NAME::zmqLmcpNetwork(),
+                                                      uxas::common::LmcpNetworkSocketAddress::strGetInProc_ToMessageHub(),
+                                                      ZMQ_PUSH, false, false, 1000, 1000);
+    std::unique_ptr<zmq::socket_t> pushSocket = ZeroMqFabric::getInstance().createSocket(pushSocketConfiguration);
+    std::unique_ptr<zmq::socket_t> clientA = createClientSocket("10.1");
+    std::unique_ptr<zmq::socket_t> clientB = createClientSocket("10.2");
+    ASSERT_TRUE(pushSocket && clientA && clientB);
+
+    const std::string airVehicleState("afrl.cmasi.AirVehicleState");
+    const std::string keyValuePair("afrl.cmasi.KeyValuePair");
+    const std::string areaOfInterest("afrl.impact.AreaOfInterest");
+
+    // B is subscribed twice to the air vehicle state (two matching prefixes)
+    sendControl(*clientA, ZeroMqMessageHubRouter::s_subscribeControl, "afrl.cmasi");
+    sendControl(*clientB, ZeroMqMessageHubRouter::s_subscribeControl, airVehicleState);
+    sendControl(*clientB, ZeroMqMessageHubRouter::s_subscribeControl, "afrl");
+    sendControl(*clientB, ZeroMqMessageHubRouter::s_subscribeControl, "afrl.cmasi.Air");
+    sendControl(*clientB, ZeroMqMessageHubRouter::s_unsubscribeControl, "afrl.cmasi.Air");
+    routeAll(router);
+
+    sendMessage(*pushSocket, airVehicleState, "10", "1");
+    sendMessage(*pushSocket, keyValuePair, "10", "2");
+    sendMessage(*pushSocket, areaOfInterest, "10", "3");
+    routeAll(router);
+    EXPECT_EQ(1u, receiveMessages(*clientA, keyValuePair));
+    EXPECT_EQ(2u, receiveMessages(*clientB, "afrl."));
+
+    const auto& routeCounters = router.getRouteCounters();
+    ASSERT_EQ(1u, routeCounters.count(airVehicleState));
+    EXPECT_EQ(1u, routeCounters.at(airVehicleState).m_messageCount);
+    EXPECT_EQ(1u, routeCounters.at(airVehicleState).m_deliveryCount);
+    EXPECT_EQ(1u, routeCounters.at(airVehicleState).m_loopbackSuppressedCount);
+    EXPECT_EQ(1u, routeCounters.at(keyValuePair).m_deliveryCount);
+    EXPECT_EQ(1u, routeCounters.at(keyValuePair).m_loopbackSuppressedCount);
+    EXPECT_EQ(1u, routeCounters.at(areaOfInterest).m_deliveryCount);
+    EXPECT_EQ(0u, routeCounters.at(areaOfInterest).m_loopbackSuppressedCount);
+
+    // cached routes follow subscription changes
+    sendControl(*clientB, ZeroMqMessageHubRouter::s_disconnectControl, "");
+    sendControl(*clientA, ZeroMqMessageHubRouter::s_subscribeControl, "");
+    routeAll(router);
+    sendMessage(*pushSocket, airVehicleState, "10", "3");
+    sendMessage(*pushSocket, areaOfInterest, "10", "3");
+    routeAll(router);
+    EXPECT_EQ(2u, receiveMessages(*clientA, "afrl."));
+    EXPECT_EQ(0u, receiveMessages(*clientB, "afrl."));
+    EXPECT_EQ(2u, routeCounters.at(airVehicleState).m_deliveryCount);
+    EXPECT_EQ(2u, routeCounters.at(areaOfInterest).m_deliveryCount);
+
+    int lingerDuration_ms(0);
+    for (auto socket : {&pushSocket, &clientA, &clientB})
+    {
+        (*socket)->setsockopt(ZMQ_LINGER, &lingerDuration_ms, sizeof(lingerDuration_ms));
+        (*socket)->close();
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}